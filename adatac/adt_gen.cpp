@@ -88,6 +88,12 @@ namespace adt_gen
       adata::write(zbuf, value);
       break;
     }
+    case e_base_type::boolean:
+    {
+      uint64_t value = mdefine.m_default_value == "true" ? 1 : 0;
+      adata::write(zbuf, value);
+      break;
+    }
     case e_base_type::float32:
     {
       float value = 0;
@@ -113,6 +119,43 @@ namespace adt_gen
     }
   }
 
+  inline std::string quant_string(const member_define& mdefine)
+  {
+    return mdefine.m_quant_step + "," + mdefine.m_quant_min + "," + mdefine.m_quant_max;
+  }
+
+  // "warrior=0,mage=5" of an enum member or element
+  inline std::string enum_string(const enum_define& edefine)
+  {
+    std::string value;
+    for (const auto& item : edefine.m_items)
+    {
+      if (value.length())
+      {
+        value += ",";
+      }
+      value += item.m_name + "=" + std::to_string(item.m_value);
+    }
+    return value;
+  }
+
+  // an enum integer keeps 1 + the string id of its enum_string as its size, other integers 0
+  inline int32_t enum_size(const member_define& mdefine, string_pool& spool)
+  {
+    return mdefine.m_enum ? (int32_t)spool.id(enum_string(*mdefine.m_enum)) + 1 : 0;
+  }
+
+  // 0 for a member with no [align]
+  inline int32_t align_log2(int align)
+  {
+    int32_t log2 = 0;
+    while (align > (1 << log2))
+    {
+      ++log2;
+    }
+    return log2;
+  }
+
   inline int32_t find_type_namespace_idx(const descrip_define& define, const std::string& name)
   {
     for (size_t i = 0; i < define.m_types.size(); ++i)
@@ -174,12 +217,18 @@ namespace adt_gen
         {
           spool.id(m_define.m_typename);
         }
+        if (m_define.is_quant())
+        {
+          spool.id(quant_string(m_define));
+        }
+        enum_size(m_define, spool);
         for (const auto& ptype : m_define.m_template_parameters)
         {
           if (ptype.m_type == e_base_type::type)
           {
             spool.id(ptype.m_typename);
           }
+          enum_size(ptype, spool);
         }
       }
     }
@@ -222,9 +271,15 @@ namespace adt_gen
           int32_t namespace_idx = find_type_namespace_idx(define, m_define.m_typename);
           adata::write(zbuf, namespace_idx);
         }
-        adata::write(zbuf, (int32_t)m_define.m_deleted);
+        // member flags: 1 deleted, 2 sized, 4 to 16 the list encoding, 32 columnar, 64 to 4096 the [bits] width,
+        // 8192 on every member of a [packed] type, 16384 a [quant] float, 32768 a [dict] string, 65536 on every member of a [union] type,
+        // 131072 an optional member, 262144 to 2097152 the log2 of the [align] of a bytes member
+        adata::write(zbuf, (int32_t)m_define.m_deleted | (m_define.m_sized ? 2 : 0) | (int32_t)m_define.m_encoding << 2 | (m_define.m_columnar ? 32 : 0) | m_define.m_bit_width << 6
+          | (t_define.m_packed ? 8192 : 0) | (m_define.is_quant() ? 16384 : 0) | (m_define.m_dict ? 32768 : 0) | (t_define.m_union ? 65536 : 0)
+          | (m_define.m_optional ? 131072 : 0) | align_log2(m_define.m_align) << 18);
         encode_default_value(m_define, zbuf, spool);
-        int32_t size = atoi(m_define.m_size.c_str());
+        // a [quant] float has no size, it keeps the string id of its "step,min,max" there
+        int32_t size = m_define.is_quant() ? (int32_t)spool.id(quant_string(m_define)) : m_define.m_enum ? enum_size(m_define, spool) : atoi(m_define.m_size.c_str());
         adata::write(zbuf, size);
         size = (int32_t)m_define.m_template_parameters.size();
         adata::write(zbuf, size);
@@ -237,7 +292,7 @@ namespace adt_gen
             int32_t namespace_idx = find_type_namespace_idx(define, ptype.m_typename);
             adata::write(zbuf, namespace_idx);
           }          
-          size = atoi(ptype.m_size.c_str());
+          size = ptype.m_enum ? enum_size(ptype, spool) : atoi(ptype.m_size.c_str());
           adata::write(zbuf, size);
         }
       }
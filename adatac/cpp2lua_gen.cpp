@@ -66,7 +66,12 @@ namespace cpp2lua_gen
         type_name += ",";
         type_name += make_typename(desc_define, define.m_template_parameters[1].m_typename);
       }
-      if (desc_define.m_option.m_cpp_allocator.length())
+      if (define.m_type == e_base_type::array)
+      {
+        type_name += ",";
+        type_name += define.m_size;
+      }
+      else if (desc_define.m_option.m_cpp_allocator.length())
       {
         type_name += ",";
         type_name += desc_define.m_option.m_cpp_allocator;
@@ -117,6 +122,17 @@ namespace cpp2lua_gen
         os << tabs(tab_indent + 1) << "}" << std::endl;
         os << tabs(tab_indent + 1) << "lua_pop(L,1);" << std::endl;
       }
+      else if (mdefine.m_type == e_base_type::array)
+      {
+        // elements missing from the table keep their value
+        os << tabs(tab_indent + 1) << "int len = (int)seq_len(L,-1);" << std::endl;
+        os << tabs(tab_indent + 1) << "for (int i = 0 ; i < len && i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        os << tabs(tab_indent + 2) << "lua_rawgeti(L, -1, i+1);" << std::endl;
+        gen_adata_operator_load_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, var_name + "[i]");
+        os << tabs(tab_indent + 1) << "}" << std::endl;
+        os << tabs(tab_indent + 1) << "lua_pop(L,1);" << std::endl;
+      }
       else if (mdefine.m_type == e_base_type::map)
       {
         os << tabs(tab_indent + 1) << "lua_pushnil(L);" << std::endl;
@@ -185,6 +201,15 @@ namespace cpp2lua_gen
         os << tabs(tab_indent + 2) << "lua_rawseti(L, -2, i+1);" << std::endl;
         os << tabs(tab_indent + 1) << "}" << std::endl;
       }
+      else if (mdefine.m_type == e_base_type::array)
+      {
+        os << tabs(tab_indent + 1) << "lua_createtable(L, " << mdefine.m_size << ", 0);" << std::endl;
+        os << tabs(tab_indent + 1) << "for (int i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        gen_adata_operator_push_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, var_name + "[i]");
+        os << tabs(tab_indent + 2) << "lua_rawseti(L, -2, i+1);" << std::endl;
+        os << tabs(tab_indent + 1) << "}" << std::endl;
+      }
       else if (mdefine.m_type == e_base_type::map)
       {
         os << tabs(tab_indent + 1) << "lua_createtable(L, 0, (int)" << var_name << ".size());" << std::endl;
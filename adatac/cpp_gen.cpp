@@ -11,9 +11,12 @@
 #include "descrip.h"
 #include "util.h"
 #include <assert.h>
+#include <algorithm>
 #include <vector>
 #include <fstream>
 #include <ctime>
+#include <cstdlib>
+#include <cstdio>
 
 using namespace std;
 
@@ -47,11 +50,46 @@ namespace cpp_gen
     }
   }
 
+  inline std::string make_enum_typename(const descrip_define& desc_define, const std::string& name)
+  {
+    if (name.find('.') != std::string::npos)
+    {
+      return "::" + replace_all_copy(name, ".", "::");
+    }
+    return desc_define.m_namespace.m_cpp_fullname + name;
+  }
+
+  // a list or map element, an enum one is its enum class
+  inline std::string make_element_typename(const descrip_define& desc_define, const member_define& param)
+  {
+    return param.m_enum ? make_enum_typename(desc_define, param.m_enum_name) : make_typename(desc_define, param.m_typename);
+  }
+
   std::string make_type_desc(const descrip_define& desc_define, const member_define& define)
   {
     std::string type_name;
 
-    if (define.is_container())
+    if (define.m_enum)
+    {
+      type_name = make_enum_typename(desc_define, define.m_enum_name);
+    }
+    else if (define.m_encoding == list_bitmap)
+    {
+      type_name = "::adata::id_set";
+    }
+    else if (define.m_soa)
+    {
+      type_name = make_typename(desc_define, define.m_template_parameters[0].m_typename) + "_soa";
+    }
+    else if (define.m_type == e_base_type::bits)
+    {
+      type_name = make_typename(desc_define, define.m_typename) + "< " + define.m_size + " >";
+    }
+    else if (define.m_type == e_base_type::array)
+    {
+      type_name = make_typename(desc_define, define.m_typename) + "< " + make_type_desc(desc_define, define.m_template_parameters[0]) + "," + define.m_size + " >";
+    }
+    else if (define.is_container())
     {
       type_name = make_typename(desc_define, define.m_typename);
       auto find = define.m_options.find(cpp_lang);
@@ -60,11 +98,11 @@ namespace cpp_gen
         type_name = find->second;
       }
       type_name += "< ";
-      type_name += make_typename(desc_define, define.m_template_parameters[0].m_typename);
+      type_name += make_element_typename(desc_define, define.m_template_parameters[0]);
       if (define.m_type == e_base_type::map)
       {
         type_name += ",";
-        type_name += make_typename(desc_define, define.m_template_parameters[1].m_typename);
+        type_name += make_element_typename(desc_define, define.m_template_parameters[1]);
       }
       if (desc_define.m_option.m_cpp_allocator.length())
       {
@@ -73,6 +111,10 @@ namespace cpp_gen
       }
       type_name += " >";
     }
+    else if (define.m_bytes)
+    {
+      type_name = "::adata::bytes";
+    }
     else if (define.m_type == e_base_type::string)
     {
       type_name = make_typename(desc_define, define.m_typename);
@@ -90,8 +132,13 @@ namespace cpp_gen
     return type_name;
   }
 
-  std::string make_type_default(const descrip_define&, const member_define& define)
+  std::string make_type_default(const descrip_define& desc_define, const member_define& define)
   {
+    if (define.m_enum)
+    {
+      const enum_define::item_type * item = define.m_enum->find_value(std::strtoll(define.m_default_value.c_str(), nullptr, 10));
+      return make_enum_typename(desc_define, define.m_enum_name) + "::" + item->m_name;
+    }
     switch (define.m_type)
     {
     case e_base_type::uint8:
@@ -119,6 +166,7 @@ namespace cpp_gen
       return value;
     }
     case e_base_type::float64:
+    case e_base_type::boolean:
     {
       std::string value = define.m_default_value;
       return value;
@@ -138,20 +186,37 @@ namespace cpp_gen
     return "";
   }
 
+  // a [view] bytes views the read buffer of a zero_copy_buffer, other streams copy it
+  inline std::string gen_read_bytes_code(const member_define& mdefine, const std::string& stream_name, const std::string& var_name)
+  {
+    std::string code = "read_bytes(" + stream_name + "," + var_name + "," + std::to_string(mdefine.m_align) + "," + (mdefine.m_view ? "true" : "false");
+    if (mdefine.m_size.length())
+    {
+      code += "," + mdefine.m_size;
+    }
+    return code + ");";
+  }
+
+  // the value of an optional<T> member, where it is known to be set
+  inline std::string member_value(const member_define& mdefine, const std::string& var_name)
+  {
+    return mdefine.m_optional ? "(*" + var_name + ")" : var_name;
+  }
+
   void gen_code_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
   {
     os << tabs(1) << "struct " << tdefine.m_name << std::endl << "  {" << std::endl;
 
     std::vector<member_define*> mb_list;
 
-    //sort member by type to arrange layout
+    //sort member by type to arrange layout, a packed type keeps the order of its bytes
     for (auto& member : tdefine.m_members)
     {
       member_define * mb = (member_define *)&member;
       auto it = mb_list.begin();
       for (; it != mb_list.end(); ++it)
       {
-        if (member_cmp(mb, *it) < 0)
+        if (!tdefine.m_packed && member_cmp(mb, *it) < 0)
         {
           break;
         }
@@ -168,6 +233,10 @@ namespace cpp_gen
         continue;
       }
       std::string type_name = make_type_desc(desc_define, member);
+      if (member.m_optional)
+      {
+        type_name = "::adata::optional< " + type_name + " >";
+      }
       os << tabs(2) << type_name << " " << member.m_name << ";" << std::endl;
     }
 
@@ -181,7 +250,7 @@ namespace cpp_gen
       {
         continue;
       }
-      if (member.is_initable())
+      if ((member.is_initable() || member.m_type == e_base_type::array) && !member.m_optional)
       {
         ++init_count;
       }
@@ -196,7 +265,8 @@ namespace cpp_gen
       {
         continue;
       }
-      if (member->is_initable())
+      // an array of numbers is zeroed, as a list of them starts empty, an optional member starts unset
+      if ((member->is_initable() || member->m_type == e_base_type::array) && !member->m_optional)
       {
         ++pos;
         os << tabs(2) << member->m_name;
@@ -214,9 +284,341 @@ namespace cpp_gen
     os << tabs(1) << "};" << std::endl << std::endl;
   }
 
+  // a union holds one of its members or none, it is built in place when set and destroyed when reset,
+  // kind_type numbers the members from 1 in the order they are declared, deleted ones keep their number
+  void gen_code_union_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    const std::string& name = tdefine.m_name;
+    os << tabs(1) << "struct " << name << std::endl << "  {" << std::endl;
+    os << tabs(2) << "enum kind_type" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "none_kind = 0," << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        os << tabs(3) << "//" << member.m_name << "_kind = " << i + 1 << " deleted" << std::endl;
+        continue;
+      }
+      os << tabs(3) << member.m_name << "_kind = " << i + 1 << "," << std::endl;
+    }
+    os << tabs(2) << "};" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "typedef " << make_type_desc(desc_define, member) << " " << member.m_name << "_type;" << std::endl;
+      }
+    }
+    os << std::endl;
+
+    os << tabs(2) << name << "() : m_kind(none_kind) {}" << std::endl;
+    os << tabs(2) << name << "(const " << name << "& other) : m_kind(none_kind) { assign(other); }" << std::endl;
+    os << tabs(2) << name << "(" << name << "&& other) : m_kind(none_kind) { assign(::std::move(other)); }" << std::endl;
+    os << tabs(2) << "~" << name << "() { reset(); }" << std::endl;
+    os << tabs(2) << name << "& operator=(const " << name << "& other)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "if(this != &other) { reset(); assign(other); }" << std::endl;
+    os << tabs(3) << "return *this;" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(2) << name << "& operator=(" << name << "&& other)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "if(this != &other) { reset(); assign(::std::move(other)); }" << std::endl;
+    os << tabs(3) << "return *this;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "kind_type kind() const { return m_kind; }" << std::endl;
+    os << tabs(2) << "bool empty() const { return m_kind == none_kind; }" << std::endl;
+    os << tabs(2) << "void reset()" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "switch(m_kind)" << std::endl;
+    os << tabs(3) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(3) << "case " << member.m_name << "_kind: m_" << member.m_name << ".~" << member.m_name << "_type(); break;" << std::endl;
+      }
+    }
+    os << tabs(3) << "default: break;" << std::endl;
+    os << tabs(3) << "}" << std::endl;
+    os << tabs(3) << "m_kind = none_kind;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    for (const auto& member : tdefine.m_members)
+    {
+      if (member.m_deleted)
+      {
+        os << tabs(2) << "//" << member.m_name << " deleted , skip define." << std::endl << std::endl;
+        continue;
+      }
+      const std::string& alt = member.m_name;
+      std::string type_name = alt + "_type";
+      os << tabs(2) << type_name << " * get_" << alt << "() { return m_kind == " << alt << "_kind ? &m_" << alt << " : nullptr; }" << std::endl;
+      os << tabs(2) << "const " << type_name << " * get_" << alt << "() const { return m_kind == " << alt << "_kind ? &m_" << alt << " : nullptr; }" << std::endl;
+      os << tabs(2) << type_name << "& set_" << alt << "()" << std::endl;
+      os << tabs(2) << "{" << std::endl;
+      os << tabs(3) << "reset();" << std::endl;
+      os << tabs(3) << "new (&m_" << alt << ") " << type_name << "();" << std::endl;
+      os << tabs(3) << "m_kind = " << alt << "_kind;" << std::endl;
+      os << tabs(3) << "return m_" << alt << ";" << std::endl;
+      os << tabs(2) << "}" << std::endl;
+      // value may be the member held or a part of it, it is copied before reset destroys it
+      os << tabs(2) << type_name << "& set_" << alt << "(const " << type_name << "& value)" << std::endl;
+      os << tabs(2) << "{" << std::endl;
+      os << tabs(3) << type_name << " temp(value);" << std::endl;
+      os << tabs(3) << "reset();" << std::endl;
+      os << tabs(3) << "new (&m_" << alt << ") " << type_name << "(::std::move(temp));" << std::endl;
+      os << tabs(3) << "m_kind = " << alt << "_kind;" << std::endl;
+      os << tabs(3) << "return m_" << alt << ";" << std::endl;
+      os << tabs(2) << "}" << std::endl;
+      os << tabs(2) << type_name << "& set_" << alt << "(" << type_name << "&& value)" << std::endl;
+      os << tabs(2) << "{" << std::endl;
+      os << tabs(3) << type_name << " temp(::std::move(value));" << std::endl;
+      os << tabs(3) << "reset();" << std::endl;
+      os << tabs(3) << "new (&m_" << alt << ") " << type_name << "(::std::move(temp));" << std::endl;
+      os << tabs(3) << "m_kind = " << alt << "_kind;" << std::endl;
+      os << tabs(3) << "return m_" << alt << ";" << std::endl;
+      os << tabs(2) << "}" << std::endl << std::endl;
+    }
+
+    os << tabs(1) << "private:" << std::endl;
+    os << tabs(2) << "void assign(const " << name << "& other)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "switch(other.m_kind)" << std::endl;
+    os << tabs(3) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(3) << "case " << member.m_name << "_kind: set_" << member.m_name << "(other.m_" << member.m_name << "); break;" << std::endl;
+      }
+    }
+    os << tabs(3) << "default: break;" << std::endl;
+    os << tabs(3) << "}" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(2) << "void assign(" << name << "&& other)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "switch(other.m_kind)" << std::endl;
+    os << tabs(3) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(3) << "case " << member.m_name << "_kind: set_" << member.m_name << "(::std::move(other.m_" << member.m_name << ")); break;" << std::endl;
+      }
+    }
+    os << tabs(3) << "default: break;" << std::endl;
+    os << tabs(3) << "}" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "kind_type m_kind;" << std::endl;
+    os << tabs(2) << "union" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(3) << member.m_name << "_type m_" << member.m_name << ";" << std::endl;
+      }
+    }
+    os << tabs(2) << "};" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // the element of a <type>_soa column, a bool is a byte so a column isn't the std::vector<bool> bit proxy
+  inline std::string soa_column_type(const descrip_define& desc_define, const member_define& mdefine)
+  {
+    return mdefine.m_type == e_base_type::boolean ? "uint8_t" : make_type_desc(desc_define, mdefine);
+  }
+
+  // a struct of arrays, one vector per member of the type, see "soa = type;"
+  void gen_code_soa_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::vector<const member_define*> mb_list;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        mb_list.push_back(&member);
+      }
+    }
+    os << tabs(1) << "struct " << tdefine.m_name << "_soa" << std::endl << "  {" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(2) << "::std::vector< " << soa_column_type(desc_define, *mb) << " > " << mb->m_name << ";" << std::endl;
+    }
+    os << std::endl;
+
+    const std::string& first = mb_list.front()->m_name;
+    os << tabs(2) << "::std::size_t size() const { return this->" << first << ".size(); }" << std::endl;
+    os << tabs(2) << "bool empty() const { return this->" << first << ".empty(); }" << std::endl << std::endl;
+
+    os << tabs(2) << "void clear()" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(3) << "this->" << mb->m_name << ".clear();" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "void resize(::std::size_t count)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(3) << "this->" << mb->m_name << ".resize(count";
+      if (mb->is_initable())
+      {
+        os << ",(" << soa_column_type(desc_define, *mb) << ")" << make_type_default(desc_define, *mb);
+      }
+      os << ");" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "void push_back(const " << tdefine.m_name << "& value)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(3) << "this->" << mb->m_name << ".push_back(value." << mb->m_name << ");" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << tdefine.m_name << " at(::std::size_t i) const" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << tdefine.m_name << " value;" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(3) << "value." << mb->m_name << " = this->" << mb->m_name << "[i]" << (mb->m_type == e_base_type::boolean ? " != 0" : "") << ";" << std::endl;
+    }
+    os << tabs(3) << "return value;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "void set(::std::size_t i, const " << tdefine.m_name << "& value)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& mb : mb_list)
+    {
+      os << tabs(3) << "this->" << mb->m_name << "[i] = value." << mb->m_name << ";" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  inline const char * list_encoding_name(e_list_encoding encoding)
+  {
+    switch (encoding)
+    {
+    case list_delta: return "list_delta";
+    case list_delta2: return "list_delta2";
+    case list_rle: return "list_rle";
+    case list_bitmap: return "list_bitmap";
+    case list_xor: return "list_xor";
+    default: return "list_plain";
+    }
+  }
+
+  // an array of fix_ integers or floats is copied in one go, see adata::read_fixed_array
+  inline bool is_fixed_array(const member_define& mdefine)
+  {
+    const member_define& element = mdefine.m_template_parameters[0];
+    return element.m_fixed || element.is_float();
+  }
+
+  // bytes of all the elements of a fixed array
+  inline std::string fixed_array_size(const member_define& mdefine)
+  {
+    const member_define& element = mdefine.m_template_parameters[0];
+    int element_size = element.m_type == e_base_type::float32 ? 4 : element.m_type == e_base_type::float64 ? 8 : 1 << ((element.m_type - e_base_type::int8) / 2);
+    return std::to_string(element_size * std::strtol(mdefine.m_size.c_str(), nullptr, 10));
+  }
+
+  // bytes of a [packed] type, its members back to back
+  inline int packed_size(const type_define& tdefine)
+  {
+    int size = 0;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (member.m_type == e_base_type::type)
+      {
+        size += packed_size(*member.m_typedef);
+      }
+      else
+      {
+        size += member.m_type == e_base_type::float32 ? 4 : member.m_type == e_base_type::float64 ? 8 : 1 << ((member.m_type - e_base_type::int8) / 2);
+      }
+    }
+    return size;
+  }
+
+  // a plain list of a [packed] type is copied in one go, see adata::read_packed_list
+  inline const type_define * packed_list_element(const member_define& mdefine)
+  {
+    if (mdefine.m_type != e_base_type::list || mdefine.m_encoding != list_plain || mdefine.m_columnar || mdefine.m_soa)
+    {
+      return nullptr;
+    }
+    const type_define * element = mdefine.m_template_parameters[0].m_typedef;
+    return element != nullptr && element->m_packed ? element : nullptr;
+  }
+
   void gen_adata_operator_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    if (mdefine.is_multi())
+    if (mdefine.m_columnar)
+    {
+      os << tabs(tab_indent) << "{read_columnar(stream," << var_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "{read(stream," << var_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_encoding != list_plain)
+    {
+      os << tabs(tab_indent) << "{read_list(stream," << var_name << "," << list_encoding_name(mdefine.m_encoding);
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      // no length, the count is in the type
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "{read_fixed_array(stream," << var_name << ");}" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_adata_operator_read_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_dict)
+    {
+      os << tabs(tab_indent) << "{read_dict_string(stream," << var_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "{" << gen_read_bytes_code(mdefine, "stream", var_name) << "}" << std::endl;
+    }
+    else if (mdefine.is_multi())
     {
       os << tabs(tab_indent) << "{";
       os << std::endl << tabs(tab_indent + 1)
@@ -232,6 +634,10 @@ namespace cpp_gen
         os << tabs(tab_indent + 1) << var_name << ".resize(len);" << std::endl
           << tabs(tab_indent + 1) << "stream.read((char *)" << var_name << ".data(),len);";
       }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent + 1) << "read_packed_list(stream," << var_name << ",len," << packed_size(*packed_list_element(mdefine)) << ");";
+      }
       else if (mdefine.m_type == e_base_type::list)
       {
         os << tabs(tab_indent + 1) << var_name << ".resize(len);" << std::endl;
@@ -242,6 +648,7 @@ namespace cpp_gen
       }
       else if (mdefine.m_type == e_base_type::map)
       {
+        os << tabs(tab_indent + 1) << var_name << ".clear();" << std::endl;
         os << tabs(tab_indent + 1) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
         os << tabs(tab_indent + 2) << make_type_desc(desc_define, mdefine.m_template_parameters[0]) << " first_element;" << std::endl;
@@ -265,13 +672,71 @@ namespace cpp_gen
     }
   }
 
-  void gen_adata_operator_read_skip_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string&)
+  void gen_adata_operator_read_skip_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string&, const std::string& stream_name = "stream")
   {
-    if (mdefine.is_multi())
+    if (mdefine.m_type == e_base_type::boolean)
+    {
+      os << tabs(tab_indent) << "{}" << std::endl;
+    }
+    else if (mdefine.m_sized)
+    {
+      os << tabs(tab_indent) << "{skip_read_sized(" << stream_name << ");}" << std::endl;
+    }
+    else if (mdefine.m_columnar)
+    {
+      os << tabs(tab_indent) << "{skip_read_columnar(" << stream_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_encoding != list_plain)
+    {
+      os << tabs(tab_indent) << "{skip_read_list<" << make_type_desc(desc_define, mdefine.m_template_parameters[0]) << ">(" << stream_name << "," << list_encoding_name(mdefine.m_encoding);
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "{" << stream_name << ".skip_read(" << fixed_array_size(mdefine) << ");}" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, "element", stream_name);
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_dict)
+    {
+      os << tabs(tab_indent) << "{skip_read_dict_string(" << stream_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "{skip_read_bytes(" << stream_name << "," << mdefine.m_align;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");}" << std::endl;
+    }
+    else if (mdefine.is_multi())
     {
       os << tabs(tab_indent) << "{";
       os << std::endl << tabs(tab_indent + 1)
-        << "int32_t len = check_read_size(stream";
+        << "int32_t len = check_read_size(" << stream_name;
       if (mdefine.m_size.length())
       {
         os << "," << mdefine.m_size;
@@ -280,21 +745,25 @@ namespace cpp_gen
       os << std::endl;
       if (mdefine.m_type == e_base_type::string)
       {
-        os << tabs(tab_indent + 1) << "stream.skip_read(len);" << std::endl;
+        os << tabs(tab_indent + 1) << stream_name << ".skip_read(len);" << std::endl;
+      }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent + 1) << stream_name << ".skip_read((::std::size_t)len * " << packed_size(*packed_list_element(mdefine)) << ");" << std::endl;
       }
       else if (mdefine.m_type == e_base_type::list)
       {
         os << tabs(tab_indent + 1) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
-        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "element");
+        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "element", stream_name);
         os << tabs(tab_indent + 1) << "}" << std::endl;
       }
       else if (mdefine.m_type == e_base_type::map)
       {
         os << tabs(tab_indent + 1) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
-        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "first_element");
-        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 2, "second_element");
+        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "first_element", stream_name);
+        gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 2, "second_element", stream_name);
         os << tabs(tab_indent + 1) << "}" << std::endl;
       }
       os << tabs(tab_indent) << "}" << std::endl;
@@ -306,20 +775,36 @@ namespace cpp_gen
       {
         os << "fix_";
       }
-      os << "skip_read(stream,dummy_value);";
+      os << "skip_read(" << stream_name << ",dummy_value);";
       os << "}" << std::endl;
     }
   }
 
-  inline void gen_adata_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent)
+  // index picks the element of a <type>_soa column
+  inline void gen_adata_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& index = "")
   {
     std::string var_name = "value.";
-    var_name += mdefine.m_name;
+    var_name += mdefine.m_name + index;
 
     if (mdefine.m_deleted)
     {
       gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine, os, tab_indent, var_name);
     }
+    else if (mdefine.m_optional)
+    {
+      // built only when it is in the data
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << var_name << ".emplace();" << std::endl;
+      gen_adata_operator_read_member_code(desc_define, tdefine, mdefine, os, tab_indent + 1, member_value(mdefine, var_name));
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else if (mdefine.m_sized)
+    {
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "{int32_t payload_len = 0;read(stream,payload_len);}" << std::endl;
+      gen_adata_operator_read_member_code(desc_define, tdefine, mdefine, os, tab_indent + 1, var_name);
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
     else
     {
       gen_adata_operator_read_member_code(desc_define, tdefine, mdefine, os, tab_indent, var_name);
@@ -345,37 +830,265 @@ namespace cpp_gen
     os << tabs(tab_indent) << "}" << std::endl;
   }
 
-  void gen_adata_read_tag(std::ofstream& os, int tab_indent)
+  // members 0 to 62 have a bit in tag, a wider type keeps the others in ext_tag (see adata::read_ext_tag)
+  const std::size_t tag_members = 63;
+
+  inline bool is_wide_type(const type_define& tdefine)
   {
-    os << tabs(tab_indent) << "::std::size_t offset = stream.read_length();" << std::endl;
-    os << tabs(tab_indent) << "int64_t tag = 0;" << std::endl;
-    os << tabs(tab_indent) << "read(stream,tag);" << std::endl;
-    os << tabs(tab_indent) << "int32_t len_tag = 0;" << std::endl;
-    os << tabs(tab_indent) << "read(stream,len_tag);" << std::endl;
-    os << std::endl;
+    return tdefine.m_members.size() > tag_members;
   }
 
-  void gen_adata_operator_read_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  inline std::size_t ext_tag_count(const type_define& tdefine)
   {
-    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << "template<typename stream_ty>" << std::endl;
-    os << tabs(1) << gen_inline_code(tdefine) << "void read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
-    os << tabs(1) << "{" << std::endl;
-
-    gen_adata_read_tag(os, 2);
+    return (tdefine.m_members.size() + 63) / 64;
+  }
 
-    uint64_t tag_mask = 1;
-    uint64_t total_mask = 0;
-    for (const auto& member : tdefine.m_members)
+  inline std::string tag_bit(std::size_t index, const std::string& tag = "tag", const std::string& ext_tag = "ext_tag")
+  {
+    if (index < tag_members)
     {
-      os << tabs(2) << "if(tag&" << tag_mask << "LL)";
-      gen_adata_read_member_code(desc_define, tdefine, member, os, 2);
-      total_mask |= tag_mask;
-      tag_mask <<= 1;
+      return tag + "&" + std::to_string((uint64_t)1 << index) + "LL";
     }
+    return ext_tag + "[" + std::to_string(index / 64) + "]&" + std::to_string((uint64_t)1 << (index % 64)) + "ULL";
+  }
+
+  inline std::string tag_set(std::size_t index, const std::string& tag = "tag", const std::string& ext_tag = "ext_tag")
+  {
+    if (index < tag_members)
+    {
+      return tag + "|=" + std::to_string((uint64_t)1 << index) + "LL;";
+    }
+    return ext_tag + "[" + std::to_string(index / 64) + "]|=" + std::to_string((uint64_t)1 << (index % 64)) + "ULL;";
+  }
+
+  inline std::string tag_type(const type_define& tdefine)
+  {
+    return is_wide_type(tdefine) ? "uint64_t" : "int64_t";
+  }
+
+  // [bits=k] members next to each other share one bit stream (see adata::bit_writer) at the
+  // place of their values. a run ends at member 63, where a wide type keeps its ext_tag
+  inline bool is_bit_run_start(const type_define& tdefine, std::size_t i)
+  {
+    return tdefine.m_members[i].m_bit_width > 0 && (i == 0 || i == tag_members || tdefine.m_members[i - 1].m_bit_width == 0);
+  }
+
+  inline std::size_t bit_run_end(const type_define& tdefine, std::size_t begin)
+  {
+    std::size_t end = begin + 1;
+    while (end < tdefine.m_members.size() && end != tag_members && tdefine.m_members[end].m_bit_width > 0)
+    {
+      ++end;
+    }
+    return end;
+  }
+
+  // step, min and max of a [quant] float, the arguments of adata::quantize
+  inline std::string quant_args(const member_define& mdefine)
+  {
+    return mdefine.m_quant_step + "," + mdefine.m_quant_min + "," + mdefine.m_quant_max;
+  }
+
+  // a member of a run in its bits, a [quant] float as its count of steps from min
+  inline std::string bit_read_code(const member_define& mdefine, const std::string& var_name)
+  {
+    if (mdefine.is_quant())
+    {
+      return "bits.read_quant(" + var_name + "," + std::to_string(mdefine.m_bit_width) + "," + mdefine.m_quant_step + "," + mdefine.m_quant_min + ");";
+    }
+    return "bits.read(" + var_name + "," + std::to_string(mdefine.m_bit_width) + ");";
+  }
+
+  inline std::string bit_write_code(const member_define& mdefine, const std::string& var_name)
+  {
+    if (mdefine.is_quant())
+    {
+      return "bits.write_quant(" + var_name + "," + std::to_string(mdefine.m_bit_width) + "," + quant_args(mdefine) + ");";
+    }
+    return "bits.write(" + var_name + "," + std::to_string(mdefine.m_bit_width) + ");";
+  }
+
+  // true if a member of the run is in the data
+  inline std::string bit_run_present(std::size_t begin, std::size_t end)
+  {
+    std::string code;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      code += (i == begin ? "(" : " || (") + tag_bit(i) + ")";
+    }
+    return code;
+  }
+
+  // bit_count of the members of the run in the data
+  void gen_bit_run_count_code(const type_define& tdefine, std::size_t begin, std::size_t end, std::ofstream& os, int tab_indent)
+  {
+    os << tabs(tab_indent) << "int32_t bit_count = 0;" << std::endl;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      os << tabs(tab_indent) << "if(" << tag_bit(i) << "){bit_count += " << tdefine.m_members[i].m_bit_width << ";}" << std::endl;
+    }
+  }
+
+  // read the run of members from begin, a projected read skips the members not in mask
+  void gen_adata_read_bit_run_code(const type_define& tdefine, std::size_t begin, std::ofstream& os, int tab_indent, const std::string& index, bool projected = false)
+  {
+    std::size_t end = bit_run_end(tdefine, begin);
+    os << tabs(tab_indent) << "if(" << bit_run_present(begin, end) << ")" << std::endl;
+    os << tabs(tab_indent) << "{" << std::endl;
+    os << tabs(tab_indent + 1) << "bit_reader<stream_ty> bits(stream);" << std::endl;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      os << tabs(tab_indent + 1) << "if(" << tag_bit(i) << "){";
+      if (member.m_deleted)
+      {
+        os << "bits.skip(" << member.m_bit_width << ");";
+      }
+      else if (projected)
+      {
+        if (is_wide_type(tdefine))
+        {
+          os << "if(mask[" << i / 64 << "]&" << ((uint64_t)1 << (i % 64)) << "ULL)";
+        }
+        else
+        {
+          os << "if(" << tag_bit(i, "mask") << ")";
+        }
+        os << bit_read_code(member, "value." + member.m_name + index) << "else bits.skip(" << member.m_bit_width << ");";
+      }
+      else
+      {
+        os << bit_read_code(member, "value." + member.m_name + index);
+      }
+      os << "}" << std::endl;
+    }
+    os << tabs(tab_indent) << "}" << std::endl;
+  }
+
+  // skip the run of members from begin
+  void gen_adata_skip_bit_run_code(const type_define& tdefine, std::size_t begin, std::ofstream& os, int tab_indent)
+  {
+    os << tabs(tab_indent) << "{" << std::endl;
+    gen_bit_run_count_code(tdefine, begin, bit_run_end(tdefine, begin), os, tab_indent + 1);
+    os << tabs(tab_indent + 1) << "stream.skip_read((::std::size_t)size_of_bit_run(bit_count));" << std::endl;
+    os << tabs(tab_indent) << "}" << std::endl;
+  }
+
+  void gen_adata_read_tag(std::ofstream& os, int tab_indent, const type_define& tdefine)
+  {
+    os << tabs(tab_indent) << "::std::size_t offset = stream.read_length();" << std::endl;
+    os << tabs(tab_indent) << tag_type(tdefine) << " tag = 0;" << std::endl;
+    os << tabs(tab_indent) << "read(stream,tag);" << std::endl;
+    os << tabs(tab_indent) << "int32_t len_tag = 0;" << std::endl;
+    os << tabs(tab_indent) << "read(stream,len_tag);" << std::endl;
+    if (is_wide_type(tdefine))
+    {
+      os << tabs(tab_indent) << "uint64_t ext_tag[" << ext_tag_count(tdefine) << "] = {0};" << std::endl;
+    }
+    os << std::endl;
+  }
+
+  // in front of member 63 of a wide type
+  void gen_adata_read_ext_tag(std::ofstream& os, int tab_indent, const type_define& tdefine, const std::string& stream_name = "stream")
+  {
+    os << tabs(tab_indent) << "if(tag&ext_tag_bit) read_ext_tag(" << stream_name << ",ext_tag," << ext_tag_count(tdefine) << ");" << std::endl;
+  }
+
+  // a bool is its tag bit, set when it isn't the default, so it is always assigned
+  inline std::string bool_read_code(const type_define& tdefine, std::size_t i, const std::string& index)
+  {
+    const member_define& member = tdefine.m_members[i];
+    return "value." + member.m_name + index + " = ((" + tag_bit(i) + ") != 0) != " + (member.m_default_value == "true" ? "true" : "false") + ";";
+  }
+
+  // the members in the data, index picks the element of a <type>_soa column
+  void gen_adata_read_members_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os, int tab_indent, const std::string& index = "")
+  {
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      if (i == tag_members)
+      {
+        gen_adata_read_ext_tag(os, tab_indent, tdefine);
+      }
+      if (tdefine.m_members[i].m_bit_width > 0)
+      {
+        if (is_bit_run_start(tdefine, i))
+        {
+          gen_adata_read_bit_run_code(tdefine, i, os, tab_indent, index);
+        }
+        continue;
+      }
+      if (tdefine.m_members[i].m_type == e_base_type::boolean)
+      {
+        if (!tdefine.m_members[i].m_deleted)
+        {
+          os << tabs(tab_indent) << bool_read_code(tdefine, i, index) << std::endl;
+        }
+        continue;
+      }
+      os << tabs(tab_indent) << "if(" << tag_bit(i) << ")";
+      gen_adata_read_member_code(desc_define, tdefine, tdefine.m_members[i], os, tab_indent, index);
+    }
+  }
+
+  // what a member not in the data is read as: the value its writer leaves out
+  std::string gen_member_reset_code(const descrip_define& desc_define, const member_define& mdefine, const std::string& var_name)
+  {
+    if (mdefine.m_optional || mdefine.m_type == e_base_type::bits)
+    {
+      return var_name + ".reset();";
+    }
+    if (mdefine.m_type == e_base_type::array || mdefine.m_type == e_base_type::type)
+    {
+      return var_name + " = " + make_type_desc(desc_define, mdefine) + "();";
+    }
+    if (mdefine.is_multi())
+    {
+      return var_name + ".clear();";
+    }
+    return var_name + " = (" + make_type_desc(desc_define, mdefine) + ")" + make_type_default(desc_define, mdefine) + ";";
+  }
+
+  // the members not in the data go back to their defaults, so reading into a used object gives
+  // what reading into a new one does. a projected read resets only the members in mask, and
+  // assigns its bools here, where its loop can't have stopped before them
+  void gen_adata_reset_members_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os, int tab_indent, bool projected = false)
+  {
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      bool boolean = member.m_type == e_base_type::boolean;
+      if (member.m_deleted || (boolean && !projected))
+      {
+        continue;
+      }
+      std::string in_mask = is_wide_type(tdefine) ? "mask[" + std::to_string(i / 64) + "]&" + std::to_string((uint64_t)1 << (i % 64)) + "ULL" : tag_bit(i, "mask");
+      if (boolean)
+      {
+        os << tabs(tab_indent) << "if(" << in_mask << "){" << bool_read_code(tdefine, i, "") << "}" << std::endl;
+        continue;
+      }
+      os << tabs(tab_indent) << "if(!(" << tag_bit(i) << ")";
+      if (projected)
+      {
+        os << " && (" << in_mask << ")";
+      }
+      os << "){" << gen_member_reset_code(desc_define, member, "value." + member.m_name) << "}" << std::endl;
+    }
+  }
+
+  void gen_adata_operator_read_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    gen_adata_read_tag(os, 2, tdefine);
+    gen_adata_read_members_code(desc_define, tdefine, os, 2);
+    gen_adata_reset_members_code(desc_define, tdefine, os, 2);
+    gen_adata_len_tag_jump(os, 2);
 
-    gen_adata_len_tag_jump(os, 2);
-
     os << tabs(1) << "}" << std::endl << std::endl;
   }
 
@@ -386,6 +1099,79 @@ namespace cpp_gen
     gen_adata_operator_read_skip_member_code(desc_define, tdefine, mdefine, os, tab_indent, var_name);
   }
 
+  // read only the members whose tag bit is in mask, skip the others, stop at the last wanted one.
+  // a wide type takes one mask bit per member index, in as many words as it has ext_tag
+  void gen_adata_operator_read_projected_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    bool wide = is_wide_type(tdefine);
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void read_projected( stream_ty& stream, " << full_type_name << "& value, "
+      << (wide ? "const uint64_t * mask" : "int64_t mask") << ")" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    gen_adata_read_tag(os, 2, tdefine);
+    if (!wide)
+    {
+      os << tabs(2) << "uint64_t wanted = (uint64_t)(tag&mask);" << std::endl;
+    }
+    os << tabs(2) << "do" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_bit_width > 0 && !is_bit_run_start(tdefine, i))
+      {
+        continue;
+      }
+      if (!wide)
+      {
+        os << tabs(3) << "if(len_tag >= 0 && wanted < " << ((uint64_t)1 << i) << "ULL) break;" << std::endl;
+      }
+      else if (i == tag_members)
+      {
+        gen_adata_read_ext_tag(os, 3, tdefine);
+      }
+      if (member.m_bit_width > 0)
+      {
+        gen_adata_read_bit_run_code(tdefine, i, os, 3, "", true);
+        continue;
+      }
+      if (member.m_type == e_base_type::boolean)
+      {
+        continue;
+      }
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (member.m_deleted)
+      {
+        gen_adata_skip_read_member_code(desc_define, tdefine, member, os, 4);
+      }
+      else
+      {
+        if (wide)
+        {
+          os << tabs(4) << "if(mask[" << i / 64 << "]&" << ((uint64_t)1 << (i % 64)) << "ULL)";
+        }
+        else
+        {
+          os << tabs(4) << "if(" << tag_bit(i, "mask") << ")";
+        }
+        gen_adata_read_member_code(desc_define, tdefine, member, os, 4);
+        os << tabs(4) << "else";
+        gen_adata_skip_read_member_code(desc_define, tdefine, member, os, 4);
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+
+    os << tabs(2) << "} while(false);" << std::endl;
+    gen_adata_reset_members_code(desc_define, tdefine, os, 2, true);
+    gen_adata_len_tag_jump(os, 2);
+
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
   void gen_adata_operator_skip_read_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
   {
     std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
@@ -396,33 +1182,194 @@ namespace cpp_gen
     os << tabs(1) << "}" << std::endl << std::endl;
   }
 
-  void gen_adata_operator_write_tag_code(const descrip_define&, const type_define& tdefine, std::ofstream& os, int tab_indent)
+  // leave the stream at the value of member index, false if it is not in the data
+  void gen_adata_operator_seek_member_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
   {
-    uint64_t tag = 0;
-    uint64_t tag_mask = 1;
-    for (const auto& member : tdefine.m_members)
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << "template <typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "bool seek_member(stream_ty& stream, " << full_type_name << "* , int32_t index, bool& absent)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << tag_type(tdefine) << " tag = 0;" << std::endl;
+    os << tabs(2) << "read(stream,tag);" << std::endl;
+    os << tabs(2) << "int32_t len_tag = 0;" << std::endl;
+    os << tabs(2) << "read(stream,len_tag);" << std::endl;
+    std::size_t count = tdefine.m_members.size();
+    if (is_wide_type(tdefine))
+    {
+      os << tabs(2) << "uint64_t ext_tag[" << ext_tag_count(tdefine) << "] = {0};" << std::endl;
+      os << tabs(2) << "if(index < 0 || index >= " << count << ") return false;" << std::endl;
+      os << tabs(2) << "if(index < " << tag_members << " && !(tag&(1ULL<<index))){absent = true; return false;}" << std::endl;
+    }
+    else
+    {
+      os << tabs(2) << "if(index < 0 || index >= " << count << ") return false;" << std::endl;
+      os << tabs(2) << "if(!(tag&(1LL<<index))){absent = true; return false;}" << std::endl;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (i == tag_members)
+      {
+        gen_adata_read_ext_tag(os, 2, tdefine);
+        os << tabs(2) << "if(!(ext_tag[index>>6]&(1ULL<<(index&63)))){absent = true; return false;}" << std::endl;
+      }
+      // a [sized] member can be skipped but not patched, its byte length would go stale,
+      // nor an encoded or columnar list, the patcher writes plain elements, nor a bool, it has no bytes,
+      // nor an [align] bytes, it writes no pad
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_bit_width > 0)
+      {
+        // nor a member of a bit run
+        if (is_bit_run_start(tdefine, i))
+        {
+          std::size_t end = bit_run_end(tdefine, i);
+          os << tabs(2) << "if(index >= " << i << " && index < " << end << ") return false;" << std::endl;
+          if (end < count)
+          {
+            gen_adata_skip_bit_run_code(tdefine, i, os, 2);
+          }
+        }
+        continue;
+      }
+      bool patchable = !member.m_sized && member.m_encoding == list_plain && !member.m_columnar && member.m_type != e_base_type::boolean && !member.m_dict && member.m_align == 0;
+      os << tabs(2) << "if(index == " << i << ") return " << (patchable ? "true" : "false") << ";" << std::endl;
+      if (i + 1 < count)
+      {
+        os << tabs(2) << "if(" << tag_bit(i) << ")";
+        gen_adata_operator_read_skip_member_code(desc_define, tdefine, tdefine.m_members[i], os, 2, "");
+      }
+    }
+    os << tabs(2) << "return false;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  // true if the member is written: optional ones when set, strings and containers not empty, others not at the schema default
+  std::string gen_member_present_code(const descrip_define& desc_define, const member_define& mdefine, const std::string& var_name)
+  {
+    if (mdefine.m_optional)
     {
-      if (!member.is_multi() && (!member.m_deleted))
+      return var_name + ".has_value()";
+    }
+    if (mdefine.m_type == e_base_type::array)
+    {
+      // written unless every element is at the default of its type
+      const member_define& element = mdefine.m_template_parameters[0];
+      if (element.m_type == e_base_type::type)
       {
-        tag |= tag_mask;
+        return "!is_default(" + var_name + ",&is_default)";
       }
-      tag_mask <<= 1;
+      return "!is_default(" + var_name + "," + make_type_desc(desc_define, element) + "())";
+    }
+    if (mdefine.is_multi())
+    {
+      return "!" + var_name + ".empty()";
+    }
+    if (mdefine.m_type == e_base_type::type)
+    {
+      return "!is_default(" + var_name + ")";
+    }
+    if (mdefine.m_type == e_base_type::boolean)
+    {
+      return "(bool)(" + var_name + ") != " + make_type_default(desc_define, mdefine);
+    }
+    if (mdefine.m_type == e_base_type::bits)
+    {
+      return var_name + ".any()";
     }
-    tag_mask = 1;
-    os << tabs(tab_indent) << "int64_t tag = " << tag << "LL;" << std::endl;
+    return "!is_default(" + var_name + ",(" + make_type_desc(desc_define, mdefine) + ")" + make_type_default(desc_define, mdefine) + ")";
+  }
+
+  // a nested type is left out when it would be written without any member
+  void gen_adata_operator_is_default_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << gen_inline_code(tdefine) << "bool is_default(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    int count = 0;
     for (const auto& member : tdefine.m_members)
     {
-      if (member.is_multi() && (!member.m_deleted))
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      os << tabs(2) << "if(" << gen_member_present_code(desc_define, member, "value." + member.m_name) << ") return false;" << std::endl;
+      ++count;
+    }
+    if (count == 0)
+    {
+      os << tabs(2) << "(void)value;" << std::endl;
+    }
+    os << tabs(2) << "return true;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  void gen_adata_operator_write_tag_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os, int tab_indent, const std::string& index = "")
+  {
+    bool wide = is_wide_type(tdefine);
+    if (wide)
+    {
+      os << tabs(tab_indent) << "uint64_t tag = 0ULL;" << std::endl;
+      os << tabs(tab_indent) << "uint64_t ext_tag[" << ext_tag_count(tdefine) << "] = {0};" << std::endl;
+    }
+    else
+    {
+      os << tabs(tab_indent) << "int64_t tag = 0LL;" << std::endl;
+    }
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (!member.m_deleted)
+      {
+        os << tabs(tab_indent) << "if(" << gen_member_present_code(desc_define, member, "value." + member.m_name + index) << "){" << tag_set(i) << "}" << std::endl;
+      }
+    }
+    if (wide)
+    {
+      os << tabs(tab_indent) << "if(";
+      for (std::size_t w = 0; w < ext_tag_count(tdefine); ++w)
       {
-        os << tabs(tab_indent) << "if(!value." << member.m_name << ".empty()){tag|=" << tag_mask << "LL;}" << std::endl;
+        os << (w ? " || " : "") << "ext_tag[" << w << "]";
       }
-      tag_mask <<= 1;
+      os << "){tag|=ext_tag_bit;}" << std::endl;
     }
   }
 
   void gen_member_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    if (mdefine.is_multi())
+    if (mdefine.m_columnar)
+    {
+      os << tabs(tab_indent) << "size += size_of_columnar(" << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "size += size_of(" << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_encoding != list_plain)
+    {
+      os << tabs(tab_indent) << "size += size_of_list(" << var_name << "," << list_encoding_name(mdefine.m_encoding) << ");" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "size += " << fixed_array_size(mdefine) << ";" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_dict)
+    {
+      os << tabs(tab_indent) << "size += size_of_dict_string(" << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "size += size_of_bytes(" << var_name << "," << mdefine.m_align << ");" << std::endl;
+    }
+    else if (mdefine.is_multi())
     {
       os << tabs(tab_indent) << "{" << std::endl;
       ++tab_indent;
@@ -433,6 +1380,10 @@ namespace cpp_gen
         os << tabs(tab_indent) << "size += len;";
         os << std::endl;
       }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent) << "size += len * " << packed_size(*packed_list_element(mdefine)) << ";" << std::endl;
+      }
       else if (mdefine.m_type == e_base_type::list)
       {
         os << tabs(tab_indent) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
@@ -465,45 +1416,113 @@ namespace cpp_gen
     }
   }
 
-  void gen_adata_operator_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  // a [sized] member counts its byte length too
+  void gen_member_sized_size_of_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& member, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << gen_inline_code(tdefine) << "int32_t size_of(const " << full_type_name << "& value)" << std::endl;
-    os << tabs(1) << "{" << std::endl;
-
-    os << tabs(2) << "int32_t size = 0;" << std::endl;
+    if (member.m_sized)
+    {
+      os << tabs(tab_indent) << "int32_t payload_len = size;" << std::endl;
+    }
+    gen_member_size_of_type_code(desc_define, tdefine, member, os, tab_indent, var_name);
+    if (member.m_sized)
+    {
+      os << tabs(tab_indent) << "payload_len = size - payload_len;" << std::endl;
+      os << tabs(tab_indent) << "size += size_of(payload_len);" << std::endl;
+    }
+  }
 
-    gen_adata_operator_write_tag_code(desc_define, tdefine, os, 2);
-    uint64_t tag_mask = 1;
-    for (const auto& member : tdefine.m_members)
+  // the encoded size of value, or of element index of a <type>_soa
+  void gen_adata_size_of_body_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os, int tab_indent, const std::string& index)
+  {
+    os << tabs(tab_indent) << "int32_t size = 0;" << std::endl;
+
+    gen_adata_operator_write_tag_code(desc_define, tdefine, os, tab_indent, index);
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
     {
+      const member_define& member = tdefine.m_members[i];
       std::string var_name = "value.";
-      var_name += member.m_name;
-      if (!member.m_deleted)
+      var_name += member.m_name + index;
+      if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(tab_indent) << "//" << var_name << " bool , in the tag only." << std::endl;
+      }
+      else if (member.m_bit_width > 0)
       {
-        if (member.is_multi())
+        if (is_bit_run_start(tdefine, i))
         {
-          os << tabs(2) << "if(tag&" << tag_mask << "LL)" << std::endl;
+          os << tabs(tab_indent) << "{" << std::endl;
+          gen_bit_run_count_code(tdefine, i, bit_run_end(tdefine, i), os, tab_indent + 1);
+          os << tabs(tab_indent + 1) << "size += size_of_bit_run(bit_count);" << std::endl;
+          os << tabs(tab_indent) << "}" << std::endl;
         }
-        os << tabs(2) << "{" << std::endl;
-        gen_member_size_of_type_code(desc_define, tdefine, member, os, 3, var_name);
-        os << tabs(2) << "}" << std::endl;
+      }
+      else if (!member.m_deleted)
+      {
+        os << tabs(tab_indent) << "if(" << tag_bit(i) << ")" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_sized_size_of_code(desc_define, tdefine, member, os, tab_indent + 1, member_value(member, var_name));
+        os << tabs(tab_indent) << "}" << std::endl;
       }
       else
       {
-        os << tabs(2) << "//" << var_name << " deleted , skip write." << std::endl;
+        os << tabs(tab_indent) << "//" << var_name << " deleted , skip write." << std::endl;
       }
-      tag_mask <<= 1;
     }
-    os << tabs(2) << "size += size_of(tag);" << std::endl;
-    os << tabs(2) << "size += size_of(size + size_of(size));" << std::endl;
-    os << tabs(2) << "return size;" << std::endl;
+    if (is_wide_type(tdefine))
+    {
+      os << tabs(tab_indent) << "if(tag&ext_tag_bit){size += size_of_ext_tag(ext_tag," << ext_tag_count(tdefine) << ");}" << std::endl;
+    }
+    os << tabs(tab_indent) << "size += size_of(tag);" << std::endl;
+    os << tabs(tab_indent) << "size += size_of(size + size_of(size));" << std::endl;
+    os << tabs(tab_indent) << "return size;" << std::endl;
+  }
+
+  void gen_adata_operator_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << gen_inline_code(tdefine) << "int32_t size_of(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    gen_adata_size_of_body_code(desc_define, tdefine, os, 2, "");
     os << tabs(1) << "}" << std::endl << std::endl;
   }
 
   void gen_member_write_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    if (mdefine.is_multi())
+    if (mdefine.m_columnar)
+    {
+      os << tabs(tab_indent) << "write_columnar(stream," << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "write(stream," << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_encoding != list_plain)
+    {
+      os << tabs(tab_indent) << "write_list(stream," << var_name << "," << list_encoding_name(mdefine.m_encoding) << ");" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "write_fixed_array(stream," << var_name << ");" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_dict)
+    {
+      os << tabs(tab_indent) << "write_dict_string(stream," << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "write_bytes(stream," << var_name << "," << mdefine.m_align << ");" << std::endl;
+    }
+    else if (mdefine.is_multi())
     {
       os << tabs(tab_indent) << "{" << std::endl;
       os << tabs(tab_indent + 1) << "int32_t len = (int32_t)(" << var_name << ").size();" << std::endl;
@@ -513,6 +1532,10 @@ namespace cpp_gen
       {
         os << tabs(tab_indent + 1) << "stream.write((" << var_name << ").data(),len);" << std::endl;
       }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent + 1) << "write_packed_list(stream," << var_name << "," << packed_size(*packed_list_element(mdefine)) << ");" << std::endl;
+      }
       else if (mdefine.m_type == e_base_type::list)
       {
         os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
@@ -543,43 +1566,137 @@ namespace cpp_gen
     }
   }
 
-  void gen_adata_operator_write_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  // a [sized] member is preceded by its byte length
+  void gen_member_sized_write_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& member, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << "template<typename stream_ty>" << std::endl;
-    os << tabs(1) << gen_inline_code(tdefine) << "void write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
-    os << tabs(1) << "{" << std::endl;
-    gen_adata_operator_write_tag_code(desc_define, tdefine, os, 2);
-    os << tabs(2) << "write(stream,tag);" << std::endl;
-    os << tabs(2) << "write(stream,size_of(value));" << std::endl;
+    if (member.m_sized)
+    {
+      os << std::endl << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      os << tabs(tab_indent + 2) << "int32_t size = 0;" << std::endl;
+      gen_member_size_of_type_code(desc_define, tdefine, member, os, tab_indent + 2, var_name);
+      os << tabs(tab_indent + 2) << "write(stream,size);" << std::endl;
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      gen_member_write_type_code(desc_define, tdefine, member, os, tab_indent + 1, var_name);
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else
+    {
+      gen_member_write_type_code(desc_define, tdefine, member, os, tab_indent, var_name);
+    }
+  }
 
-    uint64_t tag_mask = 1;
-    uint64_t total_mask = 0;
-    for (const auto& member : tdefine.m_members)
+  // write value, or element index of a <type>_soa whose encoded size is size_expr
+  void gen_adata_write_body_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os, int tab_indent, const std::string& index, const std::string& size_expr)
+  {
+    gen_adata_operator_write_tag_code(desc_define, tdefine, os, tab_indent, index);
+    os << tabs(tab_indent) << "write(stream,tag);" << std::endl;
+    os << tabs(tab_indent) << "write(stream," << size_expr << ");" << std::endl;
+
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
     {
+      const member_define& member = tdefine.m_members[i];
       std::string var_name = "value.";
-      var_name += member.m_name;
-      if (!member.m_deleted)
+      var_name += member.m_name + index;
+      if (i == tag_members)
+      {
+        os << tabs(tab_indent) << "if(tag&ext_tag_bit){write_ext_tag(stream,ext_tag," << ext_tag_count(tdefine) << ");}" << std::endl;
+      }
+      if (member.m_type == e_base_type::boolean)
       {
-        if (member.is_multi())
+        os << tabs(tab_indent) << "//" << var_name << " bool , in the tag only." << std::endl;
+      }
+      else if (member.m_bit_width > 0)
+      {
+        if (is_bit_run_start(tdefine, i))
         {
-          os << tabs(2) << "if(tag&" << tag_mask << "LL)";
+          std::size_t end = bit_run_end(tdefine, i);
+          os << tabs(tab_indent) << "if(" << bit_run_present(i, end) << ")" << std::endl;
+          os << tabs(tab_indent) << "{" << std::endl;
+          os << tabs(tab_indent + 1) << "bit_writer<stream_ty> bits(stream);" << std::endl;
+          for (std::size_t r = i; r < end; ++r)
+          {
+            const member_define& run_member = tdefine.m_members[r];
+            if (!run_member.m_deleted)
+            {
+              os << tabs(tab_indent + 1) << "if(" << tag_bit(r) << "){" << bit_write_code(run_member, "value." + run_member.m_name + index) << "}" << std::endl;
+            }
+          }
+          os << tabs(tab_indent + 1) << "bits.flush();" << std::endl;
+          os << tabs(tab_indent) << "}" << std::endl;
         }
-        gen_member_write_type_code(desc_define, tdefine, member, os, 2, var_name);
+      }
+      else if (!member.m_deleted)
+      {
+        os << tabs(tab_indent) << "if(" << tag_bit(i) << ")";
+        gen_member_sized_write_code(desc_define, tdefine, member, os, tab_indent, member_value(member, var_name));
       }
       else
       {
-        os << tabs(2) << "//" << var_name << " deleted , skip write." << std::endl;
+        os << tabs(tab_indent) << "//" << var_name << " deleted , skip write." << std::endl;
       }
-      total_mask |= tag_mask;
-      tag_mask <<= 1;
     }
+  }
+
+  void gen_adata_operator_write_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    gen_adata_write_body_code(desc_define, tdefine, os, 2, "", "size_of(value)");
     os << tabs(1) << "}" << std::endl << std::endl;
   }
   
   void gen_adata_operator_raw_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
   {
-    if (mdefine.is_multi())
+    if (mdefine.m_encoding == list_bitmap)
+    {
+      // raw data keeps the plain ids, an id_set has no index to read them into
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "int32_t len = check_read_size(stream";
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");" << std::endl;
+      os << tabs(tab_indent + 1) << var_name << ".clear();" << std::endl;
+      os << tabs(tab_indent + 1) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      os << tabs(tab_indent + 2) << "uint32_t id = 0;" << std::endl;
+      os << tabs(tab_indent + 2) << "read(stream,id);" << std::endl;
+      os << tabs(tab_indent + 2) << var_name << ".insert(id);" << std::endl;
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "raw_read(stream," << var_name;
+      if (mdefine.m_size.length())
+      {
+        os << "," << mdefine.m_size;
+      }
+      os << ");" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "read_fixed_array(stream," << var_name << ");" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_adata_operator_raw_read_member_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << gen_read_bytes_code(mdefine, "stream", var_name) << std::endl;
+    }
+    else if (mdefine.is_multi())
     {
       os << tabs(tab_indent) << "{";
       os << std::endl << tabs(tab_indent + 1)
@@ -595,6 +1712,10 @@ namespace cpp_gen
         os << tabs(tab_indent + 1) << var_name << ".resize(len);" << std::endl
           << tabs(tab_indent + 1) << "stream.read((char *)" << var_name << ".data(),len);";
       }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent + 1) << "read_packed_list(stream," << var_name << ",len," << packed_size(*packed_list_element(mdefine)) << ");";
+      }
       else if (mdefine.m_type == e_base_type::list)
       {
         os << tabs(tab_indent + 1) << var_name << ".resize(len);" << std::endl;
@@ -605,6 +1726,7 @@ namespace cpp_gen
       }
       else if (mdefine.m_type == e_base_type::map)
       {
+        os << tabs(tab_indent + 1) << var_name << ".clear();" << std::endl;
         os << tabs(tab_indent + 1) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
         os << tabs(tab_indent + 2) << make_type_desc(desc_define, mdefine.m_template_parameters[0]) << " first_element;" << std::endl;
@@ -618,230 +1740,2203 @@ namespace cpp_gen
     }
     else
     {
-      os << tabs(tab_indent);
-      if(mdefine.m_type == e_base_type::type)
-      {
-        os << "raw_read(stream," << var_name << ");";
-      }
-      else
-      {
-        if (mdefine.m_fixed)
-        {
-          os << "fix_";
-        }
-        os << "read(stream," << var_name << ");";
-      }
-      os << std::endl;
+      os << tabs(tab_indent);
+      if(mdefine.m_type == e_base_type::type)
+      {
+        os << "raw_read(stream," << var_name << ");";
+      }
+      else
+      {
+        if (mdefine.m_fixed)
+        {
+          os << "fix_";
+        }
+        os << "read(stream," << var_name << ");";
+      }
+      os << std::endl;
+    }
+  }
+
+  inline void gen_adata_raw_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent)
+  {
+    std::string var_name = "value.";
+    var_name += mdefine.m_name;
+
+    if (mdefine.m_deleted)
+    {
+      return;
+    }
+    if (mdefine.m_optional)
+    {
+      // a presence byte, then the value when it is set
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "uint8_t has_value = 0;" << std::endl;
+      os << tabs(tab_indent + 1) << "read(stream,has_value);" << std::endl;
+      os << tabs(tab_indent + 1) << "if(has_value)" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      os << tabs(tab_indent + 2) << var_name << ".emplace();" << std::endl;
+      gen_adata_operator_raw_read_member_code(desc_define, tdefine, mdefine, os, tab_indent + 2, member_value(mdefine, var_name));
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent + 1) << "else{" << var_name << ".reset();}" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else
+    {
+      gen_adata_operator_raw_read_member_code(desc_define, tdefine, mdefine, os, tab_indent, var_name);
+    }
+  }
+
+  void gen_adata_operator_raw_read_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void raw_read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    for (const auto& member : tdefine.m_members)
+    {
+      gen_adata_raw_read_member_code(desc_define, tdefine, member, os, 2);
+    }
+
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  void gen_member_raw_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
+  {
+    if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "size += raw_size_of(" << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "size += " << fixed_array_size(mdefine) << ";" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "size += size_of_bytes(" << var_name << "," << mdefine.m_align << ");" << std::endl;
+    }
+    else if (mdefine.is_multi())
+    {
+      os << tabs(tab_indent) << "{" << std::endl;
+      ++tab_indent;
+      os << tabs(tab_indent) << "int32_t len = (int32_t)(" << var_name << ").size();" << std::endl;
+      os << tabs(tab_indent) << "size += size_of(len);" << std::endl;
+      if (mdefine.m_type == e_base_type::string)
+      {
+        os << tabs(tab_indent) << "size += len;";
+        os << std::endl;
+      }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent) << "size += len * " << packed_size(*packed_list_element(mdefine)) << ";" << std::endl;
+      }
+      else if (mdefine.m_type == e_base_type::list)
+      {
+        os << tabs(tab_indent) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, "*i");
+        os << tabs(tab_indent) << "}";
+        os << std::endl;
+      }
+      else if (mdefine.m_type == e_base_type::map)
+      {
+        os << tabs(tab_indent) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, "i->first");
+        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 1, "i->second");
+        os << tabs(tab_indent) << "}";
+        os << std::endl;
+      }
+      --tab_indent;
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else
+    {
+      os << tabs(tab_indent);
+      os << "size += ";
+      if(mdefine.m_type == e_base_type::type)
+      {
+        os << "raw_size_of(" << var_name << ");" << std::endl;
+      }
+      else
+      {
+        if (mdefine.m_fixed)
+        {
+          os << "fix_";
+        }
+        os << "size_of(" << var_name << ");" << std::endl;
+      }
+    }
+  }
+
+  void gen_adata_operator_raw_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << gen_inline_code(tdefine) << "int32_t raw_size_of(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    os << tabs(2) << "int32_t size = 0;" << std::endl;
+
+    for (const auto& member : tdefine.m_members)
+    {
+      std::string var_name = "value.";
+      var_name += member.m_name;
+      if (member.m_optional && !member.m_deleted)
+      {
+        os << tabs(2) << "size += 1;" << std::endl;
+        os << tabs(2) << "if(" << var_name << ".has_value())" << std::endl;
+        os << tabs(2) << "{" << std::endl;
+        gen_member_raw_size_of_type_code(desc_define, tdefine, member, os, 3, member_value(member, var_name));
+        os << tabs(2) << "}" << std::endl;
+      }
+      else if (member.m_deleted == false)
+      {
+        gen_member_raw_size_of_type_code(desc_define, tdefine, member, os, 2, var_name);
+      }
+    }
+    os << tabs(2) << "return size;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  void gen_member_raw_write_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
+  {
+    if (mdefine.m_soa)
+    {
+      os << tabs(tab_indent) << "raw_write(stream," << var_name << ");" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::array)
+    {
+      if (is_fixed_array(mdefine))
+      {
+        os << tabs(tab_indent) << "write_fixed_array(stream," << var_name << ");" << std::endl;
+      }
+      else
+      {
+        os << tabs(tab_indent) << "for (int32_t i = 0 ; i < " << mdefine.m_size << " ; ++i)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, var_name + "[i]");
+        os << tabs(tab_indent) << "}" << std::endl;
+      }
+    }
+    else if (mdefine.m_bytes)
+    {
+      os << tabs(tab_indent) << "write_bytes(stream," << var_name << "," << mdefine.m_align << ");" << std::endl;
+    }
+    else if (mdefine.is_multi())
+    {
+      os << tabs(tab_indent) << "{";
+      os << std::endl;
+      os << tabs(tab_indent + 1) << "int32_t len = (int32_t)(" << var_name << ").size();" << std::endl;
+      os << tabs(tab_indent + 1) << "write(stream,len);" << std::endl;
+
+      if (mdefine.m_type == e_base_type::string)
+      {
+        os << tabs(tab_indent + 1) << "stream.write((" << var_name << ").data(),len);" << std::endl;
+      }
+      else if (packed_list_element(mdefine))
+      {
+        os << tabs(tab_indent + 1) << "write_packed_list(stream," << var_name << "," << packed_size(*packed_list_element(mdefine)) << ");" << std::endl;
+      }
+      else if (mdefine.m_type == e_base_type::list)
+      {
+        os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "*i");
+        os << tabs(tab_indent + 1) << "}" << std::endl;
+      }
+      else if (mdefine.m_type == e_base_type::map)
+      {
+        os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "i->first");
+        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 2, "i->second");
+        os << tabs(tab_indent + 1) << "}" << std::endl;
+      }
+      os << tabs(tab_indent) << "}" << std::endl;
+    }
+    else
+    {
+      os << tabs(tab_indent);
+      if(mdefine.m_type == e_base_type::type)
+      {
+        os << "raw_write(stream," << var_name << ");";
+      }
+      else
+      {
+        if (mdefine.m_fixed)
+        {
+          os << "fix_";
+        }
+        os << "write(stream," << var_name << ");";
+      }
+      os << std::endl;
+    }
+  }
+
+  void gen_adata_operator_raw_write_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void raw_write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    for (const auto& member : tdefine.m_members)
+    {
+      std::string var_name = "value.";
+      var_name += member.m_name;
+      if (member.m_optional && !member.m_deleted)
+      {
+        os << tabs(2) << "write(stream,(uint8_t)(" << var_name << ".has_value() ? 1 : 0));" << std::endl;
+        os << tabs(2) << "if(" << var_name << ".has_value())" << std::endl;
+        os << tabs(2) << "{" << std::endl;
+        gen_member_raw_write_type_code(desc_define, tdefine, member, os, 3, member_value(member, var_name));
+        os << tabs(2) << "}" << std::endl;
+      }
+      else if (!member.m_deleted)
+      {
+        gen_member_raw_write_type_code(desc_define, tdefine, member, os, 2, var_name);        
+      }
+    }
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  // an integer member has a column of its own for the list kernels, see adata::write_column,
+  // a [quant] float has the column of its steps
+  inline bool is_column_member(const member_define& mdefine)
+  {
+    return mdefine.is_integer() && !mdefine.m_fixed;
+  }
+
+  // an enum column is the column of its underlying integer
+  inline std::string column_type_desc(const descrip_define& desc_define, const member_define& mdefine)
+  {
+    return mdefine.m_enum ? make_typename(desc_define, mdefine.m_typename) : make_type_desc(desc_define, mdefine);
+  }
+
+  inline std::string column_value(const descrip_define& desc_define, const member_define& mdefine, const std::string& var_name)
+  {
+    return mdefine.m_enum ? "(" + column_type_desc(desc_define, mdefine) + ")" + var_name : var_name;
+  }
+
+  inline void gen_column_loop_begin(std::ofstream& os, int tab_indent, const std::string& element)
+  {
+    os << tabs(tab_indent) << "for (int32_t k = 0 ; k < count ; ++k)" << std::endl;
+    os << tabs(tab_indent) << "{" << std::endl;
+    if (element.length())
+    {
+      os << tabs(tab_indent + 1) << element << " = values[k];" << std::endl;
+    }
+  }
+
+  // the columns of a [columnar] list<T>, a type of more than 63 members or of an optional one can't be one
+  void gen_adata_columns_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    if (is_wide_type(tdefine))
+    {
+      return;
+    }
+    for (const auto& member : tdefine.m_members)
+    {
+      if (member.m_optional)
+      {
+        return;
+      }
+    }
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    bool live = false;
+    for (const auto& member : tdefine.m_members)
+    {
+      live = live || !member.m_deleted;
+    }
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct columns< " << full_type_name << " >" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    os << tabs(2) << "template<typename list_ty>" << std::endl;
+    os << tabs(2) << "static int64_t column_tag(const list_ty& values)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int64_t tag = 0LL;" << std::endl;
+    if (live)
+    {
+      os << tabs(3) << "int32_t count = (int32_t)values.size();" << std::endl;
+      gen_column_loop_begin(os, 3, "const " + full_type_name + "& value");
+      for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+      {
+        const member_define& member = tdefine.m_members[i];
+        if (!member.m_deleted)
+        {
+          os << tabs(4) << "if(" << gen_member_present_code(desc_define, member, "value." + member.m_name) << "){" << tag_set(i) << "}" << std::endl;
+        }
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    else
+    {
+      os << tabs(3) << "(void)values;" << std::endl;
+    }
+    os << tabs(3) << "return tag;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "template<typename list_ty>" << std::endl;
+    os << tabs(2) << "static int32_t column_size(const list_ty& values, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int32_t size = 0;" << std::endl;
+    os << tabs(3) << "int32_t count = (int32_t)values.size();" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member))
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column(count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){column[k] = " << column_value(desc_define, member, "values[k]." + member.m_name) << ";}" << std::endl;
+        os << tabs(4) << "size += size_of_column(column);" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column(count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k]." << member.m_name << "," << quant_args(member) << ");}" << std::endl;
+        os << tabs(4) << "size += size_of_column(column);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "size += size_of_bool_column(count);" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, "const " + full_type_name + "& value");
+        gen_member_sized_size_of_code(desc_define, tdefine, member, os, 5, "value." + member.m_name);
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    if (!live)
+    {
+      os << tabs(3) << "(void)tag;(void)count;" << std::endl;
+    }
+    os << tabs(3) << "return size;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "template<typename stream_ty, typename list_ty>" << std::endl;
+    os << tabs(2) << "static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int32_t count = (int32_t)values.size();" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member))
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column(count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){column[k] = " << column_value(desc_define, member, "values[k]." + member.m_name) << ";}" << std::endl;
+        os << tabs(4) << "write_column(stream,column);" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column(count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k]." << member.m_name << "," << quant_args(member) << ");}" << std::endl;
+        os << tabs(4) << "write_column(stream,column);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "::std::vector<bool> column(count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k]." << member.m_name << ";}" << std::endl;
+        os << tabs(4) << "write_bool_column(stream,column);" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, "const " + full_type_name + "& value");
+        gen_member_sized_write_code(desc_define, tdefine, member, os, 5, "value." + member.m_name);
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    if (!live)
+    {
+      os << tabs(3) << "(void)stream;(void)tag;(void)count;" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "template<typename stream_ty, typename list_ty>" << std::endl;
+    os << tabs(2) << "static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int32_t count = (int32_t)values.size();" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member) && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_column< " << column_type_desc(desc_define, member) << " >(stream,count);" << std::endl;
+      }
+      else if (is_column_member(member))
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column;" << std::endl;
+        os << tabs(4) << "read_column(stream,column,count);" << std::endl;
+        if (member.m_enum)
+        {
+          os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){values[k]." << member.m_name << " = to_enum< " << make_type_desc(desc_define, member) << " >(column[k]);}" << std::endl;
+        }
+        else
+        {
+          os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){values[k]." << member.m_name << " = column[k];}" << std::endl;
+        }
+      }
+      else if (member.is_quant() && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_column<uint64_t>(stream,count);" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column;" << std::endl;
+        os << tabs(4) << "read_column(stream,column,count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){values[k]." << member.m_name << " = (" << make_type_desc(desc_define, member)
+          << ")dequantize(column[k]," << member.m_quant_step << "," << member.m_quant_min << ");}" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_bool_column(stream,count);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "::std::vector<bool> column;" << std::endl;
+        os << tabs(4) << "read_bool_column(stream,column,count);" << std::endl;
+        os << tabs(4) << "for (int32_t k = 0 ; k < count ; ++k){values[k]." << member.m_name << " = column[k];}" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, member.m_deleted ? "" : full_type_name + "& value");
+        gen_adata_read_member_code(desc_define, tdefine, member, os, 5);
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    if (tdefine.m_members.empty())
+    {
+      os << tabs(3) << "(void)stream;(void)tag;(void)count;" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // the columns of a [columnar] <type>_soa are its own vectors
+  void gen_adata_soa_columns_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string soa_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name + "_soa";
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct columns_of< " << soa_name << " >" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "typedef columns< " << soa_name << " > type;" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct columns< " << soa_name << " >" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+
+    os << tabs(2) << "static int64_t column_tag(const " << soa_name << "& value)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int64_t tag = 0LL;" << std::endl;
+    os << tabs(3) << "int32_t count = (int32_t)value.size();" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (!member.m_deleted)
+      {
+        os << tabs(3) << "for (int32_t k = 0 ; k < count ; ++k){if(" << gen_member_present_code(desc_define, member, "value." + member.m_name + "[k]") << "){" << tag_set(i) << "break;}}" << std::endl;
+      }
+    }
+    os << tabs(3) << "return tag;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    bool loop = false;
+    for (const auto& member : tdefine.m_members)
+    {
+      loop = loop || (!member.m_deleted && !is_column_member(member) && !member.is_quant());
+    }
+
+    os << tabs(2) << "static int32_t column_size(const " << soa_name << "& value, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int32_t size = 0;" << std::endl;
+    if (loop)
+    {
+      os << tabs(3) << "int32_t count = (int32_t)value.size();" << std::endl;
+    }
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member) && member.m_enum)
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column;" << std::endl;
+        os << tabs(4) << "enum_column(value." << member.m_name << ",column);" << std::endl;
+        os << tabs(4) << "size += size_of_column(column);" << std::endl;
+      }
+      else if (is_column_member(member))
+      {
+        os << tabs(4) << "size += size_of_column(value." << member.m_name << ");" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column;" << std::endl;
+        os << tabs(4) << "quantize_column(value." << member.m_name << ",column," << quant_args(member) << ");" << std::endl;
+        os << tabs(4) << "size += size_of_column(column);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "size += size_of_bool_column(count);" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, "");
+        gen_member_sized_size_of_code(desc_define, tdefine, member, os, 5, "value." + member.m_name + "[k]");
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    os << tabs(3) << "return size;" << std::endl;
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "template<typename stream_ty>" << std::endl;
+    os << tabs(2) << "static void write_columns(stream_ty& stream, const " << soa_name << "& value, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    if (loop)
+    {
+      os << tabs(3) << "int32_t count = (int32_t)value.size();" << std::endl;
+    }
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member) && member.m_enum)
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column;" << std::endl;
+        os << tabs(4) << "enum_column(value." << member.m_name << ",column);" << std::endl;
+        os << tabs(4) << "write_column(stream,column);" << std::endl;
+      }
+      else if (is_column_member(member))
+      {
+        os << tabs(4) << "write_column(stream,value." << member.m_name << ");" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column;" << std::endl;
+        os << tabs(4) << "quantize_column(value." << member.m_name << ",column," << quant_args(member) << ");" << std::endl;
+        os << tabs(4) << "write_column(stream,column);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "write_bool_column(stream,value." << member.m_name << ");" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, "");
+        gen_member_sized_write_code(desc_define, tdefine, member, os, 5, "value." + member.m_name + "[k]");
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
+
+    os << tabs(2) << "template<typename stream_ty>" << std::endl;
+    os << tabs(2) << "static void read_columns(stream_ty& stream, " << soa_name << "& value, int64_t tag)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "int32_t count = (int32_t)value.size();" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      os << tabs(3) << "if(" << tag_bit(i) << ")" << std::endl;
+      os << tabs(3) << "{" << std::endl;
+      if (is_column_member(member) && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_column< " << column_type_desc(desc_define, member) << " >(stream,count);" << std::endl;
+      }
+      else if (is_column_member(member) && member.m_enum)
+      {
+        os << tabs(4) << "::std::vector< " << column_type_desc(desc_define, member) << " > column;" << std::endl;
+        os << tabs(4) << "read_column(stream,column,count);" << std::endl;
+        os << tabs(4) << "enum_column_values(column,value." << member.m_name << ");" << std::endl;
+      }
+      else if (is_column_member(member))
+      {
+        os << tabs(4) << "read_column(stream,value." << member.m_name << ",count);" << std::endl;
+      }
+      else if (member.is_quant() && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_column<uint64_t>(stream,count);" << std::endl;
+      }
+      else if (member.is_quant())
+      {
+        os << tabs(4) << "::std::vector<uint64_t> column;" << std::endl;
+        os << tabs(4) << "read_column(stream,column,count);" << std::endl;
+        os << tabs(4) << "dequantize_column(column,value." << member.m_name << "," << member.m_quant_step << "," << member.m_quant_min << ");" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean && member.m_deleted)
+      {
+        os << tabs(4) << "skip_read_bool_column(stream,count);" << std::endl;
+      }
+      else if (member.m_type == e_base_type::boolean)
+      {
+        os << tabs(4) << "read_bool_column(stream,value." << member.m_name << ",count);" << std::endl;
+      }
+      else
+      {
+        gen_column_loop_begin(os, 4, "");
+        gen_adata_read_member_code(desc_define, tdefine, member, os, 5, "[k]");
+        os << tabs(4) << "}" << std::endl;
+      }
+      os << tabs(3) << "}" << std::endl;
+    }
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // a <type>_soa reads and writes as a list<type>, converting each element from and to its columns
+  void gen_adata_operator_soa_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    std::string soa_name = full_type_name + "_soa";
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << "void read( stream_ty& stream, " << soa_name << "& value, int size = 0)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = check_read_size(stream,size);" << std::endl;
+    os << tabs(2) << "value.clear();" << std::endl;
+    os << tabs(2) << "value.resize(count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    gen_adata_read_tag(os, 3, tdefine);
+    gen_adata_read_members_code(desc_define, tdefine, os, 3, "[k]");
+    gen_adata_len_tag_jump(os, 3);
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "inline int32_t size_of_element(const " << soa_name << "& value, int32_t k)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    gen_adata_size_of_body_code(desc_define, tdefine, os, 2, "[k]");
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "inline int32_t size_of(const " << soa_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = (int32_t)value.size();" << std::endl;
+    os << tabs(2) << "int32_t size = size_of(count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k){size += size_of_element(value,k);}" << std::endl;
+    os << tabs(2) << "return size;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << "void write(stream_ty& stream , const " << soa_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = (int32_t)value.size();" << std::endl;
+    os << tabs(2) << "write(stream,count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    gen_adata_write_body_code(desc_define, tdefine, os, 3, "[k]", "size_of_element(value,k)");
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << "void raw_read( stream_ty& stream, " << soa_name << "& value, int size = 0)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = check_read_size(stream,size);" << std::endl;
+    os << tabs(2) << "value.clear();" << std::endl;
+    os << tabs(2) << "value.resize(count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k){" << full_type_name << " element;raw_read(stream,element);value.set(k,element);}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "inline int32_t raw_size_of(const " << soa_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = (int32_t)value.size();" << std::endl;
+    os << tabs(2) << "int32_t size = size_of(count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k){size += raw_size_of(value.at(k));}" << std::endl;
+    os << tabs(2) << "return size;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << "void raw_write(stream_ty& stream , const " << soa_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "int32_t count = (int32_t)value.size();" << std::endl;
+    os << tabs(2) << "write(stream,count);" << std::endl;
+    os << tabs(2) << "for (int32_t k = 0 ; k < count ; ++k){raw_write(stream,value.at(k));}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    gen_adata_soa_columns_type_code(desc_define, tdefine, os);
+  }
+
+  // a [packed] type is its members back to back, every one of them, the same bytes as its raw encoding
+  void gen_adata_operator_packed_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+    int size = packed_size(tdefine);
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      gen_adata_read_member_code(desc_define, tdefine, member, os, 2);
+    }
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template <typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void skip_read(stream_ty& stream, " << full_type_name << "* )" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "stream.skip_read(" << size << ");" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    // no len_tag for adata::member_patcher to rewrite, a packed value is patched as a whole
+    os << tabs(1) << "template <typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "bool seek_member(stream_ty& , " << full_type_name << "* , int32_t , bool& )" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "return false;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    gen_adata_operator_is_default_type_code(desc_define, tdefine, os);
+
+    os << tabs(1) << gen_inline_code(tdefine) << "int32_t size_of(const " << full_type_name << "& )" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "return " << size << ";" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      gen_member_write_type_code(desc_define, tdefine, member, os, 2, "value." + member.m_name);
+    }
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    gen_adata_operator_raw_read_type_code(desc_define, tdefine, os);
+    gen_adata_operator_raw_size_of_type_code(desc_define, tdefine, os);
+    gen_adata_operator_raw_write_type_code(desc_define, tdefine, os);
+  }
+
+  // the varint kind, then the member held if there is one. a kind this schema doesn't know, or has deleted,
+  // is skipped by the tag and len_tag of its type and leaves the union empty, raw data has no such kinds
+  void gen_adata_operator_union_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "uint32_t kind = 0;" << std::endl;
+    os << tabs(2) << "read(stream,kind);" << std::endl;
+    os << tabs(2) << "switch(kind)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(2) << "case 0: value.reset(); break;" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << i + 1 << ": read(stream,value.set_" << member.m_name << "()); break;" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: value.reset(); skip_read_compatible(stream);" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template <typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void skip_read(stream_ty& stream, " << full_type_name << "* )" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "uint32_t kind = 0;" << std::endl;
+    os << tabs(2) << "read(stream,kind);" << std::endl;
+    os << tabs(2) << "if(kind != 0) skip_read_compatible(stream);" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    // the member held changes from value to value, there is nothing fixed to patch
+    os << tabs(1) << "template <typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "bool seek_member(stream_ty& , " << full_type_name << "* , int32_t , bool& )" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "return false;" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << gen_inline_code(tdefine) << "bool is_default(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "return value.empty();" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << gen_inline_code(tdefine) << "int32_t size_of(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "switch(value.kind())" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << full_type_name << "::" << member.m_name << "_kind: return size_of((uint32_t)value.kind()) + size_of(*value.get_" << member.m_name << "());" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: return size_of((uint32_t)0);" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "write(stream,(uint32_t)value.kind());" << std::endl;
+    os << tabs(2) << "switch(value.kind())" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << full_type_name << "::" << member.m_name << "_kind: write(stream,*value.get_" << member.m_name << "()); break;" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: break;" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void raw_read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "uint32_t kind = 0;" << std::endl;
+    os << tabs(2) << "read(stream,kind);" << std::endl;
+    os << tabs(2) << "switch(kind)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(2) << "case 0: value.reset(); break;" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << i + 1 << ": raw_read(stream,value.set_" << member.m_name << "()); break;" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: throw exception(undefined_member_protocol_not_compatible);" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << gen_inline_code(tdefine) << "int32_t raw_size_of(const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "switch(value.kind())" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << full_type_name << "::" << member.m_name << "_kind: return size_of((uint32_t)value.kind()) + raw_size_of(*value.get_" << member.m_name << "());" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: return size_of((uint32_t)0);" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+
+    os << tabs(1) << "template<typename stream_ty>" << std::endl;
+    os << tabs(1) << gen_inline_code(tdefine) << "void raw_write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "write(stream,(uint32_t)value.kind());" << std::endl;
+    os << tabs(2) << "switch(value.kind())" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (!member.m_deleted)
+      {
+        os << tabs(2) << "case " << full_type_name << "::" << member.m_name << "_kind: raw_write(stream,*value.get_" << member.m_name << "()); break;" << std::endl;
+      }
+    }
+    os << tabs(2) << "default: break;" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  inline void gen_adata_operator_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    if (tdefine.m_packed)
+    {
+      gen_adata_operator_packed_type_code(desc_define, tdefine, os);
+      return;
+    }
+    if (tdefine.m_union)
+    {
+      gen_adata_operator_union_type_code(desc_define, tdefine, os);
+      return;
+    }
+    gen_adata_operator_read_type_code(desc_define, tdefine, os);
+    gen_adata_operator_read_projected_type_code(desc_define, tdefine, os);
+    gen_adata_operator_skip_read_type_code(desc_define, tdefine, os);
+    gen_adata_operator_seek_member_type_code(desc_define, tdefine, os);
+    gen_adata_operator_is_default_type_code(desc_define, tdefine, os);
+    gen_adata_operator_size_of_type_code(desc_define, tdefine, os);
+    gen_adata_operator_write_type_code(desc_define, tdefine, os);
+    gen_adata_columns_type_code(desc_define, tdefine, os);
+    gen_adata_operator_raw_read_type_code(desc_define, tdefine, os);
+    gen_adata_operator_raw_size_of_type_code(desc_define, tdefine, os);
+    gen_adata_operator_raw_write_type_code(desc_define, tdefine, os);
+    if (tdefine.m_soa)
+    {
+      gen_adata_operator_soa_type_code(desc_define, tdefine, os);
+    }
+  }
+
+  void gen_adata_operator_code(const descrip_define& desc_define, std::ofstream& os)
+  {
+    os << "namespace adata" << std::endl << "{" << std::endl;
+    for (auto& t_define : desc_define.m_types)
+    {
+      gen_adata_operator_type_code(desc_define, t_define, os);
+    }
+    os << "}" << std::endl << std::endl;
+  }
+
+  void gen_include(const descrip_define& desc_define, std::ofstream& os)
+  {
+    for (auto const& inc : desc_define.m_includes)
+    {
+      std::string inc_path = replace_all_copy(inc.first, ".", "/");
+      inc_path += ".adl.h";
+      os << "#include \"" << inc_path << "\"" << std::endl;
+    }
+    os << std::endl;
+  }
+
+  inline std::string int64_literal(int64_t value)
+  {
+    // -9223372036854775808LL is the negation of a literal too large for long long
+    return value == INT64_MIN ? "(-9223372036854775807LL - 1)" : std::to_string(value) + "LL";
+  }
+
+  void gen_code_enum(const descrip_define& desc_define, const enum_define& edefine, std::ofstream& os)
+  {
+    os << tabs(1) << "enum class " << edefine.m_name << " : " << make_typename(desc_define, edefine.m_typename) << std::endl << "  {" << std::endl;
+    for (std::size_t i = 0; i < edefine.m_items.size(); ++i)
+    {
+      const enum_define::item_type& item = edefine.m_items[i];
+      os << tabs(2) << item.m_name << " = " << (edefine.m_type == e_base_type::int64 ? int64_literal(item.m_value) : std::to_string(item.m_value))
+        << (i + 1 < edefine.m_items.size() ? "," : "") << std::endl;
+    }
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // names and values by index, the index of a value from a table when the values are dense, else from a switch
+  void gen_enum_traits(const descrip_define& desc_define, const enum_define& edefine, std::ofstream& os)
+  {
+    std::string full_name = make_enum_typename(desc_define, edefine.m_name);
+    std::size_t count = edefine.m_items.size();
+    uint64_t span = (uint64_t)edefine.m_max - (uint64_t)edefine.m_min;
+    os << "template<>\nstruct enum_traits< " << full_name << " >\n{\n";
+    os << "  typedef " << make_typename(desc_define, edefine.m_typename) << " value_type;\n";
+    os << "  enum { count = " << count << " };\n\n";
+
+    os << "  ADATA_INLINE static const char * name(int32_t index)\n  {\n";
+    os << "    static const char * const names[] = {";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      os << (i ? "," : "") << "\"" << edefine.m_items[i].m_name << "\"";
+    }
+    os << "};\n    return names[index];\n  }\n\n";
+
+    os << "  ADATA_INLINE static " << full_name << " value(int32_t index)\n  {\n";
+    os << "    static const " << full_name << " values[] = {";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      os << (i ? "," : "") << full_name << "::" << edefine.m_items[i].m_name;
+    }
+    os << "};\n    return values[index];\n  }\n\n";
+
+    os << "  // -1 if value is not an enumerator\n";
+    os << "  ADATA_INLINE static int32_t index_of(" << full_name << " value)\n  {\n";
+    if (span < 4 * count + 64)
+    {
+      std::vector<int32_t> indexes((std::size_t)span + 1, -1);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        indexes[(std::size_t)((uint64_t)edefine.m_items[i].m_value - (uint64_t)edefine.m_min)] = (int32_t)i;
+      }
+      os << "    static const " << (count < 0x80 ? "int8_t" : count < 0x8000 ? "int16_t" : "int32_t") << " indexes[] = {";
+      for (std::size_t i = 0; i < indexes.size(); ++i)
+      {
+        os << (i ? "," : "") << indexes[i];
+      }
+      os << "};\n";
+      os << "    uint64_t offset = (uint64_t)(int64_t)value - (uint64_t)" << int64_literal(edefine.m_min) << ";\n";
+      os << "    return offset < " << indexes.size() << "ULL ? indexes[offset] : -1;\n";
+    }
+    else
+    {
+      os << "    switch ((int64_t)value)\n    {\n";
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        os << "    case " << int64_literal(edefine.m_items[i].m_value) << ": return " << i << ";\n";
+      }
+      os << "    default: return -1;\n    }\n";
+    }
+    os << "  }\n};\n\n";
+
+    // ahead of the generated types, their read and write find these
+    os << "ADATA_INLINE int32_t size_of(const " << full_name << "& value)\n{\n  return size_of_enum(value);\n}\n\n";
+    os << "template<typename stream_ty>\nADATA_INLINE void read(stream_ty& stream, " << full_name << "& value)\n{\n  read_enum(stream, value);\n}\n\n";
+    os << "template<typename stream_ty>\nADATA_INLINE void write(stream_ty& stream, const " << full_name << "& value)\n{\n  write_enum(stream, value);\n}\n\n";
+    os << "template<typename stream_ty>\nADATA_INLINE void skip_read(stream_ty& stream, " << full_name << " * value)\n{\n  skip_read_enum(stream, value);\n}\n\n";
+  }
+
+  void gen_traits_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    os << "template<>\nstruct is_adata<";
+    for (const auto& name : desc_define.m_namespace.m_names)
+    {
+      os << name << "::";
+    }
+    os << tdefine.m_name << ">\n{\n  static const bool value = true;\n};\n\n";
+  }
+
+  void gen_member_index_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    os << "template<>\nstruct member_index< " << desc_define.m_namespace.m_cpp_fullname << tdefine.m_name << " >\n{\n";
+    os << "  enum\n  {\n";
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        os << "    //" << member.m_name << " deleted" << std::endl;
+        continue;
+      }
+      os << "    " << member.m_name << " = " << i << "," << std::endl;
+    }
+    os << "    member_count = " << tdefine.m_members.size() << std::endl;
+    os << "  };\n};\n\n";
+  }
+
+  void gen_table_typedef(const descrip_define&, const table_define& table, std::ofstream& os)
+  {
+    os << tabs(1) << "typedef ::adata::table< " << table.m_typename << " > " << table.m_typename << "_table;" << std::endl;
+  }
+
+  void gen_table_traits(const descrip_define& desc_define, const table_define& table, std::ofstream& os)
+  {
+    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + table.m_typename;
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct table_traits< " << full_type_name << " >" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "typedef " << full_type_name << " value_type;" << std::endl;
+    os << tabs(2) << "static int64_t key(const value_type& value) { return (int64_t)value." << table.m_key << "; }" << std::endl;
+    os << tabs(2) << "static int32_t size_of(const value_type& value) { return ::adata::size_of(value); }" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  void gen_table_code(const descrip_define& desc_define, std::ofstream& os)
+  {
+    os << "namespace adata" << std::endl << "{" << std::endl;
+    for (auto& table : desc_define.m_tables)
+    {
+      gen_table_traits(desc_define, table, os);
+    }
+    os << "}" << std::endl << std::endl;
+  }
+
+  inline std::string make_transcoder_name(const descrip_define& desc_define, const std::string& from, const std::string& to)
+  {
+    return "transcoder< " + make_typename(desc_define, from) + ", " + make_typename(desc_define, to) + " >";
+  }
+
+  // index of the live member of from_define with the same name, -1 if none
+  int find_transcode_source(const type_define& from_define, const member_define& to_member)
+  {
+    if (to_member.m_deleted)
+    {
+      return -1;
+    }
+    for (std::size_t i = 0; i < from_define.m_members.size(); ++i)
+    {
+      const member_define& member = from_define.m_members[i];
+      if (member.m_name == to_member.m_name)
+      {
+        return member.m_deleted ? -1 : (int)i;
+      }
+    }
+    return -1;
+  }
+
+  // a member at its default is not in the data, the new type must be given the old default
+  // when it has another one. a nested type may nest such members too, so it is transcoded from empty
+  bool transcode_needs_default(const descrip_define& desc_define, const member_define& from_member, const member_define& to_member)
+  {
+    // an optional member not in the data is unset, not at a default
+    if (from_member.is_multi() || from_member.m_optional || to_member.m_optional)
+    {
+      return false;
+    }
+    if (from_member.m_type == e_base_type::type)
+    {
+      return transcode_member_kind(desc_define, from_member, to_member) == transcode_convert;
+    }
+    return from_member.m_default_value != to_member.m_default_value;
+  }
+
+  // a bool is only its tag bit, flipped when the new type has the other default
+  inline std::string transcode_bool_bit(const member_define& from_member, const member_define& to_member, std::size_t source)
+  {
+    if (from_member.m_default_value == to_member.m_default_value)
+    {
+      return tag_bit(source);
+    }
+    return "!(" + tag_bit(source) + ")";
+  }
+
+  void gen_transcode_default_code(const descrip_define& desc_define, const member_define& from_member, const member_define& to_member, std::ofstream& os, int tab_indent)
+  {
+    if (from_member.m_type == e_base_type::type)
+    {
+      // tag 0 and len_tag 2, a type with no member present
+      os << tabs(tab_indent) << "static const unsigned char empty_type[2] = {0,2};" << std::endl;
+      os << tabs(tab_indent) << "zero_copy_buffer field;" << std::endl;
+      os << tabs(tab_indent) << "field.set_read(empty_type,2);" << std::endl;
+      os << tabs(tab_indent) << make_transcoder_name(desc_define, from_member.m_typename, to_member.m_typename) << "::transcode(field,out);" << std::endl;
+      return;
+    }
+    // an enum is written as its integer
+    std::string to_desc = to_member.m_enum ? make_typename(desc_define, to_member.m_typename) : make_type_desc(desc_define, to_member);
+    os << tabs(tab_indent) << "out." << (to_member.m_fixed ? "fix_write_value" : "write_value")
+      << "((" << to_desc << ")" << make_type_default(desc_define, from_member) << ");" << std::endl;
+  }
+
+  // the new value of a member of a bit run of the new type, or of a member of a bit run of the old
+  // type, in a local. a member is in the data when its value isn't the new default
+  inline std::string transcode_bit_value(const member_define& from_member, const member_define& to_member, std::size_t source, std::size_t target)
+  {
+    if (to_member.m_bit_width > 0)
+    {
+      return "out_bit_value_" + std::to_string(target);
+    }
+    (void)from_member;
+    return "bit_value_" + std::to_string(source);
+  }
+
+  inline std::string transcode_bit_present(const descrip_define& desc_define, const member_define& from_member, const member_define& to_member, std::size_t source, std::size_t target)
+  {
+    std::string type_desc = make_type_desc(desc_define, to_member);
+    return "(" + type_desc + ")" + transcode_bit_value(from_member, to_member, source, target) + " != (" + type_desc + ")" + make_type_default(desc_define, to_member);
+  }
+
+  void gen_transcode_declare(const descrip_define& desc_define, const transcode_define& transcode, std::ofstream& os)
+  {
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct " << make_transcoder_name(desc_define, transcode.m_from, transcode.m_to) << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "static void transcode(zero_copy_buffer& stream, transcode_buffer& out);" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // one container element read from field
+  void gen_transcode_element_code(const descrip_define& desc_define, const type_define& from_define, const member_define& from_param, const member_define& to_param, std::ofstream& os, int tab_indent)
+  {
+    if (transcode_member_kind(desc_define, from_param, to_param) == transcode_convert)
+    {
+      os << tabs(tab_indent) << make_transcoder_name(desc_define, from_param.m_typename, to_param.m_typename) << "::transcode(field,out);" << std::endl;
+      return;
+    }
+    os << tabs(tab_indent) << "{" << std::endl;
+    os << tabs(tab_indent + 1) << "const unsigned char * begin = field.read_ptr();" << std::endl;
+    gen_adata_operator_read_skip_member_code(desc_define, from_define, from_param, os, tab_indent + 1, "", "field");
+    os << tabs(tab_indent + 1) << "out.append(begin,field.read_ptr() - begin);" << std::endl;
+    os << tabs(tab_indent) << "}" << std::endl;
+  }
+
+  void gen_transcode_type_code(const descrip_define& desc_define, const transcode_define& transcode, std::ofstream& os)
+  {
+    const type_define& from_define = *transcode.m_from_define;
+    const type_define& to_define = *transcode.m_to_define;
+    std::vector<int> sources;
+    std::vector<bool> kept(from_define.m_members.size(), false);
+    for (const auto& member : to_define.m_members)
+    {
+      int source = find_transcode_source(from_define, member);
+      sources.push_back(source);
+      if (source >= 0)
+      {
+        kept[source] = true;
+      }
+    }
+
+    os << tabs(1) << "inline void " << make_transcoder_name(desc_define, transcode.m_from, transcode.m_to) << "::transcode(zero_copy_buffer& stream, transcode_buffer& out)" << std::endl;
+    os << tabs(1) << "{" << std::endl;
+    gen_adata_read_tag(os, 2, from_define);
+
+    // first pass: find the bytes of every member kept, skip the others
+    std::size_t span_count = from_define.m_members.size();
+    if (std::find(kept.begin(), kept.end(), true) != kept.end())
+    {
+      os << tabs(2) << "const unsigned char * span[" << span_count << "] = {0};" << std::endl;
+      os << tabs(2) << "::std::size_t span_len[" << span_count << "] = {0};" << std::endl;
+    }
+    for (std::size_t i = 0; i < span_count; ++i)
+    {
+      const member_define& member = from_define.m_members[i];
+      if (kept[i] && member.m_bit_width > 0)
+      {
+        os << tabs(2) << make_type_desc(desc_define, member) << " bit_value_" << i << " = (" << make_type_desc(desc_define, member) << ")" << make_type_default(desc_define, member) << ";" << std::endl;
+      }
+    }
+    for (std::size_t i = 0; i < span_count; ++i)
+    {
+      const member_define& member = from_define.m_members[i];
+      if (i == tag_members)
+      {
+        gen_adata_read_ext_tag(os, 2, from_define);
+      }
+      if (member.m_bit_width > 0)
+      {
+        // the members kept are decoded, a bit run is packed again
+        if (is_bit_run_start(from_define, i))
+        {
+          std::size_t end = bit_run_end(from_define, i);
+          os << tabs(2) << "if(" << bit_run_present(i, end) << ")" << std::endl;
+          os << tabs(2) << "{" << std::endl;
+          os << tabs(3) << "bit_reader<zero_copy_buffer> bits(stream);" << std::endl;
+          for (std::size_t r = i; r < end; ++r)
+          {
+            os << tabs(3) << "if(" << tag_bit(r) << "){";
+            if (kept[r])
+            {
+              os << bit_read_code(from_define.m_members[r], "bit_value_" + std::to_string(r));
+            }
+            else
+            {
+              os << "bits.skip(" << from_define.m_members[r].m_bit_width << ");";
+            }
+            os << "}" << std::endl;
+          }
+          os << tabs(2) << "}" << std::endl;
+        }
+        continue;
+      }
+      if (kept[i])
+      {
+        os << tabs(2) << "if(" << tag_bit(i) << ")" << std::endl;
+        os << tabs(2) << "{" << std::endl;
+        os << tabs(3) << "span[" << i << "] = stream.read_ptr();" << std::endl;
+        gen_adata_operator_read_skip_member_code(desc_define, from_define, member, os, 3, "");
+        os << tabs(3) << "span_len[" << i << "] = stream.read_ptr() - span[" << i << "];" << std::endl;
+        os << tabs(2) << "}" << std::endl;
+      }
+      else
+      {
+        os << tabs(2) << "if(" << tag_bit(i) << ")";
+        gen_adata_operator_read_skip_member_code(desc_define, from_define, member, os, 2, "");
+      }
+    }
+    gen_adata_len_tag_jump(os, 2);
+    os << std::endl;
+
+    // the values of the members of bit runs of the new type
+    for (std::size_t j = 0; j < to_define.m_members.size(); ++j)
+    {
+      const member_define& to_member = to_define.m_members[j];
+      if (sources[j] < 0 || to_member.m_bit_width == 0)
+      {
+        continue;
+      }
+      const member_define& from_member = from_define.m_members[sources[j]];
+      std::string to_desc = make_type_desc(desc_define, to_member);
+      if (from_member.m_bit_width > 0)
+      {
+        os << tabs(2) << to_desc << " out_bit_value_" << j << " = (" << to_desc << ")bit_value_" << sources[j] << ";" << std::endl;
+        continue;
+      }
+      std::string from_desc = make_type_desc(desc_define, from_member);
+      os << tabs(2) << to_desc << " out_bit_value_" << j << " = (" << to_desc << ")" << make_type_default(desc_define, from_member) << ";" << std::endl;
+      os << tabs(2) << "if(" << tag_bit(sources[j]) << ")" << std::endl;
+      os << tabs(2) << "{" << std::endl;
+      os << tabs(3) << "zero_copy_buffer field;" << std::endl;
+      os << tabs(3) << "field.set_read(span[" << sources[j] << "],span_len[" << sources[j] << "]);" << std::endl;
+      os << tabs(3) << from_desc << " item = 0;" << std::endl;
+      os << tabs(3) << (from_member.m_fixed ? "fix_read" : "read") << "(field,item);" << std::endl;
+      os << tabs(3) << "out_bit_value_" << j << " = (" << to_desc << ")item;" << std::endl;
+      os << tabs(2) << "}" << std::endl;
+    }
+
+    // second pass: write them in the order of the new type
+    os << tabs(2) << "::std::size_t header = out.begin_type();" << std::endl;
+    os << tabs(2) << tag_type(to_define) << " out_tag = 0;" << std::endl;
+    if (is_wide_type(to_define))
+    {
+      os << tabs(2) << "uint64_t out_ext_tag[" << ext_tag_count(to_define) << "] = {0};" << std::endl;
+    }
+    for (std::size_t j = 0; j < to_define.m_members.size(); ++j)
+    {
+      if (j == tag_members)
+      {
+        // presence of the members from 63 on goes in front of them
+        for (std::size_t k = j; k < to_define.m_members.size(); ++k)
+        {
+          if (sources[k] >= 0 && (to_define.m_members[k].m_bit_width > 0 || from_define.m_members[sources[k]].m_bit_width > 0))
+          {
+            os << tabs(2) << "if(" << transcode_bit_present(desc_define, from_define.m_members[sources[k]], to_define.m_members[k], sources[k], k) << "){" << tag_set(k, "out_tag", "out_ext_tag") << "}" << std::endl;
+          }
+          else if (sources[k] >= 0 && to_define.m_members[k].m_type == e_base_type::boolean)
+          {
+            os << tabs(2) << "if(" << transcode_bool_bit(from_define.m_members[sources[k]], to_define.m_members[k], sources[k]) << "){" << tag_set(k, "out_tag", "out_ext_tag") << "}" << std::endl;
+          }
+          else if (sources[k] >= 0 && transcode_needs_default(desc_define, from_define.m_members[sources[k]], to_define.m_members[k]))
+          {
+            os << tabs(2) << tag_set(k, "out_tag", "out_ext_tag") << std::endl;
+          }
+          else if (sources[k] >= 0)
+          {
+            os << tabs(2) << "if(" << tag_bit(sources[k]) << "){" << tag_set(k, "out_tag", "out_ext_tag") << "}" << std::endl;
+          }
+        }
+        os << tabs(2) << "if(";
+        for (std::size_t w = 0; w < ext_tag_count(to_define); ++w)
+        {
+          os << (w ? " || " : "") << "out_ext_tag[" << w << "]";
+        }
+        os << "){out_tag|=ext_tag_bit;out.write_ext_tag(out_ext_tag," << ext_tag_count(to_define) << ");}" << std::endl;
+      }
+      int source = sources[j];
+      const member_define& to_member = to_define.m_members[j];
+      if (to_member.m_bit_width > 0)
+      {
+        if (is_bit_run_start(to_define, j))
+        {
+          std::size_t end = bit_run_end(to_define, j);
+          os << tabs(2) << "{" << std::endl;
+          os << tabs(3) << "int32_t bit_count = 0;" << std::endl;
+          for (std::size_t r = j; r < end; ++r)
+          {
+            if (sources[r] < 0)
+            {
+              continue;
+            }
+            os << tabs(3) << "if(" << transcode_bit_present(desc_define, from_define.m_members[sources[r]], to_define.m_members[r], sources[r], r) << "){"
+              << (r < tag_members ? tag_set(r, "out_tag", "out_ext_tag") : "") << "bit_count += " << to_define.m_members[r].m_bit_width << ";}" << std::endl;
+          }
+          os << tabs(3) << "if(bit_count > 0)" << std::endl;
+          os << tabs(3) << "{" << std::endl;
+          os << tabs(4) << "zero_copy_buffer bits_out;" << std::endl;
+          os << tabs(4) << "out.reserve_write(bits_out,(::std::size_t)size_of_bit_run(bit_count));" << std::endl;
+          os << tabs(4) << "bit_writer<zero_copy_buffer> bits(bits_out);" << std::endl;
+          for (std::size_t r = j; r < end; ++r)
+          {
+            if (sources[r] < 0)
+            {
+              continue;
+            }
+            os << tabs(4) << "if(" << transcode_bit_present(desc_define, from_define.m_members[sources[r]], to_define.m_members[r], sources[r], r) << "){" << bit_write_code(to_define.m_members[r], "out_bit_value_" + std::to_string(r)) << "}" << std::endl;
+          }
+          os << tabs(4) << "bits.flush();" << std::endl;
+          os << tabs(3) << "}" << std::endl;
+          os << tabs(2) << "}" << std::endl;
+        }
+        continue;
+      }
+      if (source < 0)
+      {
+        continue;
+      }
+      const member_define& from_member = from_define.m_members[source];
+      std::string out_set = tag_set(j, "out_tag", "out_ext_tag");
+      if (from_member.m_bit_width > 0)
+      {
+        std::string to_desc = make_type_desc(desc_define, to_member);
+        os << tabs(2) << "if(" << transcode_bit_present(desc_define, from_member, to_member, source, j) << "){" << out_set
+          << "out." << (to_member.m_fixed ? "fix_write_value" : "write_value") << "((" << to_desc << ")bit_value_" << source << ");}" << std::endl;
+        continue;
+      }
+      if (to_member.m_type == e_base_type::boolean)
+      {
+        if (j < tag_members)
+        {
+          os << tabs(2) << "if(" << transcode_bool_bit(from_member, to_member, source) << "){" << out_set << "}" << std::endl;
+        }
+        continue;
+      }
+      if (transcode_member_kind(desc_define, from_member, to_member) == transcode_copy)
+      {
+        os << tabs(2) << "if(" << tag_bit(source) << "){" << out_set << "out.append(span[" << source << "],span_len[" << source << "]);}" << std::endl;
+        if (transcode_needs_default(desc_define, from_member, to_member))
+        {
+          os << tabs(2) << "else" << std::endl;
+          os << tabs(2) << "{" << std::endl;
+          os << tabs(3) << out_set << std::endl;
+          gen_transcode_default_code(desc_define, from_member, to_member, os, 3);
+          os << tabs(2) << "}" << std::endl;
+        }
+        continue;
+      }
+      os << tabs(2) << "if(" << tag_bit(source) << ")" << std::endl;
+      os << tabs(2) << "{" << std::endl;
+      os << tabs(3) << out_set << std::endl;
+      os << tabs(3) << "zero_copy_buffer field;" << std::endl;
+      os << tabs(3) << "field.set_read(span[" << source << "],span_len[" << source << "]);" << std::endl;
+      if (from_member.m_type == e_base_type::type)
+      {
+        os << tabs(3) << make_transcoder_name(desc_define, from_member.m_typename, to_member.m_typename) << "::transcode(field,out);" << std::endl;
+      }
+      else
+      {
+        if (from_member.m_sized)
+        {
+          os << tabs(3) << "{int32_t payload_len = 0;read(field,payload_len);}" << std::endl;
+        }
+        if (to_member.m_sized)
+        {
+          os << tabs(3) << "::std::size_t payload = out.begin_sized();" << std::endl;
+        }
+        if (from_member.m_columnar || to_member.m_columnar)
+        {
+          // decode the elements and write them in the other layout
+          os << tabs(3) << "::std::vector< " << make_type_desc(desc_define, from_member.m_template_parameters[0]) << " > items;" << std::endl;
+          if (from_member.m_columnar)
+          {
+            os << tabs(3) << "read_columnar(field,items);" << std::endl;
+          }
+          else
+          {
+            os << tabs(3) << "items.resize(check_read_size(field));" << std::endl;
+            os << tabs(3) << "for (::std::size_t i = 0 ; i < items.size() ; ++i){read(field,items[i]);}" << std::endl;
+          }
+          os << tabs(3) << "zero_copy_buffer items_out;" << std::endl;
+          if (to_member.m_columnar)
+          {
+            os << tabs(3) << "out.reserve_write(items_out,(::std::size_t)size_of_columnar(items));" << std::endl;
+            os << tabs(3) << "write_columnar(items_out,items);" << std::endl;
+          }
+          else
+          {
+            os << tabs(3) << "int32_t len = (int32_t)items.size();" << std::endl;
+            os << tabs(3) << "int32_t size = size_of(len);" << std::endl;
+            os << tabs(3) << "for (int32_t i = 0 ; i < len ; ++i){size += size_of(items[i]);}" << std::endl;
+            os << tabs(3) << "out.reserve_write(items_out,(::std::size_t)size);" << std::endl;
+            os << tabs(3) << "write(items_out,len);" << std::endl;
+            os << tabs(3) << "for (int32_t i = 0 ; i < len ; ++i){write(items_out,items[i]);}" << std::endl;
+          }
+        }
+        else if (from_member.m_encoding != list_plain || to_member.m_encoding != list_plain)
+        {
+          // decode the integers and encode them again
+          os << tabs(3) << make_type_desc(desc_define, from_member) << " items;" << std::endl;
+          os << tabs(3) << "read_list(field,items," << list_encoding_name(from_member.m_encoding) << ");" << std::endl;
+          os << tabs(3) << make_type_desc(desc_define, to_member) << " out_items(items.begin(),items.end());" << std::endl;
+          os << tabs(3) << "out.write_list(out_items," << list_encoding_name(to_member.m_encoding) << ");" << std::endl;
+        }
+        else
+        {
+          os << tabs(3) << "int32_t len = check_read_size(field);" << std::endl;
+          os << tabs(3) << "out.write_value(len);" << std::endl;
+          os << tabs(3) << "for (int32_t i = 0 ; i < len ; ++i)" << std::endl;
+          os << tabs(3) << "{" << std::endl;
+          for (std::size_t p = 0; p < from_member.m_template_parameters.size(); ++p)
+          {
+            gen_transcode_element_code(desc_define, from_define, from_member.m_template_parameters[p], to_member.m_template_parameters[p], os, 4);
+          }
+          os << tabs(3) << "}" << std::endl;
+        }
+        if (to_member.m_sized)
+        {
+          os << tabs(3) << "out.end_sized(payload);" << std::endl;
+        }
+      }
+      os << tabs(2) << "}" << std::endl;
+      if (transcode_needs_default(desc_define, from_member, to_member))
+      {
+        os << tabs(2) << "else" << std::endl;
+        os << tabs(2) << "{" << std::endl;
+        os << tabs(3) << out_set << std::endl;
+        gen_transcode_default_code(desc_define, from_member, to_member, os, 3);
+        os << tabs(2) << "}" << std::endl;
+      }
+    }
+    os << tabs(2) << "out.end_type(header,out_tag);" << std::endl;
+    os << tabs(1) << "}" << std::endl << std::endl;
+  }
+
+  void gen_transcode_code(const descrip_define& desc_define, std::ofstream& os)
+  {
+    os << "namespace adata" << std::endl << "{" << std::endl;
+    // declare all first, nested transcodes may refer to each other in any order
+    for (auto& transcode : desc_define.m_transcodes)
+    {
+      gen_transcode_declare(desc_define, transcode, os);
+    }
+    for (auto& transcode : desc_define.m_transcodes)
+    {
+      gen_transcode_type_code(desc_define, transcode, os);
+    }
+    os << "}" << std::endl << std::endl;
+  }
+
+  // bytes of a number in a flat record, a fix_ integer as the plain one and a bool as one byte
+  inline int flat_number_size(e_base_type type)
+  {
+    if (type >= e_base_type::fix_int8 && type <= e_base_type::fix_uint64)
+    {
+      type = (e_base_type)(type + e_base_type::int8 - e_base_type::fix_int8);
+    }
+    switch (type)
+    {
+    case e_base_type::boolean: return 1;
+    case e_base_type::float32: return 4;
+    case e_base_type::float64: return 8;
+    default: return 1 << ((type - e_base_type::int8) / 2);
+    }
+  }
+
+  // a list, map or array element, or a member read as one, see adata::flat_scalar
+  inline std::string flat_slot_type(const descrip_define& desc_define, const member_define& mdefine)
+  {
+    if (mdefine.m_enum)
+    {
+      return "::adata::flat_enum< " + make_enum_typename(desc_define, mdefine.m_enum_name) + ", " + make_typename(desc_define, mdefine.m_typename) + " >";
+    }
+    if (mdefine.m_type == e_base_type::string)
+    {
+      return "::adata::flat_string";
+    }
+    if (mdefine.m_type == e_base_type::type)
+    {
+      return make_typename(desc_define, mdefine.m_typename) + "_flat";
+    }
+    return "::adata::flat_scalar< " + make_typename(desc_define, mdefine.m_typename) + " >";
+  }
+
+  // a string or type is the offset of its block
+  inline int flat_slot_size(const member_define& mdefine)
+  {
+    if (mdefine.m_type == e_base_type::string || mdefine.m_type == e_base_type::type)
+    {
+      return 4;
+    }
+    return flat_number_size(mdefine.m_type);
+  }
+
+  // an optional number is a presence byte, padded to the size of the number, then the number
+  inline void flat_member_layout(const member_define& mdefine, int& size, int& align)
+  {
+    switch (mdefine.m_type)
+    {
+    case e_base_type::list:
+    case e_base_type::map:
+    {
+      size = align = 4;
+      return;
+    }
+    case e_base_type::bits:
+    {
+      size = (std::atoi(mdefine.m_size.c_str()) + 7) / 8;
+      align = 1;
+      return;
+    }
+    case e_base_type::array:
+    {
+      align = flat_slot_size(mdefine.m_template_parameters[0]);
+      size = align * std::atoi(mdefine.m_size.c_str());
+      return;
+    }
+    default:
+    {
+      break;
+    }
+    }
+    size = align = flat_slot_size(mdefine);
+    if (mdefine.m_optional && mdefine.m_type != e_base_type::string && mdefine.m_type != e_base_type::type)
+    {
+      size *= 2;
+    }
+  }
+
+  // members in declared order each aligned to its size, -1 for a deleted one
+  struct flat_layout
+  {
+    std::vector<int> offsets;
+    int size;
+    int align;
+  };
+
+  inline flat_layout make_flat_layout(const type_define& tdefine)
+  {
+    flat_layout layout;
+    layout.size = 0;
+    layout.align = 1;
+    for (const auto& member : tdefine.m_members)
+    {
+      if (member.m_deleted)
+      {
+        layout.offsets.push_back(-1);
+        continue;
+      }
+      int size = 0;
+      int align = 1;
+      flat_member_layout(member, size, align);
+      layout.size = (layout.size + align - 1) / align * align;
+      layout.offsets.push_back(layout.size);
+      layout.size += size;
+      layout.align = std::max(layout.align, align);
+    }
+    layout.size = (layout.size + layout.align - 1) / layout.align * layout.align;
+    return layout;
+  }
+
+  uint32_t flat_layout_hash(const descrip_define& desc_define, const type_define& tdefine);
+
+  // an element as the layout hash sees it, an enum is its integer and a type its own hash
+  inline std::string flat_element_desc(const descrip_define& desc_define, const member_define& mdefine)
+  {
+    if (mdefine.m_type == e_base_type::type)
+    {
+      return std::to_string(flat_layout_hash(desc_define, *desc_define.find_decl_type(mdefine.m_typename)));
+    }
+    if (mdefine.m_type == e_base_type::string)
+    {
+      return "string";
+    }
+    return make_typename(desc_define, mdefine.m_typename);
+  }
+
+  // fnv-1a of the names, types and offsets of the members, a reader of another layout is refused
+  uint32_t flat_layout_hash(const descrip_define& desc_define, const type_define& tdefine)
+  {
+    flat_layout layout = make_flat_layout(tdefine);
+    std::string desc;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        continue;
+      }
+      desc += member.m_name + "@" + std::to_string(layout.offsets[i]) + ":" + (member.m_optional ? "?" : "");
+      if (member.is_container() || member.m_type == e_base_type::bits)
+      {
+        desc += member.m_typename + "<";
+        for (const auto& ptype : member.m_template_parameters)
+        {
+          desc += flat_element_desc(desc_define, ptype) + ",";
+        }
+        desc += member.m_size + ">;";
+      }
+      else
+      {
+        desc += flat_element_desc(desc_define, member) + ";";
+      }
+    }
+    uint32_t hash = 2166136261U;
+    for (auto c : desc)
+    {
+      hash = (hash ^ (uint8_t)c) * 16777619U;
+    }
+    return hash;
+  }
+
+  void gen_flat_view_member_code(const descrip_define& desc_define, const member_define& mdefine, int offset, std::ofstream& os)
+  {
+    std::string at = "m_offset + " + std::to_string(offset);
+    const std::string& name = mdefine.m_name;
+    std::string type;
+    if (mdefine.m_type == e_base_type::list || mdefine.m_type == e_base_type::array)
+    {
+      type = "::adata::flat_list< " + flat_slot_type(desc_define, mdefine.m_template_parameters[0]) + " >";
+    }
+    else if (mdefine.m_type == e_base_type::map)
+    {
+      type = "::adata::flat_map< " + flat_slot_type(desc_define, mdefine.m_template_parameters[0]) + ", " + flat_slot_type(desc_define, mdefine.m_template_parameters[1]) + " >";
+    }
+    switch (mdefine.m_type)
+    {
+    case e_base_type::list:
+    case e_base_type::map:
+    {
+      os << tabs(2) << type << " " << name << "() const { return " << type << "(m_base, ::adata::flat_load<uint32_t>(m_base + " << at << ")); }" << std::endl;
+      return;
+    }
+    case e_base_type::array:
+    {
+      os << tabs(2) << type << " " << name << "() const { return " << type << "(m_base, " << at << ", " << mdefine.m_size << "); }" << std::endl;
+      return;
+    }
+    case e_base_type::bits:
+    {
+      type = "::adata::flat_bits< " + mdefine.m_size + " >";
+      os << tabs(2) << type << " " << name << "() const { return " << type << "(m_base + " << at << "); }" << std::endl;
+      return;
+    }
+    default:
+    {
+      break;
+    }
+    }
+    if (mdefine.m_enum)
+    {
+      type = make_enum_typename(desc_define, mdefine.m_enum_name);
+    }
+    else if (mdefine.m_type == e_base_type::string)
+    {
+      type = "::adata::flat_string";
+    }
+    else if (mdefine.m_type == e_base_type::type)
+    {
+      type = make_typename(desc_define, mdefine.m_typename) + "_flat";
+    }
+    else
+    {
+      type = make_typename(desc_define, mdefine.m_typename);
+    }
+    if (mdefine.m_optional)
+    {
+      if (mdefine.m_type == e_base_type::string || mdefine.m_type == e_base_type::type)
+      {
+        os << tabs(2) << "bool has_" << name << "() const { return ::adata::flat_load<uint32_t>(m_base + " << at << ") != 0; }" << std::endl;
+      }
+      else
+      {
+        os << tabs(2) << "bool has_" << name << "() const { return m_base[" << at << "] != 0; }" << std::endl;
+        at = "m_offset + " + std::to_string(offset + flat_slot_size(mdefine));
+      }
+    }
+    os << tabs(2) << type << " " << name << "() const { return " << flat_slot_type(desc_define, mdefine) << "::load_slot(m_base, " << at << "); }" << std::endl;
+  }
+
+  // a view is a pointer to the buffer and the offset of a record, it is a type slot of a list or map as well
+  void gen_code_flat_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  {
+    std::string name = tdefine.m_name + "_flat";
+    flat_layout layout = make_flat_layout(tdefine);
+    os << tabs(1) << "struct " << name << std::endl << "  {" << std::endl;
+    os << tabs(2) << "typedef " << name << " value_type;" << std::endl;
+    os << tabs(2) << "static const uint32_t slot_size = 4;" << std::endl << std::endl;
+    os << tabs(2) << name << "() : m_base(0), m_offset(0) {}" << std::endl;
+    os << tabs(2) << name << "(const char * base, uint32_t offset) : m_base(base), m_offset(offset) {}" << std::endl;
+    os << tabs(2) << "static " << name << " load_slot(const char * base, uint32_t offset) { return " << name << "(base, ::adata::flat_load<uint32_t>(base + offset)); }" << std::endl << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      const member_define& member = tdefine.m_members[i];
+      if (member.m_deleted)
+      {
+        os << tabs(2) << "//" << member.m_name << " deleted" << std::endl;
+        continue;
+      }
+      gen_flat_view_member_code(desc_define, member, layout.offsets[i], os);
+    }
+    os << tabs(1) << "private:" << std::endl;
+    os << tabs(2) << "const char * m_base;" << std::endl;
+    os << tabs(2) << "uint32_t m_offset;" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
+  }
+
+  // write an element of a list, map or array into its slot at at
+  void gen_flat_write_element_code(const descrip_define& desc_define, const member_define& param, std::ofstream& os, int tab_indent, const std::string& at, const std::string& var_name)
+  {
+    if (param.m_type == e_base_type::string)
+    {
+      os << tabs(tab_indent) << "out.put(" << at << ", out.add_string(" << var_name << ".data(), " << var_name << ".size()));" << std::endl;
+    }
+    else if (param.m_type == e_base_type::type)
+    {
+      os << tabs(tab_indent) << "out.put(" << at << ", out.add(" << var_name << "));" << std::endl;
+    }
+    else if (param.m_type == e_base_type::boolean)
+    {
+      os << tabs(tab_indent) << "out.put(" << at << ", (bool)" << var_name << ");" << std::endl;
+    }
+    else
+    {
+      os << tabs(tab_indent) << "out.put(" << at << ", (" << make_typename(desc_define, param.m_typename) << ")" << var_name << ");" << std::endl;
+    }
+  }
+
+  void gen_flat_write_member_code(const descrip_define& desc_define, const member_define& mdefine, int offset, std::ofstream& os, int tab_indent)
+  {
+    std::string at = "offset + " + std::to_string(offset);
+    std::string var_name = "value." + mdefine.m_name;
+    switch (mdefine.m_type)
+    {
+    case e_base_type::list:
+    {
+      const member_define& param = mdefine.m_template_parameters[0];
+      std::string size = std::to_string(flat_slot_size(param));
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t list = out.add_list(" << var_name << ".size(), " << size << ");" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t at = list + ::adata::flat_block_header_size;" << std::endl;
+      os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i, at += " << size << ")" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      gen_flat_write_element_code(desc_define, param, os, tab_indent + 2, "at", "(*i)");
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent + 1) << "out.put(" << at << ", list);" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::map:
+    {
+      const member_define& key = mdefine.m_template_parameters[0];
+      const member_define& param = mdefine.m_template_parameters[1];
+      std::string key_size = std::to_string(flat_slot_size(key));
+      std::string size = std::to_string(flat_slot_size(param));
+      std::string iterator = make_type_desc(desc_define, mdefine) + "::const_iterator";
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "::std::vector< " << iterator << " > items;" << std::endl;
+      os << tabs(tab_indent + 1) << "items.reserve(" << var_name << ".size());" << std::endl;
+      os << tabs(tab_indent + 1) << "for (" << iterator << " i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      os << tabs(tab_indent + 2) << "items.push_back(i);" << std::endl;
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent + 1) << "::std::sort(items.begin(), items.end(), ::adata::flat_key_less());" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t map = out.add_map(items.size(), " << key_size << ", " << size << ");" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t key_at = map + ::adata::flat_block_header_size;" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t value_at = map + ::adata::flat_map_values((uint32_t)items.size(), " << key_size << ");" << std::endl;
+      os << tabs(tab_indent + 1) << "for (::std::size_t k = 0; k < items.size(); ++k, key_at += " << key_size << ", value_at += " << size << ")" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      gen_flat_write_element_code(desc_define, key, os, tab_indent + 2, "key_at", "items[k]->first");
+      gen_flat_write_element_code(desc_define, param, os, tab_indent + 2, "value_at", "items[k]->second");
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent + 1) << "out.put(" << at << ", map);" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::array:
+    {
+      const member_define& param = mdefine.m_template_parameters[0];
+      std::string size = std::to_string(flat_slot_size(param));
+      os << tabs(tab_indent) << "for (uint32_t k = 0; k < " << mdefine.m_size << "; ++k)" << std::endl;
+      os << tabs(tab_indent) << "{" << std::endl;
+      gen_flat_write_element_code(desc_define, param, os, tab_indent + 1, at + " + k * " + size, var_name + "[k]");
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::bits:
+    {
+      os << tabs(tab_indent) << "for (::std::size_t k = 0; k < " << mdefine.m_size << "; ++k)" << std::endl;
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "if (" << var_name << "[k]) out.set_bit(" << at << ", k);" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    default:
+    {
+      break;
+    }
+    }
+    if (!mdefine.m_optional)
+    {
+      gen_flat_write_element_code(desc_define, mdefine, os, tab_indent, at, var_name);
+      return;
+    }
+    os << tabs(tab_indent) << "if (" << var_name << ".has_value())" << std::endl;
+    os << tabs(tab_indent) << "{" << std::endl;
+    if (mdefine.m_type == e_base_type::string)
+    {
+      // an optional string that is set has a block even when it is empty
+      os << tabs(tab_indent + 1) << "out.put(" << at << ", out.add_string((*" << var_name << ").data(), (*" << var_name << ").size(), true));" << std::endl;
+    }
+    else if (mdefine.m_type == e_base_type::type)
+    {
+      gen_flat_write_element_code(desc_define, mdefine, os, tab_indent + 1, at, "(*" + var_name + ")");
+    }
+    else
+    {
+      os << tabs(tab_indent + 1) << "out.put(" << at << ", true);" << std::endl;
+      gen_flat_write_element_code(desc_define, mdefine, os, tab_indent + 1, "offset + " + std::to_string(offset + flat_slot_size(mdefine)), "(*" + var_name + ")");
     }
+    os << tabs(tab_indent) << "}" << std::endl;
   }
 
-  inline void gen_adata_raw_read_member_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent)
+  // read an element of a list, map or array into var_name
+  void gen_flat_read_element_code(const descrip_define& desc_define, const member_define& param, std::ofstream& os, int tab_indent, const std::string& source, const std::string& var_name)
   {
-    std::string var_name = "value.";
-    var_name += mdefine.m_name;
-
-    if (mdefine.m_deleted == false)
+    if (param.m_type == e_base_type::string)
     {
-      gen_adata_operator_raw_read_member_code(desc_define, tdefine, mdefine, os, tab_indent, var_name);
+      os << tabs(tab_indent) << "{ ::adata::flat_string s = " << source << "; " << var_name << ".assign(s.data(), s.size()); }" << std::endl;
     }
-  }
-
-  void gen_adata_operator_raw_read_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
-  {
-    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << "template<typename stream_ty>" << std::endl;
-    os << tabs(1) << gen_inline_code(tdefine) << "void raw_read( stream_ty& stream, " << full_type_name << "& value)" << std::endl;
-    os << tabs(1) << "{" << std::endl;
-
-    for (const auto& member : tdefine.m_members)
+    else if (param.m_type == e_base_type::type)
     {
-      gen_adata_raw_read_member_code(desc_define, tdefine, member, os, 2);
+      os << tabs(tab_indent) << "::adata::flat_traits< " << make_typename(desc_define, param.m_typename) << " >::read(" << source << ", " << var_name << ");" << std::endl;
+    }
+    else
+    {
+      os << tabs(tab_indent) << var_name << " = " << source << ";" << std::endl;
     }
-
-    os << tabs(1) << "}" << std::endl << std::endl;
   }
 
-  void gen_member_raw_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
+  void gen_flat_read_member_code(const descrip_define& desc_define, const member_define& mdefine, std::ofstream& os, int tab_indent)
   {
-    if (mdefine.is_multi())
+    std::string source = "view." + mdefine.m_name + "()";
+    std::string var_name = "value." + mdefine.m_name;
+    switch (mdefine.m_type)
     {
+    case e_base_type::list:
+    {
+      const member_define& param = mdefine.m_template_parameters[0];
       os << tabs(tab_indent) << "{" << std::endl;
-      ++tab_indent;
-      os << tabs(tab_indent) << "int32_t len = (int32_t)(" << var_name << ").size();" << std::endl;
-      os << tabs(tab_indent) << "size += size_of(len);" << std::endl;
-      if (mdefine.m_type == e_base_type::string)
-      {
-        os << tabs(tab_indent) << "size += len;";
-        os << std::endl;
-      }
-      else if (mdefine.m_type == e_base_type::list)
+      os << tabs(tab_indent + 1) << "::adata::flat_list< " << flat_slot_type(desc_define, param) << " > list = " << source << ";" << std::endl;
+      if (mdefine.m_encoding == list_bitmap)
       {
-        os << tabs(tab_indent) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
-        os << tabs(tab_indent) << "{" << std::endl;
-        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, "*i");
-        os << tabs(tab_indent) << "}";
-        os << std::endl;
+        os << tabs(tab_indent + 1) << var_name << ".clear();" << std::endl;
+        os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < list.size(); ++k)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        os << tabs(tab_indent + 2) << var_name << ".insert(list[k]);" << std::endl;
+        os << tabs(tab_indent + 1) << "}" << std::endl;
       }
-      else if (mdefine.m_type == e_base_type::map)
+      else
       {
-        os << tabs(tab_indent) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
-        os << tabs(tab_indent) << "{" << std::endl;
-        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 1, "i->first");
-        gen_member_raw_size_of_type_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 1, "i->second");
-        os << tabs(tab_indent) << "}";
-        os << std::endl;
+        os << tabs(tab_indent + 1) << var_name << ".resize(list.size());" << std::endl;
+        os << tabs(tab_indent + 1) << make_type_desc(desc_define, mdefine) << "::iterator i = " << var_name << ".begin();" << std::endl;
+        os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < list.size(); ++k, ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "{" << std::endl;
+        gen_flat_read_element_code(desc_define, param, os, tab_indent + 2, "list[k]", "(*i)");
+        os << tabs(tab_indent + 1) << "}" << std::endl;
       }
-      --tab_indent;
       os << tabs(tab_indent) << "}" << std::endl;
+      return;
     }
-    else
+    case e_base_type::map:
     {
-      os << tabs(tab_indent);
-      os << "size += ";
-      if(mdefine.m_type == e_base_type::type)
+      const member_define& key = mdefine.m_template_parameters[0];
+      const member_define& param = mdefine.m_template_parameters[1];
+      std::string type_desc = make_type_desc(desc_define, mdefine);
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "::adata::flat_map< " << flat_slot_type(desc_define, key) << ", " << flat_slot_type(desc_define, param) << " > map = " << source << ";" << std::endl;
+      os << tabs(tab_indent + 1) << var_name << ".clear();" << std::endl;
+      os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < map.size(); ++k)" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      os << tabs(tab_indent + 2) << type_desc << "::key_type key;" << std::endl;
+      gen_flat_read_element_code(desc_define, key, os, tab_indent + 2, "map.key(k)", "key");
+      os << tabs(tab_indent + 2) << type_desc << "::mapped_type& item = " << var_name << "[key];" << std::endl;
+      gen_flat_read_element_code(desc_define, param, os, tab_indent + 2, "map.value(k)", "item");
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::array:
+    {
+      const member_define& param = mdefine.m_template_parameters[0];
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "::adata::flat_list< " << flat_slot_type(desc_define, param) << " > list = " << source << ";" << std::endl;
+      os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < " << mdefine.m_size << "; ++k)" << std::endl;
+      os << tabs(tab_indent + 1) << "{" << std::endl;
+      gen_flat_read_element_code(desc_define, param, os, tab_indent + 2, "list[k]", var_name + "[k]");
+      os << tabs(tab_indent + 1) << "}" << std::endl;
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::bits:
+    {
+      os << tabs(tab_indent) << var_name << " = " << source << ".to_bitset();" << std::endl;
+      return;
+    }
+    default:
+    {
+      break;
+    }
+    }
+    if (!mdefine.m_optional)
+    {
+      gen_flat_read_element_code(desc_define, mdefine, os, tab_indent, source, var_name);
+      return;
+    }
+    os << tabs(tab_indent) << "if (view.has_" << mdefine.m_name << "())" << std::endl;
+    os << tabs(tab_indent) << "{" << std::endl;
+    os << tabs(tab_indent + 1) << var_name << ".emplace();" << std::endl;
+    gen_flat_read_element_code(desc_define, mdefine, os, tab_indent + 1, source, "(*" + var_name + ")");
+    os << tabs(tab_indent) << "}" << std::endl;
+    os << tabs(tab_indent) << "else" << std::endl;
+    os << tabs(tab_indent) << "{" << std::endl;
+    os << tabs(tab_indent + 1) << var_name << ".reset();" << std::endl;
+    os << tabs(tab_indent) << "}" << std::endl;
+  }
+
+  // check the string or type of a slot at at, numbers are in bounds with their record
+  void gen_flat_verify_element_code(const descrip_define& desc_define, const member_define& param, std::ofstream& os, int tab_indent, const std::string& at, bool optional = false)
+  {
+    if (param.m_type == e_base_type::string)
+    {
+      os << tabs(tab_indent) << "if (!v.string(v.ref(" << at << "))) return false;" << std::endl;
+    }
+    else if (param.m_type == e_base_type::type)
+    {
+      std::string check = "::adata::flat_traits< " + make_typename(desc_define, param.m_typename) + " >::verify(v, v.ref(" + at + "), depth + 1)";
+      if (optional)
       {
-        os << "raw_size_of(" << var_name << ");" << std::endl;
+        os << tabs(tab_indent) << "if (v.ref(" << at << ") && !" << check << ") return false;" << std::endl;
       }
       else
       {
-        if (mdefine.m_fixed)
-        {
-          os << "fix_";
-        }
-        os << "size_of(" << var_name << ");" << std::endl;
+        os << tabs(tab_indent) << "if (!" << check << ") return false;" << std::endl;
       }
     }
   }
 
-  void gen_adata_operator_raw_size_of_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  inline bool is_flat_block(const member_define& param)
   {
-    std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << gen_inline_code(tdefine) << "int32_t raw_size_of(const " << full_type_name << "& value)" << std::endl;
-    os << tabs(1) << "{" << std::endl;
-
-    os << tabs(2) << "int32_t size = 0;" << std::endl;
-
-    for (const auto& member : tdefine.m_members)
-    {
-      std::string var_name = "value.";
-      var_name += member.m_name;
-      if (member.m_deleted == false)
-      {
-        gen_member_raw_size_of_type_code(desc_define, tdefine, member, os, 2, var_name);
-      }
-    }
-    os << tabs(2) << "return size;" << std::endl;
-    os << tabs(1) << "}" << std::endl << std::endl;
+    return param.m_type == e_base_type::string || param.m_type == e_base_type::type;
   }
 
-  void gen_member_raw_write_type_code(const descrip_define& desc_define, const type_define& tdefine, const member_define& mdefine, std::ofstream& os, int tab_indent, const std::string& var_name)
+  void gen_flat_verify_member_code(const descrip_define& desc_define, const member_define& mdefine, int offset, std::ofstream& os, int tab_indent)
   {
-    if (mdefine.is_multi())
+    std::string at = "offset + " + std::to_string(offset);
+    switch (mdefine.m_type)
     {
-      os << tabs(tab_indent) << "{";
-      os << std::endl;
-      os << tabs(tab_indent + 1) << "int32_t len = (int32_t)(" << var_name << ").size();" << std::endl;
-      os << tabs(tab_indent + 1) << "write(stream,len);" << std::endl;
-
-      if (mdefine.m_type == e_base_type::string)
-      {
-        os << tabs(tab_indent + 1) << "stream.write((" << var_name << ").data(),len);" << std::endl;
-      }
-      else if (mdefine.m_type == e_base_type::list)
+    case e_base_type::list:
+    {
+      const member_define& param = mdefine.m_template_parameters[0];
+      std::string size = std::to_string(flat_slot_size(param));
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t count = 0;" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t list = v.ref(" << at << ");" << std::endl;
+      os << tabs(tab_indent + 1) << "if (!v.list(list, " << size << ", count)) return false;" << std::endl;
+      if (is_flat_block(param))
       {
-        os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < count; ++k)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
-        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "*i");
+        gen_flat_verify_element_code(desc_define, param, os, tab_indent + 2, "list + ::adata::flat_block_header_size + k * " + size);
         os << tabs(tab_indent + 1) << "}" << std::endl;
       }
-      else if (mdefine.m_type == e_base_type::map)
+      os << tabs(tab_indent) << "}" << std::endl;
+      return;
+    }
+    case e_base_type::map:
+    {
+      const member_define& key = mdefine.m_template_parameters[0];
+      const member_define& param = mdefine.m_template_parameters[1];
+      std::string key_size = std::to_string(flat_slot_size(key));
+      std::string size = std::to_string(flat_slot_size(param));
+      os << tabs(tab_indent) << "{" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t count = 0;" << std::endl;
+      os << tabs(tab_indent + 1) << "uint32_t map = v.ref(" << at << ");" << std::endl;
+      os << tabs(tab_indent + 1) << "if (!v.map(map, " << key_size << ", " << size << ", count)) return false;" << std::endl;
+      if (is_flat_block(key) || is_flat_block(param))
       {
-        os << tabs(tab_indent + 1) << "for (" << make_type_desc(desc_define, mdefine) << "::const_iterator i = " << var_name << ".begin() ; i != " << var_name << ".end() ; ++i)" << std::endl;
+        os << tabs(tab_indent + 1) << "for (uint32_t k = 0; k < count; ++k)" << std::endl;
         os << tabs(tab_indent + 1) << "{" << std::endl;
-        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[0], os, tab_indent + 2, "i->first");
-        gen_member_raw_write_type_code(desc_define, tdefine, mdefine.m_template_parameters[1], os, tab_indent + 2, "i->second");
+        gen_flat_verify_element_code(desc_define, key, os, tab_indent + 2, "map + ::adata::flat_block_header_size + k * " + key_size);
+        gen_flat_verify_element_code(desc_define, param, os, tab_indent + 2, "map + ::adata::flat_map_values(count, " + key_size + ") + k * " + size);
         os << tabs(tab_indent + 1) << "}" << std::endl;
       }
       os << tabs(tab_indent) << "}" << std::endl;
+      return;
     }
-    else
+    case e_base_type::array:
     {
-      os << tabs(tab_indent);
-      if(mdefine.m_type == e_base_type::type)
-      {
-        os << "raw_write(stream," << var_name << ");";
-      }
-      else
+      const member_define& param = mdefine.m_template_parameters[0];
+      if (is_flat_block(param))
       {
-        if (mdefine.m_fixed)
-        {
-          os << "fix_";
-        }
-        os << "write(stream," << var_name << ");";
+        os << tabs(tab_indent) << "for (uint32_t k = 0; k < " << mdefine.m_size << "; ++k)" << std::endl;
+        os << tabs(tab_indent) << "{" << std::endl;
+        gen_flat_verify_element_code(desc_define, param, os, tab_indent + 1, at + " + k * " + std::to_string(flat_slot_size(param)));
+        os << tabs(tab_indent) << "}" << std::endl;
       }
-      os << std::endl;
+      return;
+    }
+    case e_base_type::bits:
+    {
+      return;
+    }
+    default:
+    {
+      break;
+    }
     }
+    gen_flat_verify_element_code(desc_define, mdefine, os, tab_indent, at, mdefine.m_optional);
   }
 
-  void gen_adata_operator_raw_write_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  // write appends the blocks of a value and fills in its record, read copies a view out into a value
+  // and verify checks the blocks of a record before it is read in place
+  void gen_flat_traits_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
   {
     std::string full_type_name = desc_define.m_namespace.m_cpp_fullname + tdefine.m_name;
-    os << tabs(1) << "template<typename stream_ty>" << std::endl;
-    os << tabs(1) << gen_inline_code(tdefine) << "void raw_write(stream_ty& stream , const " << full_type_name << "& value)" << std::endl;
+    flat_layout layout = make_flat_layout(tdefine);
+    char layout_hash[16];
+    std::snprintf(layout_hash, sizeof(layout_hash), "0x%08xU", flat_layout_hash(desc_define, tdefine));
+
+    os << tabs(1) << "template<>" << std::endl;
+    os << tabs(1) << "struct flat_traits< " << full_type_name << " >" << std::endl;
     os << tabs(1) << "{" << std::endl;
+    os << tabs(2) << "typedef " << full_type_name << " value_type;" << std::endl;
+    os << tabs(2) << "typedef " << full_type_name << "_flat view_type;" << std::endl;
+    os << tabs(2) << "enum { size = " << layout.size << ", align = " << layout.align << ", layout = " << layout_hash << " };" << std::endl << std::endl;
+
+    os << tabs(2) << "static void write(::adata::flat_writer& out, uint32_t offset, const value_type& value)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
+    {
+      if (!tdefine.m_members[i].m_deleted)
+      {
+        gen_flat_write_member_code(desc_define, tdefine.m_members[i], layout.offsets[i], os, 3);
+      }
+    }
+    os << tabs(2) << "}" << std::endl << std::endl;
 
+    os << tabs(2) << "static void read(const view_type& view, value_type& value)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
     for (const auto& member : tdefine.m_members)
     {
-      std::string var_name = "value.";
-      var_name += member.m_name;
       if (!member.m_deleted)
       {
-        gen_member_raw_write_type_code(desc_define, tdefine, member, os, 2, var_name);        
+        gen_flat_read_member_code(desc_define, member, os, 3);
       }
     }
-    os << tabs(1) << "}" << std::endl << std::endl;
-  }
-
-  inline void gen_adata_operator_type_code(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
-  {
-    gen_adata_operator_read_type_code(desc_define, tdefine, os);
-    gen_adata_operator_skip_read_type_code(desc_define, tdefine, os);
-    gen_adata_operator_size_of_type_code(desc_define, tdefine, os);
-    gen_adata_operator_write_type_code(desc_define, tdefine, os);
-    gen_adata_operator_raw_read_type_code(desc_define, tdefine, os);
-    gen_adata_operator_raw_size_of_type_code(desc_define, tdefine, os);
-    gen_adata_operator_raw_write_type_code(desc_define, tdefine, os);
-  }
+    os << tabs(2) << "}" << std::endl << std::endl;
 
-  void gen_adata_operator_code(const descrip_define& desc_define, std::ofstream& os)
-  {
-    os << "namespace adata" << std::endl << "{" << std::endl;
-    for (auto& t_define : desc_define.m_types)
+    os << tabs(2) << "static bool verify(::adata::flat_verifier& v, uint32_t offset, int32_t depth)" << std::endl;
+    os << tabs(2) << "{" << std::endl;
+    os << tabs(3) << "if (depth > ::adata::flat_max_depth || !v.record(offset, size)) return false;" << std::endl;
+    for (std::size_t i = 0; i < tdefine.m_members.size(); ++i)
     {
-      gen_adata_operator_type_code(desc_define, t_define, os);
+      if (!tdefine.m_members[i].m_deleted)
+      {
+        gen_flat_verify_member_code(desc_define, tdefine.m_members[i], layout.offsets[i], os, 3);
+      }
     }
-    os << "}" << std::endl << std::endl;
+    os << tabs(3) << "return true;" << std::endl;
+    os << tabs(2) << "}" << std::endl;
+    os << tabs(1) << "};" << std::endl << std::endl;
   }
 
-  void gen_include(const descrip_define& desc_define, std::ofstream& os)
+  inline bool has_flat_type(const descrip_define& desc_define)
   {
-    for (auto const& inc : desc_define.m_includes)
+    for (auto& t_define : desc_define.m_types)
     {
-      std::string inc_path = replace_all_copy(inc.first, ".", "/");
-      inc_path += ".adl.h";
-      os << "#include \"" << inc_path << "\"" << std::endl;
+      if (t_define.m_flat)
+      {
+        return true;
+      }
     }
-    os << std::endl;
+    return false;
   }
 
-  void gen_traits_type(const descrip_define& desc_define, const type_define& tdefine, std::ofstream& os)
+  void gen_flat_code(const descrip_define& desc_define, std::ofstream& os)
   {
-    os << "template<>\nstruct is_adata<";
-    for (const auto& name : desc_define.m_namespace.m_names)
+    os << "namespace adata" << std::endl << "{" << std::endl;
+    for (auto& t_define : desc_define.m_types)
     {
-      os << name << "::";
+      if (t_define.m_flat)
+      {
+        gen_flat_traits_type_code(desc_define, t_define, os);
+      }
     }
-    os << tdefine.m_name << ">\n{\n  static const bool value = true;\n};\n\n";
+    os << "}" << std::endl << std::endl;
   }
 
   void gen_type_code(const descrip_define& desc_define, std::ofstream& os)
@@ -852,9 +3947,41 @@ namespace cpp_gen
     }
     os << std::endl;
 
+    // enums of include files are in their own header
+    for (auto& e_define : desc_define.m_enums)
+    {
+      if (e_define.m_name.find('.') == std::string::npos)
+      {
+        gen_code_enum(desc_define, e_define, os);
+      }
+    }
+
     for (auto& t_define : desc_define.m_types)
     {
+      if (t_define.m_union)
+      {
+        gen_code_union_type(desc_define, t_define, os);
+        continue;
+      }
       gen_code_type(desc_define, t_define, os);
+      if (t_define.m_soa)
+      {
+        gen_code_soa_type(desc_define, t_define, os);
+      }
+    }
+
+    // views after all the types, a view holds the views of the types in it
+    for (auto& t_define : desc_define.m_types)
+    {
+      if (t_define.m_flat)
+      {
+        gen_code_flat_type(desc_define, t_define, os);
+      }
+    }
+
+    for (auto& table : desc_define.m_tables)
+    {
+      gen_table_typedef(desc_define, table, os);
     }
 
     for (const auto& name : desc_define.m_namespace.m_names)
@@ -863,9 +3990,17 @@ namespace cpp_gen
     }
     os << std::endl << std::endl;
     os << "namespace adata\n{\n";
+    for (auto& e_define : desc_define.m_enums)
+    {
+      if (e_define.m_name.find('.') == std::string::npos)
+      {
+        gen_enum_traits(desc_define, e_define, os);
+      }
+    }
     for (auto& t_define : desc_define.m_types)
     {
       gen_traits_type(desc_define, t_define, os);
+      gen_member_index_type(desc_define, t_define, os);
     }
     os << "}\n";
   }
@@ -902,11 +4037,35 @@ namespace cpp_gen
     os << "#define " << header_id << std::endl << std::endl;
 
     os << "#include <" << define.adata_header << "adata.hpp>" << std::endl;
+    if (!define.m_tables.empty())
+    {
+      os << "#include <" << define.adata_header << "adata_table.hpp>" << std::endl;
+    }
+    if (!define.m_transcodes.empty())
+    {
+      os << "#include <" << define.adata_header << "adata_transcode.hpp>" << std::endl;
+    }
+    if (has_flat_type(define))
+    {
+      os << "#include <" << define.adata_header << "adata_flat.hpp>" << std::endl;
+    }
 
     gen_include(define, os);
     gen_type_code(define, os);
 
     gen_adata_operator_code(define, os);
+    if (!define.m_tables.empty())
+    {
+      gen_table_code(define, os);
+    }
+    if (!define.m_transcodes.empty())
+    {
+      gen_transcode_code(define, os);
+    }
+    if (has_flat_type(define))
+    {
+      gen_flat_code(define, os);
+    }
 
     os << "#endif" << std::endl;
     os.close();
@@ -80,6 +80,175 @@ const type_define * descrip_define::find_decl_type(const std::string& type) cons
   return NULL;
 }
 
+const enum_define * descrip_define::find_enum(const std::string& name) const
+{
+  for (const auto& define : m_enums)
+  {
+    if (define.m_name == name)
+    {
+      return std::addressof(define);
+    }
+  }
+  return NULL;
+}
+
+const enum_define::item_type * enum_define::find_item(const std::string& name) const
+{
+  for (const auto& item : m_items)
+  {
+    if (item.m_name == name)
+    {
+      return std::addressof(item);
+    }
+  }
+  return NULL;
+}
+
+const enum_define::item_type * enum_define::find_value(int64_t value) const
+{
+  for (const auto& item : m_items)
+  {
+    if (item.m_value == value)
+    {
+      return std::addressof(item);
+    }
+  }
+  return NULL;
+}
+
+const transcode_define* descrip_define::find_transcode(const type_define* from, const type_define* to) const
+{
+  for (const auto& define : m_transcodes)
+  {
+    if (define.m_from_define == from && define.m_to_define == to)
+    {
+      return std::addressof(define);
+    }
+  }
+  return NULL;
+}
+
+e_transcode_kind transcode_member_kind(const descrip_define& desc_define, const member_define& from, const member_define& to)
+{
+  // template parameters keep fix_ types, members are normalized by the parser
+  e_base_type from_type = from.m_type;
+  e_base_type to_type = to.m_type;
+  bool from_fixed = from.m_fixed;
+  bool to_fixed = to.m_fixed;
+  if (from.is_fixed())
+  {
+    from_type = (e_base_type)(from_type + int8 - fix_int8);
+    from_fixed = true;
+  }
+  if (to.is_fixed())
+  {
+    to_type = (e_base_type)(to_type + int8 - fix_int8);
+    to_fixed = true;
+  }
+  if (from_fixed != to_fixed)
+  {
+    return transcode_incompatible;
+  }
+  // values of one enum may be out of the range of another
+  if (from.m_enum_name.length() && to.m_enum_name.length() && from.m_enum_name != to.m_enum_name)
+  {
+    return transcode_incompatible;
+  }
+  // a [dict] string may be an index into the string_dict of its message, it is only copied
+  if (from.m_dict != to.m_dict)
+  {
+    return transcode_incompatible;
+  }
+  // the payload of an [align] bytes is padded, it is only copied to one of the same alignment
+  if (from.m_align != to.m_align)
+  {
+    return transcode_incompatible;
+  }
+  if (from_type != to_type)
+  {
+    // a varint reads the same into any wider integer of the same signedness
+    bool from_signed = (from_type - int8) % 2 == 0;
+    bool to_signed = (to_type - int8) % 2 == 0;
+    if (!from_fixed && from_type >= int8 && from_type <= uint64 && to_type >= int8 && to_type <= uint64
+      && from_signed == to_signed && from_type < to_type)
+    {
+      return from.m_bit_width || to.m_bit_width ? transcode_convert : transcode_copy;
+    }
+    return transcode_incompatible;
+  }
+  if (from_type == e_base_type::type)
+  {
+    const type_define* from_define = desc_define.find_decl_type(from.m_typename);
+    const type_define* to_define = desc_define.find_decl_type(to.m_typename);
+    if (from_define == to_define)
+    {
+      return transcode_copy;
+    }
+    return desc_define.find_transcode(from_define, to_define) ? transcode_convert : transcode_incompatible;
+  }
+  if (is_container(from_type))
+  {
+    if (from.m_template_parameters.size() != to.m_template_parameters.size())
+    {
+      return transcode_incompatible;
+    }
+    // an array has no length, its elements are copied as they are or not at all
+    if (from_type == e_base_type::array)
+    {
+      if (from.m_size != to.m_size)
+      {
+        return transcode_incompatible;
+      }
+      e_transcode_kind param_kind = transcode_member_kind(desc_define, from.m_template_parameters[0], to.m_template_parameters[0]);
+      return param_kind == transcode_copy ? transcode_copy : transcode_incompatible;
+    }
+    // adding or dropping the byte length of a [sized] member rewrites it
+    e_transcode_kind kind = from.m_sized == to.m_sized ? transcode_copy : transcode_convert;
+    // an encoded list is rewritten for another encoding, or for a wider element as its differences wrap
+    if (from.m_encoding != to.m_encoding ||
+      (from.m_encoding != list_plain && from.m_template_parameters[0].m_type != to.m_template_parameters[0].m_type))
+    {
+      kind = transcode_convert;
+    }
+    // a [columnar] list is rewritten through its c++ elements, so only for the same element type
+    if (from.m_columnar || to.m_columnar)
+    {
+      if (desc_define.find_decl_type(from.m_template_parameters[0].m_typename) != desc_define.find_decl_type(to.m_template_parameters[0].m_typename))
+      {
+        return transcode_incompatible;
+      }
+      if (from.m_columnar != to.m_columnar)
+      {
+        kind = transcode_convert;
+      }
+    }
+    for (std::size_t i = 0; i < from.m_template_parameters.size(); ++i)
+    {
+      e_transcode_kind param_kind = transcode_member_kind(desc_define, from.m_template_parameters[i], to.m_template_parameters[i]);
+      if (param_kind == transcode_incompatible)
+      {
+        return transcode_incompatible;
+      }
+      if (param_kind == transcode_convert)
+      {
+        kind = transcode_convert;
+      }
+    }
+    return kind;
+  }
+  // bits of another count are another length
+  if (from_type == e_base_type::bits && from.m_size != to.m_size)
+  {
+    return transcode_incompatible;
+  }
+  // a [bits=k] member has no bytes of its own, its run is packed again
+  if (from.m_bit_width || to.m_bit_width)
+  {
+    return transcode_convert;
+  }
+  return transcode_copy;
+}
+
 namespace
 {
   std::string s_fix_int8 = "fix_int8";
@@ -101,8 +270,12 @@ namespace
   std::string s_float32 = "float32";
   std::string s_float64 = "float64";
   std::string s_string = "string";
+  std::string s_bytes = "bytes";
+  std::string s_bool = "bool";
+  std::string s_bits = "bits";
   std::string s_list = "list";
   std::string s_map = "map";
+  std::string s_array = "array";
 
   static typename_map_type make_typedef_cpp()
   {
@@ -126,8 +299,12 @@ namespace
     define.insert(std::make_pair(s_float32, "float"));
     define.insert(std::make_pair(s_float64, "double"));
     define.insert(std::make_pair(s_string, "::std::string"));
+    define.insert(std::make_pair(s_bytes, "::adata::bytes"));
+    define.insert(std::make_pair(s_bool, "bool"));
+    define.insert(std::make_pair(s_bits, "::std::bitset"));
     define.insert(std::make_pair(s_list, "::std::vector"));
     define.insert(std::make_pair(s_map, "::std::map"));
+    define.insert(std::make_pair(s_array, "::std::array"));
 
     return define;
   }
@@ -156,9 +333,13 @@ namespace
     define.insert(std::make_pair(s_float32, float32));
     define.insert(std::make_pair(s_float64, float64));
     define.insert(std::make_pair(s_string, e_base_type::string));
+    define.insert(std::make_pair(s_bytes, e_base_type::string));
+    define.insert(std::make_pair(s_bool, boolean));
+    define.insert(std::make_pair(s_bits, bits));
 
     define.insert(std::make_pair(s_list, list));
     define.insert(std::make_pair(s_map, map));
+    define.insert(std::make_pair(s_array, e_base_type::array));
 
     return define;
   }
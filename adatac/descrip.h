@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -58,17 +59,32 @@ enum e_base_type
   list,
   map,
   type,
+  boolean,
+  bits,
+  array,
   max_count
 };
 
 e_base_type get_type(std::string const& type);
 
+// integer list encodings, same values as adata::list_encoding
+enum e_list_encoding
+{
+  list_plain,
+  list_delta,
+  list_delta2,
+  list_rle,
+  list_bitmap,
+  list_xor
+};
+
 inline bool is_container(e_base_type type)
 {
   switch (type)
   {
   case list:
   case map:
+  case array:
     return true;
   default:
   {
@@ -79,6 +95,7 @@ inline bool is_container(e_base_type type)
 }
 
 struct type_define;
+struct enum_define;
 
 struct member_define
 {
@@ -88,12 +105,36 @@ struct member_define
   e_base_type										m_type;
   std::string										m_typename;
   option_map_type								m_options;
+  // range of a string or container, bit count of bits, element count of array
   std::string										m_size;
   template_parameter_list_type	m_template_parameters;
   std::string										m_default_value;
   type_define *                 m_typedef;
   bool													m_fixed;
   bool													m_deleted;
+  bool													m_sized;
+  e_list_encoding								m_encoding;
+  bool													m_columnar;
+  bool													m_soa;
+  // [bits=k], 0 if the integer is written as usual
+  int														m_bit_width;
+  // [quant=step, min=, max=] of a float, written in m_bit_width bits as its count of steps from min
+  std::string										m_quant_step;
+  std::string										m_quant_min;
+  std::string										m_quant_max;
+  // [dict] string, an index into the string_dict of the message once it was written before
+  bool													m_dict;
+  // optional<T>, written when it is set rather than when it isn't the default, T is in m_type and m_typename
+  bool													m_optional;
+  // a bytes member, written as a string and read into an ::adata::bytes. [align=k] pads its payload
+  // to a multiple of k from the start of the stream, 0 if it isn't aligned, and a [view] one views
+  // the read buffer instead of copying its payload
+  bool													m_bytes;
+  int														m_align;
+  bool													m_view;
+  // an enum member keeps its underlying integer in m_type and m_typename, and the enum here
+  std::string										m_enum_name;
+  const enum_define *						m_enum;
   int														m_tag;
   int														m_parser_lines;
   int														m_parser_cols;
@@ -104,6 +145,17 @@ struct member_define
     , m_typedef(NULL)
     , m_fixed(false)
     , m_deleted(false)
+    , m_sized(false)
+    , m_encoding(list_plain)
+    , m_columnar(false)
+    , m_soa(false)
+    , m_bit_width(0)
+    , m_dict(false)
+    , m_optional(false)
+    , m_bytes(false)
+    , m_align(0)
+    , m_view(false)
+    , m_enum(NULL)
     , m_tag(0)
     , m_parser_lines(0)
     , m_parser_cols(0)
@@ -119,6 +171,11 @@ struct member_define
     return false;
   }
 
+  inline bool	is_quant()const
+  {
+    return m_quant_step.length() > 0;
+  }
+
   inline bool	is_integer()const
   {
     if (m_type >= int8 && m_type <= uint64)
@@ -149,7 +206,7 @@ struct member_define
 
   inline bool is_initable()const
   {
-    if (m_type >= int8 && m_type < string)
+    if ((m_type >= int8 && m_type < string) || m_type == boolean)
     {
       return true;
     }
@@ -168,6 +225,14 @@ struct type_define
   std::string                   m_parser_include;
   int                           m_index;
   bool                          m_ismulti;
+  // a struct of arrays <name>_soa is generated, declared by "soa = type;"
+  bool                          m_soa;
+  // a view <name>_flat reading it in place from a flat buffer is generated, declared by "flat = type;"
+  bool                          m_flat;
+  // "type [packed] { ... }", written as its fixed members back to back, without tag and len_tag
+  bool                          m_packed;
+  // "event [union] { move move; chat chat; }", holds at most one of its members, written as the varint kind and that member
+  bool                          m_union;
   std::string                   m_filename;
   struct cpp_opt
   {
@@ -178,12 +243,48 @@ struct type_define
     , m_parser_cols(0)
     , m_index(0)
     , m_ismulti(false)
+    , m_soa(false)
+    , m_flat(false)
+    , m_packed(false)
+    , m_union(false)
   {
   }
 
   bool has_member(const std::string& member_name) const;
 };
 
+// "job [enum] { warrior; mage = 5; }", a C++ enum class written as the smallest integer holding its values
+struct enum_define
+{
+  struct item_type
+  {
+    std::string m_name;
+    int64_t			m_value;
+  };
+  typedef std::vector<item_type> item_list_type;
+  std::string										m_name;
+  item_list_type								m_items;
+  e_base_type										m_type;
+  std::string										m_typename;
+  int64_t												m_min;
+  int64_t												m_max;
+  int														m_parser_lines;
+  int														m_parser_cols;
+  std::string                   m_parser_include;
+
+  enum_define()
+    : m_type(unknow)
+    , m_min(0)
+    , m_max(0)
+    , m_parser_lines(0)
+    , m_parser_cols(0)
+  {
+  }
+
+  const item_type * find_item(const std::string& name) const;
+  const item_type * find_value(int64_t value) const;
+};
+
 struct option_value
 {
   std::string m_value;
@@ -198,6 +299,78 @@ struct option_value
   }
 };
 
+struct table_define
+{
+  std::string m_typename;
+  std::string m_key;
+  int					m_parser_lines;
+  int					m_parser_cols;
+  std::string m_parser_include;
+
+  table_define()
+    : m_parser_lines(0)
+    , m_parser_cols(0)
+  {
+  }
+};
+
+struct soa_define
+{
+  std::string m_typename;
+  int					m_parser_lines;
+  int					m_parser_cols;
+  std::string m_parser_include;
+
+  soa_define()
+    : m_parser_lines(0)
+    , m_parser_cols(0)
+  {
+  }
+};
+
+struct flat_define
+{
+  std::string m_typename;
+  int					m_parser_lines;
+  int					m_parser_cols;
+  std::string m_parser_include;
+
+  flat_define()
+    : m_parser_lines(0)
+    , m_parser_cols(0)
+  {
+  }
+};
+
+struct transcode_define
+{
+  std::string m_from;
+  std::string m_to;
+  const type_define * m_from_define;
+  const type_define * m_to_define;
+  int					m_parser_lines;
+  int					m_parser_cols;
+  std::string m_parser_include;
+
+  transcode_define()
+    : m_from_define(NULL)
+    , m_to_define(NULL)
+    , m_parser_lines(0)
+    , m_parser_cols(0)
+  {
+  }
+};
+
+// how a member of one type carries over to the same named member of another
+enum e_transcode_kind
+{
+  transcode_incompatible,
+  // encoded bytes are valid as is
+  transcode_copy,
+  // needs a declared transcode of a nested type
+  transcode_convert
+};
+
 struct descrip_define;
 struct include_define
 {
@@ -216,6 +389,11 @@ struct descrip_define
   typedef std::vector<type_define>	type_list_type;
   typedef std::map<std::string, option_value> option_map_type;
   typedef std::map<std::string, include_define> include_map_type;
+  typedef std::vector<table_define> table_list_type;
+  typedef std::vector<transcode_define> transcode_list_type;
+  typedef std::vector<soa_define> soa_list_type;
+  typedef std::vector<flat_define> flat_list_type;
+  typedef std::vector<enum_define> enum_list_type;
 
   include_map_type m_includes;
   namespace_type m_namespace;
@@ -224,6 +402,16 @@ struct descrip_define
   type_list_type m_types;
   // Nous Xiong: add include type_defines
   type_list_type m_include_types;
+  // config tables declared by "table = type(key);"
+  table_list_type m_tables;
+  // schema migrations declared by "transcode = from : to;"
+  transcode_list_type m_transcodes;
+  // struct of arrays containers declared by "soa = type;", of include files too
+  soa_list_type m_soas;
+  // in place views declared by "flat = type;", of include files too
+  flat_list_type m_flats;
+  // enums of this file and of include files, named as include types are
+  enum_list_type m_enums;
   // Nous Xiong: add filename
   std::string m_filename;
   // Nous Xiong: adata.hpp include path
@@ -231,8 +419,12 @@ struct descrip_define
 
   bool has_decl_type(const std::string& type) const;
   const type_define* find_decl_type(const std::string& type) const;
+  const enum_define* find_enum(const std::string& name) const;
+  const transcode_define* find_transcode(const type_define* from, const type_define* to) const;
 };
 
+e_transcode_kind transcode_member_kind(const descrip_define& desc_define, const member_define& from, const member_define& to);
+
 typedef std::map<std::string, std::string> typename_map_type;
 
 typename_map_type& get_cpp_typename_map();
@@ -53,6 +53,10 @@ namespace java_gen
     case e_base_type::uint16: throw std::logic_error("java not support uint16 type!");
     case e_base_type::uint32: throw std::logic_error("java not support uint32 type!");
     case e_base_type::uint64: throw std::logic_error("java not support uint64 type!");
+    case e_base_type::boolean: throw std::logic_error("java not support bool type!");
+    case e_base_type::bits: throw std::logic_error("java not support bits type!");
+    case e_base_type::array: throw std::logic_error("java not support array type!");
+    default: break;
     }
   }
 
@@ -37,6 +37,10 @@ namespace kotlin_gen
     case e_base_type::uint16: throw std::logic_error("kotlin not support uint16 type!");
     case e_base_type::uint32: throw std::logic_error("kotlin not support uint32 type!");
     case e_base_type::uint64: throw std::logic_error("kotlin not support uint64 type!");
+    case e_base_type::boolean: throw std::logic_error("kotlin not support bool type!");
+    case e_base_type::bits: throw std::logic_error("kotlin not support bits type!");
+    case e_base_type::array: throw std::logic_error("kotlin not support array type!");
+    default: break;
     }
   }
 
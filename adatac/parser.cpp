@@ -618,6 +618,142 @@ public:
     }
   }
 
+  void parser_table()
+  {
+    const options& opt = get_options();
+    char c = skip_ws();
+    if (c == '=')
+    {
+      table_define t_define;
+      t_define.m_parser_lines = m_lines;
+      t_define.m_parser_cols = m_cols;
+      t_define.m_parser_include = m_include;
+      t_define.m_typename = parser_typename();
+      c = skip_ws();
+      if (c != '(')
+      {
+        throw parse_execption("table syntax error , miss key member , usage table = item(id);", m_lines, m_cols, m_include);
+      }
+      t_define.m_key = parser_string();
+      if (opt.camel_case)
+      {
+        t_define.m_key = camel_case_str(t_define.m_key, false);
+      }
+      c = skip_ws();
+      if (c != ')')
+      {
+        throw parse_execption("table syntax error , key member miss ) at end", m_lines, m_cols, m_include);
+      }
+      c = skip_ws();
+      if (c != ';')
+      {
+        throw parse_execption("table syntax error , miss ; at line end", m_lines, m_cols, m_include);
+      }
+      // tables of an include file belong to its own generated code
+      if (!is_include_)
+      {
+        m_define.m_tables.push_back(t_define);
+      }
+    }
+    else
+    {
+      throw parse_execption("table syntax error,usage table = item(id);", m_lines, m_cols, m_include);
+    }
+  }
+
+  void parser_transcode()
+  {
+    char c = skip_ws();
+    if (c == '=')
+    {
+      transcode_define t_define;
+      t_define.m_parser_lines = m_lines;
+      t_define.m_parser_cols = m_cols;
+      t_define.m_parser_include = m_include;
+      t_define.m_from = parser_typename();
+      c = skip_ws();
+      if (c != ':')
+      {
+        throw parse_execption("transcode syntax error , miss : between types , usage transcode = player_v1 : player_v2;", m_lines, m_cols, m_include);
+      }
+      t_define.m_to = parser_typename();
+      c = skip_ws();
+      if (c != ';')
+      {
+        throw parse_execption("transcode syntax error , miss ; at line end", m_lines, m_cols, m_include);
+      }
+      // transcodes of an include file belong to its own generated code
+      if (!is_include_)
+      {
+        m_define.m_transcodes.push_back(t_define);
+      }
+    }
+    else
+    {
+      throw parse_execption("transcode syntax error,usage transcode = player_v1 : player_v2;", m_lines, m_cols, m_include);
+    }
+  }
+
+  void parser_soa()
+  {
+    char c = skip_ws();
+    if (c == '=')
+    {
+      soa_define s_define;
+      s_define.m_parser_lines = m_lines;
+      s_define.m_parser_cols = m_cols;
+      s_define.m_parser_include = m_include;
+      s_define.m_typename = parser_typename();
+      c = skip_ws();
+      if (c != ';')
+      {
+        throw parse_execption("soa syntax error , miss ; at line end", m_lines, m_cols, m_include);
+      }
+      if (s_define.m_typename.find('.') != std::string::npos)
+      {
+        throw parse_execption("soa syntax error ,soa type must be declared in this file", m_lines, m_cols, m_include);
+      }
+      // the container of an include type comes with its own generated code, members may still use it
+      if (is_include_)
+      {
+        s_define.m_typename = namespace_.m_fullname + "." + s_define.m_typename;
+      }
+      m_define.m_soas.push_back(s_define);
+    }
+    else
+    {
+      throw parse_execption("soa syntax error,usage soa = item;", m_lines, m_cols, m_include);
+    }
+  }
+
+  void parser_flat()
+  {
+    char c = skip_ws();
+    if (c == '=')
+    {
+      flat_define f_define;
+      f_define.m_parser_lines = m_lines;
+      f_define.m_parser_cols = m_cols;
+      f_define.m_parser_include = m_include;
+      f_define.m_typename = parser_typename();
+      c = skip_ws();
+      if (c != ';')
+      {
+        throw parse_execption("flat syntax error , miss ; at line end", m_lines, m_cols, m_include);
+      }
+      // a type of an include file comes with its namespace, its view is in its own generated code
+      if (!is_include_ && f_define.m_typename.find('.') != std::string::npos)
+      {
+        throw parse_execption("flat syntax error ,flat type must be declared in this file", m_lines, m_cols, m_include);
+      }
+      m_define.m_flats.push_back(f_define);
+    }
+    else
+    {
+      throw parse_execption("flat syntax error,usage flat = item;", m_lines, m_cols, m_include);
+    }
+  }
+
   void parser_template_parameter(type_define&, member_define& f_define, int parmeter_count)
   {
     char c = skip_ws();
@@ -632,16 +768,33 @@ public:
           throw parse_execption("type syntax error ,member type declaration paramter type, usage list<int32> list_value;", m_lines, m_cols, m_include);
         }
 
-        if (m_define.has_decl_type(paramter_type_name))
+        const enum_define * e_define = m_define.find_enum(paramter_type_name);
+        if (e_define != NULL || m_define.has_decl_type(paramter_type_name))
         {
-          e_base_type p_type = get_type(paramter_type_name);
+          e_base_type p_type = e_define != NULL ? e_define->m_type : get_type(paramter_type_name);
+          if (e_define != NULL && f_define.m_type == e_base_type::array)
+          {
+            throw parse_execption("type member syntax error , array element couldn't be an enum, its elements start at zero", m_lines, m_cols, m_include);
+          }
           if (is_container(p_type))
           {
             throw parse_execption("type member syntax error , container parameter couldn't be container", m_lines, m_cols, m_include);
           }
+          if (p_type == e_base_type::boolean || p_type == e_base_type::bits)
+          {
+            throw parse_execption("type member syntax error , container parameter couldn't be bool or bits, use bits<N> for a row of flags", m_lines, m_cols, m_include);
+          }
+          if (is_base_type(paramter_type_name) == "bytes")
+          {
+            throw parse_execption("type member syntax error , container parameter couldn't be bytes, use a type with a bytes member", m_lines, m_cols, m_include);
+          }
           member_define p_define;
-          p_define.m_typename = paramter_type_name;
+          p_define.m_typename = e_define != NULL ? e_define->m_typename : paramter_type_name;
           p_define.m_type = p_type;
+          if (e_define != NULL)
+          {
+            p_define.m_enum_name = e_define->m_name;
+          }
           p_define.m_parser_lines = m_lines;
           p_define.m_parser_cols = m_cols;
           if (p_type == e_base_type::string)
@@ -682,6 +835,15 @@ public:
           throw parse_execption("type member syntax error ,unknow type declaration", m_lines, m_cols, m_include);
         }
       } while (!m_eof && parmeter_count);
+      if (f_define.m_type == e_base_type::array)
+      {
+        // the element count, kept as the size
+        if (skip_ws() != ',')
+        {
+          throw parse_execption("type member syntax error , array declaration miss element count, usage array<float32,3> pos;", m_lines, m_cols, m_include);
+        }
+        f_define.m_size = parser_number();
+      }
       c = skip_ws();
       if (c != '>')
       {
@@ -698,11 +860,13 @@ public:
   {
     const options& opt = get_options();
     f_define.m_type = get_type(f_define.m_typename);
+    f_define.m_bytes = is_base_type(f_define.m_typename) == "bytes";
     int parmeter_count = 0;
     switch (f_define.m_type)
     {
     case e_base_type::list: parmeter_count = 1; break;
     case e_base_type::map: parmeter_count = 2; break;
+    case e_base_type::array: parmeter_count = 1; break;
     default: break;
     }
 
@@ -710,6 +874,19 @@ public:
     {
       parser_template_parameter(t_define, f_define, parmeter_count);
     }
+    else if (f_define.m_type == e_base_type::bits)
+    {
+      // the bit count, kept as the size
+      if (skip_ws() != '<')
+      {
+        throw parse_execption("type member syntax error , bits declaration miss <, usage bits<16> flags;", m_lines, m_cols, m_include);
+      }
+      f_define.m_size = parser_number();
+      if (skip_ws() != '>')
+      {
+        throw parse_execption("type member syntax error , bits declaration miss > at end", m_lines, m_cols, m_include);
+      }
+    }
     char c = read_char();
     if (is_ws(c))
     {
@@ -738,7 +915,7 @@ public:
         {
           if (f_define.m_default_value.empty())
           {
-            f_define.m_default_value = parser_number();
+            f_define.m_default_value = f_define.m_type == e_base_type::boolean || f_define.m_enum_name.length() ? parser_value() : parser_number();
           }
           else
           {
@@ -747,6 +924,10 @@ public:
         }
         else if (c == '(')
         {
+          if (f_define.m_type == e_base_type::bits || f_define.m_type == e_base_type::array)
+          {
+            throw parse_execption("type member syntax error , " + f_define.m_typename + " has no range, its count is in <>", m_lines, m_cols, m_include);
+          }
           std::string range_value = parser_number();
           c = skip_ws();
           if (c == ')')
@@ -760,32 +941,36 @@ public:
         }
         else if (c == '[')
         {
-          std::string option_name = parser_string();
-          if (option_name.empty())
+          // one option or a list of them, [quant=0.01, min=-8192, max=8192]
+          do
           {
-            throw parse_execption("type syntax error ,member type declaration option, usage int32 value = 1[delete];", m_lines, m_cols, m_include);
-          }
+            std::string option_name = parser_string();
+            if (option_name.empty())
+            {
+              throw parse_execption("type syntax error ,member type declaration option, usage int32 value = 1[delete];", m_lines, m_cols, m_include);
+            }
 
-          std::string option_value;
-          auto find = f_define.m_options.find(option_name);
-          if (find != f_define.m_options.end())
-          {
-            throw parse_execption("type member syntax error , redefine option", m_lines, m_cols, m_include);
-          }
-          c = skip_ws();
-          if (c == '=')
-          {
-            option_value = parser_value();
+            std::string option_value;
+            auto find = f_define.m_options.find(option_name);
+            if (find != f_define.m_options.end())
+            {
+              throw parse_execption("type member syntax error , redefine option", m_lines, m_cols, m_include);
+            }
             c = skip_ws();
-          }
-          if (c == ']')
-          {
-            f_define.m_options.insert(std::make_pair(option_name, option_value));
-          }
-          else
-          {
-            throw parse_execption("type member syntax error , option miss ] at end", m_lines, m_cols, m_include);
-          }
+            if (c == '=')
+            {
+              option_value = parser_value();
+              c = skip_ws();
+            }
+            if (c == ']' || c == ',')
+            {
+              f_define.m_options.insert(std::make_pair(option_name, option_value));
+            }
+            else
+            {
+              throw parse_execption("type member syntax error , option miss ] at end", m_lines, m_cols, m_include);
+            }
+          } while (c == ',');
         }
       } while (!m_eof);
     }
@@ -795,6 +980,98 @@ public:
     }
   }
 
+  // "vec3 [packed] {", "job [enum] {" or "event [union] {", empty without an attribute
+  std::string parser_type_attribute()
+  {
+    char c = skip_ws();
+    if (c != '[')
+    {
+      --m_doc;
+      --m_cols;
+      return "";
+    }
+    std::string attribute = parser_string();
+    if ((attribute != "packed" && attribute != "enum" && attribute != "union") || skip_ws() != ']')
+    {
+      throw parse_execption("type syntax error , unknow type attribute, usage vec3 [packed] { float32 x; }, job [enum] { warrior; mage = 5; } or event [union] { move move; }", m_lines, m_cols, m_include);
+    }
+    return attribute;
+  }
+
+  // enumerators are numbered from 0, or from the one before them, unless they are given a value
+  void parser_enum(enum_define& e_define)
+  {
+    if (skip_ws() != '{')
+    {
+      throw parse_execption("enum syntax error , miss { after enum declaration", m_lines, m_cols, m_include);
+    }
+    int64_t value = 0;
+    do
+    {
+      char c = skip_ws();
+      if (c == '}')
+      {
+        break;
+      }
+      --m_doc;
+      --m_cols;
+      enum_define::item_type item;
+      item.m_name = parser_string();
+      if (item.m_name.empty())
+      {
+        throw parse_execption("enum syntax error ,enumerator declaration , usage mage = 5;", m_lines, m_cols, m_include);
+      }
+      if (e_define.find_item(item.m_name))
+      {
+        throw parse_execption("enum syntax error , redefine enumerator " + item.m_name, m_lines, m_cols, m_include);
+      }
+      c = skip_ws();
+      if (c == '=')
+      {
+        std::string number = parser_number();
+        char * end = nullptr;
+        value = std::strtoll(number.c_str(), &end, 10);
+        if (*end != 0)
+        {
+          throw parse_execption("enum syntax error ,enumerator value is not an integer", m_lines, m_cols, m_include);
+        }
+        c = skip_ws();
+      }
+      if (c != ';')
+      {
+        throw parse_execption("enum syntax error , miss ; after enumerator", m_lines, m_cols, m_include);
+      }
+      if (e_define.find_value(value))
+      {
+        throw parse_execption("enum syntax error , enumerator " + item.m_name + " has the value of another one", m_lines, m_cols, m_include);
+      }
+      item.m_value = value++;
+      e_define.m_items.push_back(item);
+    } while (!m_eof);
+    if (e_define.m_items.empty())
+    {
+      throw parse_execption("enum syntax error , enum has no enumerator", e_define.m_parser_lines, e_define.m_parser_cols, e_define.m_parser_include);
+    }
+    e_define.m_min = e_define.m_max = e_define.m_items[0].m_value;
+    for (const auto& item : e_define.m_items)
+    {
+      e_define.m_min = std::min(e_define.m_min, item.m_value);
+      e_define.m_max = std::max(e_define.m_max, item.m_value);
+    }
+    // the smallest integer holding all values, an enum of 0 to 127 takes one byte
+    if (e_define.m_min >= 0)
+    {
+      e_define.m_typename = e_define.m_max <= 0xFF ? "uint8" : e_define.m_max <= 0xFFFF ? "uint16" : e_define.m_max <= 0xFFFFFFFFLL ? "uint32" : "uint64";
+    }
+    else
+    {
+      e_define.m_typename = e_define.m_min >= -0x80 && e_define.m_max < 0x80 ? "int8"
+        : e_define.m_min >= -0x8000 && e_define.m_max < 0x8000 ? "int16"
+        : e_define.m_min >= -0x80000000LL && e_define.m_max < 0x80000000LL ? "int32" : "int64";
+    }
+    e_define.m_type = get_type(e_define.m_typename);
+  }
+
   void parser_type(type_define& t_define)
   {
     char c = skip_ws();
@@ -819,13 +1096,43 @@ public:
         {
           throw parse_execption("type syntax error ,member type declaration , usage int32 value = 1;", m_lines, m_cols, m_include);
         }
+        // optional<vec3> pos; the member has the type in <>, and is either set or not
+        bool optional = member_type_name == "optional";
+        if (optional)
+        {
+          if (skip_ws() != '<')
+          {
+            throw parse_execption("type member syntax error , optional declaration miss <, usage optional<vec3> pos;", m_lines, m_cols, m_include);
+          }
+          member_type_name = parser_typename();
+          e_base_type member_type = get_type(member_type_name);
+          if (is_container(member_type) || member_type == e_base_type::boolean || member_type == e_base_type::bits)
+          {
+            throw parse_execption("type member syntax error , optional of a container, bool or bits, an empty one is already left out", m_lines, m_cols, m_include);
+          }
+          if (is_base_type(member_type_name) == "bytes")
+          {
+            throw parse_execption("type member syntax error , optional of bytes, empty bytes are already left out", m_lines, m_cols, m_include);
+          }
+          if (skip_ws() != '>')
+          {
+            throw parse_execption("type member syntax error , optional declaration miss > at end", m_lines, m_cols, m_include);
+          }
+        }
 
-        if (m_define.has_decl_type(member_type_name))
+        const enum_define * e_define = m_define.find_enum(member_type_name);
+        if (e_define != NULL || m_define.has_decl_type(member_type_name))
         {
           member_define f_define;
           f_define.m_parser_lines = m_lines;
           f_define.m_parser_cols = m_cols;
           f_define.m_typename = member_type_name;
+          f_define.m_optional = optional;
+          if (e_define != NULL)
+          {
+            f_define.m_typename = e_define->m_typename;
+            f_define.m_enum_name = e_define->m_name;
+          }
           t_define.m_members.push_back(f_define);
           parser_member(t_define, t_define.m_members[t_define.m_members.size() - 1]);
         }
@@ -871,16 +1178,88 @@ public:
     return true;
   }
 
-  void valid_types(descrip_define::type_list_type& types)
+  // a number option, [quant=0.01, min=-8192, max=8192]
+  bool valid_float_option(const std::string& value, double& number)
   {
-    for (auto& tdefine : types)
+    if (value.empty() || !valid_float_value_string(value))
     {
-      if (tdefine.m_members.size() > 63)
+      return false;
+    }
+    char * end = nullptr;
+    number = std::strtod(value.c_str(), &end);
+    return *end == 0;
+  }
+
+  // the default of an enum member or element becomes the number of its enumerator, the first one if not given
+  void valid_enum_member(member_define& member)
+  {
+    member.m_enum = m_define.find_enum(member.m_enum_name);
+    const enum_define::item_type * item = nullptr;
+    const std::string& value = member.m_default_value;
+    if (value.empty())
+    {
+      item = &member.m_enum->m_items[0];
+    }
+    else if (is_number_header(value[0]))
+    {
+      char * end = nullptr;
+      int64_t number = std::strtoll(value.c_str(), &end, 10);
+      item = *end == 0 ? member.m_enum->find_value(number) : nullptr;
+    }
+    else
+    {
+      item = member.m_enum->find_item(lower_case_str(value));
+    }
+    if (item == nullptr)
+    {
+      throw parse_execption("member syntax error ,default value is not an enumerator of " + member.m_enum_name, member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+    }
+    member.m_default_value = std::to_string(item->m_value);
+  }
+
+  // an optional member is written when it is set, it has no default and no option but [delete]
+  void valid_optional_member(const type_define& tdefine, const member_define& member)
+  {
+    if (tdefine.m_packed || tdefine.m_union)
+    {
+      throw parse_execption("member syntax error ,optional member " + member.m_name + " not in a packed or union type", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+    }
+    if (member.m_default_value.length())
+    {
+      throw parse_execption("member syntax error ,optional member has no default value, it starts unset", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+    }
+    for (auto& option : member.m_options)
+    {
+      if (option.first != "delete")
       {
-        throw parse_execption("type syntax error ,member of type max is 63", tdefine.m_parser_lines, tdefine.m_parser_cols, tdefine.m_parser_include);
+        throw parse_execption("member syntax error ,optional member can only have the [delete] option", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
       }
+    }
+    const type_define * element = member.m_type == e_base_type::type ? m_define.find_decl_type(member.m_typename) : nullptr;
+    if (element != nullptr && element->m_union)
+    {
+      throw parse_execption("member syntax error ,optional of a union type, a union holding none is already left out", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+    }
+  }
+
+  void valid_types(descrip_define::type_list_type& types)
+  {
+    for (auto& tdefine : types)
+    {
       for (auto& member : tdefine.m_members)
       {
+        if (member.m_optional)
+        {
+          valid_optional_member(tdefine, member);
+        }
+        if (member.m_bytes && member.m_default_value.length())
+        {
+          throw parse_execption("member syntax error ,bytes has no default value, it starts empty", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+        if (member.m_enum_name.length())
+        {
+          valid_enum_member(member);
+        }
         if (member.m_type == e_base_type::type)
         {
           type_define * tdef = (type_define *)m_define.find_decl_type(member.m_typename);
@@ -919,6 +1298,34 @@ public:
             member.m_default_value = "0.0";
           }
         }
+        if (member.m_type == e_base_type::boolean)
+        {
+          const std::string& value = member.m_default_value;
+          if (value.empty() || value == "false" || value == "0")
+          {
+            member.m_default_value = "false";
+          }
+          else if (value == "true" || value == "1")
+          {
+            member.m_default_value = "true";
+          }
+          else
+          {
+            throw parse_execption("member syntax error ,default value of bool is true or false", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+          }
+        }
+        if (member.m_type == e_base_type::bits)
+        {
+          if (member.m_default_value.length())
+          {
+            throw parse_execption("member syntax error ,bits has no default value, it starts with no bit set", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+          }
+          int count = std::strtol(member.m_size.c_str(), nullptr, 10);
+          if (!valid_integer_value_string(member.m_size) || count <= 0)
+          {
+            throw parse_execption("member syntax error ,bits count should be an integer > 0", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+          }
+        }
         if (member.is_container())
         {
           if(member.m_type == map)
@@ -926,7 +1333,26 @@ public:
             tdefine.m_cpp_opt.force_inline = false;
           }
           tdefine.m_ismulti = true;
-          if (member.m_size.length())
+          if (member.m_type == e_base_type::array)
+          {
+            if (member.m_default_value.length())
+            {
+              throw parse_execption("member syntax error ,array has no default value, its elements start at zero or empty", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            int count = std::strtol(member.m_size.c_str(), nullptr, 10);
+            if (!valid_integer_value_string(member.m_size) || count <= 0)
+            {
+              throw parse_execption("member syntax error ,array element count should be an integer > 0", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            // the elements of an array are written as members are, a fix_ element in its bytes
+            member_define& element = member.m_template_parameters[0];
+            if (element.is_fixed())
+            {
+              element.m_type = (e_base_type)(element.m_type + e_base_type::int8 - e_base_type::fix_int8);
+              element.m_fixed = true;
+            }
+          }
+          else if (member.m_size.length())
           {
             if (!valid_integer_value_string(member.m_size))
             {
@@ -945,6 +1371,10 @@ public:
               type_define * tdef = (type_define *)m_define.find_decl_type(ptype.m_typename);
               ptype.m_typedef = tdef;
             }
+            if (ptype.m_enum_name.length())
+            {
+              valid_enum_member(ptype);
+            }
             if (ptype.m_type == e_base_type::string)
             {
               if (ptype.m_size.length())
@@ -976,6 +1406,480 @@ public:
           {
             member.m_deleted = true;
           }
+          else if (option.first == "sized")
+          {
+            if (member.m_type != e_base_type::list && member.m_type != e_base_type::map)
+            {
+              throw parse_execption("member syntax error ,sized option only for list and map", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_sized = true;
+          }
+          else if (option.first == "delta" || option.first == "delta2" || option.first == "rle" || option.first == "bitmap")
+          {
+            if (member.m_type != e_base_type::list || !member.m_template_parameters[0].is_integer() || member.m_template_parameters[0].m_enum)
+            {
+              throw parse_execption("member syntax error ," + option.first + " option only for list of integer, not of enum", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (option.first == "bitmap" && member.m_template_parameters[0].m_type != e_base_type::uint32)
+            {
+              throw parse_execption("member syntax error ,bitmap option only for list<uint32>", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (member.m_encoding != list_plain)
+            {
+              throw parse_execption("member syntax error ,only one of delta, delta2, rle, bitmap and xor", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (option.first == "bitmap")
+            {
+              member.m_encoding = list_bitmap;
+            }
+            else
+            {
+              member.m_encoding = option.first == "delta" ? list_delta : option.first == "delta2" ? list_delta2 : list_rle;
+            }
+          }
+          else if (option.first == "xor")
+          {
+            if (member.m_type != e_base_type::list || !member.m_template_parameters[0].is_float())
+            {
+              throw parse_execption("member syntax error ,xor option only for list of float32 or float64", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (member.m_encoding != list_plain)
+            {
+              throw parse_execption("member syntax error ,only one of delta, delta2, rle, bitmap and xor", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_encoding = list_xor;
+          }
+          else if (option.first == "dict")
+          {
+            if (member.m_type != e_base_type::string || member.m_bytes)
+            {
+              throw parse_execption("member syntax error ,dict option only for string", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_dict = true;
+          }
+          else if (option.first == "align")
+          {
+            if (!member.m_bytes)
+            {
+              throw parse_execption("member syntax error ,align option only for bytes", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            int align = std::strtol(option.second.c_str(), nullptr, 10);
+            if (option.second.empty() || !valid_integer_value_string(option.second) || align <= 0 || align > 256 || (align & (align - 1)) != 0)
+            {
+              throw parse_execption("member syntax error ,align option should be a power of 2 up to 256, usage bytes frame [align=16];", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_align = align > 1 ? align : 0;
+          }
+          else if (option.first == "view")
+          {
+            if (!member.m_bytes)
+            {
+              throw parse_execption("member syntax error ,view option only for bytes", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_view = true;
+          }
+          else if (option.first == "columnar")
+          {
+            if (member.m_type != e_base_type::list || member.m_template_parameters[0].m_type != e_base_type::type)
+            {
+              throw parse_execption("member syntax error ,columnar option only for list of type", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            const type_define * element = member.m_template_parameters[0].m_typedef;
+            if (element != nullptr && element->m_members.size() > 63)
+            {
+              throw parse_execption("member syntax error ,columnar option only for a type of at most 63 members", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (element != nullptr && element->m_packed)
+            {
+              throw parse_execption("member syntax error ,columnar option not for a list of packed type, it is already one block", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (element != nullptr && element->m_union)
+            {
+              throw parse_execption("member syntax error ,columnar option not for a list of union type, its elements have different members", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            for (std::size_t i = 0; element != nullptr && i < element->m_members.size(); ++i)
+            {
+              if (element->m_members[i].m_optional)
+              {
+                throw parse_execption("member syntax error ,columnar option not for a list of type with optional member " + element->m_members[i].m_name, member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+              }
+            }
+            member.m_columnar = true;
+          }
+          else if (option.first == "soa")
+          {
+            if (member.m_type != e_base_type::list || member.m_template_parameters[0].m_type != e_base_type::type)
+            {
+              throw parse_execption("member syntax error ,soa option only for list of type", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            const type_define * element = member.m_template_parameters[0].m_typedef;
+            if (element == nullptr || !element->m_soa)
+            {
+              throw parse_execption("member syntax error ,soa option needs soa = " + member.m_template_parameters[0].m_typename + "; for the element type", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_soa = true;
+          }
+          else if (option.first == "bits")
+          {
+            if (!member.is_integer() || member.m_enum)
+            {
+              throw parse_execption("member syntax error ,bits option only for integer, not enum", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            int width = std::strtol(option.second.c_str(), nullptr, 10);
+            int type_width = 8 << ((member.m_type - e_base_type::int8) / 2);
+            if (option.second.empty() || !valid_integer_value_string(option.second) || width <= 0 || width > type_width)
+            {
+              throw parse_execption("member syntax error ,bits option should be 1 to the bit width of the integer, usage int32 level [bits=7];", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            member.m_bit_width = width;
+          }
+          else if (option.first == "quant")
+          {
+            if (!member.is_float())
+            {
+              throw parse_execption("member syntax error ,quant option only for float32 and float64", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            auto min_option = member.m_options.find("min");
+            auto max_option = member.m_options.find("max");
+            double step = 0, qmin = 0, qmax = 0;
+            if (min_option == member.m_options.end() || max_option == member.m_options.end()
+              || !valid_float_option(option.second, step) || !valid_float_option(min_option->second, qmin) || !valid_float_option(max_option->second, qmax)
+              || !(step > 0) || !(qmin < qmax))
+            {
+              throw parse_execption("member syntax error ,quant option needs a step > 0 and min < max, usage float32 x [quant=0.01, min=-8192, max=8192];", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            if (member.m_options.find("bits") != member.m_options.end())
+            {
+              throw parse_execption("member syntax error ,quant option takes its bits from min, max and the step, no bits option", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            // the steps of max, as adata::quantize counts them
+            double steps = (qmax - qmin) / step + 0.5;
+            if (steps >= 18446744073709551616.0)
+            {
+              throw parse_execption("member syntax error ,quant option has more steps from min to max than a uint64", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+            uint64_t count = (uint64_t)steps;
+            int width = 1;
+            while (width < 64 && (count >> width) != 0)
+            {
+              ++width;
+            }
+            member.m_bit_width = width;
+            member.m_quant_step = option.second;
+            member.m_quant_min = min_option->second;
+            member.m_quant_max = max_option->second;
+          }
+          else if (option.first == "min" || option.first == "max")
+          {
+            if (member.m_options.find("quant") == member.m_options.end())
+            {
+              throw parse_execption("member syntax error ," + option.first + " option only with quant", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void valid_tables()
+  {
+    for (std::size_t i = 0; i < m_define.m_tables.size(); ++i)
+    {
+      const table_define& table = m_define.m_tables[i];
+      const type_define* tdefine = nullptr;
+      for (auto& t : m_define.m_types)
+      {
+        if (t.m_name == table.m_typename)
+        {
+          tdefine = &t;
+          break;
+        }
+      }
+      if (tdefine == nullptr)
+      {
+        throw parse_execption("table syntax error ,table type must be declared in this file", table.m_parser_lines, table.m_parser_cols, table.m_parser_include);
+      }
+      for (std::size_t j = 0; j < i; ++j)
+      {
+        if (m_define.m_tables[j].m_typename == table.m_typename)
+        {
+          throw parse_execption("table syntax error ,redefine table", table.m_parser_lines, table.m_parser_cols, table.m_parser_include);
+        }
+      }
+      const member_define* key = nullptr;
+      for (auto& member : tdefine->m_members)
+      {
+        if (member.m_name == table.m_key)
+        {
+          key = &member;
+          break;
+        }
+      }
+      if (key == nullptr)
+      {
+        throw parse_execption("table syntax error ,key member not found", table.m_parser_lines, table.m_parser_cols, table.m_parser_include);
+      }
+      if (!key->is_integer() || key->m_deleted || key->m_optional)
+      {
+        throw parse_execption("table syntax error ,key member must be an integer, not optional and not deleted", table.m_parser_lines, table.m_parser_cols, table.m_parser_include);
+      }
+    }
+  }
+
+  void valid_soas()
+  {
+    // member functions of the generated container
+    static const char * const reserved[] = { "size", "empty", "clear", "resize", "push_back", "at", "set" };
+    for (auto& soa : m_define.m_soas)
+    {
+      type_define * tdefine = (type_define *)m_define.find_decl_type(soa.m_typename);
+      if (tdefine == nullptr)
+      {
+        throw parse_execption("soa syntax error ,type not found", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      if (tdefine->m_soa)
+      {
+        throw parse_execption("soa syntax error ,redefine soa", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      if (tdefine->m_packed)
+      {
+        throw parse_execption("soa syntax error ,a list of packed type is already one block", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      if (tdefine->m_union)
+      {
+        throw parse_execption("soa syntax error ,a union holds only one of its members", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      if (tdefine->m_members.size() > 63)
+      {
+        throw parse_execption("soa syntax error ,soa type of at most 63 members", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      bool live = false;
+      for (auto& member : tdefine->m_members)
+      {
+        for (auto name : reserved)
+        {
+          if (member.m_name == name)
+          {
+            throw parse_execption("soa syntax error ,member " + member.m_name + " has the name of a soa container function", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+          }
+        }
+        if (member.m_optional)
+        {
+          throw parse_execption("soa syntax error ,member " + member.m_name + " is optional, a column holds a value for every element", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+        }
+        live = live || member.m_options.find("delete") == member.m_options.end();
+      }
+      if (!live)
+      {
+        throw parse_execption("soa syntax error ,soa type has no member", soa.m_parser_lines, soa.m_parser_cols, soa.m_parser_include);
+      }
+      tdefine->m_soa = true;
+    }
+  }
+
+  // a flat type in a flat buffer of this file
+  void valid_flat_reference(const flat_define& flat, const member_define& member, const member_define& ref)
+  {
+    if (ref.m_type != e_base_type::type)
+    {
+      return;
+    }
+    const type_define * tdefine = m_define.find_decl_type(ref.m_typename);
+    if (tdefine->m_union)
+    {
+      throw parse_execption("flat syntax error ,member " + member.m_name + " holds a union, not supported by flat", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+    }
+    if (!tdefine->m_flat)
+    {
+      throw parse_execption("flat syntax error ,member " + member.m_name + " needs flat = " + ref.m_typename + "; for its type", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+    }
+  }
+
+  // a flat type is read in place from its flat buffer, so are the types it holds
+  void valid_flats()
+  {
+    // members of the generated view
+    static const char * const reserved[] = { "value_type", "slot_size", "load_slot" };
+    for (auto& flat : m_define.m_flats)
+    {
+      type_define * tdefine = (type_define *)m_define.find_decl_type(flat.m_typename);
+      if (tdefine == nullptr)
+      {
+        throw parse_execption("flat syntax error ,type not found", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+      }
+      if (tdefine->m_flat)
+      {
+        throw parse_execption("flat syntax error ,redefine flat", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+      }
+      if (tdefine->m_union)
+      {
+        throw parse_execption("flat syntax error ,a union holds only one of its members", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+      }
+      tdefine->m_flat = true;
+    }
+    for (auto& flat : m_define.m_flats)
+    {
+      const type_define * tdefine = m_define.find_decl_type(flat.m_typename);
+      for (auto& member : tdefine->m_members)
+      {
+        if (member.m_deleted)
+        {
+          continue;
+        }
+        for (auto name : reserved)
+        {
+          if (member.m_name == name)
+          {
+            throw parse_execption("flat syntax error ,member " + member.m_name + " has the name of a flat view function", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+          }
+        }
+        if (member.m_optional && tdefine->has_member("has_" + member.m_name))
+        {
+          throw parse_execption("flat syntax error ,member has_" + member.m_name + " has the name of a flat view function", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+        }
+        if (member.m_soa)
+        {
+          throw parse_execption("flat syntax error ,member " + member.m_name + " is a soa container, not supported by flat", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+        }
+        valid_flat_reference(flat, member, member);
+        for (auto& ptype : member.m_template_parameters)
+        {
+          valid_flat_reference(flat, member, ptype);
+        }
+        if (member.m_type == e_base_type::map && member.m_template_parameters[0].m_type == e_base_type::type)
+        {
+          throw parse_execption("flat syntax error ,member " + member.m_name + " has a data struct key, not supported by flat", flat.m_parser_lines, flat.m_parser_cols, flat.m_parser_include);
+        }
+      }
+    }
+  }
+
+  // a packed type has no tag to tell old data from new, its layout can never change
+  void valid_packed(descrip_define::type_list_type& types)
+  {
+    for (auto& tdefine : types)
+    {
+      if (!tdefine.m_packed)
+      {
+        continue;
+      }
+      if (tdefine.m_members.empty())
+      {
+        throw parse_execption("packed type syntax error ,packed type has no member", tdefine.m_parser_lines, tdefine.m_parser_cols, tdefine.m_parser_include);
+      }
+      for (auto& member : tdefine.m_members)
+      {
+        if (!member.m_options.empty())
+        {
+          throw parse_execption("packed type syntax error ,member " + member.m_name + " of a packed type can't have an option, not even [delete]", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+        if (member.m_default_value.length())
+        {
+          throw parse_execption("packed type syntax error ,member " + member.m_name + " of a packed type can't have a default value", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+        if (member.is_fixed() || member.is_float())
+        {
+          continue;
+        }
+        const type_define * element = member.m_type == e_base_type::type ? m_define.find_decl_type(member.m_typename) : nullptr;
+        if (element == nullptr || !element->m_packed || element == &tdefine)
+        {
+          throw parse_execption("packed type syntax error ,member " + member.m_name + " should be a fix_ integer, a float or another packed type", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+      }
+    }
+  }
+
+  // a member of a union is a type with tag and len_tag, so a reader that doesn't know it can skip it
+  void valid_unions(descrip_define::type_list_type& types)
+  {
+    for (auto& tdefine : types)
+    {
+      if (!tdefine.m_union)
+      {
+        continue;
+      }
+      if (tdefine.m_members.empty())
+      {
+        throw parse_execption("union type syntax error ,union type has no member", tdefine.m_parser_lines, tdefine.m_parser_cols, tdefine.m_parser_include);
+      }
+      for (auto& member : tdefine.m_members)
+      {
+        if (member.m_name == "none")
+        {
+          throw parse_execption("union type syntax error ,none is the kind of an empty union, not a member name", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+        for (auto& option : member.m_options)
+        {
+          if (option.first != "delete")
+          {
+            throw parse_execption("union type syntax error ,member " + member.m_name + " of a union type can only have the [delete] option", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+          }
+        }
+        if (member.m_default_value.length())
+        {
+          throw parse_execption("union type syntax error ,member " + member.m_name + " of a union type can't have a default value", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+        const type_define * element = member.m_type == e_base_type::type ? m_define.find_decl_type(member.m_typename) : nullptr;
+        if (element == nullptr || element->m_packed || element->m_union)
+        {
+          throw parse_execption("union type syntax error ,member " + member.m_name + " should be a type, not a packed or union one", member.m_parser_lines, member.m_parser_cols, member.m_parser_include);
+        }
+      }
+    }
+  }
+
+  void valid_transcodes()
+  {
+    for (std::size_t i = 0; i < m_define.m_transcodes.size(); ++i)
+    {
+      transcode_define& transcode = m_define.m_transcodes[i];
+      transcode.m_from_define = m_define.find_decl_type(transcode.m_from);
+      transcode.m_to_define = m_define.find_decl_type(transcode.m_to);
+      if (transcode.m_from_define == nullptr || transcode.m_to_define == nullptr)
+      {
+        throw parse_execption("transcode syntax error ,type not found", transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+      }
+      if (transcode.m_from_define == transcode.m_to_define)
+      {
+        throw parse_execption("transcode syntax error ,transcode a type to itself", transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+      }
+      if (transcode.m_from_define->m_packed || transcode.m_to_define->m_packed)
+      {
+        throw parse_execption("transcode syntax error ,packed type has no other version", transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+      }
+      if (transcode.m_from_define->m_union || transcode.m_to_define->m_union)
+      {
+        throw parse_execption("transcode syntax error ,a union is not transcoded", transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+      }
+      for (std::size_t j = 0; j < i; ++j)
+      {
+        if (m_define.m_transcodes[j].m_from_define == transcode.m_from_define && m_define.m_transcodes[j].m_to_define == transcode.m_to_define)
+        {
+          throw parse_execption("transcode syntax error ,redefine transcode", transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+        }
+      }
+    }
+    // nested types may use any declared transcode, so check members once all are known
+    for (const auto& transcode : m_define.m_transcodes)
+    {
+      for (const auto& to_member : transcode.m_to_define->m_members)
+      {
+        if (to_member.m_deleted)
+        {
+          continue;
+        }
+        for (const auto& from_member : transcode.m_from_define->m_members)
+        {
+          if (from_member.m_name == to_member.m_name && !from_member.m_deleted)
+          {
+            if (transcode_member_kind(m_define, from_member, to_member) == transcode_incompatible)
+            {
+              std::string msg = "transcode syntax error ,member " + to_member.m_name + " type not compatible";
+              throw parse_execption(msg, transcode.m_parser_lines, transcode.m_parser_cols, transcode.m_parser_include);
+            }
+            break;
+          }
         }
       }
     }
@@ -1038,8 +1942,16 @@ public:
       }
 
       // Nous Xiong: add include_types valid
+      valid_packed(m_define.m_include_types);
+      valid_packed(m_define.m_types);
+      valid_unions(m_define.m_include_types);
+      valid_unions(m_define.m_types);
+      valid_soas();
       valid_types(m_define.m_include_types);
       valid_types(m_define.m_types);
+      valid_flats();
+      valid_tables();
+      valid_transcodes();
     }
   }
 
@@ -1068,6 +1980,22 @@ public:
       {
         parser_include();
       }
+      else if (identity == "table")
+      {
+        parser_table();
+      }
+      else if (identity == "transcode")
+      {
+        parser_transcode();
+      }
+      else if (identity == "soa")
+      {
+        parser_soa();
+      }
+      else if (identity == "flat")
+      {
+        parser_flat();
+      }
       else
       {
         if (opt.camel_case)
@@ -1078,13 +2006,26 @@ public:
           identity = namespace_.m_fullname + "." + identity;
         }
 
-        if (m_define.find_decl_type(identity))
+        if (m_define.find_decl_type(identity) || m_define.find_enum(identity))
         {
           throw parse_execption("redefine type", m_lines, m_cols, m_include);
         }
+        std::string attribute = parser_type_attribute();
+        if (attribute == "enum")
+        {
+          enum_define e_define;
+          e_define.m_parser_lines = m_lines;
+          e_define.m_parser_cols = m_cols;
+          e_define.m_parser_include = m_include;
+          e_define.m_name = identity;
+          parser_enum(e_define);
+          m_define.m_enums.push_back(e_define);
+        }
         else
         {
           type_define t_define;
+          t_define.m_packed = attribute == "packed";
+          t_define.m_union = attribute == "union";
           t_define.m_parser_lines = m_lines;
           t_define.m_parser_cols = m_cols;
           t_define.m_parser_include = m_include;
@@ -119,6 +119,117 @@ void run_program()
     return;
   }
 
+  // tags wider than 64 bits, encoded, columnar and [sized] lists are only generated for c++ and read by the adt runtimes,
+  // the id_set of a bitmap member and the container of a soa member have no lua binding,
+  // bool, bits and array only have c++ and lua types, runs of [bits] members are only packed by c++ and the adt runtimes,
+  // and so are [packed] types written without their tag, [quant] floats and [dict] strings,
+  // an enum is its underlying integer in the other languages and has no lua binding, nor has a [union] or an optional member
+  for (auto& gen_type : opt.gen)
+  {
+    bool other_lang = gen_type == "csharp" || gen_type == "java" || gen_type == "kt";
+    if (!other_lang && gen_type != "cpp2lua")
+    {
+      continue;
+    }
+    for (auto& tdefine : define.m_types)
+    {
+      if (other_lang && tdefine.m_members.size() > 63)
+      {
+        std::cerr << "error type " << tdefine.m_name << " has more than 63 members, not supported by " << gen_type << std::endl;
+        return;
+      }
+      if (other_lang && tdefine.m_packed)
+      {
+        std::cerr << "error type " << tdefine.m_name << " is packed, not supported by " << gen_type << std::endl;
+        return;
+      }
+      if (tdefine.m_union)
+      {
+        std::cerr << "error type " << tdefine.m_name << " is a union, not supported by " << gen_type << std::endl;
+        return;
+      }
+      for (auto& mdefine : tdefine.m_members)
+      {
+        const member_define& element = mdefine.m_template_parameters.empty() ? mdefine : mdefine.m_template_parameters.back();
+        if (other_lang && element.m_typedef != nullptr && element.m_typedef->m_packed)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is of a packed type, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (element.m_typedef != nullptr && element.m_typedef->m_union)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is of a union type, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (mdefine.m_optional)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is optional, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (mdefine.m_bytes)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is bytes, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang ? mdefine.m_encoding != list_plain : mdefine.m_encoding == list_bitmap)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " has a list encoding, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && (mdefine.m_type == e_base_type::boolean || mdefine.m_type == e_base_type::bits))
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is a bool or bits, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.m_type == e_base_type::array)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is an array, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.is_quant())
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is quantized, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.m_dict)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is a dict string, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.m_bit_width)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " has a bits width, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.m_columnar)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is columnar, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (other_lang && mdefine.m_sized)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is sized, not supported by " << gen_type << std::endl;
+          return;
+        }
+        bool has_enum = mdefine.m_enum != nullptr;
+        for (const auto& ptype : mdefine.m_template_parameters)
+        {
+          has_enum = has_enum || ptype.m_enum != nullptr;
+        }
+        if (!other_lang && has_enum)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is an enum, not supported by " << gen_type << std::endl;
+          return;
+        }
+        if (!other_lang && mdefine.m_soa)
+        {
+          std::cerr << "error member " << tdefine.m_name << "." << mdefine.m_name << " is a soa container, not supported by " << gen_type << std::endl;
+          return;
+        }
+      }
+    }
+  }
+
   for (auto& gen_type : opt.gen)
   {
     if (gen_type == "cpp")
@@ -33,7 +33,10 @@ int type_weight[e_base_type::max_count] = {
   5,   //   string,
   5,   //   list,
   5,   //   map,
-  5   //   type,
+  5,   //   type,
+  1,   //   boolean,
+  5,   //   bits,
+  5   //   array,
 };
 
 int member_cmp(member_define* const a, member_define* const b)
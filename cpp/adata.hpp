@@ -30,9 +30,20 @@
 
 #include <cstring>
 
+#include <algorithm>
+#include <iterator>
+#include <new>
 #include <vector>
 #include <map>
 #include <string>
+#include <bitset>
+// array<T,N> members are ::std::array and optional<T> members can be moved, only with c++11
+#if (defined(_MSC_VER) && _MSC_VER >= 1600) || __cplusplus >= 201103L
+# include <array>
+# include <utility>
+# define ADATA_HAS_STD_ARRAY
+# define ADATA_HAS_RVALUE_REFERENCES
+#endif
 
 //define inline macro
 #ifndef ADATA_INLINE
@@ -46,6 +57,17 @@
 # endif
 #endif
 
+// the string_dict of a thread's [dict] strings
+#ifndef ADATA_THREAD_LOCAL
+# ifdef _MSC_VER
+#  define ADATA_THREAD_LOCAL __declspec(thread)
+# elif __cplusplus >= 201103L
+#  define ADATA_THREAD_LOCAL thread_local
+# else
+#  define ADATA_THREAD_LOCAL __thread
+# endif
+#endif
+
 //define endian check macro
 
 #ifdef _WIN32
@@ -118,6 +140,11 @@ namespace adata
     stream_buffer_overflow,
     number_of_element_not_match,
     undefined_member_protocol_not_compatible,
+    table_format_not_match,
+    table_key_duplicated,
+    table_reader_overflow,
+    enum_value_undefined,
+    flat_format_not_match,
   };
 
   class exception : public ::std::exception
@@ -143,6 +170,16 @@ namespace adata
         return "stream buffer overflow";
       case number_of_element_not_match:
         return "number of element not match";
+      case table_format_not_match:
+        return "table pack format not match";
+      case table_key_duplicated:
+        return "table key duplicated";
+      case table_reader_overflow:
+        return "too many table readers";
+      case enum_value_undefined:
+        return "value is not an enumerator of the enum";
+      case flat_format_not_match:
+        return "flat buffer format not match";
       default:
         break;
       }
@@ -234,7 +271,7 @@ namespace adata
   {
     if (0 <= value && value < const_tag_as_type) return 1;
     uint64_t temp = value;
-    if (value < 0) value = -value;
+    if (value < 0) temp = -value;
     if (temp < 0x100) return 2;
     else if (temp < 0x10000) return 3;
     else if (temp < 0x1000000) return 4;
@@ -719,7 +756,7 @@ namespace adata
     const int bytes = sizeof(value_type);
     value_type read_value[2] = { 0 };
     stream.read((char*)&value, 1);
-    if (value > const_tag_as_value)
+    if ((uint8_t)value > const_tag_as_value)
     {
       int sign = 1;
       if ((long)value & const_negative_bit_value)
@@ -1016,7 +1053,7 @@ namespace adata
       if (value < 0)
       {
         bytes[0] = 0x80 | const_negative_bit_value;
-        bytes[1] = (uint8_t)value;
+        bytes[1] = (uint8_t)-value;
       }
       else
       {
@@ -1160,7 +1197,7 @@ namespace adata
         negative_bit = const_negative_bit_value;
         temp = -value;
       }
-      uint8_t * ptr = (uint8_t *)&value;
+      uint8_t * ptr = (uint8_t *)&temp;
       if (temp < 0x100)
       {
         bytes[1] = ptr[ADATA_LEPOS4_0];
@@ -1299,7 +1336,7 @@ namespace adata
         negative_bit = const_negative_bit_value;
         temp = -value;
       }
-      uint8_t * ptr = (uint8_t *)&value;
+      uint8_t * ptr = (uint8_t *)&temp;
       if (temp < 0x100)
       {
         bytes[1] = ptr[ADATA_LEPOS8_0];
@@ -2133,7 +2170,7 @@ namespace adata
         negative_bit = const_negative_bit_value;
         temp = -value;
       }
-      uint8_t * ptr = (uint8_t *)&value;
+      uint8_t * ptr = (uint8_t *)&temp;
       if (temp < 0x100)
       {
         uint8_t * wptr = stream.append_write(2);
@@ -2211,7 +2248,7 @@ namespace adata
         negative_bit = const_negative_bit_value;
         temp = -value;
       }
-      uint8_t * ptr = (uint8_t *)&value;
+      uint8_t * ptr = (uint8_t *)&temp;
       if (temp < 0x100)
       {
         uint8_t * wptr = stream.append_write(2);
@@ -2352,7 +2389,7 @@ namespace adata
         negative_bit = const_negative_bit_value;
         temp = -value;
       }
-      uint8_t * ptr = (uint8_t *)&value;
+      uint8_t * ptr = (uint8_t *)&temp;
       if (temp < 0x100)
       {
         uint8_t * wptr = stream.append_write(2);
@@ -2509,16 +2546,344 @@ namespace adata
     stream.write(str.data(), len);
   }
 
+  // a bool member is only its tag bit, set when it isn't the default. in raw data and in
+  // a [columnar] list it takes a byte or a bit
+  ADATA_INLINE int32_t size_of(bool)
+  {
+    return 1;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read(stream_ty& stream, bool& value)
+  {
+    uint8_t byte = 0;
+    read(stream, byte);
+    value = byte != 0;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream, bool value)
+  {
+    uint8_t byte = value ? 1 : 0;
+    write(stream, byte);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, bool *)
+  {
+    skip_read(stream, (uint8_t *)0);
+  }
+
+  namespace detail
+  {
+    // bit i of bits in bit i % 8 of byte i / 8
+    template<typename stream_ty, typename bits_ty>
+    ADATA_INLINE void write_bit_items(stream_ty& stream, const bits_ty& bits, ::std::size_t count)
+    {
+      char bytes[64];
+      ::std::size_t i = 0;
+      while (i < count)
+      {
+        ::std::size_t n = 0;
+        for (; n < sizeof(bytes) && i < count; ++n)
+        {
+          uint8_t byte = 0;
+          for (int b = 0; b < 8 && i < count; ++b, ++i)
+          {
+            if (bits[i]) byte |= (uint8_t)(1 << b);
+          }
+          bytes[n] = (char)byte;
+        }
+        stream.write(bytes, n);
+      }
+    }
+
+    template<typename stream_ty, typename bits_ty>
+    ADATA_INLINE void read_bit_items(stream_ty& stream, bits_ty& bits, ::std::size_t count)
+    {
+      char bytes[64];
+      ::std::size_t i = 0;
+      while (i < count)
+      {
+        ::std::size_t n = (count - i + 7) / 8;
+        if (n > sizeof(bytes)) n = sizeof(bytes);
+        stream.read(bytes, n);
+        for (::std::size_t k = 0; k < n; ++k)
+        {
+          uint8_t byte = (uint8_t)bytes[k];
+          for (int b = 0; b < 8 && i < count; ++b, ++i)
+          {
+            bits[i] = ((byte >> b) & 1) != 0;
+          }
+        }
+      }
+    }
+  }
+
+  // a bits<N> member, N bits packed in (N + 7) / 8 bytes
+  template<::std::size_t count>
+  ADATA_INLINE int32_t size_of(const ::std::bitset<count>&)
+  {
+    return (int32_t)((count + 7) / 8);
+  }
+
+  template<typename stream_ty, ::std::size_t count>
+  ADATA_INLINE void read(stream_ty& stream, ::std::bitset<count>& value)
+  {
+    detail::read_bit_items(stream, value, count);
+  }
+
+  template<typename stream_ty, ::std::size_t count>
+  ADATA_INLINE void write(stream_ty& stream, const ::std::bitset<count>& value)
+  {
+    detail::write_bit_items(stream, value, count);
+  }
+
+  template<typename stream_ty, ::std::size_t count>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::std::bitset<count> *)
+  {
+    stream.skip_read((count + 7) / 8);
+  }
+
+  namespace detail
+  {
+    template<typename stream_ty>
+    ADATA_INLINE uint8_t read_bit_byte(stream_ty& stream)
+    {
+      uint8_t byte = 0;
+      stream.read((char *)&byte, 1);
+      return byte;
+    }
+
+    ADATA_INLINE uint8_t read_bit_byte(zero_copy_buffer& stream)
+    {
+      return stream.get_char();
+    }
+
+    template<typename ty>
+    struct is_signed_integer
+    {
+      enum { value = ty(-1) < ty(0) };
+    };
+  }
+
+  // a [quant=step, min=, max=] float is its count of steps from min, the value clamped to
+  // min..max first and NaN taken as min. no branch, so a loop over a column vectorizes
+  ADATA_INLINE uint64_t quantize(double value, double step, double min, double max)
+  {
+    value = value >= min ? value : min;
+    value = value <= max ? value : max;
+    return (uint64_t)((value - min) / step + 0.5);
+  }
+
+  ADATA_INLINE double dequantize(uint64_t steps, double step, double min)
+  {
+    return min + (double)steps * step;
+  }
+
+  // a run of [bits=k] members: each present member takes k bits, the first one the low
+  // bits of the first byte, and the run is padded to a whole byte at the end
+  template<typename stream_ty>
+  class bit_writer
+  {
+  public:
+    explicit bit_writer(stream_ty& stream)
+      : m_stream(stream)
+      , m_bits(0)
+      , m_count(0)
+      , m_len(0)
+    {
+    }
+
+    // throw value_too_large_to_integer_number if value doesn't fit in width bits
+    ADATA_INLINE void write_unsigned(uint64_t value, int width)
+    {
+      if (width < 64 && (value >> width) != 0)
+      {
+        throw exception(value_too_large_to_integer_number);
+      }
+      put(value, width);
+    }
+
+    // a signed member takes 0 to 2^width - 1 as an unsigned one does, a negative value throws too
+    ADATA_INLINE void write_signed(int64_t value, int width)
+    {
+      if (value < 0)
+      {
+        throw exception(value_too_large_to_integer_number);
+      }
+      write_unsigned((uint64_t)value, width);
+    }
+
+    template<typename ty>
+    ADATA_INLINE void write(ty value, int width)
+    {
+      if (detail::is_signed_integer<ty>::value)
+      {
+        write_signed((int64_t)value, width);
+      }
+      else
+      {
+        write_unsigned((uint64_t)value, width);
+      }
+    }
+
+    // a [quant] float, max takes at most width bits
+    ADATA_INLINE void write_quant(double value, int width, double step, double min, double max)
+    {
+      put(quantize(value, step, min, max), width);
+    }
+
+    // the last bits padded with zero
+    ADATA_INLINE void flush()
+    {
+      if (m_count > 0)
+      {
+        m_bytes[m_len++] = (char)(uint8_t)m_bits;
+        m_bits = 0;
+        m_count = 0;
+      }
+      if (m_len > 0)
+      {
+        m_stream.write(m_bytes, m_len);
+        m_len = 0;
+      }
+    }
+
+  private:
+    ADATA_INLINE void put(uint64_t value, int width)
+    {
+      if (width > 56)
+      {
+        put_bits(value & 0xffffffffULL, 32);
+        put_bits(value >> 32, width - 32);
+        return;
+      }
+      put_bits(value, width);
+    }
+
+    ADATA_INLINE void put_bits(uint64_t value, int width)
+    {
+      m_bits |= value << m_count;
+      m_count += width;
+      while (m_count >= 8)
+      {
+        m_bytes[m_len++] = (char)(uint8_t)m_bits;
+        m_bits >>= 8;
+        m_count -= 8;
+        // never left full, flush has room for the last byte
+        if (m_len == sizeof(m_bytes))
+        {
+          m_stream.write(m_bytes, m_len);
+          m_len = 0;
+        }
+      }
+    }
+
+    stream_ty& m_stream;
+    uint64_t m_bits;
+    int m_count;
+    ::std::size_t m_len;
+    char m_bytes[64];
+  };
+
+  // reads what bit_writer wrote, a byte is taken only when its first bit is needed
+  template<typename stream_ty>
+  class bit_reader
+  {
+  public:
+    explicit bit_reader(stream_ty& stream)
+      : m_stream(stream)
+      , m_bits(0)
+      , m_count(0)
+    {
+    }
+
+    ADATA_INLINE uint64_t read_unsigned(int width)
+    {
+      return take(width);
+    }
+
+    // never negative, see bit_writer::write_signed
+    ADATA_INLINE int64_t read_signed(int width)
+    {
+      return (int64_t)take(width);
+    }
+
+    template<typename ty>
+    ADATA_INLINE void read(ty& value, int width)
+    {
+      if (detail::is_signed_integer<ty>::value)
+      {
+        value = (ty)read_signed(width);
+      }
+      else
+      {
+        value = (ty)read_unsigned(width);
+      }
+    }
+
+    template<typename ty>
+    ADATA_INLINE void read_quant(ty& value, int width, double step, double min)
+    {
+      value = (ty)dequantize(take(width), step, min);
+    }
+
+    ADATA_INLINE void skip(int width)
+    {
+      take(width);
+    }
+
+  private:
+    ADATA_INLINE uint64_t take(int width)
+    {
+      if (width > 56)
+      {
+        uint64_t low = take_bits(32);
+        return low | (take_bits(width - 32) << 32);
+      }
+      return take_bits(width);
+    }
+
+    ADATA_INLINE uint64_t take_bits(int width)
+    {
+      while (m_count < width)
+      {
+        m_bits |= (uint64_t)detail::read_bit_byte(m_stream) << m_count;
+        m_count += 8;
+      }
+      uint64_t value = m_bits & (((uint64_t)1 << width) - 1);
+      m_bits >>= width;
+      m_count -= width;
+      return value;
+    }
+
+    stream_ty& m_stream;
+    uint64_t m_bits;
+    int m_count;
+  };
+
+  // bytes of a run of bit_count bits
+  ADATA_INLINE int32_t size_of_bit_run(int32_t bit_count)
+  {
+    return (bit_count + 7) >> 3;
+  }
+
 #ifndef MAX_ADATA_LEN 
 # define MAX_ADATA_LEN 65535
 #endif
 
+  // a count or byte length read from the data, never negative, so it can be a size_t
   template<typename stream_ty>
   ADATA_INLINE int32_t check_read_size(stream_ty& stream, int size = 0)
   {
     int32_t len;
     read(stream, len);
-    if (size > 0 && len > size)
+    if (len < 0)
+    {
+      throw exception(number_of_element_not_match);
+    }
+    else if (size > 0 && len > size)
     {
       throw exception(number_of_element_not_match);
     }
@@ -2546,63 +2911,2653 @@ namespace adata
     }
   }
 
-  template<typename stream_ty , typename ty>
-  ADATA_INLINE void read_ec(stream_ty& stream , ty& value , error_code_t& ec)
+  // an enum of an adl file is an enum class written as its underlying integer. the generated
+  // enum_traits has its names and values in declaration order and the index of a value, from
+  // a table by value when the values are dense, else from a switch
+  template<typename enum_ty>
+  struct enum_traits;
+
+  // the name of an enumerator, "" for any other value
+  template<typename enum_ty>
+  ADATA_INLINE const char * to_string(enum_ty value)
   {
-    try
+    int32_t index = enum_traits<enum_ty>::index_of(value);
+    return index < 0 ? "" : enum_traits<enum_ty>::name(index);
+  }
+
+  template<typename enum_ty>
+  ADATA_INLINE bool from_string(const char * name, enum_ty& value)
+  {
+    for (int32_t i = 0; i < (int32_t)enum_traits<enum_ty>::count; ++i)
     {
-      read(stream, value);
+      if (std::strcmp(name, enum_traits<enum_ty>::name(i)) == 0)
+      {
+        value = enum_traits<enum_ty>::value(i);
+        return true;
+      }
     }
-    catch(exception& e)
+    return false;
+  }
+
+  // an integer read as an enum, one that is not an enumerator throws enum_value_undefined
+  template<typename enum_ty>
+  ADATA_INLINE enum_ty to_enum(typename enum_traits<enum_ty>::value_type value)
+  {
+    if (enum_traits<enum_ty>::index_of((enum_ty)value) < 0)
     {
-      ec = e.error_code();
+      throw exception(enum_value_undefined);
     }
+    return (enum_ty)value;
   }
 
-
-  template<typename stream_ty, typename ty>
-  ADATA_INLINE void fix_read_ec(stream_ty& stream, ty& value, error_code_t& ec)
+  // the integer column of the enums of a soa container
+  template<typename list_ty, typename column_ty>
+  ADATA_INLINE void enum_column(const list_ty& values, column_ty& column)
   {
-    try
+    column.resize(values.size());
+    for (::std::size_t i = 0; i < values.size(); ++i)
     {
-      fix_read(stream, value);
+      column[i] = (typename column_ty::value_type)values[i];
     }
-    catch (exception& e)
+  }
+
+  template<typename column_ty, typename list_ty>
+  ADATA_INLINE void enum_column_values(const column_ty& column, list_ty& values)
+  {
+    values.resize(column.size());
+    for (::std::size_t i = 0; i < column.size(); ++i)
     {
-      ec = e.error_code();
+      values[i] = to_enum<typename list_ty::value_type>(column[i]);
     }
   }
 
-  template<typename stream_ty, typename ty>
-  ADATA_INLINE void write_ec(stream_ty& stream, ty& value, error_code_t& ec)
+  template<typename enum_ty>
+  ADATA_INLINE int32_t size_of_enum(enum_ty value)
   {
-    try
+    return size_of((typename enum_traits<enum_ty>::value_type)value);
+  }
+
+  template<typename stream_ty, typename enum_ty>
+  ADATA_INLINE void write_enum(stream_ty& stream, enum_ty value)
+  {
+    typename enum_traits<enum_ty>::value_type v = (typename enum_traits<enum_ty>::value_type)value;
+    write(stream, v);
+  }
+
+  template<typename stream_ty, typename enum_ty>
+  ADATA_INLINE void read_enum(stream_ty& stream, enum_ty& value)
+  {
+    typename enum_traits<enum_ty>::value_type v = 0;
+    read(stream, v);
+    value = to_enum<enum_ty>(v);
+  }
+
+  template<typename stream_ty, typename enum_ty>
+  ADATA_INLINE void skip_read_enum(stream_ty& stream, enum_ty *)
+  {
+    skip_read(stream, (typename enum_traits<enum_ty>::value_type *)0);
+  }
+
+  // the strings of a message with [dict] members, written once in front of it. a [dict] string
+  // is a varint code, 1 + its index in the string_dict of the thread, or 0 and the string as
+  // usual when there is none or it isn't in it. a size_of in a collecting scope fills it, then
+  // write_strings and the message are written in a plain scope; the reader does read_strings
+  // and reads the message in a scope of its own
+  class string_dict
+  {
+  public:
+    // while a scope lives the [dict] strings of this thread go through dict. a collecting
+    // one adds the strings size_of meets, in the order it meets them
+    class scope
     {
-      write(stream, value);
+    public:
+      explicit scope(string_dict& dict, bool collect = false)
+        : m_dict(dict)
+        , m_prev(current())
+        , m_collect(dict.m_collect)
+      {
+        dict.m_collect = collect;
+        current() = &dict;
+      }
+
+      ~scope()
+      {
+        m_dict.m_collect = m_collect;
+        current() = m_prev;
+      }
+
+    private:
+      scope(const scope&);
+      scope& operator=(const scope&);
+
+      string_dict& m_dict;
+      string_dict * m_prev;
+      bool m_collect;
+    };
+
+    string_dict() : m_collect(false) {}
+
+    ADATA_INLINE static string_dict *& current()
+    {
+      static ADATA_THREAD_LOCAL string_dict * dict = 0;
+      return dict;
     }
-    catch (exception& e)
+
+    ADATA_INLINE void clear()
     {
-      ec = e.error_code();
+      m_ids.clear();
+      m_strings.clear();
     }
-  }
 
-  template<typename stream_ty, typename ty>
-  ADATA_INLINE void fix_write_ec(stream_ty& stream, ty& value, error_code_t& ec)
-  {
-    try
+    ADATA_INLINE std::size_t size() const { return m_strings.size(); }
+
+    ADATA_INLINE const std::string& operator[](std::size_t index) const { return m_strings[index]->first; }
+
+    // 1 + the index of value, 0 if it isn't in the dictionary
+    ADATA_INLINE uint32_t code(const std::string& value)
     {
-      fix_write(stream, value);
+      id_map::const_iterator i = m_ids.find(value);
+      if (i != m_ids.end())
+      {
+        return i->second + 1;
+      }
+      if (m_collect)
+      {
+        add(value);
+      }
+      return 0;
     }
-    catch (exception& e)
+
+    ADATA_INLINE int32_t size_of_strings() const
     {
-      ec = e.error_code();
+      int32_t len = (int32_t)m_strings.size();
+      int32_t size = size_of(len);
+      for (std::size_t i = 0; i < m_strings.size(); ++i)
+      {
+        size += size_of(m_strings[i]->first);
+      }
+      return size;
     }
-  }
 
-  template<typename T>
-  struct is_adata
-  {
-    static const bool value = false;
+    template<typename stream_ty>
+    ADATA_INLINE void write_strings(stream_ty& stream) const
+    {
+      int32_t len = (int32_t)m_strings.size();
+      write(stream, len);
+      for (std::size_t i = 0; i < m_strings.size(); ++i)
+      {
+        write(stream, m_strings[i]->first);
+      }
+    }
+
+    // duplicates keep their index but share the string of the first one
+    template<typename stream_ty>
+    ADATA_INLINE void read_strings(stream_ty& stream)
+    {
+      clear();
+      int32_t len = check_read_size(stream);
+      std::string value;
+      for (int32_t i = 0; i < len; ++i)
+      {
+        read(stream, value);
+        add(value);
+      }
+    }
+
+  private:
+    typedef std::map<std::string, uint32_t> id_map;
+
+    ADATA_INLINE void add(const std::string& value)
+    {
+      m_strings.push_back(m_ids.insert(std::make_pair(value, (uint32_t)m_strings.size())).first);
+    }
+
+    id_map m_ids;
+    std::vector<id_map::const_iterator> m_strings;
+    bool m_collect;
+  };
+
+  ADATA_INLINE int32_t size_of_dict_string(const std::string& value)
+  {
+    string_dict * dict = string_dict::current();
+    uint32_t code = dict ? dict->code(value) : 0;
+    return code ? size_of(code) : 1 + size_of(value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_dict_string(stream_ty& stream, const std::string& value)
+  {
+    string_dict * dict = string_dict::current();
+    uint32_t code = dict ? dict->code(value) : 0;
+    write(stream, code);
+    if (code == 0)
+    {
+      write(stream, value);
+    }
+  }
+
+  // a code needs the string_dict of the message in scope, read_strings fills it and without it
+  // the code throws undefined_member_protocol_not_compatible. the member is a std::string, so
+  // it gets a copy of its entry: the dictionary saves the bytes of the duplicates and decoding
+  // them, not their allocations
+  template<typename stream_ty>
+  ADATA_INLINE void read_dict_string(stream_ty& stream, std::string& value, int size = 0)
+  {
+    uint32_t code = 0;
+    read(stream, code);
+    if (code == 0)
+    {
+      int32_t len = check_read_size(stream, size);
+      value.resize(len);
+      stream.read((char *)value.data(), len);
+      return;
+    }
+    string_dict * dict = string_dict::current();
+    if (dict == 0 || code > dict->size())
+    {
+      throw exception(undefined_member_protocol_not_compatible);
+    }
+    const std::string& entry = (*dict)[code - 1];
+    if (size > 0 && entry.size() > (std::size_t)size)
+    {
+      throw exception(number_of_element_not_match);
+    }
+    value = entry;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void skip_read_dict_string(stream_ty& stream, int size = 0)
+  {
+    uint32_t code = 0;
+    read(stream, code);
+    if (code == 0)
+    {
+      stream.skip_read(check_read_size(stream, size));
+    }
+  }
+
+  // a bytes member, a buffer of its own or a view of bytes kept alive elsewhere, such as the
+  // read buffer a [view] member was read from. a copy of a view is a view of the same bytes
+  class bytes
+  {
+  public:
+    bytes() : m_data(0), m_size(0), m_view(false) {}
+
+    bytes(const char * data, std::size_t size) : m_data(0), m_size(0), m_view(false)
+    {
+      assign(data, size);
+    }
+
+    explicit bytes(const std::string& value) : m_data(0), m_size(0), m_view(false)
+    {
+      assign(value.data(), value.size());
+    }
+
+    bytes(const bytes& other) : m_data(0), m_size(0), m_view(false)
+    {
+      *this = other;
+    }
+
+    bytes& operator=(const bytes& other)
+    {
+      if (this == &other)
+      {
+        return *this;
+      }
+      if (other.m_view)
+      {
+        view(other.m_data, other.m_size);
+      }
+      else
+      {
+        assign(other.m_data, other.m_size);
+      }
+      return *this;
+    }
+
+#ifdef ADATA_HAS_RVALUE_REFERENCES
+    bytes(bytes&& other) : m_data(0), m_size(0), m_view(false)
+    {
+      swap(other);
+    }
+
+    bytes& operator=(bytes&& other)
+    {
+      swap(other);
+      return *this;
+    }
+#endif
+
+    ADATA_INLINE void swap(bytes& other)
+    {
+      // the bytes of a vector stay where they are when it is swapped
+      m_buffer.swap(other.m_buffer);
+      std::swap(m_data, other.m_data);
+      std::swap(m_size, other.m_size);
+      std::swap(m_view, other.m_view);
+    }
+
+    ADATA_INLINE const char * data() const { return m_data; }
+    ADATA_INLINE std::size_t size() const { return m_size; }
+    ADATA_INLINE bool empty() const { return m_size == 0; }
+    ADATA_INLINE bool is_view() const { return m_view; }
+
+    ADATA_INLINE void clear()
+    {
+      m_buffer.clear();
+      m_data = 0;
+      m_size = 0;
+      m_view = false;
+    }
+
+    // copies data into a buffer of its own
+    ADATA_INLINE void assign(const char * data, std::size_t size)
+    {
+      std::vector<char> buffer(data, data + size);
+      m_buffer.swap(buffer);
+      m_data = m_buffer.empty() ? 0 : &m_buffer[0];
+      m_size = size;
+      m_view = false;
+    }
+
+    // a buffer of its own of size bytes, for buffer() to fill
+    ADATA_INLINE void resize(std::size_t size)
+    {
+      own();
+      m_buffer.resize(size);
+      m_data = m_buffer.empty() ? 0 : &m_buffer[0];
+      m_size = size;
+    }
+
+    ADATA_INLINE char * buffer()
+    {
+      own();
+      return m_buffer.empty() ? 0 : &m_buffer[0];
+    }
+
+    // views data, which must outlive the view
+    ADATA_INLINE void view(const char * data, std::size_t size)
+    {
+      m_buffer.clear();
+      m_data = data;
+      m_size = size;
+      m_view = true;
+    }
+
+    // copies the bytes of a view into a buffer of its own
+    ADATA_INLINE void own()
+    {
+      if (m_view)
+      {
+        assign(m_data, m_size);
+      }
+    }
+
+    ADATA_INLINE std::string str() const { return std::string(m_data, m_size); }
+
+    ADATA_INLINE bool operator==(const bytes& other) const
+    {
+      return m_size == other.m_size && (m_size == 0 || std::memcmp(m_data, other.m_data, m_size) == 0);
+    }
+
+    ADATA_INLINE bool operator!=(const bytes& other) const { return !(*this == other); }
+
+  private:
+    std::vector<char> m_buffer;
+    const char * m_data;
+    std::size_t m_size;
+    bool m_view;
+  };
+
+  // a zero_copy_buffer that takes payloads of min_ref bytes and up by reference, for writev,
+  // WSASend or a list of asio buffers. the rest is written into the buffer of set_write, and
+  // segments() is the message in order, pieces of that buffer and the referenced payloads,
+  // which must live until it is sent. write_length() counts the referenced bytes, so an
+  // [align] payload is aligned in the gathered message
+  struct gather_buffer : zero_copy_buffer
+  {
+    struct segment
+    {
+      const char * data;
+      std::size_t size;
+    };
+
+    explicit gather_buffer(std::size_t min_ref = 256)
+      : m_min_ref(min_ref), m_ref_length(0), m_mark(0)
+    {
+    }
+
+    ADATA_INLINE void set_write(unsigned char* buffer, ::std::size_t length)
+    {
+      zero_copy_buffer::set_write(buffer, length);
+      reset_segments();
+    }
+
+    ADATA_INLINE void set_write(char* buffer, ::std::size_t length)
+    {
+      set_write((unsigned char*)buffer, length);
+    }
+
+    ADATA_INLINE void clear_write()
+    {
+      zero_copy_buffer::clear_write();
+      reset_segments();
+    }
+
+    ADATA_INLINE void clear()
+    {
+      zero_copy_buffer::clear();
+      reset_segments();
+    }
+
+    // a payload of min_ref bytes and up becomes a segment of its own, a smaller one is copied
+    ADATA_INLINE void write_ref(const char * data, std::size_t len)
+    {
+      if (len < m_min_ref)
+      {
+        write(data, len);
+        return;
+      }
+      close_piece();
+      segment seg = { data, len };
+      m_segments.push_back(seg);
+      m_ref_length += len;
+    }
+
+    ADATA_INLINE std::size_t write_length() const
+    {
+      return zero_copy_buffer::write_length() + m_ref_length;
+    }
+
+    // the bytes written into the buffer of set_write
+    ADATA_INLINE std::size_t buffer_length() const
+    {
+      return zero_copy_buffer::write_length();
+    }
+
+    ADATA_INLINE const std::vector<segment>& segments()
+    {
+      close_piece();
+      return m_segments;
+    }
+
+  private:
+    ADATA_INLINE void close_piece()
+    {
+      std::size_t end = zero_copy_buffer::write_length();
+      if (end > m_mark)
+      {
+        segment seg = { write_data() + m_mark, end - m_mark };
+        m_segments.push_back(seg);
+        m_mark = end;
+      }
+    }
+
+    ADATA_INLINE void reset_segments()
+    {
+      m_segments.clear();
+      m_ref_length = 0;
+      m_mark = 0;
+    }
+
+    std::size_t m_min_ref;
+    std::size_t m_ref_length;
+    std::size_t m_mark;
+    std::vector<segment> m_segments;
+  };
+
+  // a bytes member is written as a string. an [align] one has a pad byte p after its length,
+  // then p zeros, the payload and align - 1 - p zeros: the payload starts at a multiple of
+  // align from the start of the stream and the size doesn't depend on where it is written.
+  // align is 256 at most so p is a byte, and 0 or 1 for no alignment
+  const int32_t max_bytes_align = 256;
+
+  namespace detail
+  {
+    template<typename stream_ty>
+    ADATA_INLINE void write_zeros(stream_ty& stream, std::size_t count)
+    {
+      static const char zeros[max_bytes_align] = {};
+      if (count)
+      {
+        stream.write(zeros, count);
+      }
+    }
+
+    // empty bytes may have no data
+    template<typename stream_ty>
+    ADATA_INLINE void write_payload(stream_ty& stream, const char * data, std::size_t len)
+    {
+      if (len)
+      {
+        stream.write(data, len);
+      }
+    }
+
+    ADATA_INLINE void write_payload(gather_buffer& stream, const char * data, std::size_t len)
+    {
+      if (len)
+      {
+        stream.write_ref(data, len);
+      }
+    }
+
+    // the count of zeros after the payload
+    template<typename stream_ty>
+    ADATA_INLINE std::size_t write_align_pad(stream_ty& stream, int32_t align)
+    {
+      std::size_t pad = (std::size_t)(align - (int32_t)((stream.write_length() + 1) % (std::size_t)align)) % (std::size_t)align;
+      fix_write(stream, (uint8_t)pad);
+      write_zeros(stream, pad);
+      return (std::size_t)align - 1 - pad;
+    }
+
+    template<typename stream_ty>
+    ADATA_INLINE std::size_t read_align_pad(stream_ty& stream, int32_t align)
+    {
+      uint8_t pad = 0;
+      fix_read(stream, pad);
+      if ((int32_t)pad >= align)
+      {
+        throw exception(undefined_member_protocol_not_compatible);
+      }
+      stream.skip_read(pad);
+      return (std::size_t)align - 1 - pad;
+    }
+
+    // a [view] member views the read buffer, other streams have none to view
+    template<typename stream_ty>
+    ADATA_INLINE void read_payload(stream_ty& stream, bytes& value, std::size_t len, bool)
+    {
+      value.resize(len);
+      if (len)
+      {
+        stream.read(value.buffer(), len);
+      }
+    }
+
+    ADATA_INLINE void read_payload(zero_copy_buffer& stream, bytes& value, std::size_t len, bool view)
+    {
+      if (view)
+      {
+        value.view((const char *)stream.skip_read(len), len);
+        return;
+      }
+      value.resize(len);
+      if (len)
+      {
+        stream.read(value.buffer(), len);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t size_of_bytes(std::size_t len, int32_t align = 0)
+  {
+    int32_t size = (int32_t)len;
+    size += size_of(size);
+    return align > 1 ? size + align : size;
+  }
+
+  ADATA_INLINE int32_t size_of_bytes(const bytes& value, int32_t align = 0)
+  {
+    return size_of_bytes(value.size(), align);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_bytes(stream_ty& stream, const char * data, std::size_t len, int32_t align = 0)
+  {
+    int32_t size = (int32_t)len;
+    write(stream, size);
+    std::size_t tail = align > 1 ? detail::write_align_pad(stream, align) : 0;
+    detail::write_payload(stream, data, len);
+    detail::write_zeros(stream, tail);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_bytes(stream_ty& stream, const bytes& value, int32_t align = 0)
+  {
+    write_bytes(stream, value.data(), value.size(), align);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_bytes(stream_ty& stream, bytes& value, int32_t align = 0, bool view = false, int size = 0)
+  {
+    int32_t len = check_read_size(stream, size);
+    std::size_t tail = align > 1 ? detail::read_align_pad(stream, align) : 0;
+    detail::read_payload(stream, value, (std::size_t)len, view);
+    stream.skip_read(tail);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void skip_read_bytes(stream_ty& stream, int32_t align = 0, int size = 0)
+  {
+    int32_t len = check_read_size(stream, size);
+    std::size_t tail = align > 1 ? detail::read_align_pad(stream, align) : 0;
+    stream.skip_read((std::size_t)len + tail);
+  }
+
+  // bytes with no alignment, as a string is
+  ADATA_INLINE int32_t size_of(const bytes& value)
+  {
+    return size_of_bytes(value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read(stream_ty& stream, bytes& value)
+  {
+    read_bytes(stream, value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream, const bytes& value)
+  {
+    write_bytes(stream, value);
+  }
+
+  // types of more than 63 members: bit 63 of the tag says the presence of members 63 and up
+  // follows, in front of the first of them. words hold one bit per member index, word 0 bit 63
+  // being member 63. on the wire it is either a bitmap or the gaps between present members,
+  // whichever is shorter, so a few present members cost a few bytes however many there are.
+  const uint64_t ext_tag_bit = 0x8000000000000000ULL;
+
+  namespace detail
+  {
+    enum { ext_tag_bitmap = 0, ext_tag_delta = 1 };
+
+    // wire word k of the bitmap, members 63 + 64 * k and up
+    ADATA_INLINE uint64_t ext_tag_word(const uint64_t * words, ::std::size_t count, ::std::size_t k)
+    {
+      uint64_t word = words[k] >> 63;
+      if (k + 1 < count)
+      {
+        word |= words[k + 1] << 1;
+      }
+      return word;
+    }
+
+    ADATA_INLINE bool ext_tag_test(const uint64_t * words, ::std::size_t index)
+    {
+      return (words[index >> 6] & ((uint64_t)1 << (index & 63))) != 0;
+    }
+
+    // choose the encoding, return the wire word count of a bitmap or the member count of a delta list
+    ADATA_INLINE uint32_t ext_tag_layout(const uint64_t * words, ::std::size_t count, int& mode)
+    {
+      uint32_t present = 0;
+      ::std::size_t last = 63;
+      int32_t delta_size = 0;
+      for (::std::size_t i = 63; i < count * 64; ++i)
+      {
+        if (ext_tag_test(words, i))
+        {
+          delta_size += size_of((uint32_t)(present ? i - last - 1 : i - 63));
+          last = i;
+          ++present;
+        }
+      }
+      uint32_t bitmap_words = present ? (uint32_t)((last - 63) / 64 + 1) : 0;
+      int32_t bitmap_size = 0;
+      for (uint32_t k = 0; k < bitmap_words; ++k)
+      {
+        bitmap_size += size_of(ext_tag_word(words, count, k));
+      }
+      delta_size += size_of((uint32_t)(present << 1 | ext_tag_delta));
+      bitmap_size += size_of((uint32_t)(bitmap_words << 1 | ext_tag_bitmap));
+      if (delta_size < bitmap_size)
+      {
+        mode = ext_tag_delta;
+        return present;
+      }
+      mode = ext_tag_bitmap;
+      return bitmap_words;
+    }
+  }
+
+  ADATA_INLINE int32_t size_of_ext_tag(const uint64_t * words, ::std::size_t count)
+  {
+    int mode = 0;
+    uint32_t len = detail::ext_tag_layout(words, count, mode);
+    int32_t size = size_of((uint32_t)(len << 1 | mode));
+    if (mode == detail::ext_tag_bitmap)
+    {
+      for (uint32_t k = 0; k < len; ++k)
+      {
+        size += size_of(detail::ext_tag_word(words, count, k));
+      }
+      return size;
+    }
+    ::std::size_t last = 63;
+    bool first = true;
+    for (::std::size_t i = 63; i < count * 64; ++i)
+    {
+      if (detail::ext_tag_test(words, i))
+      {
+        size += size_of((uint32_t)(first ? i - 63 : i - last - 1));
+        last = i;
+        first = false;
+      }
+    }
+    return size;
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void write_ext_tag(stream_ty& stream, const uint64_t * words, ::std::size_t count)
+  {
+    int mode = 0;
+    uint32_t len = detail::ext_tag_layout(words, count, mode);
+    write(stream, (uint32_t)(len << 1 | mode));
+    if (mode == detail::ext_tag_bitmap)
+    {
+      for (uint32_t k = 0; k < len; ++k)
+      {
+        write(stream, detail::ext_tag_word(words, count, k));
+      }
+      return;
+    }
+    ::std::size_t last = 63;
+    bool first = true;
+    for (::std::size_t i = 63; i < count * 64; ++i)
+    {
+      if (detail::ext_tag_test(words, i))
+      {
+        write(stream, (uint32_t)(first ? i - 63 : i - last - 1));
+        last = i;
+        first = false;
+      }
+    }
+  }
+
+  // or the presence of members 63 and up into words, members past count * 64 are unknown and dropped
+  template <typename stream_ty>
+  ADATA_INLINE void read_ext_tag(stream_ty& stream, uint64_t * words, ::std::size_t count)
+  {
+    uint32_t head = 0;
+    read(stream, head);
+    uint32_t len = head >> 1;
+    if ((head & 1) == detail::ext_tag_bitmap)
+    {
+      for (uint32_t k = 0; k < len; ++k)
+      {
+        uint64_t word = 0;
+        read(stream, word);
+        if (k < count)
+        {
+          words[k] |= word << 63;
+        }
+        if (k + 1 < count)
+        {
+          words[k + 1] |= word >> 1;
+        }
+      }
+      return;
+    }
+    uint64_t index = 62;
+    for (uint32_t k = 0; k < len; ++k)
+    {
+      uint32_t gap = 0;
+      read(stream, gap);
+      index += (uint64_t)gap + 1;
+      if (index < count * 64)
+      {
+        words[index >> 6] |= (uint64_t)1 << (index & 63);
+      }
+    }
+  }
+
+  // skip a [sized] list or map in one step by its byte length
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read_sized(stream_ty& stream)
+  {
+    int32_t len = 0;
+    read(stream, len);
+    if (len < 0)
+    {
+      throw exception(sequence_length_overflow);
+    }
+    stream.skip_read((::std::size_t)len);
+  }
+
+  // a member equal to its schema default has no tag bit, the reader keeps its default
+  template<typename ty>
+  ADATA_INLINE bool is_default(ty value, ty default_value)
+  {
+    return value == default_value;
+  }
+
+  // compare the bits, -0.0 and nan are not the default 0.0
+  ADATA_INLINE bool is_default(float value, float default_value)
+  {
+    return std::memcmp(&value, &default_value, sizeof(float)) == 0;
+  }
+
+  ADATA_INLINE bool is_default(double value, double default_value)
+  {
+    return std::memcmp(&value, &default_value, sizeof(double)) == 0;
+  }
+
+#ifdef ADATA_HAS_STD_ARRAY
+  // an array is left out when every element is at the default of its type
+  template<typename ty, std::size_t count>
+  ADATA_INLINE bool is_default(const ::std::array<ty, count>& value, const ty& default_value)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (!is_default(value[i], default_value))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // an array of types, with the generated is_default of the element type
+  template<typename ty, std::size_t count>
+  ADATA_INLINE bool is_default(const ::std::array<ty, count>& value, bool (*is_default_element)(const ty&))
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (!is_default_element(value[i]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // a fix_ integer or a float element of an array, in little endian bytes
+  template<typename stream_ty, typename ty>
+  ADATA_INLINE void read_fixed_element(stream_ty& stream, ty& value)
+  {
+    fix_read(stream, value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_fixed_element(stream_ty& stream, float& value)
+  {
+    read(stream, value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_fixed_element(stream_ty& stream, double& value)
+  {
+    read(stream, value);
+  }
+
+  template<typename stream_ty, typename ty>
+  ADATA_INLINE void write_fixed_element(stream_ty& stream, const ty& value)
+  {
+    fix_write(stream, value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_fixed_element(stream_ty& stream, const float& value)
+  {
+    write(stream, value);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_fixed_element(stream_ty& stream, const double& value)
+  {
+    write(stream, value);
+  }
+
+  // an array of fix_ integers or floats has no length, its elements are copied in one go on little endian
+  template<typename stream_ty, typename ty, std::size_t count>
+  ADATA_INLINE void read_fixed_array(stream_ty& stream, ::std::array<ty, count>& value)
+  {
+#ifdef __LITTLE_ENDIAN__
+    stream.read((char*)value.data(), sizeof(ty) * count);
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      read_fixed_element(stream, value[i]);
+    }
+#endif
+  }
+
+  template<typename stream_ty, typename ty, std::size_t count>
+  ADATA_INLINE void write_fixed_array(stream_ty& stream, const ::std::array<ty, count>& value)
+  {
+#ifdef __LITTLE_ENDIAN__
+    stream.write((const char*)value.data(), sizeof(ty) * count);
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      write_fixed_element(stream, value[i]);
+    }
+#endif
+  }
+#endif
+
+  // the len elements of a list of a [packed] type, each one size bytes
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void read_packed_list(stream_ty& stream, list_ty& value, int32_t len, std::size_t)
+  {
+    value.resize(len);
+    for (int32_t i = 0; i < len; ++i)
+    {
+      read(stream, value[i]);
+    }
+  }
+
+  // a vector is copied in one go when its elements have the bytes of their encoding,
+  // little endian and no padding in the generated struct
+  template<typename stream_ty, typename ty, typename alloc_ty>
+  ADATA_INLINE void read_packed_list(stream_ty& stream, std::vector<ty, alloc_ty>& value, int32_t len, std::size_t size)
+  {
+    value.resize(len);
+#ifdef __LITTLE_ENDIAN__
+    if (sizeof(ty) == size)
+    {
+      if (len > 0)
+      {
+        stream.read((char*)&value[0], size * (std::size_t)len);
+      }
+      return;
+    }
+#endif
+    for (int32_t i = 0; i < len; ++i)
+    {
+      read(stream, value[i]);
+    }
+  }
+
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void write_packed_list(stream_ty& stream, const list_ty& value, std::size_t)
+  {
+    for (typename list_ty::const_iterator i = value.begin(); i != value.end(); ++i)
+    {
+      write(stream, *i);
+    }
+  }
+
+  template<typename stream_ty, typename ty, typename alloc_ty>
+  ADATA_INLINE void write_packed_list(stream_ty& stream, const std::vector<ty, alloc_ty>& value, std::size_t size)
+  {
+#ifdef __LITTLE_ENDIAN__
+    if (sizeof(ty) == size)
+    {
+      if (!value.empty())
+      {
+        stream.write((const char*)&value[0], size * value.size());
+      }
+      return;
+    }
+#endif
+    for (typename std::vector<ty, alloc_ty>::const_iterator i = value.begin(); i != value.end(); ++i)
+    {
+      write(stream, *i);
+    }
+  }
+
+  namespace detail
+  {
+    ADATA_INLINE uint32_t popcount64(uint64_t x)
+    {
+#if defined(__GNUC__)
+      return (uint32_t)__builtin_popcountll(x);
+#else
+      x = x - ((x >> 1) & 0x5555555555555555ULL);
+      x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+      x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+      return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    // index of the lowest bit set, x not 0
+    ADATA_INLINE uint32_t lowest_bit64(uint64_t x)
+    {
+#if defined(__GNUC__)
+      return (uint32_t)__builtin_ctzll(x);
+#else
+      return popcount64((x & (~x + 1)) - 1);
+#endif
+    }
+
+    // index of the highest bit set, x not 0
+    ADATA_INLINE uint32_t highest_bit64(uint64_t x)
+    {
+#if defined(__GNUC__)
+      return 63 - (uint32_t)__builtin_clzll(x);
+#else
+      x |= x >> 1;
+      x |= x >> 2;
+      x |= x >> 4;
+      x |= x >> 8;
+      x |= x >> 16;
+      x |= x >> 32;
+      return popcount64(x) - 1;
+#endif
+    }
+  }
+
+  // the ids of a [bitmap] member, a sorted set of uint32. ids are kept in chunks by their
+  // high 16 bits, a chunk holds a sorted array of the low bits up to array_max ids and a
+  // bitmap above. on the wire a chunk is an array, a bitmap or runs, whichever is shortest
+  class id_set
+  {
+  public:
+    enum
+    {
+      array_max = 4096,
+      chunk_words = 1024,
+      chunk_bytes = chunk_words * 8,
+    };
+
+    // wire kinds of a chunk
+    enum
+    {
+      chunk_array = 0,
+      chunk_bitmap = 1,
+      chunk_runs = 2,
+    };
+
+  private:
+    struct chunk
+    {
+      uint32_t key;
+      uint32_t count;
+      std::vector<uint16_t> array;
+      std::vector<uint64_t> bits;
+
+      explicit chunk(uint32_t k = 0) : key(k), count(0) {}
+
+      bool operator==(const chunk& other) const
+      {
+        return key == other.key && count == other.count && array == other.array && bits == other.bits;
+      }
+
+      void swap(chunk& other)
+      {
+        std::swap(key, other.key);
+        std::swap(count, other.count);
+        array.swap(other.array);
+        bits.swap(other.bits);
+      }
+
+      bool contains(uint32_t low) const
+      {
+        if (bits.empty())
+        {
+          return std::binary_search(array.begin(), array.end(), (uint16_t)low);
+        }
+        return ((bits[low >> 6] >> (low & 63)) & 1) != 0;
+      }
+
+      void to_bits()
+      {
+        bits.assign((std::size_t)chunk_words, 0);
+        for (std::size_t i = 0; i < array.size(); ++i)
+        {
+          bits[array[i] >> 6] |= (uint64_t)1 << (array[i] & 63);
+        }
+        std::vector<uint16_t>().swap(array);
+      }
+
+      // an array up to array_max ids and a bitmap above, so equal sets are equal chunks
+      void normalize()
+      {
+        if (bits.empty())
+        {
+          if (count > (uint32_t)array_max)
+          {
+            to_bits();
+          }
+          return;
+        }
+        if (count > (uint32_t)array_max)
+        {
+          return;
+        }
+        lows(array);
+        std::vector<uint64_t>().swap(bits);
+      }
+
+      void lows(std::vector<uint16_t>& out) const
+      {
+        if (bits.empty())
+        {
+          out = array;
+          return;
+        }
+        out.clear();
+        out.reserve(count);
+        for (uint32_t w = 0; w < (uint32_t)chunk_words; ++w)
+        {
+          for (uint64_t word = bits[w]; word != 0; word &= word - 1)
+          {
+            out.push_back((uint16_t)(w << 6 | detail::lowest_bit64(word)));
+          }
+        }
+      }
+    };
+
+    struct chunk_plan
+    {
+      uint32_t kind;
+      uint32_t runs;
+      int32_t size;
+    };
+
+  public:
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef uint32_t value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const uint32_t * pointer;
+      typedef uint32_t reference;
+
+      const_iterator() : m_chunks(0), m_chunk(0), m_pos(0) {}
+
+      uint32_t operator*() const
+      {
+        const chunk& c = (*m_chunks)[m_chunk];
+        return c.key << 16 | (c.bits.empty() ? c.array[m_pos] : m_pos);
+      }
+
+      const_iterator& operator++()
+      {
+        ++m_pos;
+        settle();
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator i = *this;
+        ++*this;
+        return i;
+      }
+
+      bool operator==(const const_iterator& other) const { return m_chunk == other.m_chunk && m_pos == other.m_pos; }
+      bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+      friend class id_set;
+
+      const_iterator(const std::vector<chunk> * chunks, std::size_t index)
+        : m_chunks(chunks), m_chunk(index), m_pos(0)
+      {
+        settle();
+      }
+
+      // move to the first id at or behind m_pos
+      void settle()
+      {
+        for (; m_chunk < m_chunks->size(); ++m_chunk, m_pos = 0)
+        {
+          const chunk& c = (*m_chunks)[m_chunk];
+          if (c.bits.empty())
+          {
+            if (m_pos < c.array.size())
+            {
+              return;
+            }
+            continue;
+          }
+          while (m_pos < (uint32_t)chunk_words * 64)
+          {
+            uint64_t word = c.bits[m_pos >> 6] >> (m_pos & 63);
+            if (word != 0)
+            {
+              m_pos += detail::lowest_bit64(word);
+              return;
+            }
+            m_pos = (m_pos | 63) + 1;
+          }
+        }
+        m_pos = 0;
+      }
+
+      const std::vector<chunk> * m_chunks;
+      std::size_t m_chunk;
+      uint32_t m_pos;
+    };
+
+    id_set() : m_size(0) {}
+
+    template<typename iterator_ty>
+    id_set(iterator_ty first, iterator_ty last)
+      : m_size(0)
+    {
+      for (; first != last; ++first)
+      {
+        insert((uint32_t)*first);
+      }
+    }
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void clear()
+    {
+      m_chunks.clear();
+      m_size = 0;
+    }
+
+    const_iterator begin() const { return const_iterator(&m_chunks, 0); }
+    const_iterator end() const { return const_iterator(&m_chunks, m_chunks.size()); }
+
+    bool contains(uint32_t id) const
+    {
+      std::size_t i = find_chunk(id >> 16);
+      return i < m_chunks.size() && m_chunks[i].key == (id >> 16) && m_chunks[i].contains(id & 0xffff);
+    }
+
+    // false if id was in the set
+    bool insert(uint32_t id)
+    {
+      std::size_t i = find_chunk(id >> 16);
+      if (i == m_chunks.size() || m_chunks[i].key != (id >> 16))
+      {
+        m_chunks.insert(m_chunks.begin() + i, chunk(id >> 16));
+      }
+      chunk& c = m_chunks[i];
+      uint16_t low = (uint16_t)id;
+      if (c.bits.empty())
+      {
+        std::vector<uint16_t>::iterator pos = std::lower_bound(c.array.begin(), c.array.end(), low);
+        if (pos != c.array.end() && *pos == low)
+        {
+          return false;
+        }
+        c.array.insert(pos, low);
+      }
+      else
+      {
+        uint64_t bit = (uint64_t)1 << (low & 63);
+        if (c.bits[low >> 6] & bit)
+        {
+          return false;
+        }
+        c.bits[low >> 6] |= bit;
+      }
+      ++c.count;
+      ++m_size;
+      c.normalize();
+      return true;
+    }
+
+    // false if id was not in the set
+    bool erase(uint32_t id)
+    {
+      std::size_t i = find_chunk(id >> 16);
+      if (i == m_chunks.size() || m_chunks[i].key != (id >> 16) || !m_chunks[i].contains(id & 0xffff))
+      {
+        return false;
+      }
+      chunk& c = m_chunks[i];
+      uint16_t low = (uint16_t)id;
+      if (c.bits.empty())
+      {
+        c.array.erase(std::lower_bound(c.array.begin(), c.array.end(), low));
+      }
+      else
+      {
+        c.bits[low >> 6] &= ~((uint64_t)1 << (low & 63));
+      }
+      --m_size;
+      if (--c.count == 0)
+      {
+        m_chunks.erase(m_chunks.begin() + i);
+      }
+      else
+      {
+        c.normalize();
+      }
+      return true;
+    }
+
+    id_set& operator|=(const id_set& other) { combine(other, op_or); return *this; }
+    id_set& operator&=(const id_set& other) { combine(other, op_and); return *this; }
+    id_set& operator-=(const id_set& other) { combine(other, op_sub); return *this; }
+
+    bool operator==(const id_set& other) const { return m_size == other.m_size && m_chunks == other.m_chunks; }
+    bool operator!=(const id_set& other) const { return !(*this == other); }
+
+    void swap(id_set& other)
+    {
+      m_chunks.swap(other.m_chunks);
+      std::swap(m_size, other.m_size);
+    }
+
+    // wire format: int32 count, uint32 chunks, then each chunk as the gap to the key in
+    // front, a header of (ids - 1) << 2 | kind and the body of its kind
+    int32_t encoded_size() const
+    {
+      int32_t size = size_of((int32_t)m_size) + size_of((uint32_t)m_chunks.size());
+      std::vector<uint16_t> lows;
+      for (std::size_t i = 0; i < m_chunks.size(); ++i)
+      {
+        const chunk& c = m_chunks[i];
+        chunk_plan p = plan(c, lows);
+        size += size_of(key_gap(i)) + size_of((c.count - 1) << 2 | p.kind) + p.size;
+      }
+      return size;
+    }
+
+    template<typename stream_ty>
+    void encode(stream_ty& stream) const
+    {
+      write(stream, (int32_t)m_size);
+      write(stream, (uint32_t)m_chunks.size());
+      std::vector<uint16_t> lows;
+      for (std::size_t i = 0; i < m_chunks.size(); ++i)
+      {
+        const chunk& c = m_chunks[i];
+        chunk_plan p = plan(c, lows);
+        write(stream, key_gap(i));
+        write(stream, (c.count - 1) << 2 | p.kind);
+        if (p.kind == chunk_bitmap)
+        {
+          chunk bitmap(c.key);
+          if (c.bits.empty())
+          {
+            bitmap.array = c.array;
+            bitmap.to_bits();
+          }
+          const std::vector<uint64_t>& words = c.bits.empty() ? bitmap.bits : c.bits;
+          for (uint32_t w = 0; w < (uint32_t)chunk_words; ++w)
+          {
+            fix_write(stream, words[w]);
+          }
+        }
+        else if (p.kind == chunk_runs)
+        {
+          write(stream, p.runs);
+          for (std::size_t k = 0, prev_end = 0; k < lows.size(); )
+          {
+            std::size_t end = run_end(lows, k);
+            write(stream, (uint32_t)(k ? lows[k] - prev_end - 1 : lows[k]));
+            write(stream, (uint32_t)(end - k - 1));
+            prev_end = lows[end - 1];
+            k = end;
+          }
+        }
+        else
+        {
+          for (std::size_t k = 0; k < lows.size(); ++k)
+          {
+            write(stream, (uint32_t)(k ? lows[k] - lows[k - 1] - 1 : lows[k]));
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty>
+    void decode(stream_ty& stream, int size = 0)
+    {
+      clear();
+      int32_t len = check_read_size(stream, size);
+      uint32_t chunk_count = 0;
+      read(stream, chunk_count);
+      if (chunk_count > 0x10000)
+      {
+        throw exception(number_of_element_not_match);
+      }
+      uint64_t key = 0;
+      for (uint32_t i = 0; i < chunk_count; ++i)
+      {
+        uint32_t gap = 0;
+        read(stream, gap);
+        key = i ? key + gap + 1 : gap;
+        uint32_t header = 0;
+        read(stream, header);
+        uint32_t count = (header >> 2) + 1;
+        if (key > 0xffff || count > 0x10000)
+        {
+          throw exception(number_of_element_not_match);
+        }
+        m_chunks.push_back(chunk((uint32_t)key));
+        chunk& c = m_chunks.back();
+        switch (header & 3)
+        {
+        case chunk_array: read_array(stream, c, count); break;
+        case chunk_bitmap: read_bitmap(stream, c, count); break;
+        case chunk_runs: read_runs(stream, c, count); break;
+        default: throw exception(undefined_member_protocol_not_compatible);
+        }
+        m_size += count;
+      }
+      if (m_size != (std::size_t)len)
+      {
+        throw exception(number_of_element_not_match);
+      }
+    }
+
+    template<typename stream_ty>
+    static void skip(stream_ty& stream, int size = 0)
+    {
+      check_read_size(stream, size);
+      uint32_t chunk_count = 0;
+      read(stream, chunk_count);
+      for (uint32_t i = 0; i < chunk_count; ++i)
+      {
+        skip_read(stream, (uint32_t*)0);
+        uint32_t header = 0;
+        read(stream, header);
+        uint32_t values = (header >> 2) + 1;
+        if ((header & 3) == chunk_bitmap)
+        {
+          stream.skip_read((std::size_t)chunk_bytes);
+          continue;
+        }
+        if ((header & 3) == chunk_runs)
+        {
+          read(stream, values);
+          values *= 2;
+        }
+        for (uint32_t k = 0; k < values; ++k)
+        {
+          skip_read(stream, (uint32_t*)0);
+        }
+      }
+    }
+
+  private:
+    enum { op_or, op_and, op_sub };
+
+    std::size_t find_chunk(uint32_t key) const
+    {
+      std::size_t lo = 0;
+      std::size_t hi = m_chunks.size();
+      while (lo < hi)
+      {
+        std::size_t mid = (lo + hi) / 2;
+        if (m_chunks[mid].key < key)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      return lo;
+    }
+
+    uint32_t key_gap(std::size_t i) const
+    {
+      return i ? m_chunks[i].key - m_chunks[i - 1].key - 1 : m_chunks[i].key;
+    }
+
+    static std::size_t run_end(const std::vector<uint16_t>& lows, std::size_t k)
+    {
+      std::size_t end = k + 1;
+      while (end < lows.size() && lows[end] == lows[end - 1] + 1)
+      {
+        ++end;
+      }
+      return end;
+    }
+
+    // the shortest body of a chunk, lows gets its ids
+    static chunk_plan plan(const chunk& c, std::vector<uint16_t>& lows)
+    {
+      c.lows(lows);
+      int32_t array_size = 0;
+      int32_t runs_size = 0;
+      uint32_t runs = 0;
+      for (std::size_t k = 0, prev_end = 0; k < lows.size(); )
+      {
+        array_size += size_of((uint32_t)(k ? lows[k] - lows[k - 1] - 1 : lows[k]));
+        std::size_t end = run_end(lows, k);
+        runs_size += size_of((uint32_t)(k ? lows[k] - prev_end - 1 : lows[k])) + size_of((uint32_t)(end - k - 1));
+        for (std::size_t n = k + 1; n < end; ++n)
+        {
+          array_size += size_of((uint32_t)0);
+        }
+        prev_end = lows[end - 1];
+        ++runs;
+        k = end;
+      }
+      runs_size += size_of(runs);
+      chunk_plan p = { (uint32_t)chunk_array, runs, array_size };
+      if (runs_size < p.size)
+      {
+        p.kind = chunk_runs;
+        p.size = runs_size;
+      }
+      if ((int32_t)chunk_bytes < p.size)
+      {
+        p.kind = chunk_bitmap;
+        p.size = chunk_bytes;
+      }
+      return p;
+    }
+
+    template<typename stream_ty>
+    static void read_array(stream_ty& stream, chunk& c, uint32_t count)
+    {
+      c.array.reserve(count);
+      uint32_t low = 0;
+      for (uint32_t k = 0; k < count; ++k)
+      {
+        uint32_t gap = 0;
+        read(stream, gap);
+        uint64_t next = k ? (uint64_t)low + gap + 1 : gap;
+        if (next > 0xffff)
+        {
+          throw exception(number_of_element_not_match);
+        }
+        low = (uint32_t)next;
+        c.array.push_back((uint16_t)low);
+      }
+      c.count = count;
+      c.normalize();
+    }
+
+    template<typename stream_ty>
+    static void read_bitmap(stream_ty& stream, chunk& c, uint32_t count)
+    {
+      c.bits.resize((std::size_t)chunk_words);
+      uint32_t total = 0;
+      for (uint32_t w = 0; w < (uint32_t)chunk_words; ++w)
+      {
+        fix_read(stream, c.bits[w]);
+        total += detail::popcount64(c.bits[w]);
+      }
+      if (total != count)
+      {
+        throw exception(number_of_element_not_match);
+      }
+      c.count = count;
+      c.normalize();
+    }
+
+    template<typename stream_ty>
+    static void read_runs(stream_ty& stream, chunk& c, uint32_t count)
+    {
+      uint32_t runs = 0;
+      read(stream, runs);
+      if (runs > count)
+      {
+        throw exception(number_of_element_not_match);
+      }
+      if (count > (uint32_t)array_max)
+      {
+        c.bits.assign((std::size_t)chunk_words, 0);
+      }
+      uint64_t end = 0;
+      uint32_t total = 0;
+      for (uint32_t r = 0; r < runs; ++r)
+      {
+        uint32_t gap = 0;
+        uint32_t len = 0;
+        read(stream, gap);
+        read(stream, len);
+        uint64_t start = r ? end + gap + 1 : gap;
+        end = start + len;
+        if (end > 0xffff || len >= count - total)
+        {
+          throw exception(number_of_element_not_match);
+        }
+        total += len + 1;
+        for (uint32_t low = (uint32_t)start; low <= (uint32_t)end; ++low)
+        {
+          if (c.bits.empty())
+          {
+            c.array.push_back((uint16_t)low);
+          }
+          else
+          {
+            c.bits[low >> 6] |= (uint64_t)1 << (low & 63);
+          }
+        }
+      }
+      if (total != count)
+      {
+        throw exception(number_of_element_not_match);
+      }
+      c.count = count;
+    }
+
+    // chunk by chunk in key order, an array op when both are arrays and a word op otherwise
+    void combine(const id_set& other, int op)
+    {
+      std::vector<chunk> result;
+      std::size_t i = 0;
+      std::size_t j = 0;
+      while (i < m_chunks.size() || j < other.m_chunks.size())
+      {
+        if (j == other.m_chunks.size() || (i < m_chunks.size() && m_chunks[i].key < other.m_chunks[j].key))
+        {
+          if (op != op_and)
+          {
+            result.push_back(chunk());
+            result.back().swap(m_chunks[i]);
+          }
+          ++i;
+        }
+        else if (i == m_chunks.size() || other.m_chunks[j].key < m_chunks[i].key)
+        {
+          if (op == op_or)
+          {
+            result.push_back(other.m_chunks[j]);
+          }
+          ++j;
+        }
+        else
+        {
+          chunk c(m_chunks[i].key);
+          combine_chunk(m_chunks[i], other.m_chunks[j], op, c);
+          if (c.count != 0)
+          {
+            result.push_back(chunk());
+            result.back().swap(c);
+          }
+          ++i;
+          ++j;
+        }
+      }
+      m_chunks.swap(result);
+      m_size = 0;
+      for (std::size_t k = 0; k < m_chunks.size(); ++k)
+      {
+        m_size += m_chunks[k].count;
+      }
+    }
+
+    static void combine_chunk(const chunk& a, const chunk& b, int op, chunk& c)
+    {
+      if (a.bits.empty() && b.bits.empty())
+      {
+        std::back_insert_iterator<std::vector<uint16_t> > out(c.array);
+        switch (op)
+        {
+        case op_or: std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+        case op_and: std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+        default: std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), out); break;
+        }
+        c.count = (uint32_t)c.array.size();
+        c.normalize();
+        return;
+      }
+      chunk wide_a;
+      chunk wide_b;
+      const std::vector<uint64_t> * bits_a = &a.bits;
+      const std::vector<uint64_t> * bits_b = &b.bits;
+      if (a.bits.empty())
+      {
+        wide_a.array = a.array;
+        wide_a.to_bits();
+        bits_a = &wide_a.bits;
+      }
+      if (b.bits.empty())
+      {
+        wide_b.array = b.array;
+        wide_b.to_bits();
+        bits_b = &wide_b.bits;
+      }
+      c.bits.resize((std::size_t)chunk_words);
+      for (uint32_t w = 0; w < (uint32_t)chunk_words; ++w)
+      {
+        uint64_t x = (*bits_a)[w];
+        uint64_t y = (*bits_b)[w];
+        c.bits[w] = op == op_or ? x | y : op == op_and ? x & y : x & ~y;
+        c.count += detail::popcount64(c.bits[w]);
+      }
+      c.normalize();
+    }
+
+    std::vector<chunk> m_chunks;
+    std::size_t m_size;
+  };
+
+  // integer lists of a [delta], [delta2] or [rle] member and the ids of a [bitmap] one.
+  // differences are taken in the width of the element type, so every list round-trips,
+  // wrapping included. float lists of a [xor] member, see detail::encode_xor
+  enum list_encoding
+  {
+    list_plain = 0,
+    list_delta = 1,
+    list_delta2 = 2,
+    list_rle = 3,
+    list_bitmap = 4,
+    list_xor = 5,
+  };
+
+  namespace detail
+  {
+    template<typename ty> struct list_unsigned;
+    template<> struct list_unsigned<int8_t> { typedef uint8_t type; typedef int8_t signed_type; };
+    template<> struct list_unsigned<uint8_t> { typedef uint8_t type; typedef int8_t signed_type; };
+    template<> struct list_unsigned<int16_t> { typedef uint16_t type; typedef int16_t signed_type; };
+    template<> struct list_unsigned<uint16_t> { typedef uint16_t type; typedef int16_t signed_type; };
+    template<> struct list_unsigned<int32_t> { typedef uint32_t type; typedef int32_t signed_type; };
+    template<> struct list_unsigned<uint32_t> { typedef uint32_t type; typedef int32_t signed_type; };
+    template<> struct list_unsigned<int64_t> { typedef uint64_t type; typedef int64_t signed_type; };
+    template<> struct list_unsigned<uint64_t> { typedef uint64_t type; typedef int64_t signed_type; };
+
+    // zigzag keeps small negative differences in one byte
+    template<typename ty>
+    ADATA_INLINE uint64_t list_zigzag(typename list_unsigned<ty>::type value)
+    {
+      int64_t n = (int64_t)(typename list_unsigned<ty>::signed_type)value;
+      return ((uint64_t)n << 1) ^ (uint64_t)(n >> 63);
+    }
+
+    template<typename ty>
+    ADATA_INLINE ty list_unzigzag(uint64_t value)
+    {
+      return (ty)(typename list_unsigned<ty>::type)((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    struct list_size_sink
+    {
+      int32_t size;
+      list_size_sink() : size(0) {}
+      ADATA_INLINE void put(uint64_t value) { size += size_of(value); }
+      ADATA_INLINE void put_run(uint32_t run, uint64_t value) { size += size_of(run) + size_of(value); }
+    };
+
+    template<typename stream_ty>
+    struct list_write_sink
+    {
+      stream_ty& stream;
+      explicit list_write_sink(stream_ty& s) : stream(s) {}
+      ADATA_INLINE void put(uint64_t value) { write(stream, value); }
+      ADATA_INLINE void put_run(uint32_t run, uint64_t value) { write(stream, run); write(stream, value); }
+    };
+
+    // feed the zigzag differences, or the runs, of value to sink
+    template<typename list_ty, typename sink_ty>
+    ADATA_INLINE void encode_list(const list_ty& value, int encoding, sink_ty& sink)
+    {
+      typedef typename list_ty::value_type value_type;
+      typedef typename list_unsigned<value_type>::type unsigned_type;
+      ::std::size_t count = value.size();
+      if (encoding == list_rle)
+      {
+        for (::std::size_t i = 0; i < count;)
+        {
+          ::std::size_t end = i + 1;
+          while (end < count && value[end] == value[i])
+          {
+            ++end;
+          }
+          sink.put_run((uint32_t)(end - i), list_zigzag<value_type>((unsigned_type)value[i]));
+          i = end;
+        }
+        return;
+      }
+      unsigned_type prev = 0;
+      unsigned_type prev_delta = 0;
+      for (::std::size_t i = 0; i < count; ++i)
+      {
+        unsigned_type delta = (unsigned_type)((unsigned_type)value[i] - prev);
+        prev = (unsigned_type)value[i];
+        if (encoding == list_delta2)
+        {
+          unsigned_type delta2 = (unsigned_type)(delta - prev_delta);
+          prev_delta = delta;
+          delta = delta2;
+        }
+        sink.put(list_zigzag<value_type>(delta));
+      }
+    }
+  }
+
+  namespace detail
+  {
+    // the elements of a list without its count, the count is written by the caller
+    template<typename list_ty>
+    ADATA_INLINE int32_t size_of_list_items(const list_ty& value, int encoding)
+    {
+      if (encoding == list_plain)
+      {
+        int32_t size = 0;
+        for (::std::size_t i = 0; i < value.size(); ++i)
+        {
+          size += size_of(value[i]);
+        }
+        return size;
+      }
+      list_size_sink sink;
+      encode_list(value, encoding, sink);
+      return sink.size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    ADATA_INLINE void write_list_items(stream_ty& stream, const list_ty& value, int encoding)
+    {
+      if (encoding == list_plain)
+      {
+        for (::std::size_t i = 0; i < value.size(); ++i)
+        {
+          write(stream, value[i]);
+        }
+        return;
+      }
+      list_write_sink<stream_ty> sink(stream);
+      encode_list(value, encoding, sink);
+    }
+
+    // value is resized to len by the caller
+    template<typename stream_ty, typename list_ty>
+    ADATA_INLINE void read_list_items(stream_ty& stream, list_ty& value, int32_t len, int encoding)
+    {
+      typedef typename list_ty::value_type value_type;
+      typedef typename list_unsigned<value_type>::type unsigned_type;
+      if (encoding == list_plain)
+      {
+        for (int32_t i = 0; i < len; ++i)
+        {
+          read(stream, value[i]);
+        }
+        return;
+      }
+      if (encoding == list_rle)
+      {
+        for (int32_t i = 0; i < len;)
+        {
+          uint32_t run = 0;
+          uint64_t zigzag = 0;
+          read(stream, run);
+          read(stream, zigzag);
+          if (run == 0 || run > (uint32_t)(len - i))
+          {
+            throw exception(number_of_element_not_match);
+          }
+          value_type element = list_unzigzag<value_type>(zigzag);
+          for (int32_t end = i + (int32_t)run; i < end; ++i)
+          {
+            value[i] = element;
+          }
+        }
+        return;
+      }
+      // the varints first, then plain prefix sums over the elements the compiler can vectorize
+      for (int32_t i = 0; i < len; ++i)
+      {
+        uint64_t zigzag = 0;
+        read(stream, zigzag);
+        value[i] = list_unzigzag<value_type>(zigzag);
+      }
+      for (int pass = 0; pass < encoding; ++pass)
+      {
+        unsigned_type sum = 0;
+        for (int32_t i = 0; i < len; ++i)
+        {
+          sum = (unsigned_type)(sum + (unsigned_type)value[i]);
+          value[i] = (value_type)sum;
+        }
+      }
+    }
+
+    template<typename ty, typename stream_ty>
+    ADATA_INLINE void skip_list_items(stream_ty& stream, int32_t len, int encoding)
+    {
+      if (encoding == list_plain)
+      {
+        for (int32_t i = 0; i < len; ++i)
+        {
+          skip_read(stream, (ty*)0);
+        }
+        return;
+      }
+      if (encoding == list_rle)
+      {
+        for (int32_t i = 0; i < len;)
+        {
+          uint32_t run = 0;
+          read(stream, run);
+          skip_read(stream, (uint64_t*)0);
+          if (run == 0 || run > (uint32_t)(len - i))
+          {
+            throw exception(number_of_element_not_match);
+          }
+          i += (int32_t)run;
+        }
+        return;
+      }
+      for (int32_t i = 0; i < len; ++i)
+      {
+        skip_read(stream, (uint64_t*)0);
+      }
+    }
+  }
+
+  // a [xor] list<float32> or list<float64> is its count and a bit stream as bit_writer writes it,
+  // gorilla style. each value is xored with the one before it, 0 for the first one, and the xor is
+  // written as
+  //   0                                   the same value
+  //   1 0 meaningful bits                 the bits fall in the window of the last 1 1
+  //   1 1 leading zeros (5 bits) meaningful bit count less one (5 or 6 bits) meaningful bits
+  // so samples that change slowly, or repeat, take a few bits each. the stream is padded to a
+  // whole byte, the count bounds it, and floats round-trip bit for bit, NaN payloads included
+  namespace detail
+  {
+    template<typename ty> struct xor_bits;
+    template<> struct xor_bits<float> { typedef uint32_t type; enum { width = 32, length_width = 5 }; };
+    template<> struct xor_bits<double> { typedef uint64_t type; enum { width = 64, length_width = 6 }; };
+
+    struct xor_size_sink
+    {
+      int64_t bits;
+      xor_size_sink() : bits(0) {}
+      ADATA_INLINE void put(uint64_t, int width) { bits += width; }
+    };
+
+    template<typename stream_ty>
+    struct xor_write_sink
+    {
+      bit_writer<stream_ty> writer;
+      explicit xor_write_sink(stream_ty& stream) : writer(stream) {}
+      ADATA_INLINE void put(uint64_t value, int width) { writer.write_unsigned(value, width); }
+    };
+
+    template<typename list_ty, typename sink_ty>
+    ADATA_INLINE void encode_xor(const list_ty& value, sink_ty& sink)
+    {
+      typedef typename list_ty::value_type value_type;
+      typedef typename xor_bits<value_type>::type bits_type;
+      const int width = xor_bits<value_type>::width;
+      const int header_width = 7 + xor_bits<value_type>::length_width;
+      bits_type prev = 0;
+      // the window of the last 1 1, none yet
+      int lead = 0;
+      int length = 0;
+      for (::std::size_t i = 0; i < value.size(); ++i)
+      {
+        bits_type bits;
+        std::memcpy(&bits, &value[i], sizeof(bits));
+        bits_type x = bits ^ prev;
+        prev = bits;
+        if (x == 0)
+        {
+          sink.put(0, 1);
+          continue;
+        }
+        int x_lead = width - 1 - (int)highest_bit64((uint64_t)x);
+        int x_trail = (int)lowest_bit64((uint64_t)x);
+        if (length > 0 && x_lead >= lead && x_trail >= width - lead - length)
+        {
+          sink.put(1, 2);
+          sink.put((uint64_t)(x >> (width - lead - length)), length);
+          continue;
+        }
+        lead = x_lead < 31 ? x_lead : 31;
+        length = width - lead - x_trail;
+        sink.put(3 | (uint64_t)lead << 2 | (uint64_t)(length - 1) << 7, header_width);
+        sink.put((uint64_t)(x >> x_trail), length);
+      }
+    }
+
+    // len values into values, or skipped when values is null
+    template<typename ty, typename stream_ty>
+    ADATA_INLINE void decode_xor(stream_ty& stream, ty * values, int32_t len)
+    {
+      typedef typename xor_bits<ty>::type bits_type;
+      const int width = xor_bits<ty>::width;
+      bit_reader<stream_ty> reader(stream);
+      bits_type prev = 0;
+      int trail = 0;
+      int length = 0;
+      for (int32_t i = 0; i < len; ++i)
+      {
+        if (reader.read_unsigned(1) != 0)
+        {
+          if (reader.read_unsigned(1) != 0)
+          {
+            int lead = (int)reader.read_unsigned(5);
+            length = (int)reader.read_unsigned(xor_bits<ty>::length_width) + 1;
+            if (lead + length > width)
+            {
+              throw exception(number_of_element_not_match);
+            }
+            trail = width - lead - length;
+          }
+          else if (length == 0)
+          {
+            throw exception(number_of_element_not_match);
+          }
+          prev ^= (bits_type)(reader.read_unsigned(length) << trail);
+        }
+        if (values)
+        {
+          std::memcpy(&values[i], &prev, sizeof(prev));
+        }
+      }
+    }
+
+    template<typename stream_ty>
+    ADATA_INLINE void skip_xor_items(stream_ty& stream, int32_t len, float *)
+    {
+      decode_xor(stream, (float *)0, len);
+    }
+
+    template<typename stream_ty>
+    ADATA_INLINE void skip_xor_items(stream_ty& stream, int32_t len, double *)
+    {
+      decode_xor(stream, (double *)0, len);
+    }
+
+    // only float lists are [xor]
+    template<typename stream_ty, typename ty>
+    ADATA_INLINE void skip_xor_items(stream_ty&, int32_t, ty *)
+    {
+      throw exception(undefined_member_protocol_not_compatible);
+    }
+
+    template<typename list_ty>
+    ADATA_INLINE int32_t size_of_float_list(const list_ty& value, int encoding)
+    {
+      int32_t len = (int32_t)value.size();
+      int32_t size = size_of(len);
+      if (encoding == list_xor)
+      {
+        xor_size_sink sink;
+        encode_xor(value, sink);
+        return size + (int32_t)((sink.bits + 7) >> 3);
+      }
+      for (int32_t i = 0; i < len; ++i)
+      {
+        size += size_of(value[i]);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    ADATA_INLINE void write_float_list(stream_ty& stream, const list_ty& value, int encoding)
+    {
+      int32_t len = (int32_t)value.size();
+      write(stream, len);
+      if (encoding == list_xor)
+      {
+        xor_write_sink<stream_ty> sink(stream);
+        encode_xor(value, sink);
+        sink.writer.flush();
+        return;
+      }
+      for (int32_t i = 0; i < len; ++i)
+      {
+        write(stream, value[i]);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    ADATA_INLINE void read_float_list(stream_ty& stream, list_ty& value, int encoding, int size)
+    {
+      int32_t len = check_read_size(stream, size);
+      value.resize(len);
+      if (encoding == list_xor)
+      {
+        decode_xor(stream, len ? &value[0] : 0, len);
+        return;
+      }
+      for (int32_t i = 0; i < len; ++i)
+      {
+        read(stream, value[i]);
+      }
+    }
+  }
+
+  template<typename alloc_ty>
+  ADATA_INLINE int32_t size_of_list(const std::vector<float, alloc_ty>& value, int encoding)
+  {
+    return detail::size_of_float_list(value, encoding);
+  }
+
+  template<typename alloc_ty>
+  ADATA_INLINE int32_t size_of_list(const std::vector<double, alloc_ty>& value, int encoding)
+  {
+    return detail::size_of_float_list(value, encoding);
+  }
+
+  template<typename stream_ty, typename alloc_ty>
+  ADATA_INLINE void write_list(stream_ty& stream, const std::vector<float, alloc_ty>& value, int encoding)
+  {
+    detail::write_float_list(stream, value, encoding);
+  }
+
+  template<typename stream_ty, typename alloc_ty>
+  ADATA_INLINE void write_list(stream_ty& stream, const std::vector<double, alloc_ty>& value, int encoding)
+  {
+    detail::write_float_list(stream, value, encoding);
+  }
+
+  template<typename stream_ty, typename alloc_ty>
+  ADATA_INLINE void read_list(stream_ty& stream, std::vector<float, alloc_ty>& value, int encoding, int size = 0)
+  {
+    detail::read_float_list(stream, value, encoding, size);
+  }
+
+  template<typename stream_ty, typename alloc_ty>
+  ADATA_INLINE void read_list(stream_ty& stream, std::vector<double, alloc_ty>& value, int encoding, int size = 0)
+  {
+    detail::read_float_list(stream, value, encoding, size);
+  }
+
+  template<typename list_ty>
+  ADATA_INLINE int32_t size_of_list(const list_ty& value, int encoding)
+  {
+    if (encoding == list_bitmap)
+    {
+      return id_set(value.begin(), value.end()).encoded_size();
+    }
+    int32_t len = (int32_t)value.size();
+    return size_of(len) + detail::size_of_list_items(value, encoding);
+  }
+
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void write_list(stream_ty& stream, const list_ty& value, int encoding)
+  {
+    if (encoding == list_bitmap)
+    {
+      id_set(value.begin(), value.end()).encode(stream);
+      return;
+    }
+    int32_t len = (int32_t)value.size();
+    write(stream, len);
+    detail::write_list_items(stream, value, encoding);
+  }
+
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void read_list(stream_ty& stream, list_ty& value, int encoding, int size = 0)
+  {
+    typedef typename list_ty::value_type value_type;
+    if (encoding == list_bitmap)
+    {
+      id_set ids;
+      ids.decode(stream, size);
+      value.resize(ids.size());
+      std::size_t i = 0;
+      for (id_set::const_iterator id = ids.begin(); id != ids.end(); ++id)
+      {
+        value[i++] = (value_type)*id;
+      }
+      return;
+    }
+    int32_t len = check_read_size(stream, size);
+    value.resize(len);
+    detail::read_list_items(stream, value, len, encoding);
+  }
+
+  template<typename ty, typename stream_ty>
+  ADATA_INLINE void skip_read_list(stream_ty& stream, int encoding, int size = 0)
+  {
+    if (encoding == list_bitmap)
+    {
+      id_set::skip(stream, size);
+      return;
+    }
+    int32_t len = check_read_size(stream, size);
+    if (encoding == list_xor)
+    {
+      detail::skip_xor_items(stream, len, (ty*)0);
+      return;
+    }
+    detail::skip_list_items<ty>(stream, len, encoding);
+  }
+
+  // an id_set is a [bitmap] member, another encoding goes through a sorted list of the ids
+  ADATA_INLINE int32_t size_of_list(const id_set& value, int encoding)
+  {
+    if (encoding == list_bitmap)
+    {
+      return value.encoded_size();
+    }
+    std::vector<uint32_t> ids(value.begin(), value.end());
+    return size_of_list(ids, encoding);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write_list(stream_ty& stream, const id_set& value, int encoding)
+  {
+    if (encoding == list_bitmap)
+    {
+      value.encode(stream);
+      return;
+    }
+    std::vector<uint32_t> ids(value.begin(), value.end());
+    write_list(stream, ids, encoding);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_list(stream_ty& stream, id_set& value, int encoding, int size = 0)
+  {
+    if (encoding == list_bitmap)
+    {
+      value.decode(stream, size);
+      return;
+    }
+    std::vector<uint32_t> ids;
+    read_list(stream, ids, encoding, size);
+    id_set(ids.begin(), ids.end()).swap(value);
+  }
+
+  // a [columnar] list<T> has one header for all of its elements, then their members column by
+  // column: the count, and if not empty a tag of the members any element writes, a len_tag as in
+  // a type and the column of every member in the tag. an integer column starts with list_plain or
+  // list_delta, whichever is shorter, and goes through the list kernels, and so does the uint64 column
+  // of the steps of a [quant] float. a bool column is a bit per element. the others hold the member of each element as it would be written in the element. columns<T> is specialized by generated code
+  template<typename ty>
+  struct columns;
+
+  // the columns of a list, a generated struct of arrays <type>_soa maps to columns of its own
+  template<typename list_ty>
+  struct columns_of
+  {
+    typedef columns<typename list_ty::value_type> type;
+  };
+
+  template<typename column_ty>
+  ADATA_INLINE int column_encoding(const column_ty& column, int32_t& size)
+  {
+    int32_t plain = detail::size_of_list_items(column, list_plain);
+    int32_t delta = detail::size_of_list_items(column, list_delta);
+    size = 1 + (delta < plain ? delta : plain);
+    return delta < plain ? list_delta : list_plain;
+  }
+
+  template<typename column_ty>
+  ADATA_INLINE int32_t size_of_column(const column_ty& column)
+  {
+    int32_t size = 0;
+    column_encoding(column, size);
+    return size;
+  }
+
+  template<typename stream_ty, typename column_ty>
+  ADATA_INLINE void write_column(stream_ty& stream, const column_ty& column)
+  {
+    int32_t size = 0;
+    uint8_t encoding = (uint8_t)column_encoding(column, size);
+    write(stream, encoding);
+    detail::write_list_items(stream, column, encoding);
+  }
+
+  template<typename stream_ty, typename column_ty>
+  ADATA_INLINE void read_column(stream_ty& stream, column_ty& column, int32_t count)
+  {
+    uint8_t encoding = 0;
+    read(stream, encoding);
+    if (encoding != list_plain && encoding != list_delta)
+    {
+      throw exception(undefined_member_protocol_not_compatible);
+    }
+    column.resize(count);
+    detail::read_list_items(stream, column, count, encoding);
+  }
+
+  template<typename ty, typename stream_ty>
+  ADATA_INLINE void skip_read_column(stream_ty& stream, int32_t count)
+  {
+    uint8_t encoding = 0;
+    read(stream, encoding);
+    if (encoding != list_plain && encoding != list_delta)
+    {
+      throw exception(undefined_member_protocol_not_compatible);
+    }
+    detail::skip_list_items<ty>(stream, count, encoding);
+  }
+
+  // a [quant] float column is an integer column of the steps of every value
+  template<typename column_ty>
+  ADATA_INLINE void quantize_column(const column_ty& values, ::std::vector<uint64_t>& steps, double step, double min, double max)
+  {
+    ::std::size_t count = values.size();
+    steps.resize(count);
+    for (::std::size_t k = 0; k < count; ++k)
+    {
+      steps[k] = quantize((double)values[k], step, min, max);
+    }
+  }
+
+  template<typename column_ty>
+  ADATA_INLINE void dequantize_column(const ::std::vector<uint64_t>& steps, column_ty& values, double step, double min)
+  {
+    typedef typename column_ty::value_type value_type;
+    ::std::size_t count = steps.size();
+    values.resize(count);
+    for (::std::size_t k = 0; k < count; ++k)
+    {
+      values[k] = (value_type)dequantize(steps[k], step, min);
+    }
+  }
+
+  // a bool column is a bit per element
+  ADATA_INLINE int32_t size_of_bool_column(int32_t count)
+  {
+    return (count + 7) / 8;
+  }
+
+  template<typename stream_ty, typename column_ty>
+  ADATA_INLINE void write_bool_column(stream_ty& stream, const column_ty& column)
+  {
+    detail::write_bit_items(stream, column, column.size());
+  }
+
+  template<typename stream_ty, typename column_ty>
+  ADATA_INLINE void read_bool_column(stream_ty& stream, column_ty& column, int32_t count)
+  {
+    column.resize(count);
+    detail::read_bit_items(stream, column, (::std::size_t)count);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void skip_read_bool_column(stream_ty& stream, int32_t count)
+  {
+    stream.skip_read((::std::size_t)size_of_bool_column(count));
+  }
+
+  template<typename list_ty>
+  ADATA_INLINE int32_t size_of_columnar(const list_ty& value)
+  {
+    typedef typename columns_of<list_ty>::type columns_type;
+    int32_t len = (int32_t)value.size();
+    if (len == 0)
+    {
+      return size_of(len);
+    }
+    int64_t tag = columns_type::column_tag(value);
+    int32_t size = columns_type::column_size(value, tag) + size_of(tag);
+    size += size_of(size + size_of(size));
+    return size_of(len) + size;
+  }
+
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void write_columnar(stream_ty& stream, const list_ty& value)
+  {
+    typedef typename columns_of<list_ty>::type columns_type;
+    int32_t len = (int32_t)value.size();
+    write(stream, len);
+    if (len == 0)
+    {
+      return;
+    }
+    int64_t tag = columns_type::column_tag(value);
+    int32_t size = columns_type::column_size(value, tag) + size_of(tag);
+    size += size_of(size + size_of(size));
+    write(stream, tag);
+    write(stream, size);
+    columns_type::write_columns(stream, value, tag);
+  }
+
+  // the elements start at their defaults, a column not in the data leaves them there
+  template<typename stream_ty, typename list_ty>
+  ADATA_INLINE void read_columnar(stream_ty& stream, list_ty& value, int size = 0)
+  {
+    typedef typename columns_of<list_ty>::type columns_type;
+    int32_t len = check_read_size(stream, size);
+    value.clear();
+    value.resize(len);
+    if (len == 0)
+    {
+      return;
+    }
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream, tag);
+    int32_t len_tag = 0;
+    read(stream, len_tag);
+    columns_type::read_columns(stream, value, tag);
+    if (len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t skip_len = (::std::size_t)len_tag;
+      if (skip_len > read_len) stream.skip_read(skip_len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void skip_read_columnar(stream_ty& stream, int size = 0)
+  {
+    int32_t len = check_read_size(stream, size);
+    if (len > 0)
+    {
+      skip_read_compatible(stream);
+    }
+  }
+
+
+  template<typename stream_ty , typename ty>
+  ADATA_INLINE void read_ec(stream_ty& stream , ty& value , error_code_t& ec)
+  {
+    try
+    {
+      read(stream, value);
+    }
+    catch(exception& e)
+    {
+      ec = e.error_code();
+    }
+  }
+
+
+  template<typename stream_ty, typename ty>
+  ADATA_INLINE void fix_read_ec(stream_ty& stream, ty& value, error_code_t& ec)
+  {
+    try
+    {
+      fix_read(stream, value);
+    }
+    catch (exception& e)
+    {
+      ec = e.error_code();
+    }
+  }
+
+  template<typename stream_ty, typename ty>
+  ADATA_INLINE void write_ec(stream_ty& stream, ty& value, error_code_t& ec)
+  {
+    try
+    {
+      write(stream, value);
+    }
+    catch (exception& e)
+    {
+      ec = e.error_code();
+    }
+  }
+
+  template<typename stream_ty, typename ty>
+  ADATA_INLINE void fix_write_ec(stream_ty& stream, ty& value, error_code_t& ec)
+  {
+    try
+    {
+      fix_write(stream, value);
+    }
+    catch (exception& e)
+    {
+      ec = e.error_code();
+    }
+  }
+
+  template<typename T>
+  struct is_adata
+  {
+    static const bool value = false;
+  };
+
+  // tag bit of every member by name, specialized by generated code
+  template<typename T>
+  struct member_index;
+
+  // an optional<T> member, a presence flag and room for a ty that is only built once it is set.
+  // a member read from data is emplaced, one not in the data is left as it was
+  template<typename ty>
+  class optional
+  {
+  public:
+    optional() : m_has(false) {}
+
+    optional(const ty& value) : m_has(false)
+    {
+      emplace(value);
+    }
+
+    optional(const optional& other) : m_has(false)
+    {
+      if (other.m_has)
+      {
+        emplace(*other);
+      }
+    }
+
+    ~optional()
+    {
+      reset();
+    }
+
+    optional& operator=(const optional& other)
+    {
+      if (!other.m_has)
+      {
+        reset();
+      }
+      else if (this != &other)
+      {
+        assign(*other);
+      }
+      return *this;
+    }
+
+    optional& operator=(const ty& value)
+    {
+      assign(value);
+      return *this;
+    }
+
+#ifdef ADATA_HAS_RVALUE_REFERENCES
+    optional(ty&& value) : m_has(false)
+    {
+      ::new (address()) ty(::std::move(value));
+      m_has = true;
+    }
+
+    optional(optional&& other) : m_has(false)
+    {
+      if (other.m_has)
+      {
+        ::new (address()) ty(::std::move(*other));
+        m_has = true;
+      }
+    }
+
+    optional& operator=(optional&& other)
+    {
+      if (!other.m_has)
+      {
+        reset();
+      }
+      else if (this != &other)
+      {
+        *this = ::std::move(*other);
+      }
+      return *this;
+    }
+
+    optional& operator=(ty&& value)
+    {
+      if (m_has)
+      {
+        **this = ::std::move(value);
+      }
+      else
+      {
+        ::new (address()) ty(::std::move(value));
+        m_has = true;
+      }
+      return *this;
+    }
+#endif
+
+    bool has_value() const
+    {
+      return m_has;
+    }
+
+    ty& emplace()
+    {
+      reset();
+      ::new (address()) ty();
+      m_has = true;
+      return **this;
+    }
+
+    ty& emplace(const ty& value)
+    {
+      reset();
+      ::new (address()) ty(value);
+      m_has = true;
+      return **this;
+    }
+
+    void reset()
+    {
+      if (m_has)
+      {
+        m_has = false;
+        (**this).~ty();
+      }
+    }
+
+    ty value_or(const ty& default_value) const
+    {
+      return m_has ? **this : default_value;
+    }
+
+    ty& operator*()
+    {
+      return *reinterpret_cast<ty *>(address());
+    }
+
+    const ty& operator*() const
+    {
+      return *reinterpret_cast<const ty *>(m_storage.bytes);
+    }
+
+    ty * operator->()
+    {
+      return &**this;
+    }
+
+    const ty * operator->() const
+    {
+      return &**this;
+    }
+
+    bool operator==(const optional& other) const
+    {
+      return m_has == other.m_has && (!m_has || **this == *other);
+    }
+
+    bool operator!=(const optional& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    void assign(const ty& value)
+    {
+      if (m_has)
+      {
+        **this = value;
+      }
+      else
+      {
+        emplace(value);
+      }
+    }
+
+    void * address()
+    {
+      return m_storage.bytes;
+    }
+
+    // aligned for any member type
+    union
+    {
+      char bytes[sizeof(ty)];
+      long double align_float;
+      uint64_t align_int;
+      void * align_pointer;
+    } m_storage;
+    bool m_has;
   };
 }
 
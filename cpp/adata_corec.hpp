@@ -8,6 +8,7 @@
 
 #include "adata.hpp"
 #include "adata_int64.hpp"
+#include <cstdlib>
 
 extern "C" {
 #include "lua.h"
@@ -620,7 +621,10 @@ namespace adata {
       adata_et_string,
       adata_et_list,
       adata_et_map,
-      adata_et_type
+      adata_et_type,
+      adata_et_bool,
+      adata_et_bits,
+      adata_et_array
     };
 
     typedef struct adata_member adata_member;
@@ -631,26 +635,60 @@ namespace adata {
       int32_t member_count;
       int32_t mt_idx;
       char * name;
+      // a [packed] type is its members back to back in packed_size bytes, the same as raw
+      int32_t packed;
+      int32_t packed_size;
+      // a [union] type is the varint kind, the member index + 1 or 0 for none, then that member,
+      // a table holding it has only that field set
+      int32_t is_union;
     }adata_type;
 
+    // an enum of an integer member or element, its names are indexes into the string table like field_idx
+    typedef struct adata_enum
+    {
+      int32_t type;
+      int32_t count;
+      int64_t * values;       // bits of a uint64 for unsigned ones
+      int32_t * name_idx;
+    }adata_enum;
+
     typedef struct adata_paramter_type
     {
       int32_t type;
       int32_t size;
       char * type_name;
       adata_type * type_define;
+      adata_enum * enum_define;
     }adata_paramter_type;
 
     typedef struct adata_member
     {
       int32_t type;
       int32_t del;
+      int32_t sized;
+      int32_t encoding;
+      int32_t columnar;
+      int32_t bit_width;
+      // a [quant] float is its count of steps from quant_min in bit_width bits, see adata::quantize
+      int32_t quant;
+      double quant_step;
+      double quant_min;
+      double quant_max;
+      // a [dict] string, a code into the string_dict of the message, Lua has no dict so it writes the string itself
+      int32_t dict;
+      // an optional member, nil when unset and written when it is not nil whatever its value
+      int32_t optional;
+      // the [align] of a bytes member, a string padded as adata::write_bytes does, 0 if not aligned
+      int32_t align;
       int32_t size;
       int32_t field_idx;
       char * name;
       char * type_name;
       adata_type * type_define;
+      adata_enum * enum_define;
       adata_paramter_type * paramter_type[2];
+      int64_t default_int;    // bits of a uint64 for unsigned members
+      double default_float;
     }adata_member;
 
     struct load_contex
@@ -688,6 +726,7 @@ namespace adata {
       {
         int64_t value = 0;
         adata::read(buf, value);
+        mb->default_int = value;
         lua_pushint64(L, value);
         lua_rawseti(L, construct_list_idx, member_idx);
         break;
@@ -703,6 +742,7 @@ namespace adata {
       {
         uint64_t value = 0;
         adata::read(buf, value);
+        mb->default_int = (int64_t)value;
         lua_pushuint64(L, value);
         lua_rawseti(L, construct_list_idx, member_idx);
         break;
@@ -711,6 +751,7 @@ namespace adata {
       {
         float value = 0;
         adata::read(buf, value);
+        mb->default_float = value;
         lua_pushnumber(L, value);
         lua_rawseti(L, construct_list_idx, member_idx);
         break;
@@ -719,10 +760,20 @@ namespace adata {
       {
         double value = 0;
         adata::read(buf, value);
+        mb->default_float = value;
         lua_pushnumber(L, value);
         lua_rawseti(L, construct_list_idx, member_idx);
         break;
       }
+      case adata_et_bool:
+      {
+        uint64_t value = 0;
+        adata::read(buf, value);
+        mb->default_int = value != 0;
+        lua_pushboolean(L, value != 0);
+        lua_rawseti(L, construct_list_idx, member_idx);
+        break;
+      }
       case adata_et_string:
       {
         lua_pushstring(L, "");
@@ -753,6 +804,102 @@ namespace adata {
 #endif
     }
 
+    // the index of a string in the string table, added if it is not there yet
+    inline int32_t intern_string(lua_State * L, const char * str, size_t len)
+    {
+      lua_pushlstring(L, str, len);
+      lua_pushvalue(L, -1);
+      lua_gettable(L, load_contex::str_pool_idx);
+      if (lua_isnil(L, -1))
+      {
+        lua_pop(L, 1);
+        int32_t idx = get_lua_len(L, load_contex::str_idx_idx) + 1;
+        lua_pushvalue(L, -1);
+        lua_pushinteger(L, idx);
+        lua_settable(L, load_contex::str_pool_idx);
+        lua_rawseti(L, load_contex::str_idx_idx, idx);
+        return idx;
+      }
+      int32_t idx = (int32_t)lua_tointeger(L, -1);
+      lua_pop(L, 2);
+      return idx;
+    }
+
+    // an enum integer has 1 + the string id of its "warrior=0,mage=5" as its size, the size is 0 then.
+    // the layout is kept alive by the enum list of its type
+    inline adata_enum * load_enum(lua_State * L, load_contex& context, int32_t type, int32_t& size, int enum_list_idx)
+    {
+      if (size <= 0 || type < adata_et_fix_int8 || type > adata_et_uint64)
+      {
+        return NULL;
+      }
+      if ((size_t)size > context.namespace_str_pool.size())
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+        return NULL;
+      }
+      const char * text = context.namespace_str_pool[size - 1];
+      size = 0;
+      int32_t count = 1;
+      for (const char * p = text; *p; ++p)
+      {
+        count += *p == ',' ? 1 : 0;
+      }
+      adata_enum * en = (adata_enum *)lua_newuserdata(L, sizeof(adata_enum) + count * (sizeof(int64_t) + sizeof(int32_t)));
+      lua_rawseti(L, enum_list_idx, get_lua_len(L, enum_list_idx) + 1);
+      en->type = type;
+      en->count = count;
+      en->values = (int64_t *)(en + 1);
+      en->name_idx = (int32_t *)(en->values + count);
+      const char * name = text;
+      for (int32_t i = 0; i < count; ++i)
+      {
+        const char * eq = std::strchr(name, '=');
+        char * end = NULL;
+        if (eq != NULL && eq != name)
+        {
+          en->values[i] = (int64_t)std::strtoll(eq + 1, &end, 10);
+        }
+        if (end == NULL || end == eq + 1 || (*end != ',' && *end != 0))
+        {
+          luaL_error(L, "undefined member protocol not compatible");
+          return NULL;
+        }
+        en->name_idx[i] = intern_string(L, name, (size_t)(eq - name));
+        name = end + 1;
+      }
+      return en;
+    }
+
+    inline bool read_quant(const char * text, adata_member * mb)
+    {
+      char * end = NULL;
+      mb->quant_step = strtod(text, &end);
+      if (*end == ',')
+      {
+        mb->quant_min = strtod(end + 1, &end);
+      }
+      if (*end == ',')
+      {
+        mb->quant_max = strtod(end + 1, &end);
+      }
+      return *end == 0 && mb->quant_step > 0 && mb->quant_min < mb->quant_max;
+    }
+
+    // a [quant] float as the generated code reads it, a float32 one rounded to float
+    inline double dequantize_member(adata_member * mb, uint64_t steps)
+    {
+      double v = adata::dequantize(steps, mb->quant_step, mb->quant_min);
+      return mb->type == adata_et_float32 ? (double)(float)v : v;
+    }
+
+    // the value of a [quant] float on the top of the stack, a float32 one is a float first as in the generated code
+    inline double quant_source(lua_State *L, adata_member * mb)
+    {
+      double source = lua_tonumber(L, -1);
+      return mb->type == adata_et_float32 ? (double)(float)source : source;
+    }
+
     inline int load_type(lua_State * L, adata::zero_copy_buffer& buf, load_contex& context)
     {
       //type { layout , name , {field list} , { construct list }  ,  metatable }
@@ -762,7 +909,8 @@ namespace adata {
         idx_name,
         idx_field_list,
         idx_construct_list,
-        idx_metatable
+        idx_metatable,
+        idx_enum_list
       };
 
       lua_createtable(L, 6, 0);             //define type
@@ -785,6 +933,11 @@ namespace adata {
 
       type->member_count = member_count;
       type->members = (adata_member *)adata_member_buffer;
+      type->packed = 0;
+      type->packed_size = 0;
+      type->is_union = 0;
+      uint32_t packed_count = 0;
+      uint32_t union_count = 0;
 
       int32_t type_name_sid;
 
@@ -807,12 +960,17 @@ namespace adata {
       int field_list_idx = lua_gettop(L);
       lua_createtable(L, member_count, 0);  // construct list
       int construct_list_idx = lua_gettop(L);
+      lua_createtable(L, 0, 0);  // enum list
+      int enum_list_idx = lua_gettop(L);
 
       for (uint32_t i = 0; i < member_count; ++i)
       {
         adata_member * mb = &type->members[i];
         mb->paramter_type[0] = NULL;
         mb->paramter_type[1] = NULL;
+        mb->enum_define = NULL;
+        mb->default_int = 0;
+        mb->default_float = 0;
         int32_t member_name_sid;
         read(buf, member_name_sid);
         mb->name = context.namespace_str_pool[member_name_sid];
@@ -850,13 +1008,52 @@ namespace adata {
           mb->type_define = NULL;
         }
         read(buf, mb->del);
+        // member flags: 1 deleted, 2 sized, 4 to 16 the list encoding, 32 columnar, 64 up the [bits=k] width,
+        // 8192 packed, 16384 quant, 32768 dict, 65536 union, 131072 optional, 262144 up the log2 of the [align] of bytes
+        mb->sized = (mb->del & 2) != 0;
+        mb->encoding = (mb->del >> 2) & 7;
+        mb->columnar = (mb->del & 32) != 0;
+        mb->bit_width = (mb->del >> 6) & 127;
+        packed_count += (mb->del & 8192) ? 1 : 0;
+        mb->quant = (mb->del & 16384) != 0;
+        mb->dict = (mb->del & 32768) != 0;
+        mb->optional = (mb->del & 131072) != 0;
+        mb->align = ((mb->del >> 18) & 15) ? 1 << ((mb->del >> 18) & 15) : 0;
+        bool union_member = (mb->del & 65536) != 0;
+        union_count += union_member ? 1 : 0;
+        mb->del &= 1;
         if (mb->del == 0)
         {
           lua_rawgeti(L, load_contex::str_idx_idx, mb->field_idx);
           lua_rawseti(L, field_list_idx, member_list_count);
-          decode_default_value(L, buf, mb, member_typename_sid , member_list_count++, construct_list_idx);
+          decode_default_value(L, buf, mb, member_typename_sid , member_list_count, construct_list_idx);
+          if (union_member || mb->optional)
+          {
+            // a new union holds none of its members and an optional member starts unset, see construct in adata.lua
+            lua_pushboolean(L, 0);
+            lua_rawseti(L, construct_list_idx, member_list_count);
+          }
+          ++member_list_count;
         }
         read(buf, mb->size);
+        if (mb->quant)
+        {
+          // its size is the string id of its "step,min,max"
+          if (mb->size < 0 || (size_t)mb->size >= context.namespace_str_pool.size() || !read_quant(context.namespace_str_pool[mb->size], mb)
+            || (mb->type != adata_et_float32 && mb->type != adata_et_float64) || mb->bit_width == 0)
+          {
+            luaL_error(L, "undefined member protocol not compatible");
+            return 0;
+          }
+          mb->size = 0;
+        }
+        mb->enum_define = load_enum(L, context, mb->type, mb->size, enum_list_idx);
+        if ((mb->enum_define && (mb->bit_width > 0 || mb->encoding != adata::list_plain))
+          || (mb->align && (mb->align > adata::max_bytes_align || mb->type != adata_et_string || mb->dict || mb->optional)))
+        {
+          luaL_error(L, "undefined member protocol not compatible");
+          return 0;
+        }
         read(buf, param_type_count);
         for (uint32_t p = 0; p < param_type_count; ++p)
         {
@@ -895,8 +1092,22 @@ namespace adata {
             ptype->type_define = NULL;
           }
           read(buf, ptype->size);
+          ptype->enum_define = load_enum(L, context, ptype->type, ptype->size, enum_list_idx);
         }
       }
+      lua_rawseti(L, type_idx, idx_enum_list);
+      if (packed_count != 0 && packed_count != member_count)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+        return 0;
+      }
+      type->packed = packed_count != 0;
+      if (union_count != 0 && (union_count != member_count || type->packed))
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+        return 0;
+      }
+      type->is_union = union_count != 0;
       lua_createtable(L,4,0);
       lua_pushvalue(L, -1);
       int32_t mt_len = 0;
@@ -913,6 +1124,43 @@ namespace adata {
       return 1;
     }
 
+    inline int32_t packed_size_of(lua_State * L, adata_type * type, int depth)
+    {
+      if (!type->packed || depth > 16)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+        return 0;
+      }
+      int32_t size = 0;
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        adata_member * mb = &type->members[i];
+        switch (mb->type)
+        {
+        case adata_et_fix_int8: case adata_et_fix_uint8: size += 1; break;
+        case adata_et_fix_int16: case adata_et_fix_uint16: size += 2; break;
+        case adata_et_fix_int32: case adata_et_fix_uint32: case adata_et_float32: size += 4; break;
+        case adata_et_fix_int64: case adata_et_fix_uint64: case adata_et_float64: size += 8; break;
+        case adata_et_type: size += packed_size_of(L, mb->type_define, depth + 1); break;
+        default: luaL_error(L, "undefined member protocol not compatible"); return 0;
+        }
+      }
+      return size;
+    }
+
+    // every member of a union is a type with tag and len_tag, so an unknown kind can be skipped
+    inline void check_union(lua_State * L, adata_type * type)
+    {
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        adata_member * mb = &type->members[i];
+        if (mb->type != adata_et_type || mb->sized || mb->type_define->packed || mb->type_define->is_union)
+        {
+          luaL_error(L, "undefined member protocol not compatible");
+        }
+      }
+    }
+
     inline void load_namespace(lua_State * L, adata::zero_copy_buffer& buf, load_contex& context)
     {
       //{ namespace , {type...} }
@@ -961,6 +1209,17 @@ namespace adata {
         load_type(L, buf, context);
         lua_rawseti(L, type_list_idx, i + 1);
       }
+      for (size_t i = 0; i < context.types.size(); ++i)
+      {
+        if (context.types[i]->packed)
+        {
+          context.types[i]->packed_size = packed_size_of(L, context.types[i], 0);
+        }
+        if (context.types[i]->is_union)
+        {
+          check_union(L, context.types[i]);
+        }
+      }
       lua_rawseti(L, context.namespace_table_idx, 2);
     }
 
@@ -1053,6 +1312,8 @@ namespace adata {
       case adata_et_uint64:{ adata::skip_read(*buf, (uint64_t*)0); break; }
       case adata_et_float32:{ buf->skip_read(4); break; }
       case adata_et_float64:{ buf->skip_read(8); break; }
+      case adata_et_bool:{ break; }
+      case adata_et_bits:{ buf->skip_read((size + 7) / 8); break; }
       case adata_et_string:
       {
         uint32_t len = 0;
@@ -1082,7 +1343,38 @@ namespace adata {
 
     static int skip_read_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
     {
-      if (mb->type == adata_et_list)
+      if (mb->sized)
+      {
+        adata::skip_read_sized(*buf);
+      }
+      else if (mb->columnar)
+      {
+        adata::skip_read_columnar(*buf, mb->size);
+      }
+      else if (mb->encoding == adata::list_xor)
+      {
+        if (mb->paramter_type[0]->type == adata_et_float32)
+        {
+          adata::skip_read_list<float>(*buf, mb->encoding, mb->size);
+        }
+        else
+        {
+          adata::skip_read_list<double>(*buf, mb->encoding, mb->size);
+        }
+      }
+      else if (mb->encoding != adata::list_plain)
+      {
+        adata::skip_read_list<int64_t>(*buf, mb->encoding, mb->size);
+      }
+      else if (mb->dict)
+      {
+        adata::skip_read_dict_string(*buf, mb->size);
+      }
+      else if (mb->align)
+      {
+        adata::skip_read_bytes(*buf, mb->align, mb->size);
+      }
+      else if (mb->type == adata_et_list)
       {
         uint32_t len = 0;
         adata::read(*buf, len);
@@ -1110,6 +1402,14 @@ namespace adata {
           lua_pop(L, 1);
         }
       }
+      else if (mb->type == adata_et_array)
+      {
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int32_t i = 0; i < mb->size; ++i)
+        {
+          skip_read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+        }
+      }
       else
       {
         skip_read_value(L, buf, mb->type, mb->size, mb->type_define);
@@ -1120,8 +1420,23 @@ namespace adata {
     static int lua_skip_read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type)
     {
       (L);
-      (type);
-      adata::skip_read_compatible(*buf);
+      if (type->packed)
+      {
+        buf->skip_read(type->packed_size);
+      }
+      else if (type->is_union)
+      {
+        uint32_t kind = 0;
+        adata::read(*buf, kind);
+        if (kind != 0)
+        {
+          adata::skip_read_compatible(*buf);
+        }
+      }
+      else
+      {
+        adata::skip_read_compatible(*buf);
+      }
       return 0;
     }
 
@@ -1190,6 +1505,9 @@ namespace adata {
     }
 
     static int read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create = true);
+    static int raw_read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create = true);
+    static void enum_read_value(lua_State *L, adata_enum * en);
+    static void enum_write_value(lua_State *L, adata_enum * en);
 
     static inline int read_string(lua_State *L, zero_copy_buffer * buf, int sz)
     {
@@ -1199,6 +1517,43 @@ namespace adata {
       return 1;
     }
 
+    // a [dict] string, only one written without a dict can be read here
+    static inline int read_dict_string(lua_State *L, zero_copy_buffer * buf, int sz)
+    {
+      uint32_t code = 0;
+      adata::read(*buf, code);
+      if (code != 0)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+        return 0;
+      }
+      return read_string(L, buf, sz);
+    }
+
+    // an [align] bytes member, its payload padded as adata::write_bytes does
+    static inline int read_aligned_string(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      int32_t len = adata::check_read_size(*buf, mb->size);
+      std::size_t tail = adata::detail::read_align_pad(*buf, mb->align);
+      char * str = (char*)buf->skip_read(len);
+      buf->skip_read(tail);
+      lua_pushlstring(L, str, len);
+      return 1;
+    }
+
+    // a bits<N> member as a table of N booleans
+    static inline void read_bits(lua_State *L, zero_copy_buffer * buf, int size)
+    {
+      std::vector<bool> bits((std::size_t)size);
+      adata::detail::read_bit_items(*buf, bits, (std::size_t)size);
+      lua_createtable(L, size, 0);
+      for (int i = 0; i < size; ++i)
+      {
+        lua_pushboolean(L, bits[i]);
+        lua_rawseti(L, -2, i + 1);
+      }
+    }
+
     static inline int read_value(lua_State *L, zero_copy_buffer * buf, int type, int size, adata_type * type_define)
     {
       switch (type)
@@ -1221,6 +1576,11 @@ namespace adata {
       case adata_et_uint64:{ read_and_push_value<uint64_t>(L, buf); break; }
       case adata_et_float32:{ read_and_push_value<float>(L, buf); break; }
       case adata_et_float64:{ read_and_push_value<double>(L, buf); break; }
+      case adata_et_bits:
+      {
+        read_bits(L, buf, size);
+        break;
+      }
       case adata_et_string:
       {
         read_string(L, buf, size);
@@ -1246,122 +1606,641 @@ namespace adata {
       return 1;
     }
 
-    static int read_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    template<typename ty>
+    inline void push_list_value(lua_State *L, ty v)
     {
-      if (mb->type == adata_et_list)
+      lua_pushinteger(L, v);
+    }
+
+    template<>
+    inline void push_list_value<int64_t>(lua_State *L, int64_t v)
+    {
+      lua_pushint64(L, v);
+    }
+
+    template<>
+    inline void push_list_value<uint64_t>(lua_State *L, uint64_t v)
+    {
+      lua_pushuint64(L, v);
+    }
+
+    template<>
+    inline void push_list_value<float>(lua_State *L, float v)
+    {
+      lua_pushnumber(L, v);
+    }
+
+    template<>
+    inline void push_list_value<double>(lua_State *L, double v)
+    {
+      lua_pushnumber(L, v);
+    }
+
+    // a [delta], [delta2], [rle] or [xor] list is decoded by the adata kernels into its element type
+    template<typename ty>
+    inline void read_list_as(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      std::vector<ty> list;
+      adata::read_list(*buf, list, mb->encoding, mb->size);
+      lua_createtable(L, (int)list.size(), 0);
+      for (std::size_t i = 0; i < list.size(); ++i)
       {
-        uint32_t len = adata::check_read_size(*buf,mb->size);
-        lua_createtable(L, len, 0);
-        adata_paramter_type * ptype = mb->paramter_type[0];
-        for (uint32_t i = 1; i <= len; ++i)
-        {
-          read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
-          lua_rawseti(L, -2, i);
-        }
+        push_list_value(L, list[i]);
+        lua_rawseti(L, -2, (int)i + 1);
       }
-      else if (mb->type == adata_et_map)
+    }
+
+    static void read_encoded_list(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      switch (mb->paramter_type[0]->type)
+      {
+      case adata_et_int8:{ read_list_as<int8_t>(L, buf, mb); break; }
+      case adata_et_uint8:{ read_list_as<uint8_t>(L, buf, mb); break; }
+      case adata_et_int16:{ read_list_as<int16_t>(L, buf, mb); break; }
+      case adata_et_uint16:{ read_list_as<uint16_t>(L, buf, mb); break; }
+      case adata_et_int32:{ read_list_as<int32_t>(L, buf, mb); break; }
+      case adata_et_uint32:{ read_list_as<uint32_t>(L, buf, mb); break; }
+      case adata_et_int64:{ read_list_as<int64_t>(L, buf, mb); break; }
+      case adata_et_uint64:{ read_list_as<uint64_t>(L, buf, mb); break; }
+      case adata_et_float32:{ read_list_as<float>(L, buf, mb); break; }
+      case adata_et_float64:{ read_list_as<double>(L, buf, mb); break; }
+      default:
       {
-        uint32_t len = adata::check_read_size(*buf, mb->size);
-        adata_paramter_type * ptype1 = mb->paramter_type[0];
-        adata_paramter_type * ptype2 = mb->paramter_type[1];
-        lua_createtable(L, 0, len);
-        for (uint32_t i = 0; i < len; ++i)
-        {
-          read_value(L, buf, ptype1->type, ptype1->size, ptype1->type_define);
-          read_value(L, buf, ptype2->type, ptype2->size, ptype2->type_define);
-          lua_rawset(L, -3);
-        }
+        luaL_error(L, "undefined member protocol not compatible");
       }
-      else
-      {
-        read_value(L, buf, mb->type, mb->size, mb->type_define);
       }
-      return 1;
     }
 
-    static int read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create)
+    // a type with no member present, read it for the defaults of every member
+    static void push_default_type(lua_State *L, adata_type * type)
     {
-      if (create)
+      static const unsigned char empty_type[2] = { 0, 2 };
+      zero_copy_buffer empty;
+      empty.set_read(empty_type, sizeof(empty_type));
+      read_type(L, &empty, type, true);
+    }
+
+    // an element of an array left out of the data, zero, empty or a default type
+    static void push_default_element(lua_State *L, adata_paramter_type * ptype)
+    {
+      switch (ptype->type)
       {
-        lua_createtable(L, 0, (int)type->member_count);
-        lua_rawgeti(L, 2, type->mt_idx);
-        lua_setmetatable(L, -2);
-      }
-      int64_t data_tag = 0;
-      int32_t data_len = 0;
-      ::std::size_t offset = buf->read_length();
-      read(*buf, data_tag);
-      read(*buf, data_len);
-      uint64_t mask = 1;
-      for (size_t i = 0; i < type->member_count; ++i)
+      case adata_et_string: lua_pushlstring(L, "", 0); break;
+      case adata_et_fix_int64: case adata_et_int64: lua_pushint64(L, 0); break;
+      case adata_et_fix_uint64: case adata_et_uint64: lua_pushuint64(L, 0); break;
+      case adata_et_float32: case adata_et_float64: lua_pushnumber(L, 0); break;
+      case adata_et_type:
       {
-        adata_member * mb = &type->members[i];
-        int skip = 0;
-        int read = 0;
-        int create_default = 0;
-        if (mb->del == 0)
+        if (ptype->type_define)
         {
-          if (data_tag&mask)
-          {
-            read = 1;
-          }
-          else
-          {
-            if (create)
-            {
-              create_default = 1;
-            }
-          }
+          push_default_type(L, ptype->type_define);
         }
         else
         {
-          if (data_tag&mask)
-          {
-            skip = 1;
-          }
-        }
-        if (skip)
-        {
-          if (skip_read_member(L, buf, mb) == 0)
-          {
-            return 0;
-          }
+          luaL_error(L, "undefined member protocol not compatible");
         }
-        else if (read)
-        {
-          lua_rawgeti(L, 1, mb->field_idx);
-          if (read_member(L, buf, mb) == 0)
-          {
-            lua_pop(L, 1);
-            return 0;
-          }
-          else
-          {
-            lua_settable(L, -3);
-          }
+        break;
+      }
+      default: lua_pushinteger(L, 0); break;
+      }
+    }
+
+    // the value of a member left out of the data, false if there is none
+    static bool push_default_value(lua_State *L, adata_member * mb)
+    {
+      if (mb->optional)
+      {
+        return false;
+      }
+      switch (mb->type)
+      {
+      case adata_et_string:
+      {
+        lua_pushlstring(L, "", 0);
+        return true;
+      }
+      case adata_et_list:
+      case adata_et_map:
+      {
+        lua_createtable(L, 0, 0);
+        return true;
+      }
+      // members at their default are not in the data either
+      case adata_et_fix_int8:
+      case adata_et_fix_int16:
+      case adata_et_fix_int32:
+      case adata_et_fix_int64:
+      case adata_et_int8:
+      case adata_et_int16:
+      case adata_et_int32:
+      case adata_et_int64:
+      {
+        lua_pushint64(L, mb->default_int);
+        enum_read_value(L, mb->enum_define);
+        return true;
+      }
+      case adata_et_fix_uint8:
+      case adata_et_fix_uint16:
+      case adata_et_fix_uint32:
+      case adata_et_fix_uint64:
+      case adata_et_uint8:
+      case adata_et_uint16:
+      case adata_et_uint32:
+      case adata_et_uint64:
+      {
+        lua_pushuint64(L, (uint64_t)mb->default_int);
+        enum_read_value(L, mb->enum_define);
+        return true;
+      }
+      case adata_et_float32:
+      case adata_et_float64:
+      {
+        lua_pushnumber(L, mb->default_float);
+        return true;
+      }
+      case adata_et_bool:
+      {
+        lua_pushboolean(L, mb->default_int != 0);
+        return true;
+      }
+      case adata_et_bits:
+      {
+        lua_createtable(L, mb->size, 0);
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          lua_pushboolean(L, 0);
+          lua_rawseti(L, -2, i);
         }
-        else if (create_default)
+        return true;
+      }
+      case adata_et_array:
+      {
+        lua_createtable(L, mb->size, 0);
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          push_default_element(L, mb->paramter_type[0]);
+          lua_rawseti(L, -2, i);
+        }
+        return true;
+      }
+      case adata_et_type:
+      {
+        if (mb->type_define)
+        {
+          push_default_type(L, mb->type_define);
+          return true;
+        }
+        break;
+      }
+      }
+
+      return false;
+    }
+
+    static int read_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb);
+
+    static inline bool is_column_type(int type)
+    {
+      return (type >= adata_et_int8 && type <= adata_et_uint64) || type == adata_et_bool;
+    }
+
+    // an integer column of a [columnar] list, set on each element, and the steps of a [quant] float
+    template<typename ty>
+    inline void read_column_as(lua_State *L, zero_copy_buffer * buf, adata_member * mb, int list_idx, uint32_t len)
+    {
+      std::vector<ty> column;
+      adata::read_column(*buf, column, (int32_t)len);
+      for (uint32_t k = 0; k < len; ++k)
+      {
+        lua_rawgeti(L, list_idx, k + 1);
+        lua_rawgeti(L, 1, mb->field_idx);
+        push_list_value(L, column[k]);
+        enum_read_value(L, mb->enum_define);
+        lua_settable(L, -3);
+        lua_pop(L, 1);
+      }
+    }
+
+    static void read_column(lua_State *L, zero_copy_buffer * buf, adata_member * mb, int list_idx, uint32_t len)
+    {
+      if (mb->quant && !mb->del)
+      {
+        std::vector<uint64_t> column;
+        adata::read_column(*buf, column, (int32_t)len);
+        for (uint32_t k = 0; k < len; ++k)
+        {
+          lua_rawgeti(L, list_idx, k + 1);
+          lua_rawgeti(L, 1, mb->field_idx);
+          lua_pushnumber(L, dequantize_member(mb, column[k]));
+          lua_settable(L, -3);
+          lua_pop(L, 1);
+        }
+        return;
+      }
+      switch (mb->del ? adata_et_unknow : mb->type)
+      {
+      case adata_et_int8:{ read_column_as<int8_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_uint8:{ read_column_as<uint8_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_int16:{ read_column_as<int16_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_uint16:{ read_column_as<uint16_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_int32:{ read_column_as<int32_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_uint32:{ read_column_as<uint32_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_int64:{ read_column_as<int64_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_uint64:{ read_column_as<uint64_t>(L, buf, mb, list_idx, len); break; }
+      case adata_et_bool:
+      {
+        std::vector<bool> column;
+        adata::read_bool_column(*buf, column, (int32_t)len);
+        for (uint32_t k = 0; k < len; ++k)
+        {
+          lua_rawgeti(L, list_idx, k + 1);
+          lua_rawgeti(L, 1, mb->field_idx);
+          lua_pushboolean(L, column[k]);
+          lua_settable(L, -3);
+          lua_pop(L, 1);
+        }
+        break;
+      }
+      default:
+      {
+        if (mb->type == adata_et_bool)
         {
-          switch (mb->type)
+          adata::skip_read_bool_column(*buf, (int32_t)len);
+        }
+        else
+        {
+          adata::skip_read_column<int64_t>(*buf, (int32_t)len);
+        }
+      }
+      }
+    }
+
+    // a [columnar] list, the elements start at their defaults and are filled column by column
+    static void read_columnar(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      adata_type * type = mb->paramter_type[0]->type_define;
+      uint32_t len = adata::check_read_size(*buf, mb->size);
+      lua_createtable(L, len, 0);
+      if (len == 0)
+      {
+        return;
+      }
+      if (type == NULL)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+      }
+      int list_idx = lua_gettop(L);
+      for (uint32_t k = 1; k <= len; ++k)
+      {
+        push_default_type(L, type);
+        lua_rawseti(L, list_idx, k);
+      }
+      ::std::size_t offset = buf->read_length();
+      uint64_t data_tag = 0;
+      int32_t data_len = 0;
+      adata::read(*buf, data_tag);
+      adata::read(*buf, data_len);
+      for (int32_t i = 0; i < type->member_count && i < 63; ++i)
+      {
+        if ((data_tag & ((uint64_t)1 << i)) == 0)
+        {
+          continue;
+        }
+        adata_member * column = &type->members[i];
+        if (is_column_type(column->type) || column->quant)
+        {
+          read_column(L, buf, column, list_idx, len);
+          continue;
+        }
+        for (uint32_t k = 1; k <= len; ++k)
+        {
+          if (column->del)
           {
-          case adata_et_string:
+            skip_read_member(L, buf, column);
+            continue;
+          }
+          lua_rawgeti(L, list_idx, k);
+          lua_rawgeti(L, 1, column->field_idx);
+          read_member(L, buf, column);
+          lua_settable(L, -3);
+          lua_pop(L, 1);
+        }
+      }
+      if (data_len >= 0)
+      {
+        ::std::size_t read_len = buf->read_length() - offset;
+        ::std::size_t skip_len = (::std::size_t)data_len;
+        if (skip_len > read_len) buf->skip_read(skip_len - read_len);
+      }
+    }
+
+    static int read_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      if (mb->sized)
+      {
+        int32_t payload_len = 0;
+        adata::read(*buf, payload_len);
+      }
+      if (mb->columnar)
+      {
+        read_columnar(L, buf, mb);
+      }
+      else if (mb->encoding != adata::list_plain)
+      {
+        read_encoded_list(L, buf, mb);
+      }
+      else if (mb->dict)
+      {
+        read_dict_string(L, buf, mb->size);
+      }
+      else if (mb->align)
+      {
+        read_aligned_string(L, buf, mb);
+      }
+      else if (mb->type == adata_et_bool)
+      {
+        // in the data only when it is not the default
+        lua_pushboolean(L, mb->default_int == 0);
+      }
+      else if (mb->type == adata_et_list)
+      {
+        uint32_t len = adata::check_read_size(*buf,mb->size);
+        lua_createtable(L, len, 0);
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (uint32_t i = 1; i <= len; ++i)
+        {
+          read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+          enum_read_value(L, ptype->enum_define);
+          lua_rawseti(L, -2, i);
+        }
+      }
+      else if (mb->type == adata_et_map)
+      {
+        uint32_t len = adata::check_read_size(*buf, mb->size);
+        adata_paramter_type * ptype1 = mb->paramter_type[0];
+        adata_paramter_type * ptype2 = mb->paramter_type[1];
+        lua_createtable(L, 0, len);
+        for (uint32_t i = 0; i < len; ++i)
+        {
+          read_value(L, buf, ptype1->type, ptype1->size, ptype1->type_define);
+          enum_read_value(L, ptype1->enum_define);
+          read_value(L, buf, ptype2->type, ptype2->size, ptype2->type_define);
+          enum_read_value(L, ptype2->enum_define);
+          lua_rawset(L, -3);
+        }
+      }
+      else if (mb->type == adata_et_array)
+      {
+        // no length, the count is in the type
+        lua_createtable(L, mb->size, 0);
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+          enum_read_value(L, ptype->enum_define);
+          lua_rawseti(L, -2, i);
+        }
+      }
+      else
+      {
+        read_value(L, buf, mb->type, mb->size, mb->type_define);
+        enum_read_value(L, mb->enum_define);
+      }
+      return 1;
+    }
+
+    // [bits=k] members next to each other share one run of bits, a run ends at member 63
+    static inline size_t bit_run_end(adata_type * type, size_t first)
+    {
+      size_t end = first + 1;
+      while (end < type->member_count && end != 63 && type->members[end].bit_width > 0)
+      {
+        ++end;
+      }
+      return end;
+    }
+
+    template<typename ty>
+    inline void read_bit_value_as(lua_State *L, adata::bit_reader<zero_copy_buffer>& bits, int width)
+    {
+      ty v;
+      bits.read(v, width);
+      push_list_value(L, v);
+    }
+
+    static void read_bit_value(lua_State *L, adata::bit_reader<zero_copy_buffer>& bits, adata_member * mb)
+    {
+      if (mb->quant)
+      {
+        lua_pushnumber(L, dequantize_member(mb, bits.read_unsigned(mb->bit_width)));
+        return;
+      }
+      switch (mb->type)
+      {
+      case adata_et_fix_int8: case adata_et_int8:{ read_bit_value_as<int8_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint8: case adata_et_uint8:{ read_bit_value_as<uint8_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int16: case adata_et_int16:{ read_bit_value_as<int16_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint16: case adata_et_uint16:{ read_bit_value_as<uint16_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int32: case adata_et_int32:{ read_bit_value_as<int32_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint32: case adata_et_uint32:{ read_bit_value_as<uint32_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int64: case adata_et_int64:{ read_bit_value_as<int64_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint64: case adata_et_uint64:{ read_bit_value_as<uint64_t>(L, bits, mb->bit_width); break; }
+      default:
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+      }
+      }
+    }
+
+    // the members of the run starting at first, return the index behind it
+    static size_t read_bit_run(lua_State *L, zero_copy_buffer * buf, adata_type * type, size_t first, const uint64_t * words)
+    {
+      size_t end = bit_run_end(type, first);
+      adata::bit_reader<zero_copy_buffer> bits(*buf);
+      for (size_t i = first; i < end; ++i)
+      {
+        adata_member * mb = &type->members[i];
+        bool present = detail::ext_tag_test(words, i);
+        if (mb->del)
+        {
+          if (present)
+          {
+            bits.skip(mb->bit_width);
+          }
+          continue;
+        }
+        if (present)
+        {
+          lua_rawgeti(L, 1, mb->field_idx);
+          read_bit_value(L, bits, mb);
+          lua_settable(L, -3);
+        }
+        else
+        {
+          lua_rawgeti(L, 1, mb->field_idx);
+          if (push_default_value(L, mb))
           {
-            lua_rawgeti(L, 1, mb->field_idx);
-            lua_pushlstring(L, "", 0);
             lua_settable(L, -3);
-            break;
           }
-          case adata_et_list:
-          case adata_et_map:
+          else
+          {
+            lua_pop(L, 1);
+          }
+        }
+      }
+      return end;
+    }
+
+    // the field of the member held is set and the others cleared, a kind not known or deleted
+    // is skipped and leaves none, raw data has no such kinds
+    static int read_union(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create, bool raw)
+    {
+      if (create)
+      {
+        lua_createtable(L, 0, 1);
+        lua_rawgeti(L, 2, type->mt_idx);
+        lua_setmetatable(L, -2);
+      }
+      uint32_t kind = 0;
+      read(*buf, kind);
+      for (int32_t i = 0; i < type->member_count && !create; ++i)
+      {
+        if (type->members[i].del == 0)
+        {
+          lua_rawgeti(L, 1, type->members[i].field_idx);
+          lua_pushnil(L);
+          lua_settable(L, -3);
+        }
+      }
+      if (kind == 0)
+      {
+        return 1;
+      }
+      if (kind > (uint32_t)type->member_count || type->members[kind - 1].del)
+      {
+        if (raw)
+        {
+          luaL_error(L, "undefined member protocol not compatible");
+          return 0;
+        }
+        adata::skip_read_compatible(*buf);
+        return 1;
+      }
+      adata_member * mb = &type->members[kind - 1];
+      lua_rawgeti(L, 1, mb->field_idx);
+      if ((raw ? raw_read_type(L, buf, mb->type_define, true) : read_type(L, buf, mb->type_define, true)) == 0)
+      {
+        lua_pop(L, 1);
+        return 0;
+      }
+      lua_settable(L, -3);
+      return 1;
+    }
+
+    static int read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create)
+    {
+      if (type->packed)
+      {
+        return raw_read_type(L, buf, type, create);
+      }
+      if (type->is_union)
+      {
+        return read_union(L, buf, type, create, false);
+      }
+      if (create)
+      {
+        lua_createtable(L, 0, (int)type->member_count);
+        lua_rawgeti(L, 2, type->mt_idx);
+        lua_setmetatable(L, -2);
+      }
+      uint64_t data_tag = 0;
+      int32_t data_len = 0;
+      ::std::size_t offset = buf->read_length();
+      read(*buf, data_tag);
+      read(*buf, data_len);
+      // presence bit of every member index, more than one word only for wide types
+      size_t word_count = (type->member_count + 63) / 64;
+      uint64_t first_word = data_tag & ~ext_tag_bit;
+      uint64_t * words = &first_word;
+      std::vector<uint64_t> more_words;
+      if (word_count > 1)
+      {
+        more_words.assign(word_count, 0);
+        more_words[0] = first_word;
+        words = &more_words[0];
+      }
+      for (size_t i = 0; i < type->member_count; ++i)
+      {
+        if (i == 63 && (data_tag & ext_tag_bit))
+        {
+          read_ext_tag(*buf, words, word_count);
+        }
+        adata_member * mb = &type->members[i];
+        if (mb->bit_width > 0)
+        {
+          i = read_bit_run(L, buf, type, i, words) - 1;
+          continue;
+        }
+        bool present = detail::ext_tag_test(words, i);
+        int skip = 0;
+        int read = 0;
+        int create_default = 0;
+        if (mb->del == 0)
+        {
+          if (present)
+          {
+            read = 1;
+          }
+          else
+          {
+            // also when reading into a used table, which then reads as a new one would
+            create_default = 1;
+          }
+        }
+        else
+        {
+          if (present)
+          {
+            skip = 1;
+          }
+        }
+        if (skip)
+        {
+          if (skip_read_member(L, buf, mb) == 0)
+          {
+            return 0;
+          }
+        }
+        else if (read)
+        {
+          lua_rawgeti(L, 1, mb->field_idx);
+          if (read_member(L, buf, mb) == 0)
+          {
+            lua_pop(L, 1);
+            return 0;
+          }
+          else
+          {
+            lua_settable(L, -3);
+          }
+        }
+        else if (create_default)
+        {
+          lua_rawgeti(L, 1, mb->field_idx);
+          if (push_default_value(L, mb))
           {
-            lua_rawgeti(L, 1, mb->field_idx);
-            lua_createtable(L, 0, 0);
             lua_settable(L, -3);
-            break;
           }
+          else if (mb->optional)
+          {
+            lua_pushnil(L);
+            lua_settable(L, -3);
+          }
+          else
+          {
+            lua_pop(L, 1);
           }
         }
-        mask <<= 1;
       }
       ::std::size_t read_len = buf->read_length() - offset;
       ::std::size_t len = (::std::size_t)data_len;
@@ -1400,8 +2279,6 @@ namespace adata {
     }
 
 
-    static int raw_read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create = true);
-
     static inline int raw_read_value(lua_State *L, zero_copy_buffer * buf, int type, int size, adata_type * type_define)
     {
       switch (type)
@@ -1424,6 +2301,18 @@ namespace adata {
       case adata_et_uint64:{ read_and_push_value<uint64_t>(L, buf); break; }
       case adata_et_float32:{ read_and_push_value<float>(L, buf); break; }
       case adata_et_float64:{ read_and_push_value<double>(L, buf); break; }
+      case adata_et_bool:
+      {
+        bool value = false;
+        adata::read(*buf, value);
+        lua_pushboolean(L, value);
+        break;
+      }
+      case adata_et_bits:
+      {
+        read_bits(L, buf, size);
+        break;
+      }
       case adata_et_string:
       {
         read_string(L, buf, size);
@@ -1451,6 +2340,17 @@ namespace adata {
 
     static int raw_read_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
     {
+      if (mb->optional)
+      {
+        // a presence byte, then the value when it is set
+        uint8_t has_value = 0;
+        adata::read(*buf, has_value);
+        if (has_value == 0)
+        {
+          lua_pushnil(L);
+          return 1;
+        }
+      }
       if (mb->type == adata_et_list)
       {
         uint32_t len = adata::check_read_size(*buf, mb->size);
@@ -1459,6 +2359,7 @@ namespace adata {
         for (uint32_t i = 1; i <= len; ++i)
         {
           raw_read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+          enum_read_value(L, ptype->enum_define);
           lua_rawseti(L, -2, i);
         }
       }
@@ -1471,19 +2372,41 @@ namespace adata {
         for (uint32_t i = 0; i < len; ++i)
         {
           raw_read_value(L, buf, ptype1->type, ptype1->size, ptype1->type_define);
+          enum_read_value(L, ptype1->enum_define);
           raw_read_value(L, buf, ptype2->type, ptype2->size, ptype2->type_define);
+          enum_read_value(L, ptype2->enum_define);
           lua_rawset(L, -3);
         }
       }
+      else if (mb->type == adata_et_array)
+      {
+        lua_createtable(L, mb->size, 0);
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          raw_read_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+          enum_read_value(L, ptype->enum_define);
+          lua_rawseti(L, -2, i);
+        }
+      }
+      else if (mb->align)
+      {
+        read_aligned_string(L, buf, mb);
+      }
       else
       {
         raw_read_value(L, buf, mb->type, mb->size, mb->type_define);
+        enum_read_value(L, mb->enum_define);
       }
       return 1;
     }
 
     static int raw_read_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, bool create)
     {
+      if (type->is_union)
+      {
+        return read_union(L, buf, type, create, true);
+      }
       if (create)
       {
         lua_createtable(L, 0, (int)type->member_count);
@@ -1529,6 +2452,8 @@ namespace adata {
     {
       uint64_t tag;
       uint32_t size;
+      // presence of every member index, only for a wide type with members 63 and up present
+      std::vector<uint64_t> ext_tag;
       type_sizeof_info() :tag(0), size(0){}
     };
 
@@ -1542,6 +2467,7 @@ namespace adata {
     };
 
     static int write_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, sizeof_cache_contex& ctx);
+    static int raw_write_type(lua_State *L, zero_copy_buffer * buf, adata_type * type);
 
     template<typename ty>
     inline int lua_to_number(lua_State *L, int idx, ty& v)
@@ -1621,6 +2547,117 @@ namespace adata {
       return 0;
     }
 
+    // reads give the name of an enum instead of its integer, see lua_enum_names
+    inline bool& enum_names_option()
+    {
+      static bool names = false;
+      return names;
+    }
+
+    // adata_core.enum_names([on]), return the setting before
+    static int lua_enum_names(lua_State * L)
+    {
+      bool& names = enum_names_option();
+      bool before = names;
+      if (lua_gettop(L) > 0)
+      {
+        names = lua_toboolean(L, 1) != 0;
+      }
+      lua_pushboolean(L, before);
+      return 1;
+    }
+
+    static inline bool is_unsigned_enum(adata_enum * en)
+    {
+      switch (en->type)
+      {
+      case adata_et_fix_uint8: case adata_et_fix_uint16: case adata_et_fix_uint32: case adata_et_fix_uint64:
+      case adata_et_uint8: case adata_et_uint16: case adata_et_uint32: case adata_et_uint64:
+        return true;
+      }
+      return false;
+    }
+
+    // the index of the integer on the top of the stack in the enum, -1 if it is no enumerator
+    static inline int32_t enum_index_of(lua_State *L, adata_enum * en)
+    {
+      int64_t value = 0;
+      if (is_unsigned_enum(en))
+      {
+        uint64_t u = 0;
+        lua_to_number(L, -1, u);
+        value = (int64_t)u;
+      }
+      else
+      {
+        lua_to_number(L, -1, value);
+      }
+      for (int32_t i = 0; i < en->count; ++i)
+      {
+        if (en->values[i] == value)
+        {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    // the integer of an enum just read on the top of the stack, its name instead when enum_names is on
+    static void enum_read_value(lua_State *L, adata_enum * en)
+    {
+      if (en == NULL)
+      {
+        return;
+      }
+      int32_t i = enum_index_of(L, en);
+      if (i < 0)
+      {
+        luaL_error(L, "value is not an enumerator of the enum");
+      }
+      if (enum_names_option())
+      {
+        lua_pop(L, 1);
+        lua_rawgeti(L, 1, en->name_idx[i]);
+      }
+    }
+
+    // the value of an enum on the top of the stack to be written, a name is replaced by its integer
+    static void enum_write_value(lua_State *L, adata_enum * en)
+    {
+      if (en == NULL)
+      {
+        return;
+      }
+      if (lua_type(L, -1) != LUA_TSTRING)
+      {
+        if (enum_index_of(L, en) < 0)
+        {
+          luaL_error(L, "value is not an enumerator of the enum");
+        }
+        return;
+      }
+      for (int32_t i = 0; i < en->count; ++i)
+      {
+        lua_rawgeti(L, 1, en->name_idx[i]);
+        bool found = lua_rawequal(L, -1, -2) != 0;
+        lua_pop(L, 1);
+        if (found)
+        {
+          lua_pop(L, 1);
+          if (is_unsigned_enum(en))
+          {
+            lua_pushuint64(L, (uint64_t)en->values[i]);
+          }
+          else
+          {
+            lua_pushint64(L, en->values[i]);
+          }
+          return;
+        }
+      }
+      luaL_error(L, "value is not an enumerator of the enum");
+    }
+
     template<typename ty>
     void fix_pop_and_write_value(lua_State *L, zero_copy_buffer * buf)
     {
@@ -1696,6 +2733,26 @@ namespace adata {
       return 1;
     }
 
+    static inline int32_t sizeof_aligned_string(lua_State *L, adata_member * mb)
+    {
+      size_t slen = 0;
+      lua_get_string_ref(L, -1, &slen);
+      return adata::size_of_bytes(slen, mb->align);
+    }
+
+    static inline int write_aligned_string(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      size_t slen = 0;
+      char * str = lua_get_string_ref(L, -1, &slen);
+      if (mb->size > 0 && slen > (size_t)mb->size)
+      {
+        luaL_error(L, "number of element not match");
+        return 0;
+      }
+      adata::write_bytes(*buf, str, slen, mb->align);
+      return 1;
+    }
+
     static inline int lua_get_len(lua_State *L, adata_member * mb)
     {
       int len = 0;
@@ -1743,8 +2800,67 @@ namespace adata {
       return len;
     }
 
+    template<typename ty>
+    static inline bool lua_is_default_value(lua_State *L, ty default_value)
+    {
+      ty v = 0;
+      lua_to_number(L, -1, v);
+      return adata::is_default(v, default_value);
+    }
+
+    // true if a bits<N> table has one of its first N entries set
+    static inline bool lua_bits_any(lua_State *L, int size)
+    {
+      if (lua_type(L, -1) != LUA_TTABLE)
+      {
+        return false;
+      }
+      bool any = false;
+      for (int i = 1; i <= size && !any; ++i)
+      {
+        lua_rawgeti(L, -1, i);
+        any = lua_toboolean(L, -1) != 0;
+        lua_pop(L, 1);
+      }
+      return any;
+    }
+
+    static inline bool test_adata_default_type(lua_State *L, adata_type * type);
+
+    // true if an element of an array is at the default of its type
+    static inline bool test_adata_empty_element(lua_State *L, adata_paramter_type * ptype)
+    {
+      switch (ptype->type)
+      {
+      case adata_et_string:
+      {
+        size_t slen = 0;
+        return lua_type(L, -1) != LUA_TSTRING || (lua_tolstring(L, -1, &slen), slen == 0);
+      }
+      case adata_et_type:
+      {
+        return ptype->type_define != NULL && lua_type(L, -1) == LUA_TTABLE && test_adata_default_type(L, ptype->type_define);
+      }
+      case adata_et_float32: return lua_is_default_value<float>(L, 0.0f);
+      case adata_et_float64: return lua_is_default_value<double>(L, 0.0);
+      case adata_et_fix_uint64: case adata_et_uint64: return lua_is_default_value<uint64_t>(L, 0);
+      }
+      return lua_is_default_value<int64_t>(L, 0);
+    }
+
+    // true if the member is left out: optional ones nil, strings and containers empty, others at the schema default.
+    // an enum given by its name is replaced by its integer first
     static inline bool test_adata_empty(lua_State *L, adata_member * mb)
     {
+      if (mb->optional && lua_isnil(L, -1))
+      {
+        return true;
+      }
+      enum_write_value(L, mb->enum_define);
+      if (mb->optional)
+      {
+        return false;
+      }
       switch (mb->type)
       {
       case adata_et_string:
@@ -1753,10 +2869,89 @@ namespace adata {
       {
         return lua_get_len(L, mb) == 0;
       }
+      case adata_et_fix_int8: case adata_et_int8: return lua_is_default_value<int8_t>(L, (int8_t)mb->default_int);
+      case adata_et_fix_uint8: case adata_et_uint8: return lua_is_default_value<uint8_t>(L, (uint8_t)mb->default_int);
+      case adata_et_fix_int16: case adata_et_int16: return lua_is_default_value<int16_t>(L, (int16_t)mb->default_int);
+      case adata_et_fix_uint16: case adata_et_uint16: return lua_is_default_value<uint16_t>(L, (uint16_t)mb->default_int);
+      case adata_et_fix_int32: case adata_et_int32: return lua_is_default_value<int32_t>(L, (int32_t)mb->default_int);
+      case adata_et_fix_uint32: case adata_et_uint32: return lua_is_default_value<uint32_t>(L, (uint32_t)mb->default_int);
+      case adata_et_fix_int64: case adata_et_int64: return lua_is_default_value<int64_t>(L, mb->default_int);
+      case adata_et_fix_uint64: case adata_et_uint64: return lua_is_default_value<uint64_t>(L, (uint64_t)mb->default_int);
+      case adata_et_float32: return lua_is_default_value<float>(L, (float)mb->default_float);
+      case adata_et_float64: return lua_is_default_value<double>(L, mb->default_float);
+      case adata_et_bool: return (lua_toboolean(L, -1) != 0) == (mb->default_int != 0);
+      case adata_et_bits: return !lua_bits_any(L, mb->size);
+      case adata_et_array:
+      {
+        if (lua_type(L, -1) != LUA_TTABLE)
+        {
+          return true;
+        }
+        bool empty = true;
+        for (int i = 1; i <= mb->size && empty; ++i)
+        {
+          lua_rawgeti(L, -1, i);
+          empty = test_adata_empty_element(L, mb->paramter_type[0]);
+          lua_pop(L, 1);
+        }
+        return empty;
+      }
+      case adata_et_type:
+      {
+        return mb->type_define != NULL && lua_type(L, -1) == LUA_TTABLE && test_adata_default_type(L, mb->type_define);
+      }
       }
       return false;
     }
 
+    // a nested type is left out when none of its members would be written
+    // the member a union holds is its first live field that is neither nil nor false, -1 for none
+    static int32_t union_member_index(lua_State *L, adata_type * type)
+    {
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        adata_member * mb = &type->members[i];
+        if (mb->del)
+        {
+          continue;
+        }
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        bool held = lua_toboolean(L, -1) != 0;
+        lua_pop(L, 1);
+        if (held)
+        {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    static inline bool test_adata_default_type(lua_State *L, adata_type * type)
+    {
+      if (type->is_union)
+      {
+        return union_member_index(L, type) < 0;
+      }
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        adata_member * mb = &type->members[i];
+        if (mb->del)
+        {
+          continue;
+        }
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        bool empty = test_adata_empty(L, mb);
+        lua_pop(L, 1);
+        if (!empty)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
     static int sizeof_type(lua_State *L, adata_type * type, sizeof_cache_contex * ctx = NULL);
 
     static inline int32_t sizeof_value(lua_State *L, int type, int size, adata_type * type_define, sizeof_cache_contex * ctx)
@@ -1782,6 +2977,8 @@ namespace adata {
       case adata_et_uint64:{ return sizeof_value<uint64_t>(L); }
       case adata_et_float32:{ return sizeof_value<float>(L); }
       case adata_et_float64:{ return sizeof_value<double>(L); }
+      case adata_et_bool:{ return 0; }
+      case adata_et_bits:{ return (size + 7) / 8; }
       case adata_et_string:
       {
         return sizeof_string(L);
@@ -1809,10 +3006,73 @@ namespace adata {
       return len;
     }
 
-    static int32_t sizeof_member(lua_State *L, adata_member * mb, sizeof_cache_contex * ctx)
+    // a [delta], [delta2], [rle] or [xor] list through the adata kernels, only its size when buf is null
+    template<typename ty>
+    inline int32_t write_list_as(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      int len = lua_length(L, -1);
+      if (buf && mb->size && len > mb->size)
+      {
+        luaL_error(L, "number of element not match");
+      }
+      std::vector<ty> list((std::size_t)len);
+      for (int i = 1; i <= len; ++i)
+      {
+        lua_rawgeti(L, -1, i);
+        lua_to_number(L, -1, list[i - 1]);
+        lua_pop(L, 1);
+      }
+      if (buf)
+      {
+        adata::write_list(*buf, list, mb->encoding);
+        return 0;
+      }
+      return adata::size_of_list(list, mb->encoding);
+    }
+
+    static int32_t write_encoded_list(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
+    {
+      switch (mb->paramter_type[0]->type)
+      {
+      case adata_et_int8: return write_list_as<int8_t>(L, buf, mb);
+      case adata_et_uint8: return write_list_as<uint8_t>(L, buf, mb);
+      case adata_et_int16: return write_list_as<int16_t>(L, buf, mb);
+      case adata_et_uint16: return write_list_as<uint16_t>(L, buf, mb);
+      case adata_et_int32: return write_list_as<int32_t>(L, buf, mb);
+      case adata_et_uint32: return write_list_as<uint32_t>(L, buf, mb);
+      case adata_et_int64: return write_list_as<int64_t>(L, buf, mb);
+      case adata_et_uint64: return write_list_as<uint64_t>(L, buf, mb);
+      case adata_et_float32: return write_list_as<float>(L, buf, mb);
+      case adata_et_float64: return write_list_as<double>(L, buf, mb);
+      default: break;
+      }
+      luaL_error(L, "undefined member protocol not compatible");
+      return 0;
+    }
+
+    static int32_t encode_columnar(lua_State *L, zero_copy_buffer * buf, adata_member * mb, sizeof_cache_contex * ctx);
+
+    static int32_t sizeof_member(lua_State *L, adata_member * mb, sizeof_cache_contex * ctx, bool payload_only = false)
     {
       int32_t size = 0;
-      if (mb->type == adata_et_list)
+      if (mb->columnar)
+      {
+        size += encode_columnar(L, NULL, mb, ctx);
+      }
+      else if (mb->encoding != adata::list_plain)
+      {
+        size += write_encoded_list(L, NULL, mb);
+      }
+      else if (mb->dict)
+      {
+        // code 0, the string follows
+        size += 1 + sizeof_string(L);
+      }
+      else if (mb->align)
+      {
+        size += sizeof_aligned_string(L, mb);
+      }
+      else if (mb->type == adata_et_list)
       {
         int len = lua_length(L, -1);
         size += adata::size_of(len);
@@ -1820,6 +3080,7 @@ namespace adata {
         for (int i = 1; i <= len; ++i)
         {
           lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
           size += sizeof_value(L, ptype->type, ptype->size, ptype->type_define, ctx);
           lua_pop(L, 1);
         }
@@ -1833,23 +3094,59 @@ namespace adata {
         while (lua_next(L, -2))
         {
           lua_pushvalue(L, -2);
+          enum_write_value(L, ptype1->enum_define);
           size += sizeof_value(L, ptype1->type, ptype1->size, ptype1->type_define, ctx);
           lua_pop(L, 1);
+          enum_write_value(L, ptype2->enum_define);
           size += sizeof_value(L, ptype2->type, ptype2->size, ptype2->type_define, ctx);
           lua_pop(L, 1);
           ++i;
         }
         size += adata::size_of(--i);
       }
+      else if (mb->type == adata_et_array)
+      {
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
+          size += sizeof_value(L, ptype->type, ptype->size, ptype->type_define, ctx);
+          lua_pop(L, 1);
+        }
+      }
       else
       {
+        enum_write_value(L, mb->enum_define);
         size += sizeof_value(L, mb->type, mb->size, mb->type_define, ctx);
       }
+      if (mb->sized && !payload_only)
+      {
+        size += adata::size_of(size);
+      }
       return size;
     }
 
     static int sizeof_type(lua_State *L, adata_type * type, sizeof_cache_contex * ctx)
     {
+      if (type->packed)
+      {
+        return type->packed_size;
+      }
+      if (type->is_union)
+      {
+        int32_t i = union_member_index(L, type);
+        if (i < 0)
+        {
+          return adata::size_of((uint32_t)0);
+        }
+        adata_member * mb = &type->members[i];
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        int32_t size = adata::size_of((uint32_t)(i + 1)) + sizeof_type(L, mb->type_define, ctx);
+        lua_pop(L, 1);
+        return size;
+      }
       type_sizeof_info info;
       size_t top = 0;
       if (ctx)
@@ -1857,7 +3154,7 @@ namespace adata {
         ctx->list.push_back(info);
         top = ctx->list.size() - 1;
       }
-      uint64_t mask = 1;
+      int32_t bit_count = 0;
       for (size_t i = 0; i < type->member_count; ++i)
       {
         adata_member * mb = &type->members[i];
@@ -1867,12 +3164,39 @@ namespace adata {
           lua_gettable(L, -2);
           if (test_adata_empty(L, mb) == false)
           {
-            info.tag |= mask;
-            info.size += sizeof_member(L, mb, ctx);
+            if (i < 63)
+            {
+              info.tag |= (uint64_t)1 << i;
+            }
+            else
+            {
+              if (info.ext_tag.empty())
+              {
+                info.ext_tag.assign((type->member_count + 63) / 64, 0);
+              }
+              info.ext_tag[i / 64] |= (uint64_t)1 << (i % 64);
+              info.tag |= ext_tag_bit;
+            }
+            if (mb->bit_width > 0)
+            {
+              bit_count += mb->bit_width;
+            }
+            else
+            {
+              info.size += sizeof_member(L, mb, ctx);
+            }
           }
           lua_pop(L, 1);
         }
-        mask <<= 1;
+        if (mb->bit_width > 0 && bit_run_end(type, i) == i + 1)
+        {
+          info.size += adata::size_of_bit_run(bit_count);
+          bit_count = 0;
+        }
+      }
+      if (info.tag & ext_tag_bit)
+      {
+        info.size += adata::size_of_ext_tag(&info.ext_tag[0], info.ext_tag.size());
       }
       info.size += adata::size_of(info.tag);
       info.size += adata::size_of(info.size);
@@ -1916,6 +3240,8 @@ namespace adata {
       case adata_et_uint64:{ return sizeof_value<uint64_t>(L); }
       case adata_et_float32:{ return sizeof_value<float>(L); }
       case adata_et_float64:{ return sizeof_value<double>(L); }
+      case adata_et_bool:{ return 1; }
+      case adata_et_bits:{ return (size + 7) / 8; }
       case adata_et_string:
       {
         return sizeof_string(L);
@@ -1936,6 +3262,14 @@ namespace adata {
     static int32_t raw_sizeof_member(lua_State *L, adata_member * mb)
     {
       int32_t size = 0;
+      if (mb->optional)
+      {
+        size += 1;
+        if (lua_isnil(L, -1))
+        {
+          return size;
+        }
+      }
       if (mb->type == adata_et_list)
       {
         int len = lua_length(L, -1);
@@ -1944,6 +3278,7 @@ namespace adata {
         for (int i = 1; i <= len; ++i)
         {
           lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
           size += raw_sizeof_value(L, ptype->type, ptype->size, ptype->type_define);
           lua_pop(L, 1);
         }
@@ -1957,16 +3292,34 @@ namespace adata {
         while (lua_next(L, -2))
         {
           lua_pushvalue(L, -2);
+          enum_write_value(L, ptype1->enum_define);
           size += raw_sizeof_value(L, ptype1->type, ptype1->size, ptype1->type_define);
           lua_pop(L, 1);
+          enum_write_value(L, ptype2->enum_define);
           size += raw_sizeof_value(L, ptype2->type, ptype2->size, ptype2->type_define);
           lua_pop(L, 1);
           ++i;
         }
         size += adata::size_of(--i);
       }
+      else if (mb->type == adata_et_array)
+      {
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
+          size += raw_sizeof_value(L, ptype->type, ptype->size, ptype->type_define);
+          lua_pop(L, 1);
+        }
+      }
+      else if (mb->align)
+      {
+        size += sizeof_aligned_string(L, mb);
+      }
       else
       {
+        enum_write_value(L, mb->enum_define);
         size += raw_sizeof_value(L, mb->type, mb->size, mb->type_define);
       }
       return size;
@@ -1974,6 +3327,20 @@ namespace adata {
 
     static int raw_sizeof_type(lua_State *L, adata_type * type)
     {
+      if (type->is_union)
+      {
+        int32_t i = union_member_index(L, type);
+        if (i < 0)
+        {
+          return adata::size_of((uint32_t)0);
+        }
+        adata_member * mb = &type->members[i];
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        int32_t size = adata::size_of((uint32_t)(i + 1)) + raw_sizeof_type(L, mb->type_define);
+        lua_pop(L, 1);
+        return size;
+      }
       int size = 0;
       for (size_t i = 0; i < type->member_count; ++i)
       {
@@ -1997,6 +3364,22 @@ namespace adata {
       return 1;
     }
 
+    // a table of booleans as a bits<N> member, missing entries are false
+    static inline void write_bits(lua_State *L, zero_copy_buffer * buf, int size)
+    {
+      std::vector<bool> bits((std::size_t)size);
+      if (lua_type(L, -1) == LUA_TTABLE)
+      {
+        for (int i = 0; i < size; ++i)
+        {
+          lua_rawgeti(L, -1, i + 1);
+          bits[i] = lua_toboolean(L, -1) != 0;
+          lua_pop(L, 1);
+        }
+      }
+      adata::detail::write_bit_items(*buf, bits, (std::size_t)size);
+    }
+
     static inline int write_value(lua_State *L, zero_copy_buffer * buf, int type, int size, adata_type * type_define, sizeof_cache_contex& ctx)
     {
       switch (type)
@@ -2019,6 +3402,12 @@ namespace adata {
       case adata_et_uint64:{ pop_and_write_value<uint64_t>(L, buf); break; }
       case adata_et_float32:{ pop_and_write_value<float>(L, buf); break; }
       case adata_et_float64:{ pop_and_write_value<double>(L, buf); break; }
+      case adata_et_bool:{ break; }
+      case adata_et_bits:
+      {
+        write_bits(L, buf, size);
+        break;
+      }
       case adata_et_string:
       {
         write_string(L, buf, size);
@@ -2058,7 +3447,28 @@ namespace adata {
 
     static int write_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb, sizeof_cache_contex& ctx)
     {
-      if (mb->type == adata_et_list)
+      if (mb->sized)
+      {
+        adata::write(*buf, sizeof_member(L, mb, NULL, true));
+      }
+      if (mb->columnar)
+      {
+        encode_columnar(L, buf, mb, &ctx);
+      }
+      else if (mb->encoding != adata::list_plain)
+      {
+        write_encoded_list(L, buf, mb);
+      }
+      else if (mb->dict)
+      {
+        adata::write(*buf, (uint32_t)0);
+        write_string(L, buf, mb->size);
+      }
+      else if (mb->align)
+      {
+        write_aligned_string(L, buf, mb);
+      }
+      else if (mb->type == adata_et_list)
       {
         int len = lua_length(L, -1);
         if (mb->size && len > mb->size)
@@ -2070,6 +3480,7 @@ namespace adata {
         for (int i = 1; i <= len; ++i)
         {
           lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
           write_value(L, buf, ptype->type, ptype->size, ptype->type_define, ctx);
           lua_pop(L, 1);
         }
@@ -2089,31 +3500,310 @@ namespace adata {
         while (lua_next(L, -2))
         {
           lua_pushvalue(L, -2);
+          enum_write_value(L, ptype1->enum_define);
           write_value(L, buf, ptype1->type, ptype1->size, ptype1->type_define, ctx);
           lua_pop(L, 1);
+          enum_write_value(L, ptype2->enum_define);
           write_value(L, buf, ptype2->type, ptype2->size, ptype2->type_define, ctx);
           lua_pop(L, 1);
           ++i;
         }
       }
+      else if (mb->type == adata_et_array)
+      {
+        if (lua_length(L, -1) != mb->size)
+        {
+          luaL_error(L, "number of element not match");
+        }
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
+          write_value(L, buf, ptype->type, ptype->size, ptype->type_define, ctx);
+          lua_pop(L, 1);
+        }
+      }
       else
       {
+        enum_write_value(L, mb->enum_define);
         write_value(L, buf, mb->type, mb->size, mb->type_define, ctx);
       }
       return 1;
     }
 
+    // member mb of element k of the list at list_idx, its default when the element leaves it out
+    static void push_column_cell(lua_State *L, int list_idx, int k, adata_member * mb)
+    {
+      lua_rawgeti(L, list_idx, k);
+      if (lua_type(L, -1) != LUA_TTABLE)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+      }
+      lua_rawgeti(L, 1, mb->field_idx);
+      lua_gettable(L, -2);
+      lua_remove(L, -2);
+      if (lua_isnil(L, -1))
+      {
+        lua_pop(L, 1);
+        if (!push_default_value(L, mb))
+        {
+          luaL_error(L, "undefined member protocol not compatible");
+        }
+      }
+      enum_write_value(L, mb->enum_define);
+    }
+
+    template<typename ty>
+    inline int32_t encode_column_as(lua_State *L, zero_copy_buffer * buf, adata_member * mb, int list_idx, int len)
+    {
+      std::vector<ty> column((std::size_t)len);
+      for (int k = 1; k <= len; ++k)
+      {
+        push_column_cell(L, list_idx, k, mb);
+        lua_to_number(L, -1, column[k - 1]);
+        lua_pop(L, 1);
+      }
+      if (buf)
+      {
+        adata::write_column(*buf, column);
+        return 0;
+      }
+      return adata::size_of_column(column);
+    }
+
+    // one column of a [columnar] list, only its size when buf is null
+    static int32_t encode_column(lua_State *L, zero_copy_buffer * buf, adata_member * mb, int list_idx, int len, sizeof_cache_contex * ctx)
+    {
+      if (mb->quant)
+      {
+        std::vector<uint64_t> column((std::size_t)len);
+        for (int k = 1; k <= len; ++k)
+        {
+          push_column_cell(L, list_idx, k, mb);
+          column[k - 1] = adata::quantize(quant_source(L, mb), mb->quant_step, mb->quant_min, mb->quant_max);
+          lua_pop(L, 1);
+        }
+        if (buf)
+        {
+          adata::write_column(*buf, column);
+          return 0;
+        }
+        return adata::size_of_column(column);
+      }
+      switch (mb->type)
+      {
+      case adata_et_int8: return encode_column_as<int8_t>(L, buf, mb, list_idx, len);
+      case adata_et_uint8: return encode_column_as<uint8_t>(L, buf, mb, list_idx, len);
+      case adata_et_int16: return encode_column_as<int16_t>(L, buf, mb, list_idx, len);
+      case adata_et_uint16: return encode_column_as<uint16_t>(L, buf, mb, list_idx, len);
+      case adata_et_int32: return encode_column_as<int32_t>(L, buf, mb, list_idx, len);
+      case adata_et_uint32: return encode_column_as<uint32_t>(L, buf, mb, list_idx, len);
+      case adata_et_int64: return encode_column_as<int64_t>(L, buf, mb, list_idx, len);
+      case adata_et_uint64: return encode_column_as<uint64_t>(L, buf, mb, list_idx, len);
+      case adata_et_bool:
+      {
+        std::vector<bool> column((std::size_t)len);
+        for (int k = 1; k <= len; ++k)
+        {
+          push_column_cell(L, list_idx, k, mb);
+          column[k - 1] = lua_toboolean(L, -1) != 0;
+          lua_pop(L, 1);
+        }
+        if (buf)
+        {
+          adata::write_bool_column(*buf, column);
+          return 0;
+        }
+        return adata::size_of_bool_column(len);
+      }
+      default: break;
+      }
+      int32_t size = 0;
+      for (int k = 1; k <= len; ++k)
+      {
+        push_column_cell(L, list_idx, k, mb);
+        if (buf)
+        {
+          write_member(L, buf, mb, *ctx);
+        }
+        else
+        {
+          size += sizeof_member(L, mb, ctx);
+        }
+        lua_pop(L, 1);
+      }
+      return size;
+    }
+
+    // a [columnar] list, see adata::write_columnar. only its size when buf is null, the
+    // size pass caches nested types column by column, in the order they are written
+    static int32_t encode_columnar(lua_State *L, zero_copy_buffer * buf, adata_member * mb, sizeof_cache_contex * ctx)
+    {
+      adata_type * type = mb->paramter_type[0]->type_define;
+      int list_idx = lua_gettop(L);
+      int len = lua_length(L, list_idx);
+      if (buf && mb->size && len > mb->size)
+      {
+        luaL_error(L, "number of element not match");
+      }
+      if (type == NULL || type->member_count > 63)
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+      }
+      if (buf)
+      {
+        adata::write(*buf, len);
+      }
+      if (len == 0)
+      {
+        return adata::size_of(len);
+      }
+      uint64_t tag = 0;
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        adata_member * column = &type->members[i];
+        for (int k = 1; k <= len && column->del == 0; ++k)
+        {
+          push_column_cell(L, list_idx, k, column);
+          bool empty = test_adata_empty(L, column);
+          lua_pop(L, 1);
+          if (!empty)
+          {
+            tag |= (uint64_t)1 << i;
+            break;
+          }
+        }
+      }
+      int32_t size = 0;
+      for (int32_t i = 0; i < type->member_count; ++i)
+      {
+        if (tag & ((uint64_t)1 << i))
+        {
+          size += encode_column(L, NULL, &type->members[i], list_idx, len, buf ? NULL : ctx);
+        }
+      }
+      size += adata::size_of(tag);
+      size += adata::size_of(size + adata::size_of(size));
+      if (buf)
+      {
+        adata::write(*buf, tag);
+        adata::write(*buf, size);
+        for (int32_t i = 0; i < type->member_count; ++i)
+        {
+          if (tag & ((uint64_t)1 << i))
+          {
+            encode_column(L, buf, &type->members[i], list_idx, len, ctx);
+          }
+        }
+      }
+      return adata::size_of(len) + size;
+    }
+
+    template<typename ty>
+    inline void pop_and_write_bit_value(lua_State *L, adata::bit_writer<zero_copy_buffer>& bits, int width)
+    {
+      ty v;
+      lua_to_number(L, -1, v);
+      bits.write(v, width);
+    }
+
+    static void write_bit_value(lua_State *L, adata::bit_writer<zero_copy_buffer>& bits, adata_member * mb)
+    {
+      if (mb->quant)
+      {
+        bits.write_quant(quant_source(L, mb), mb->bit_width, mb->quant_step, mb->quant_min, mb->quant_max);
+        return;
+      }
+      switch (mb->type)
+      {
+      case adata_et_fix_int8: case adata_et_int8:{ pop_and_write_bit_value<int8_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint8: case adata_et_uint8:{ pop_and_write_bit_value<uint8_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int16: case adata_et_int16:{ pop_and_write_bit_value<int16_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint16: case adata_et_uint16:{ pop_and_write_bit_value<uint16_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int32: case adata_et_int32:{ pop_and_write_bit_value<int32_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint32: case adata_et_uint32:{ pop_and_write_bit_value<uint32_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_int64: case adata_et_int64:{ pop_and_write_bit_value<int64_t>(L, bits, mb->bit_width); break; }
+      case adata_et_fix_uint64: case adata_et_uint64:{ pop_and_write_bit_value<uint64_t>(L, bits, mb->bit_width); break; }
+      default:
+      {
+        luaL_error(L, "undefined member protocol not compatible");
+      }
+      }
+    }
+
+    // the present members of the run starting at first, return the index behind it
+    static size_t write_bit_run(lua_State *L, zero_copy_buffer * buf, adata_type * type, size_t first, const type_sizeof_info& info)
+    {
+      size_t end = bit_run_end(type, first);
+      adata::bit_writer<zero_copy_buffer> bits(*buf);
+      for (size_t i = first; i < end; ++i)
+      {
+        bool present = i < 63 ? (info.tag & ((uint64_t)1 << i)) != 0
+          : (info.tag & ext_tag_bit) != 0 && detail::ext_tag_test(&info.ext_tag[0], i);
+        if (present)
+        {
+          adata_member * mb = &type->members[i];
+          lua_rawgeti(L, 1, mb->field_idx);
+          lua_gettable(L, -2);
+          write_bit_value(L, bits, mb);
+          lua_pop(L, 1);
+        }
+      }
+      bits.flush();
+      return end;
+    }
+
     static int write_type(lua_State *L, zero_copy_buffer * buf, adata_type * type, sizeof_cache_contex& ctx)
     {
+      if (type->packed)
+      {
+        return raw_write_type(L, buf, type);
+      }
+      if (type->is_union)
+      {
+        int32_t i = union_member_index(L, type);
+        adata::write(*buf, (uint32_t)(i + 1));
+        if (i < 0)
+        {
+          return 1;
+        }
+        adata_member * mb = &type->members[i];
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        if (write_type(L, buf, mb->type_define, ctx) == 0)
+        {
+          return 0;
+        }
+        lua_pop(L, 1);
+        return 1;
+      }
       type_sizeof_info& info = ctx.list[ctx.write_idx++];
-      int64_t data_tag = info.tag;
+      uint64_t data_tag = info.tag;
       int32_t  data_len = info.size;
       adata::write(*buf, data_tag);
       adata::write(*buf, data_len);
-      int64_t mask = 1;
       for (size_t i = 0; i < type->member_count; ++i)
       {
-        if (data_tag&mask)
+        bool present = false;
+        if (i < 63)
+        {
+          present = (data_tag & ((uint64_t)1 << i)) != 0;
+        }
+        else if (data_tag & ext_tag_bit)
+        {
+          if (i == 63)
+          {
+            adata::write_ext_tag(*buf, &info.ext_tag[0], info.ext_tag.size());
+          }
+          present = detail::ext_tag_test(&info.ext_tag[0], i);
+        }
+        if (type->members[i].bit_width > 0)
+        {
+          i = write_bit_run(L, buf, type, i, info) - 1;
+          continue;
+        }
+        if (present)
         {
           adata_member * mb = &type->members[i];
           lua_rawgeti(L, 1, mb->field_idx);
@@ -2124,7 +3814,6 @@ namespace adata {
           }
           lua_pop(L, 1);
         }
-        mask <<= 1;
       }
       return 1;
     }
@@ -2146,8 +3835,6 @@ namespace adata {
       return 0;
     }
 
-    static int raw_write_type(lua_State *L, zero_copy_buffer * buf, adata_type * type);
-
     static inline int raw_write_value(lua_State *L, zero_copy_buffer * buf, int type, int size, adata_type * type_define)
     {
       switch (type)
@@ -2170,6 +3857,16 @@ namespace adata {
       case adata_et_uint64:{ pop_and_write_value<uint64_t>(L, buf); break; }
       case adata_et_float32:{ pop_and_write_value<float>(L, buf); break; }
       case adata_et_float64:{ pop_and_write_value<double>(L, buf); break; }
+      case adata_et_bool:
+      {
+        adata::write(*buf, lua_toboolean(L, -1) != 0);
+        break;
+      }
+      case adata_et_bits:
+      {
+        write_bits(L, buf, size);
+        break;
+      }
       case adata_et_string:
       {
         write_string(L, buf, size);
@@ -2197,6 +3894,15 @@ namespace adata {
 
     static int raw_write_member(lua_State *L, zero_copy_buffer * buf, adata_member * mb)
     {
+      if (mb->optional)
+      {
+        bool has_value = !lua_isnil(L, -1);
+        adata::write(*buf, (uint8_t)(has_value ? 1 : 0));
+        if (!has_value)
+        {
+          return 1;
+        }
+      }
       if (mb->type == adata_et_list)
       {
         int len = lua_length(L, -1);
@@ -2209,6 +3915,7 @@ namespace adata {
         for (int i = 1; i <= len; ++i)
         {
           lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
           raw_write_value(L, buf, ptype->type, ptype->size, ptype->type_define);
           lua_pop(L, 1);
         }
@@ -2228,15 +3935,37 @@ namespace adata {
         while (lua_next(L, -2))
         {
           lua_pushvalue(L, -2);
+          enum_write_value(L, ptype1->enum_define);
           raw_write_value(L, buf, ptype1->type, ptype1->size, ptype1->type_define);
           lua_pop(L, 1);
+          enum_write_value(L, ptype2->enum_define);
           raw_write_value(L, buf, ptype2->type, ptype2->size, ptype2->type_define);
           lua_pop(L, 1);
           ++i;
         }
       }
+      else if (mb->type == adata_et_array)
+      {
+        if (lua_length(L, -1) != mb->size)
+        {
+          luaL_error(L, "number of element not match");
+        }
+        adata_paramter_type * ptype = mb->paramter_type[0];
+        for (int i = 1; i <= mb->size; ++i)
+        {
+          lua_rawgeti(L, -1, i);
+          enum_write_value(L, ptype->enum_define);
+          raw_write_value(L, buf, ptype->type, ptype->size, ptype->type_define);
+          lua_pop(L, 1);
+        }
+      }
+      else if (mb->align)
+      {
+        write_aligned_string(L, buf, mb);
+      }
       else
       {
+        enum_write_value(L, mb->enum_define);
         raw_write_value(L, buf, mb->type, mb->size, mb->type_define);
       }
       return 1;
@@ -2244,6 +3973,24 @@ namespace adata {
 
     static int raw_write_type(lua_State *L, zero_copy_buffer * buf, adata_type * type)
     {
+      if (type->is_union)
+      {
+        int32_t i = union_member_index(L, type);
+        adata::write(*buf, (uint32_t)(i + 1));
+        if (i < 0)
+        {
+          return 1;
+        }
+        adata_member * mb = &type->members[i];
+        lua_rawgeti(L, 1, mb->field_idx);
+        lua_gettable(L, -2);
+        if (raw_write_type(L, buf, mb->type_define) == 0)
+        {
+          return 0;
+        }
+        lua_pop(L, 1);
+        return 1;
+      }
       for (size_t i = 0; i < type->member_count; ++i)
       {
         adata_member * mb = &type->members[i];
@@ -2288,6 +4035,7 @@ namespace adata {
         { "raw_read", lua_raw_read },
         { "raw_size_of", lua_raw_sizeof },
         { "raw_write", lua_raw_write },
+        { "enum_names", lua_enum_names },
         { "new_buf", new_zbuf },
         { "del_buf", del_zbuf },
         { "resize_buf", resize_zuf },
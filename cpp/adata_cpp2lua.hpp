@@ -71,6 +71,23 @@ namespace adata
       lua_pushnumber(L, v);
     }
 
+    inline void push(lua_State * L, bool v)
+    {
+      lua_pushboolean(L, v ? 1 : 0);
+    }
+
+    // bits<N> is a table of N booleans
+    template<::std::size_t count>
+    inline void push(lua_State * L, const ::std::bitset<count>& v)
+    {
+      lua_createtable(L, (int)count, 0);
+      for (::std::size_t i = 0; i < count; ++i)
+      {
+        lua_pushboolean(L, v[i] ? 1 : 0);
+        lua_rawseti(L, -2, (int)i + 1);
+      }
+    }
+
     template<typename alloc>
     inline void push(lua_State * L, const ::std::basic_string<char, ::std::char_traits<char>, alloc>& v)
     {
@@ -173,6 +190,22 @@ namespace adata
       v = lua_tonumber(L, -1);
     }
 
+    inline void load(lua_State * L, bool& v)
+    {
+      v = lua_toboolean(L, -1) != 0;
+    }
+
+    template<::std::size_t count>
+    inline void load(lua_State * L, ::std::bitset<count>& v)
+    {
+      for (::std::size_t i = 0; i < count; ++i)
+      {
+        lua_rawgeti(L, -1, (int)i + 1);
+        v[i] = lua_toboolean(L, -1) != 0;
+        lua_pop(L, 1);
+      }
+    }
+
     template<typename alloc>
     inline void load(lua_State * L, ::std::basic_string<char, ::std::char_traits<char>, alloc>& v)
     {
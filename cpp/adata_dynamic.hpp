@@ -0,0 +1,2503 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_DYNAMIC_HPP_HEADER_
+#define ADATA_DYNAMIC_HPP_HEADER_
+
+#include "adata.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+// schema driven codec without generated code and without lua.
+//
+// adata::dynamic::schema loads .adt files or packs (as adatac -Gadt / -p write them)
+// into type_layout/member_layout, the same information adata_corec.hpp loads into lua.
+// every type is lowered to a program, one instr per member plus op_end, which
+// decode() runs with a threaded interpreter (computed goto on gcc/clang, switch
+// elsewhere) and reports to a handler: a visitor subclass, or any class with the
+// same member functions for static dispatch (dom_builder does this to build a value).
+
+#if defined(__GNUC__) && !defined(ADATA_DYNAMIC_NO_COMPUTED_GOTO)
+# define ADATA_DYNAMIC_THREADED 1
+#endif
+
+namespace adata
+{
+  namespace dynamic
+  {
+    // same numbering as e_base_type in adatac and adata_et_* in adata_corec.hpp
+    enum elem_type
+    {
+      et_unknow,
+      et_fix_int8,
+      et_fix_uint8,
+      et_fix_int16,
+      et_fix_uint16,
+      et_fix_int32,
+      et_fix_uint32,
+      et_fix_int64,
+      et_fix_uint64,
+      et_int8,
+      et_uint8,
+      et_int16,
+      et_uint16,
+      et_int32,
+      et_uint32,
+      et_int64,
+      et_uint64,
+      et_float32,
+      et_float64,
+      et_string,
+      et_list,
+      et_map,
+      et_type,
+      et_bool,
+      et_bits,
+      et_array,
+      et_max_count
+    };
+
+    enum opcode
+    {
+      // op_fix_int8 .. op_array equal to the elem_type of a live member
+      op_end = et_max_count,
+      op_skip,
+      // presence of members 63 and up, in front of member 63 of a wide type
+      op_ext_tag,
+      // a run of [bits] members, word is the index behind its last member
+      op_bit_run,
+      // an enum member, type is its integer
+      op_enum,
+      op_count
+    };
+
+    ADATA_INLINE bool is_signed_type(int32_t type)
+    {
+      switch (type)
+      {
+      case et_fix_int8: case et_fix_int16: case et_fix_int32: case et_fix_int64:
+      case et_int8: case et_int16: case et_int32: case et_int64:
+        return true;
+      default:
+        break;
+      }
+      return false;
+    }
+
+    ADATA_INLINE bool is_unsigned_type(int32_t type)
+    {
+      switch (type)
+      {
+      case et_fix_uint8: case et_fix_uint16: case et_fix_uint32: case et_fix_uint64:
+      case et_uint8: case et_uint16: case et_uint32: case et_uint64:
+        return true;
+      default:
+        break;
+      }
+      return false;
+    }
+
+    ADATA_INLINE bool is_float_type(int32_t type)
+    {
+      return type == et_float32 || type == et_float64;
+    }
+
+    struct type_layout;
+
+    // an enum of an integer member or element, its values are the integers as any other, see adata::enum_traits
+    struct enum_layout
+    {
+      std::vector<std::string> names;
+      // a uint64 one above INT64_MAX is kept as its int64 bits
+      std::vector<int64_t> values;
+
+      // -1 if value is not an enumerator
+      int32_t index_of(int64_t value) const
+      {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+          if (values[i] == value) return (int32_t)i;
+        }
+        return -1;
+      }
+
+      // -1 if no such enumerator
+      int32_t find(const std::string& name) const
+      {
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+          if (names[i] == name) return (int32_t)i;
+        }
+        return -1;
+      }
+    };
+
+    struct param_layout
+    {
+      int32_t type;
+      int32_t size;
+      std::string type_name;
+      const type_layout * type_define;
+      // null if not an enum
+      const enum_layout * enum_define;
+
+      param_layout() : type(et_unknow), size(0), type_define(0), enum_define(0) {}
+    };
+
+    struct member_layout
+    {
+      std::string name;
+      int32_t type;
+      int32_t size;
+      uint32_t index;
+      bool deleted;
+      bool sized;
+      int32_t encoding;
+      bool columnar;
+      // [bits=k], 0 if not packed. the first member of a run has the index behind its last one
+      int32_t bit_width;
+      uint32_t bit_run_end;
+      // a [quant] float is its count of steps from quant_min in bit_width bits, see adata::quantize
+      bool quant;
+      double quant_step;
+      double quant_min;
+      double quant_max;
+      // a [dict] string, see adata::write_dict_string
+      bool dict;
+      // an optional member, written when it is not null whatever its value, null when not in the data
+      bool optional;
+      // the [align] of a bytes member, a string padded as adata::write_bytes does, 0 if not aligned
+      int32_t align;
+      std::string type_name;
+      const type_layout * type_define;
+      // null if not an enum
+      const enum_layout * enum_define;
+      int32_t param_count;
+      param_layout params[2];
+      int64_t default_int;
+      uint64_t default_uint;
+      double default_float;
+
+      member_layout()
+        : type(et_unknow), size(0), index(0), deleted(false), sized(false), encoding(list_plain), columnar(false), bit_width(0), bit_run_end(0)
+        , quant(false), quant_step(0), quant_min(0), quant_max(0), dict(false), optional(false), align(0), type_define(0), enum_define(0), param_count(0)
+        , default_int(0), default_uint(0), default_float(0)
+      {}
+    };
+
+    struct instr
+    {
+      uint8_t op;
+      uint8_t type;
+      uint32_t word;
+      uint64_t mask;
+      const member_layout * member;
+    };
+
+    struct type_layout
+    {
+      std::string name;
+      std::string fullname;
+      std::vector<member_layout> members;
+      std::vector<instr> program;
+      // a [packed] type is its members back to back in packed_size bytes, no tag and no len_tag
+      bool packed;
+      int32_t packed_size;
+      // a [union] type is the varint kind, the member index + 1 or 0 for none, then the object of that member
+      bool is_union;
+
+      type_layout() : packed(false), packed_size(0), is_union(false) {}
+
+      // null if no such live member
+      const member_layout * find_member(const std::string& member_name) const
+      {
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+          if (members[i].name == member_name && !members[i].deleted)
+          {
+            return &members[i];
+          }
+        }
+        return 0;
+      }
+    };
+
+    class schema
+    {
+    public:
+      // data is a single .adt or a pack of them, throw adata::exception on a broken layout
+      void load(const char * data, std::size_t length)
+      {
+        zero_copy_buffer stream;
+        stream.set_read(data, length);
+        int32_t count = 0;
+        ::adata::read(stream, count);
+        for (int32_t i = 0; i < count; ++i)
+        {
+          load_namespace(stream);
+        }
+      }
+
+      // return false if the file can't be read
+      bool load_file(const char * filename)
+      {
+        FILE * fp = std::fopen(filename, "rb");
+        if (fp == NULL)
+        {
+          return false;
+        }
+        std::fseek(fp, 0, SEEK_END);
+        long len = std::ftell(fp);
+        std::fseek(fp, 0, SEEK_SET);
+        std::vector<char> data(len > 0 ? (std::size_t)len : 1);
+        std::size_t rd_len = len > 0 ? std::fread(&data[0], 1, (std::size_t)len, fp) : 0;
+        std::fclose(fp);
+        if (len <= 0 || rd_len != (std::size_t)len)
+        {
+          return false;
+        }
+        load(&data[0], rd_len);
+        return true;
+      }
+
+      // fullname is namespace.name, e.g. my.game.player_v1
+      const type_layout * find_type(const std::string& fullname) const
+      {
+        type_map_type::const_iterator it = m_type_map.find(fullname);
+        return it == m_type_map.end() ? 0 : it->second;
+      }
+
+      std::size_t type_count() const { return m_types.size(); }
+      const type_layout& type_at(std::size_t index) const { return m_types[index]; }
+
+    private:
+      typedef std::map<std::string, const type_layout *> type_map_type;
+
+      const type_layout * resolve(zero_copy_buffer& stream, const std::vector<std::string>& pool, const std::vector<type_layout *>& ns_types, std::string& type_name)
+      {
+        int32_t sid = 0;
+        int32_t namespace_idx = 0;
+        ::adata::read(stream, sid);
+        ::adata::read(stream, namespace_idx);
+        type_name = pool.at((std::size_t)sid);
+        if (namespace_idx >= 0 && (std::size_t)namespace_idx < ns_types.size())
+        {
+          return ns_types[namespace_idx];
+        }
+        const type_layout * t = find_type(type_name);
+        if (t == 0)
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+        return t;
+      }
+
+      void load_namespace(zero_copy_buffer& stream)
+      {
+        std::string ns;
+        ::adata::read(stream, ns);
+        uint32_t pool_count = 0;
+        ::adata::read(stream, pool_count);
+        std::vector<std::string> pool(pool_count);
+        for (uint32_t i = 0; i < pool_count; ++i)
+        {
+          ::adata::read(stream, pool[i]);
+        }
+        uint32_t type_count = 0;
+        ::adata::read(stream, type_count);
+        std::vector<type_layout *> ns_types;
+        for (uint32_t t = 0; t < type_count; ++t)
+        {
+          m_types.push_back(type_layout());
+          type_layout& type = m_types.back();
+          ns_types.push_back(&type);
+          uint32_t member_count = 0;
+          uint32_t param_type_count = 0;
+          int32_t name_sid = 0;
+          ::adata::read(stream, member_count);
+          ::adata::read(stream, param_type_count);
+          ::adata::read(stream, name_sid);
+          type.name = pool.at((std::size_t)name_sid);
+          type.fullname = ns + "." + type.name;
+          type.members.resize(member_count);
+          uint32_t packed_count = 0;
+          uint32_t union_count = 0;
+          for (uint32_t i = 0; i < member_count; ++i)
+          {
+            member_layout& mb = type.members[i];
+            int32_t member_name_sid = 0;
+            ::adata::read(stream, member_name_sid);
+            mb.name = pool.at((std::size_t)member_name_sid);
+            mb.index = i;
+            ::adata::read(stream, mb.type);
+            if (mb.type == et_type)
+            {
+              mb.type_define = resolve(stream, pool, ns_types, mb.type_name);
+            }
+            int32_t del = 0;
+            ::adata::read(stream, del);
+            mb.deleted = (del & 1) != 0;
+            mb.sized = (del & 2) != 0;
+            mb.encoding = (del >> 2) & 7;
+            mb.columnar = (del & 32) != 0;
+            mb.bit_width = (del >> 6) & 127;
+            packed_count += (del & 8192) ? 1 : 0;
+            mb.quant = (del & 16384) != 0;
+            mb.dict = (del & 32768) != 0;
+            union_count += (del & 65536) ? 1 : 0;
+            mb.optional = (del & 131072) != 0;
+            int32_t align_log2 = (del >> 18) & 15;
+            mb.align = align_log2 ? 1 << align_log2 : 0;
+            if (!mb.deleted)
+            {
+              read_default_value(stream, mb);
+            }
+            ::adata::read(stream, mb.size);
+            if (mb.quant)
+            {
+              // its size is the string id of its "step,min,max"
+              read_quant(pool.at((std::size_t)mb.size), mb);
+              mb.size = 0;
+            }
+            mb.enum_define = read_enum(pool, mb.type, mb.size);
+            ::adata::read(stream, mb.param_count);
+            if (mb.param_count < 0 || mb.param_count > 2)
+            {
+              throw exception(undefined_member_protocol_not_compatible);
+            }
+            for (int32_t p = 0; p < mb.param_count; ++p)
+            {
+              param_layout& param = mb.params[p];
+              ::adata::read(stream, param.type);
+              if (param.type == et_type)
+              {
+                param.type_define = resolve(stream, pool, ns_types, param.type_name);
+              }
+              ::adata::read(stream, param.size);
+              param.enum_define = read_enum(pool, param.type, param.size);
+            }
+            if (mb.type <= et_unknow || mb.type >= et_max_count || (mb.type == et_list && mb.param_count != 1) || (mb.type == et_map && mb.param_count != 2)
+              || (mb.type == et_array && (mb.param_count != 1 || mb.size <= 0))
+              || mb.bit_width > 64 || (mb.bit_width > 0 && !is_signed_type(mb.type) && !is_unsigned_type(mb.type) && !mb.quant)
+              || (mb.quant && (mb.bit_width == 0 || (mb.type != et_float32 && mb.type != et_float64)))
+              || (mb.encoding == list_xor && (mb.type != et_list || (mb.params[0].type != et_float32 && mb.params[0].type != et_float64)))
+              || (mb.dict && mb.type != et_string)
+              || (mb.align && (mb.align > max_bytes_align || mb.type != et_string || mb.dict || mb.optional))
+              || (mb.optional && (mb.bit_width > 0 || mb.sized || mb.param_count != 0 || mb.type == et_bool || mb.type == et_bits || (del & (8192 | 65536)) != 0))
+              || (mb.enum_define && (mb.bit_width > 0 || mb.encoding != list_plain)))
+            {
+              throw exception(undefined_member_protocol_not_compatible);
+            }
+          }
+          if (packed_count != 0 && packed_count != member_count)
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          type.packed = packed_count != 0;
+          if (union_count != 0 && (union_count != member_count || type.packed))
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          type.is_union = union_count != 0;
+          compile(type);
+          m_type_map[type.fullname] = &type;
+        }
+        // a packed type may hold another one declared behind it
+        for (std::size_t t = 0; t < ns_types.size(); ++t)
+        {
+          if (ns_types[t]->packed)
+          {
+            ns_types[t]->packed_size = packed_size_of(*ns_types[t], 0);
+          }
+          if (ns_types[t]->is_union)
+          {
+            check_union(*ns_types[t]);
+          }
+        }
+      }
+
+      // every member of a union is a type with tag and len_tag, so an unknown kind can be skipped
+      static void check_union(const type_layout& type)
+      {
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          const member_layout& mb = type.members[i];
+          if (mb.type != et_type || mb.sized || mb.type_define->packed || mb.type_define->is_union)
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+        }
+      }
+
+      static int32_t packed_size_of(const type_layout& type, int depth)
+      {
+        if (!type.packed || depth > 16)
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+        int32_t size = 0;
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          const member_layout& mb = type.members[i];
+          switch (mb.type)
+          {
+          case et_fix_int8: case et_fix_uint8: size += 1; break;
+          case et_fix_int16: case et_fix_uint16: size += 2; break;
+          case et_fix_int32: case et_fix_uint32: case et_float32: size += 4; break;
+          case et_fix_int64: case et_fix_uint64: case et_float64: size += 8; break;
+          case et_type: size += packed_size_of(*mb.type_define, depth + 1); break;
+          default: throw exception(undefined_member_protocol_not_compatible);
+          }
+          if (mb.deleted)
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+        }
+        return size;
+      }
+
+      // an enum integer has 1 + the string id of its "warrior=0,mage=5" as its size, the size is 0 then
+      const enum_layout * read_enum(const std::vector<std::string>& pool, int32_t type, int32_t& size)
+      {
+        if (size <= 0 || !(is_signed_type(type) || is_unsigned_type(type)))
+        {
+          return 0;
+        }
+        const std::string& text = pool.at((std::size_t)size - 1);
+        size = 0;
+        m_enums.push_back(enum_layout());
+        enum_layout& en = m_enums.back();
+        std::size_t pos = 0;
+        while (pos < text.size())
+        {
+          std::size_t eq = text.find('=', pos);
+          if (eq == std::string::npos)
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          const char * ptr = text.c_str() + eq + 1;
+          char * end = 0;
+          int64_t value = (int64_t)std::strtoll(ptr, &end, 10);
+          if (end == ptr || (*end != ',' && *end != 0))
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          en.names.push_back(text.substr(pos, eq - pos));
+          en.values.push_back(value);
+          pos = (std::size_t)(end - text.c_str()) + 1;
+        }
+        if (en.names.empty())
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+        return &en;
+      }
+
+      static void read_quant(const std::string& text, member_layout& mb)
+      {
+        const char * ptr = text.c_str();
+        char * end = 0;
+        mb.quant_step = std::strtod(ptr, &end);
+        if (*end == ',')
+        {
+          mb.quant_min = std::strtod(end + 1, &end);
+        }
+        if (*end == ',')
+        {
+          mb.quant_max = std::strtod(end + 1, &end);
+        }
+        if (*end != 0 || !(mb.quant_step > 0) || !(mb.quant_min < mb.quant_max))
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+      }
+
+      static void read_default_value(zero_copy_buffer& stream, member_layout& mb)
+      {
+        if (is_signed_type(mb.type))
+        {
+          ::adata::read(stream, mb.default_int);
+          mb.default_uint = (uint64_t)mb.default_int;
+          mb.default_float = (double)mb.default_int;
+        }
+        else if (is_unsigned_type(mb.type))
+        {
+          ::adata::read(stream, mb.default_uint);
+          mb.default_int = (int64_t)mb.default_uint;
+          mb.default_float = (double)mb.default_uint;
+        }
+        else if (mb.type == et_float32)
+        {
+          float value = 0;
+          ::adata::read(stream, value);
+          mb.default_float = value;
+        }
+        else if (mb.type == et_float64)
+        {
+          ::adata::read(stream, mb.default_float);
+        }
+        else if (mb.type == et_bool)
+        {
+          ::adata::read(stream, mb.default_uint);
+          mb.default_int = (int64_t)mb.default_uint;
+          mb.default_float = (double)mb.default_uint;
+        }
+      }
+
+      static instr make_instr(uint8_t op)
+      {
+        instr ins;
+        ins.op = op;
+        ins.type = et_unknow;
+        ins.word = 0;
+        ins.mask = 0;
+        ins.member = 0;
+        return ins;
+      }
+
+      static void compile(type_layout& type)
+      {
+        type.program.clear();
+        uint64_t mask = 1;
+        for (std::size_t i = 0; i < type.members.size(); ++i, mask <<= 1)
+        {
+          if (i == 63)
+          {
+            type.program.push_back(make_instr(op_ext_tag));
+          }
+          if (mask == 0)
+          {
+            mask = 1;
+          }
+          member_layout& mb = type.members[i];
+          if (mb.bit_width > 0)
+          {
+            // one instr for a run, it ends at member 63 like the tag does
+            if (i == 0 || i == 63 || type.members[i - 1].bit_width == 0)
+            {
+              std::size_t end = i + 1;
+              while (end < type.members.size() && end != 63 && type.members[end].bit_width > 0)
+              {
+                ++end;
+              }
+              mb.bit_run_end = (uint32_t)end;
+              instr ins = make_instr(op_bit_run);
+              ins.word = (uint32_t)end;
+              ins.member = &mb;
+              type.program.push_back(ins);
+            }
+            continue;
+          }
+          instr ins = make_instr((uint8_t)(mb.deleted ? op_skip : mb.enum_define ? op_enum : mb.type));
+          ins.type = (uint8_t)mb.type;
+          ins.word = (uint32_t)(i / 64);
+          ins.mask = mask;
+          ins.member = &mb;
+          type.program.push_back(ins);
+        }
+        type.program.push_back(make_instr(op_end));
+      }
+
+      std::deque<type_layout> m_types;
+      std::deque<enum_layout> m_enums;
+      type_map_type m_type_map;
+    };
+
+    // receives decode events, override what is needed
+    class visitor
+    {
+    public:
+      virtual ~visitor() {}
+      virtual void begin_type(const type_layout&) {}
+      virtual void end_type(const type_layout&) {}
+      // a live member present in the data, its value follows
+      virtual void field(const member_layout&) {}
+      // a live member absent from the data
+      virtual void missing(const member_layout&) {}
+      virtual void on_int(int64_t) {}
+      virtual void on_uint(uint64_t) {}
+      virtual void on_float(double) {}
+      // points into the read buffer
+      virtual void on_string(const char *, std::size_t) {}
+      virtual void begin_list(uint32_t) {}
+      virtual void end_list() {}
+      // count pairs follow as key, value, key, value...
+      virtual void begin_map(uint32_t) {}
+      virtual void end_map() {}
+    };
+
+    namespace detail
+    {
+      ADATA_INLINE uint32_t read_length(zero_copy_buffer& stream, int32_t size)
+      {
+        return (uint32_t)check_read_size(stream, size);
+      }
+
+      inline void skip_object(zero_copy_buffer& stream, const type_layout& type)
+      {
+        if (type.packed)
+        {
+          stream.skip_read((std::size_t)type.packed_size);
+        }
+        else if (type.is_union)
+        {
+          uint32_t kind = 0;
+          ::adata::read(stream, kind);
+          if (kind != 0)
+          {
+            skip_read_compatible(stream);
+          }
+        }
+        else
+        {
+          skip_read_compatible(stream);
+        }
+      }
+
+      inline void skip_value(zero_copy_buffer& stream, int32_t type, int32_t size, const type_layout * sub)
+      {
+        switch (type)
+        {
+        case et_fix_int8: case et_fix_uint8: stream.skip_read(1); break;
+        case et_fix_int16: case et_fix_uint16: stream.skip_read(2); break;
+        case et_fix_int32: case et_fix_uint32: case et_float32: stream.skip_read(4); break;
+        case et_fix_int64: case et_fix_uint64: case et_float64: stream.skip_read(8); break;
+        case et_int8: ::adata::skip_read(stream, (int8_t*)0); break;
+        case et_uint8: ::adata::skip_read(stream, (uint8_t*)0); break;
+        case et_int16: ::adata::skip_read(stream, (int16_t*)0); break;
+        case et_uint16: ::adata::skip_read(stream, (uint16_t*)0); break;
+        case et_int32: ::adata::skip_read(stream, (int32_t*)0); break;
+        case et_uint32: ::adata::skip_read(stream, (uint32_t*)0); break;
+        case et_int64: ::adata::skip_read(stream, (int64_t*)0); break;
+        case et_uint64: ::adata::skip_read(stream, (uint64_t*)0); break;
+        case et_string: stream.skip_read(read_length(stream, size)); break;
+        case et_type: skip_object(stream, *sub); break;
+        case et_bool: break;
+        case et_bits: stream.skip_read(((std::size_t)size + 7) / 8); break;
+        default: throw exception(undefined_member_protocol_not_compatible);
+        }
+      }
+
+      inline void skip_member(zero_copy_buffer& stream, const member_layout& mb)
+      {
+        if (mb.sized)
+        {
+          skip_read_sized(stream);
+        }
+        else if (mb.columnar)
+        {
+          skip_read_columnar(stream, mb.size);
+        }
+        else if (mb.encoding == list_xor)
+        {
+          if (mb.params[0].type == et_float32)
+          {
+            skip_read_list<float>(stream, mb.encoding, mb.size);
+          }
+          else
+          {
+            skip_read_list<double>(stream, mb.encoding, mb.size);
+          }
+        }
+        else if (mb.encoding != list_plain)
+        {
+          skip_read_list<int64_t>(stream, mb.encoding, mb.size);
+        }
+        else if (mb.dict)
+        {
+          skip_read_dict_string(stream, mb.size);
+        }
+        else if (mb.align)
+        {
+          skip_read_bytes(stream, mb.align, mb.size);
+        }
+        else if (mb.type == et_list)
+        {
+          uint32_t len = read_length(stream, mb.size);
+          for (uint32_t i = 0; i < len; ++i)
+          {
+            skip_value(stream, mb.params[0].type, mb.params[0].size, mb.params[0].type_define);
+          }
+        }
+        else if (mb.type == et_map)
+        {
+          uint32_t len = read_length(stream, mb.size);
+          for (uint32_t i = 0; i < len; ++i)
+          {
+            skip_value(stream, mb.params[0].type, mb.params[0].size, mb.params[0].type_define);
+            skip_value(stream, mb.params[1].type, mb.params[1].size, mb.params[1].type_define);
+          }
+        }
+        else if (mb.type == et_array)
+        {
+          for (int32_t i = 0; i < mb.size; ++i)
+          {
+            skip_value(stream, mb.params[0].type, mb.params[0].size, mb.params[0].type_define);
+          }
+        }
+        else
+        {
+          skip_value(stream, mb.type, mb.size, mb.type_define);
+        }
+      }
+
+      template<typename handler_ty>
+      void decode_type(zero_copy_buffer& stream, const type_layout& type, handler_ty& handler);
+
+      template<typename ty, typename handler_ty>
+      ADATA_INLINE void fix_signed(zero_copy_buffer& stream, handler_ty& handler)
+      {
+        ty v; ::adata::fix_read(stream, v); handler.on_int((int64_t)v);
+      }
+
+      template<typename ty, typename handler_ty>
+      ADATA_INLINE void fix_unsigned(zero_copy_buffer& stream, handler_ty& handler)
+      {
+        ty v; ::adata::fix_read(stream, v); handler.on_uint((uint64_t)v);
+      }
+
+      template<typename ty, typename handler_ty>
+      ADATA_INLINE void var_signed(zero_copy_buffer& stream, handler_ty& handler)
+      {
+        ty v; ::adata::read(stream, v); handler.on_int((int64_t)v);
+      }
+
+      template<typename ty, typename handler_ty>
+      ADATA_INLINE void var_unsigned(zero_copy_buffer& stream, handler_ty& handler)
+      {
+        ty v; ::adata::read(stream, v); handler.on_uint((uint64_t)v);
+      }
+
+      template<typename ty, typename handler_ty>
+      ADATA_INLINE void var_float(zero_copy_buffer& stream, handler_ty& handler)
+      {
+        ty v; ::adata::read(stream, v); handler.on_float((double)v);
+      }
+
+      template<typename handler_ty>
+      ADATA_INLINE void decode_string(zero_copy_buffer& stream, int32_t size, handler_ty& handler)
+      {
+        uint32_t len = read_length(stream, size);
+        const char * str = (const char *)stream.skip_read(len);
+        handler.on_string(str, len);
+      }
+
+      // a [dict] string is an entry of the string_dict of the thread, or a code 0 and the string.
+      // an [align] bytes has its payload padded
+      template<typename handler_ty>
+      ADATA_INLINE void decode_member_string(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        if (mb.dict)
+        {
+          uint32_t code = 0;
+          ::adata::read(stream, code);
+          if (code != 0)
+          {
+            string_dict * dict = string_dict::current();
+            if (dict == 0 || code > dict->size())
+            {
+              throw exception(undefined_member_protocol_not_compatible);
+            }
+            const std::string& entry = (*dict)[code - 1];
+            if (mb.size > 0 && entry.size() > (std::size_t)mb.size)
+            {
+              throw exception(number_of_element_not_match);
+            }
+            handler.on_string(entry.data(), (uint32_t)entry.size());
+            return;
+          }
+        }
+        if (mb.align)
+        {
+          uint32_t len = read_length(stream, mb.size);
+          std::size_t tail = ::adata::detail::read_align_pad(stream, mb.align);
+          const char * str = (const char *)stream.skip_read(len);
+          stream.skip_read(tail);
+          handler.on_string(str, len);
+          return;
+        }
+        decode_string(stream, mb.size, handler);
+      }
+
+      // a bits<N> member, reported as a list of N 0 or 1
+      template<typename handler_ty>
+      ADATA_INLINE void decode_bits(zero_copy_buffer& stream, int32_t count, handler_ty& handler)
+      {
+        const unsigned char * bytes = (const unsigned char *)stream.skip_read(((std::size_t)count + 7) / 8);
+        handler.begin_list((uint32_t)count);
+        for (int32_t i = 0; i < count; ++i)
+        {
+          handler.on_uint((uint64_t)((bytes[i >> 3] >> (i & 7)) & 1));
+        }
+        handler.end_list();
+      }
+
+      // a [quant] float as the generated code reads it, a float32 one rounded to float
+      ADATA_INLINE double dequantize_member(const member_layout& mb, uint64_t steps)
+      {
+        double v = ::adata::dequantize(steps, mb.quant_step, mb.quant_min);
+        return mb.type == et_float32 ? (double)(float)v : v;
+      }
+
+      // the members of a run of [bits] members from first up to index end
+      template<typename handler_ty>
+      void decode_bit_run(zero_copy_buffer& stream, const member_layout * first, uint32_t end, const uint64_t * words, handler_ty& handler)
+      {
+        bit_reader<zero_copy_buffer> bits(stream);
+        for (uint32_t i = first->index; i < end; ++i)
+        {
+          const member_layout * mb = first + (i - first->index);
+          bool present = ::adata::detail::ext_tag_test(words, mb->index);
+          if (mb->deleted)
+          {
+            if (present) bits.skip(mb->bit_width);
+          }
+          else if (!present)
+          {
+            handler.missing(*mb);
+          }
+          else
+          {
+            handler.field(*mb);
+            if (mb->quant)
+            {
+              handler.on_float(dequantize_member(*mb, bits.read_unsigned(mb->bit_width)));
+            }
+            else if (is_signed_type(mb->type))
+            {
+              handler.on_int(bits.read_signed(mb->bit_width));
+            }
+            else
+            {
+              handler.on_uint(bits.read_unsigned(mb->bit_width));
+            }
+          }
+        }
+      }
+
+      template<typename handler_ty>
+      void decode_scalar(zero_copy_buffer& stream, int32_t type, handler_ty& handler)
+      {
+        switch (type)
+        {
+        case et_fix_int8: fix_signed<int8_t>(stream, handler); break;
+        case et_fix_uint8: fix_unsigned<uint8_t>(stream, handler); break;
+        case et_fix_int16: fix_signed<int16_t>(stream, handler); break;
+        case et_fix_uint16: fix_unsigned<uint16_t>(stream, handler); break;
+        case et_fix_int32: fix_signed<int32_t>(stream, handler); break;
+        case et_fix_uint32: fix_unsigned<uint32_t>(stream, handler); break;
+        case et_fix_int64: fix_signed<int64_t>(stream, handler); break;
+        case et_fix_uint64: fix_unsigned<uint64_t>(stream, handler); break;
+        case et_int8: var_signed<int8_t>(stream, handler); break;
+        case et_uint8: var_unsigned<uint8_t>(stream, handler); break;
+        case et_int16: var_signed<int16_t>(stream, handler); break;
+        case et_uint16: var_unsigned<uint16_t>(stream, handler); break;
+        case et_int32: var_signed<int32_t>(stream, handler); break;
+        case et_uint32: var_unsigned<uint32_t>(stream, handler); break;
+        case et_int64: var_signed<int64_t>(stream, handler); break;
+        case et_uint64: var_unsigned<uint64_t>(stream, handler); break;
+        case et_float32: var_float<float>(stream, handler); break;
+        case et_float64: var_float<double>(stream, handler); break;
+        default: throw exception(undefined_member_protocol_not_compatible);
+        }
+      }
+
+      ADATA_INLINE void check_enum(const enum_layout& en, int64_t value)
+      {
+        if (en.index_of(value) < 0)
+        {
+          throw exception(enum_value_undefined);
+        }
+      }
+
+      // hands the integer of an enum on to handler once it is found to be an enumerator
+      template<typename handler_ty>
+      struct enum_checker
+      {
+        const enum_layout& en;
+        handler_ty& handler;
+
+        enum_checker(const enum_layout& e, handler_ty& h) : en(e), handler(h) {}
+        ADATA_INLINE void on_int(int64_t v) { check_enum(en, v); handler.on_int(v); }
+        ADATA_INLINE void on_uint(uint64_t v) { check_enum(en, (int64_t)v); handler.on_uint(v); }
+        ADATA_INLINE void on_float(double) { throw exception(undefined_member_protocol_not_compatible); }
+      };
+
+      template<typename handler_ty>
+      ADATA_INLINE void decode_enum(zero_copy_buffer& stream, int32_t type, const enum_layout& en, handler_ty& handler)
+      {
+        enum_checker<handler_ty> checker(en, handler);
+        decode_scalar(stream, type, checker);
+      }
+
+      // container elements, not worth a program of their own
+      template<typename handler_ty>
+      void decode_value(zero_copy_buffer& stream, const param_layout& param, handler_ty& handler)
+      {
+        switch (param.type)
+        {
+        case et_string: decode_string(stream, param.size, handler); break;
+        case et_type: decode_type(stream, *param.type_define, handler); break;
+        default:
+          if (param.enum_define)
+          {
+            decode_enum(stream, param.type, *param.enum_define, handler);
+          }
+          else
+          {
+            decode_scalar(stream, param.type, handler);
+          }
+          break;
+        }
+      }
+
+      // a [delta], [delta2], [rle] or [xor] list is decoded by the adata kernels into its element type
+      template<typename ty, typename handler_ty>
+      void decode_list_as(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        std::vector<ty> list;
+        ::adata::read_list(stream, list, mb.encoding, mb.size);
+        handler.begin_list((uint32_t)list.size());
+        for (std::size_t i = 0; i < list.size(); ++i)
+        {
+          if (is_signed_type(mb.params[0].type))
+          {
+            handler.on_int((int64_t)list[i]);
+          }
+          else
+          {
+            handler.on_uint((uint64_t)list[i]);
+          }
+        }
+        handler.end_list();
+      }
+
+      // a [xor] list of float32 or float64
+      template<typename ty, typename handler_ty>
+      void decode_float_list_as(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        std::vector<ty> list;
+        ::adata::read_list(stream, list, mb.encoding, mb.size);
+        handler.begin_list((uint32_t)list.size());
+        for (std::size_t i = 0; i < list.size(); ++i)
+        {
+          handler.on_float((double)list[i]);
+        }
+        handler.end_list();
+      }
+
+      template<typename handler_ty>
+      void decode_encoded_list(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        switch (mb.params[0].type)
+        {
+        case et_float32: decode_float_list_as<float>(stream, mb, handler); break;
+        case et_float64: decode_float_list_as<double>(stream, mb, handler); break;
+        case et_int8: decode_list_as<int8_t>(stream, mb, handler); break;
+        case et_uint8: decode_list_as<uint8_t>(stream, mb, handler); break;
+        case et_int16: decode_list_as<int16_t>(stream, mb, handler); break;
+        case et_uint16: decode_list_as<uint16_t>(stream, mb, handler); break;
+        case et_int32: decode_list_as<int32_t>(stream, mb, handler); break;
+        case et_uint32: decode_list_as<uint32_t>(stream, mb, handler); break;
+        case et_int64: decode_list_as<int64_t>(stream, mb, handler); break;
+        case et_uint64: decode_list_as<uint64_t>(stream, mb, handler); break;
+        default: throw exception(undefined_member_protocol_not_compatible);
+        }
+      }
+
+      // the integer members of a [columnar] list have a column for the list kernels
+      ADATA_INLINE bool is_column_type(int32_t type)
+      {
+        return type >= et_int8 && type <= et_uint64;
+      }
+
+      template<typename ty>
+      void read_column_as(zero_copy_buffer& stream, uint32_t count, std::vector<int64_t>& numbers)
+      {
+        std::vector<ty> column;
+        ::adata::read_column(stream, column, (int32_t)count);
+        numbers.resize(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          numbers[i] = (int64_t)column[i];
+        }
+      }
+
+      // numbers is left empty for a deleted member
+      inline void read_column(zero_copy_buffer& stream, const member_layout& mb, uint32_t count, std::vector<int64_t>& numbers)
+      {
+        if (mb.deleted)
+        {
+          ::adata::skip_read_column<int64_t>(stream, (int32_t)count);
+          return;
+        }
+        if (mb.quant)
+        {
+          read_column_as<uint64_t>(stream, count, numbers);
+          return;
+        }
+        switch (mb.type)
+        {
+        case et_int8: read_column_as<int8_t>(stream, count, numbers); break;
+        case et_uint8: read_column_as<uint8_t>(stream, count, numbers); break;
+        case et_int16: read_column_as<int16_t>(stream, count, numbers); break;
+        case et_uint16: read_column_as<uint16_t>(stream, count, numbers); break;
+        case et_int32: read_column_as<int32_t>(stream, count, numbers); break;
+        case et_uint32: read_column_as<uint32_t>(stream, count, numbers); break;
+        case et_uint64: read_column_as<uint64_t>(stream, count, numbers); break;
+        default: read_column_as<int64_t>(stream, count, numbers); break;
+        }
+        for (std::size_t k = 0; mb.enum_define && k < numbers.size(); ++k)
+        {
+          check_enum(*mb.enum_define, numbers[k]);
+        }
+      }
+
+      template<typename handler_ty>
+      void decode_member(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler);
+
+      // an integer column of a [columnar] list in numbers, and the steps of a [quant] float, the others as the
+      // position of every element in cells
+      struct decoded_column
+      {
+        bool present;
+        std::vector<int64_t> numbers;
+        std::vector<const unsigned char *> cells;
+        decoded_column() : present(false) {}
+      };
+
+      // a [columnar] list: its columns are read first, then each element is reported in turn
+      template<typename handler_ty>
+      void decode_columnar(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        const type_layout& type = *mb.params[0].type_define;
+        uint32_t len = read_length(stream, mb.size);
+        handler.begin_list(len);
+        if (len == 0)
+        {
+          handler.end_list();
+          return;
+        }
+        ::std::size_t offset = stream.read_length();
+        uint64_t tag = 0;
+        ::adata::read(stream, tag);
+        int32_t len_tag = 0;
+        ::adata::read(stream, len_tag);
+
+        std::vector<decoded_column> columns(type.members.size());
+        for (std::size_t i = 0; i < type.members.size() && i < 63; ++i)
+        {
+          const member_layout& member = type.members[i];
+          if ((tag & ((uint64_t)1 << i)) == 0)
+          {
+            continue;
+          }
+          decoded_column& col = columns[i];
+          col.present = !member.deleted;
+          if (is_column_type(member.type) || member.quant)
+          {
+            read_column(stream, member, len, col.numbers);
+            continue;
+          }
+          if (member.type == et_bool)
+          {
+            std::vector<bool> column;
+            ::adata::read_bool_column(stream, column, (int32_t)len);
+            col.numbers.assign(column.begin(), column.end());
+            continue;
+          }
+          col.cells.resize(len + 1);
+          for (uint32_t k = 0; k < len; ++k)
+          {
+            col.cells[k] = stream.read_ptr();
+            skip_member(stream, member);
+          }
+          col.cells[len] = stream.read_ptr();
+        }
+        if (len_tag >= 0)
+        {
+          ::std::size_t read_len = stream.read_length() - offset;
+          ::std::size_t skip_len = (::std::size_t)len_tag;
+          if (skip_len > read_len) stream.skip_read(skip_len - read_len);
+        }
+
+        for (uint32_t k = 0; k < len; ++k)
+        {
+          handler.begin_type(type);
+          for (std::size_t i = 0; i < type.members.size(); ++i)
+          {
+            const member_layout& member = type.members[i];
+            const decoded_column& col = columns[i];
+            if (member.deleted)
+            {
+              continue;
+            }
+            if (!col.present)
+            {
+              handler.missing(member);
+              continue;
+            }
+            handler.field(member);
+            if (!col.numbers.empty())
+            {
+              if (member.quant)
+              {
+                handler.on_float(dequantize_member(member, (uint64_t)col.numbers[k]));
+              }
+              else if (is_signed_type(member.type))
+              {
+                handler.on_int(col.numbers[k]);
+              }
+              else
+              {
+                handler.on_uint((uint64_t)col.numbers[k]);
+              }
+              continue;
+            }
+            zero_copy_buffer cell;
+            cell.set_read(col.cells[k], (::std::size_t)(col.cells[k + 1] - col.cells[k]));
+            decode_member(cell, member, handler);
+          }
+          handler.end_type(type);
+        }
+        handler.end_list();
+      }
+
+      template<typename handler_ty>
+      void decode_list_member(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        if (mb.sized)
+        {
+          int32_t payload_len = 0;
+          ::adata::read(stream, payload_len);
+        }
+        if (mb.columnar)
+        {
+          decode_columnar(stream, mb, handler);
+        }
+        else if (mb.encoding != list_plain)
+        {
+          decode_encoded_list(stream, mb, handler);
+        }
+        else
+        {
+          uint32_t len = read_length(stream, mb.size);
+          handler.begin_list(len);
+          for (uint32_t i = 0; i < len; ++i)
+          {
+            decode_value(stream, mb.params[0], handler);
+          }
+          handler.end_list();
+        }
+      }
+
+      template<typename handler_ty>
+      void decode_map_member(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        if (mb.sized)
+        {
+          int32_t payload_len = 0;
+          ::adata::read(stream, payload_len);
+        }
+        uint32_t len = read_length(stream, mb.size);
+        handler.begin_map(len);
+        for (uint32_t i = 0; i < len; ++i)
+        {
+          decode_value(stream, mb.params[0], handler);
+          decode_value(stream, mb.params[1], handler);
+        }
+        handler.end_map();
+      }
+
+      // an array has no length, it is reported as a list of its element count
+      template<typename handler_ty>
+      void decode_array_member(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        handler.begin_list((uint32_t)mb.size);
+        for (int32_t i = 0; i < mb.size; ++i)
+        {
+          decode_value(stream, mb.params[0], handler);
+        }
+        handler.end_list();
+      }
+
+      // one member value outside of a program, the cells of a [columnar] list
+      template<typename handler_ty>
+      void decode_member(zero_copy_buffer& stream, const member_layout& mb, handler_ty& handler)
+      {
+        switch (mb.type)
+        {
+        case et_list: decode_list_member(stream, mb, handler); break;
+        case et_map: decode_map_member(stream, mb, handler); break;
+        case et_string: decode_member_string(stream, mb, handler); break;
+        case et_type: decode_type(stream, *mb.type_define, handler); break;
+        case et_bits: decode_bits(stream, mb.size, handler); break;
+        case et_array: decode_array_member(stream, mb, handler); break;
+        default:
+          if (mb.enum_define)
+          {
+            decode_enum(stream, mb.type, *mb.enum_define, handler);
+          }
+          else
+          {
+            decode_scalar(stream, mb.type, handler);
+          }
+          break;
+        }
+      }
+
+#ifdef ADATA_DYNAMIC_THREADED
+# define ADATA_DYNAMIC_DISPATCH() goto *labels[ip->op];
+# define ADATA_DYNAMIC_CASE(op) label_##op:
+# define ADATA_DYNAMIC_NEXT() ++ip; goto *labels[ip->op];
+#else
+# define ADATA_DYNAMIC_DISPATCH() switch (ip->op)
+# define ADATA_DYNAMIC_CASE(op) case op:
+# define ADATA_DYNAMIC_NEXT() ++ip; continue;
+#endif
+
+#define ADATA_DYNAMIC_MEMBER(op, body) \
+      ADATA_DYNAMIC_CASE(op) \
+        if (words[ip->word] & ip->mask) { handler.field(*ip->member); body; } \
+        else { handler.missing(*ip->member); } \
+        ADATA_DYNAMIC_NEXT()
+
+      // every member is there, fix_ integers, floats and other packed types
+      template<typename handler_ty>
+      void decode_packed(zero_copy_buffer& stream, const type_layout& type, handler_ty& handler)
+      {
+        handler.begin_type(type);
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          const member_layout& mb = type.members[i];
+          handler.field(mb);
+          if (mb.type == et_type)
+          {
+            decode_packed(stream, *mb.type_define, handler);
+          }
+          else
+          {
+            decode_scalar(stream, mb.type, handler);
+          }
+        }
+        handler.end_type(type);
+      }
+
+      // only the member held is reported, a kind not in the schema or deleted is skipped and leaves none
+      template<typename handler_ty>
+      void decode_union(zero_copy_buffer& stream, const type_layout& type, handler_ty& handler)
+      {
+        uint32_t kind = 0;
+        ::adata::read(stream, kind);
+        handler.begin_type(type);
+        if (kind != 0 && kind <= type.members.size() && !type.members[kind - 1].deleted)
+        {
+          const member_layout& mb = type.members[kind - 1];
+          handler.field(mb);
+          decode_type(stream, *mb.type_define, handler);
+        }
+        else if (kind != 0)
+        {
+          skip_read_compatible(stream);
+        }
+        handler.end_type(type);
+      }
+
+      template<typename handler_ty>
+      void decode_type(zero_copy_buffer& stream, const type_layout& type, handler_ty& handler)
+      {
+        if (type.packed)
+        {
+          decode_packed(stream, type, handler);
+          return;
+        }
+        if (type.is_union)
+        {
+          decode_union(stream, type, handler);
+          return;
+        }
+#ifdef ADATA_DYNAMIC_THREADED
+        static void * const labels[op_count] =
+        {
+          &&label_et_unknow,
+          &&label_et_fix_int8, &&label_et_fix_uint8, &&label_et_fix_int16, &&label_et_fix_uint16,
+          &&label_et_fix_int32, &&label_et_fix_uint32, &&label_et_fix_int64, &&label_et_fix_uint64,
+          &&label_et_int8, &&label_et_uint8, &&label_et_int16, &&label_et_uint16,
+          &&label_et_int32, &&label_et_uint32, &&label_et_int64, &&label_et_uint64,
+          &&label_et_float32, &&label_et_float64, &&label_et_string,
+          &&label_et_list, &&label_et_map, &&label_et_type, &&label_et_bool, &&label_et_bits,
+          &&label_et_array,
+          &&label_op_end, &&label_op_skip, &&label_op_ext_tag, &&label_op_bit_run, &&label_op_enum
+        };
+#endif
+        ::std::size_t offset = stream.read_length();
+        uint64_t tag = 0;
+        ::adata::read(stream, tag);
+        int32_t len_tag = 0;
+        ::adata::read(stream, len_tag);
+        handler.begin_type(type);
+
+        // presence bit of every member index, more than one word only for wide types
+        const ::std::size_t word_count = (type.members.size() + 63) / 64;
+        uint64_t first_word = tag & ~ext_tag_bit;
+        uint64_t * words = &first_word;
+        std::vector<uint64_t> more_words;
+        if (word_count > 1)
+        {
+          more_words.assign(word_count, 0);
+          more_words[0] = first_word;
+          words = &more_words[0];
+        }
+
+        const instr * ip = &type.program[0];
+        for (;;)
+        {
+          ADATA_DYNAMIC_DISPATCH()
+          {
+            ADATA_DYNAMIC_MEMBER(et_fix_int8, (fix_signed<int8_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_uint8, (fix_unsigned<uint8_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_int16, (fix_signed<int16_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_uint16, (fix_unsigned<uint16_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_int32, (fix_signed<int32_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_uint32, (fix_unsigned<uint32_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_int64, (fix_signed<int64_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_fix_uint64, (fix_unsigned<uint64_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_int8, (var_signed<int8_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_uint8, (var_unsigned<uint8_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_int16, (var_signed<int16_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_uint16, (var_unsigned<uint16_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_int32, (var_signed<int32_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_uint32, (var_unsigned<uint32_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_int64, (var_signed<int64_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_uint64, (var_unsigned<uint64_t>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_float32, (var_float<float>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_float64, (var_float<double>(stream, handler)))
+            ADATA_DYNAMIC_MEMBER(et_string, (decode_member_string(stream, *ip->member, handler)))
+            ADATA_DYNAMIC_MEMBER(et_type, (decode_type(stream, *ip->member->type_define, handler)))
+            // a bool in the data is the other value than its default
+            ADATA_DYNAMIC_MEMBER(et_bool, (handler.on_uint(ip->member->default_uint ? 0 : 1)))
+            ADATA_DYNAMIC_MEMBER(et_bits, (decode_bits(stream, ip->member->size, handler)))
+            ADATA_DYNAMIC_MEMBER(et_array, (decode_array_member(stream, *ip->member, handler)))
+            ADATA_DYNAMIC_MEMBER(op_enum, (decode_enum(stream, ip->type, *ip->member->enum_define, handler)))
+            ADATA_DYNAMIC_CASE(et_list)
+            {
+              const member_layout& mb = *ip->member;
+              if (words[ip->word] & ip->mask)
+              {
+                handler.field(mb);
+                decode_list_member(stream, mb, handler);
+              }
+              else
+              {
+                handler.missing(mb);
+              }
+              ADATA_DYNAMIC_NEXT()
+            }
+            ADATA_DYNAMIC_CASE(et_map)
+            {
+              const member_layout& mb = *ip->member;
+              if (words[ip->word] & ip->mask)
+              {
+                handler.field(mb);
+                decode_map_member(stream, mb, handler);
+              }
+              else
+              {
+                handler.missing(mb);
+              }
+              ADATA_DYNAMIC_NEXT()
+            }
+            ADATA_DYNAMIC_CASE(op_skip)
+            {
+              if (words[ip->word] & ip->mask)
+              {
+                skip_member(stream, *ip->member);
+              }
+              ADATA_DYNAMIC_NEXT()
+            }
+            ADATA_DYNAMIC_CASE(op_ext_tag)
+            {
+              if (tag & ext_tag_bit)
+              {
+                read_ext_tag(stream, words, word_count);
+              }
+              ADATA_DYNAMIC_NEXT()
+            }
+            ADATA_DYNAMIC_CASE(op_bit_run)
+            {
+              decode_bit_run(stream, ip->member, ip->word, words, handler);
+              ADATA_DYNAMIC_NEXT()
+            }
+            ADATA_DYNAMIC_CASE(et_unknow)
+            {
+              throw exception(undefined_member_protocol_not_compatible);
+            }
+            ADATA_DYNAMIC_CASE(op_end)
+            {
+              break;
+            }
+#ifndef ADATA_DYNAMIC_THREADED
+          default:
+            throw exception(undefined_member_protocol_not_compatible);
+#endif
+          }
+          break;
+        }
+
+        handler.end_type(type);
+        if (len_tag >= 0)
+        {
+          ::std::size_t read_len = stream.read_length() - offset;
+          ::std::size_t len = (::std::size_t)len_tag;
+          if (len > read_len) stream.skip_read(len - read_len);
+        }
+      }
+
+#undef ADATA_DYNAMIC_MEMBER
+#undef ADATA_DYNAMIC_NEXT
+#undef ADATA_DYNAMIC_CASE
+#undef ADATA_DYNAMIC_DISPATCH
+    }
+
+    // decode one encoded type from stream, reporting to handler
+    template<typename handler_ty>
+    ADATA_INLINE void decode(zero_copy_buffer& stream, const type_layout& type, handler_ty& handler)
+    {
+      detail::decode_type(stream, type, handler);
+    }
+
+    ADATA_INLINE void skip(zero_copy_buffer& stream, const type_layout& type)
+    {
+      detail::skip_object(stream, type);
+    }
+
+    // generic document value: scalar, string, list, map (alternating key and value items)
+    // or object (one item per member, null for deleted members)
+    class value
+    {
+    public:
+      enum kind_type
+      {
+        null_kind,
+        int_kind,
+        uint_kind,
+        float_kind,
+        string_kind,
+        list_kind,
+        map_kind,
+        object_kind
+      };
+
+      value() : m_kind(null_kind), m_type(0) { m_number.i = 0; }
+      value(int64_t v) : m_kind(int_kind), m_type(0) { m_number.i = v; }
+      value(uint64_t v) : m_kind(uint_kind), m_type(0) { m_number.u = v; }
+      value(double v) : m_kind(float_kind), m_type(0) { m_number.f = v; }
+      value(const std::string& v) : m_kind(string_kind), m_type(0), m_string(v) { m_number.i = 0; }
+      value(const char * v, std::size_t len) : m_kind(string_kind), m_type(0), m_string(v, len) { m_number.i = 0; }
+
+      static value make_list() { value v; v.m_kind = list_kind; return v; }
+      static value make_map() { value v; v.m_kind = map_kind; return v; }
+
+      // all members null, i.e. default value on encode
+      static value make_object(const type_layout& type)
+      {
+        value v;
+        v.m_kind = object_kind;
+        v.m_type = &type;
+        v.m_items.resize(type.members.size());
+        return v;
+      }
+
+      kind_type kind() const { return m_kind; }
+      bool is_null() const { return m_kind == null_kind; }
+      const type_layout * type() const { return m_type; }
+
+      int64_t as_int() const
+      {
+        switch (m_kind)
+        {
+        case uint_kind: return (int64_t)m_number.u;
+        case float_kind: return (int64_t)m_number.f;
+        case int_kind: return m_number.i;
+        default: break;
+        }
+        return 0;
+      }
+
+      uint64_t as_uint() const
+      {
+        switch (m_kind)
+        {
+        case int_kind: return (uint64_t)m_number.i;
+        case float_kind: return (uint64_t)m_number.f;
+        case uint_kind: return m_number.u;
+        default: break;
+        }
+        return 0;
+      }
+
+      double as_float() const
+      {
+        switch (m_kind)
+        {
+        case int_kind: return (double)m_number.i;
+        case uint_kind: return (double)m_number.u;
+        case float_kind: return m_number.f;
+        default: break;
+        }
+        return 0;
+      }
+
+      const std::string& as_string() const { return m_string; }
+      std::string& as_string() { return m_string; }
+
+      // list items, map key/value items or object members
+      const std::vector<value>& items() const { return m_items; }
+      std::vector<value>& items() { return m_items; }
+
+      std::size_t size() const { return m_kind == map_kind ? m_items.size() / 2 : (m_kind == string_kind ? m_string.size() : m_items.size()); }
+
+      void push_back(const value& v) { m_items.push_back(v); }
+      void insert(const value& key, const value& v) { m_items.push_back(key); m_items.push_back(v); }
+      const value& map_key(std::size_t i) const { return m_items[i * 2]; }
+      const value& map_value(std::size_t i) const { return m_items[i * 2 + 1]; }
+
+      // object member by name, null if not a live member
+      value * field(const std::string& name)
+      {
+        if (m_type == 0) return 0;
+        const member_layout * mb = m_type->find_member(name);
+        return mb ? &m_items[mb->index] : 0;
+      }
+
+      const value * field(const std::string& name) const
+      {
+        return const_cast<value *>(this)->field(name);
+      }
+
+    private:
+      friend class dom_builder;
+
+      kind_type m_kind;
+      union
+      {
+        int64_t i;
+        uint64_t u;
+        double f;
+      } m_number;
+      const type_layout * m_type;
+      std::string m_string;
+      std::vector<value> m_items;
+    };
+
+    ADATA_INLINE value default_value(const member_layout& mb);
+
+    // a union holds none of its members
+    inline value default_object(const type_layout& type)
+    {
+      value v = value::make_object(type);
+      for (std::size_t i = 0; i < type.members.size() && !type.is_union; ++i)
+      {
+        if (!type.members[i].deleted)
+        {
+          v.items()[i] = default_value(type.members[i]);
+        }
+      }
+      return v;
+    }
+
+    // an element of an array before it is set, zero, empty or a default object
+    ADATA_INLINE value default_element(const param_layout& param)
+    {
+      if (is_signed_type(param.type)) return value((int64_t)0);
+      if (is_unsigned_type(param.type)) return value((uint64_t)0);
+      if (is_float_type(param.type)) return value(0.0);
+      if (param.type == et_string) return value(std::string());
+      if (param.type == et_type) return default_object(*param.type_define);
+      return value();
+    }
+
+    // an optional member is null until it is set
+    ADATA_INLINE value default_value(const member_layout& mb)
+    {
+      if (mb.optional) return value();
+      if (is_signed_type(mb.type)) return value(mb.default_int);
+      if (is_unsigned_type(mb.type)) return value(mb.default_uint);
+      if (is_float_type(mb.type)) return value(mb.default_float);
+      switch (mb.type)
+      {
+      case et_string: return value(std::string());
+      case et_list: return value::make_list();
+      case et_map: return value::make_map();
+      case et_type: return default_object(*mb.type_define);
+      case et_bool: return value(mb.default_uint);
+      case et_bits:
+      {
+        value v = value::make_list();
+        v.items().assign((std::size_t)mb.size, value((uint64_t)0));
+        return v;
+      }
+      case et_array:
+      {
+        value v = value::make_list();
+        v.items().assign((std::size_t)mb.size, default_element(mb.params[0]));
+        return v;
+      }
+      default: break;
+      }
+      return value();
+    }
+
+    // decode handler filling a value
+    class dom_builder
+    {
+    public:
+      explicit dom_builder(value& root)
+        : m_root(&root)
+        , m_field(0)
+      {
+      }
+
+      ADATA_INLINE void begin_type(const type_layout& type)
+      {
+        value& v = next();
+        v.m_kind = value::object_kind;
+        v.m_type = &type;
+        v.m_items.clear();
+        v.m_items.resize(type.members.size());
+        m_stack.push_back(&v);
+      }
+
+      ADATA_INLINE void end_type(const type_layout&) { m_stack.pop_back(); }
+      ADATA_INLINE void field(const member_layout& mb) { m_field = &m_stack.back()->m_items[mb.index]; }
+      ADATA_INLINE void missing(const member_layout& mb) { m_stack.back()->m_items[mb.index] = default_value(mb); }
+      ADATA_INLINE void on_int(int64_t v) { next() = value(v); }
+      ADATA_INLINE void on_uint(uint64_t v) { next() = value(v); }
+      ADATA_INLINE void on_float(double v) { next() = value(v); }
+
+      ADATA_INLINE void on_string(const char * str, std::size_t len)
+      {
+        value& v = next();
+        v.m_kind = value::string_kind;
+        v.m_string.assign(str, len);
+      }
+
+      ADATA_INLINE void begin_list(uint32_t len) { begin_items(value::list_kind, len); }
+      ADATA_INLINE void end_list() { m_stack.pop_back(); }
+      ADATA_INLINE void begin_map(uint32_t len) { begin_items(value::map_kind, len * 2); }
+      ADATA_INLINE void end_map() { m_stack.pop_back(); }
+
+    private:
+      // reserved items never move while nested values are filled
+      ADATA_INLINE void begin_items(value::kind_type kind, uint32_t len)
+      {
+        value& v = next();
+        v.m_kind = kind;
+        v.m_items.clear();
+        v.m_items.reserve(len);
+        m_stack.push_back(&v);
+      }
+
+      ADATA_INLINE value& next()
+      {
+        if (m_stack.empty())
+        {
+          return *m_root;
+        }
+        value& top = *m_stack.back();
+        if (top.m_kind == value::object_kind)
+        {
+          return *m_field;
+        }
+        top.m_items.push_back(value());
+        return top.m_items.back();
+      }
+
+      value * m_root;
+      value * m_field;
+      std::vector<value *> m_stack;
+    };
+
+    // decode into a document value
+    ADATA_INLINE void read(zero_copy_buffer& stream, const type_layout& type, value& v)
+    {
+      dom_builder builder(v);
+      detail::decode_type(stream, type, builder);
+    }
+
+    namespace detail
+    {
+      template<typename ty>
+      ADATA_INLINE ty to_signed(const value& v)
+      {
+        int64_t n = v.as_int();
+        if (v.kind() == value::uint_kind && v.as_uint() > (uint64_t)INT64_MAX)
+        {
+          throw exception(value_too_large_to_integer_number);
+        }
+        if ((int64_t)(ty)n != n)
+        {
+          throw exception(value_too_large_to_integer_number);
+        }
+        return (ty)n;
+      }
+
+      template<typename ty>
+      ADATA_INLINE ty to_unsigned(const value& v)
+      {
+        if ((v.kind() == value::int_kind && v.as_int() < 0) || (v.kind() == value::float_kind && v.as_float() < 0))
+        {
+          throw exception(negative_assign_to_unsigned_integer_number);
+        }
+        uint64_t n = v.as_uint();
+        if ((uint64_t)(ty)n != n)
+        {
+          throw exception(value_too_large_to_integer_number);
+        }
+        return (ty)n;
+      }
+
+      inline bool is_default_object(const type_layout& type, const value * v);
+
+      // throw enum_value_undefined if an enum is set to no enumerator of it
+      ADATA_INLINE void check_enum_value(const enum_layout * en, const value& v)
+      {
+        if (en != 0 && en->index_of(v.kind() == value::uint_kind ? (int64_t)v.as_uint() : to_signed<int64_t>(v)) < 0)
+        {
+          throw exception(enum_value_undefined);
+        }
+      }
+
+      // an element of an array away from default_element
+      ADATA_INLINE bool is_present_element(const param_layout& param, const value& v)
+      {
+        if (v.is_null())
+        {
+          return false;
+        }
+        switch (param.type)
+        {
+        case et_string: return v.size() != 0;
+        case et_type: return !is_default_object(*param.type_define, &v);
+        case et_float32: return !::adata::is_default((float)v.as_float(), 0.0f);
+        case et_float64: return !::adata::is_default(v.as_float(), 0.0);
+        default: break;
+        }
+        if (is_signed_type(param.type))
+        {
+          return to_signed<int64_t>(v) != 0;
+        }
+        return to_unsigned<uint64_t>(v) != 0;
+      }
+
+      // optional members are written when not null, strings and containers when not empty, others when not at the member default
+      ADATA_INLINE bool is_present(const member_layout& mb, const value * v)
+      {
+        if (v == 0 || v->is_null())
+        {
+          return false;
+        }
+        if (mb.optional)
+        {
+          return true;
+        }
+        switch (mb.type)
+        {
+        case et_string: case et_list: case et_map: return v->size() != 0;
+        case et_type: return !is_default_object(*mb.type_define, v);
+        case et_float32: return !::adata::is_default((float)v->as_float(), (float)mb.default_float);
+        case et_float64: return !::adata::is_default(v->as_float(), mb.default_float);
+        case et_bool: return (to_unsigned<uint64_t>(*v) != 0) != (mb.default_uint != 0);
+        case et_bits:
+        {
+          for (std::size_t i = 0; i < v->items().size(); ++i)
+          {
+            if (to_unsigned<uint64_t>(v->items()[i]) != 0) return true;
+          }
+          return false;
+        }
+        case et_array:
+        {
+          for (std::size_t i = 0; i < v->items().size(); ++i)
+          {
+            if (is_present_element(mb.params[0], v->items()[i])) return true;
+          }
+          return false;
+        }
+        default: break;
+        }
+        if (is_signed_type(mb.type))
+        {
+          return to_signed<int64_t>(*v) != mb.default_int;
+        }
+        return to_unsigned<uint64_t>(*v) != mb.default_uint;
+      }
+
+      // the member a union holds is its first live one that is not null, 0 for none
+      inline const member_layout * union_member(const type_layout& type, const value * v)
+      {
+        for (std::size_t i = 0; v != 0 && i < type.members.size(); ++i)
+        {
+          if (!type.members[i].deleted && !v->items()[i].is_null())
+          {
+            return &type.members[i];
+          }
+        }
+        return 0;
+      }
+
+      // a nested object is left out when none of its members would be written, a union when it holds none
+      inline bool is_default_object(const type_layout& type, const value * v)
+      {
+        if (v->kind() != value::object_kind || v->type() != &type)
+        {
+          return false;
+        }
+        if (type.is_union)
+        {
+          return union_member(type, v) == 0;
+        }
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          if (!type.members[i].deleted && is_present(type.members[i], &v->items()[i]))
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      inline int32_t size_of_object(const type_layout& type, const value * v);
+
+      // v may be null for the member default
+      inline int32_t size_of_value(int32_t type, const value * v, const member_layout * mb, const type_layout * sub)
+      {
+        value def;
+        if ((v == 0 || v->is_null()) && mb != 0 && type != et_type)
+        {
+          def = default_value(*mb);
+          v = &def;
+        }
+        switch (type)
+        {
+        case et_fix_int8: case et_fix_uint8: return 1;
+        case et_fix_int16: case et_fix_uint16: return 2;
+        case et_fix_int32: case et_fix_uint32: case et_float32: return 4;
+        case et_fix_int64: case et_fix_uint64: case et_float64: return 8;
+        case et_int8: return ::adata::size_of(to_signed<int8_t>(*v));
+        case et_uint8: return ::adata::size_of(to_unsigned<uint8_t>(*v));
+        case et_int16: return ::adata::size_of(to_signed<int16_t>(*v));
+        case et_uint16: return ::adata::size_of(to_unsigned<uint16_t>(*v));
+        case et_int32: return ::adata::size_of(to_signed<int32_t>(*v));
+        case et_uint32: return ::adata::size_of(to_unsigned<uint32_t>(*v));
+        case et_int64: return ::adata::size_of(to_signed<int64_t>(*v));
+        case et_uint64: return ::adata::size_of(to_unsigned<uint64_t>(*v));
+        case et_string:
+        {
+          if (mb && mb->dict)
+          {
+            return size_of_dict_string(v ? v->as_string() : std::string());
+          }
+          int32_t len = v ? (int32_t)v->as_string().size() : 0;
+          return size_of_bytes((std::size_t)len, mb ? mb->align : 0);
+        }
+        case et_type: return size_of_object(*sub, (v && !v->is_null()) ? v : 0);
+        case et_bool: return 0;
+        case et_bits: return (mb->size + 7) / 8;
+        default: break;
+        }
+        throw exception(undefined_member_protocol_not_compatible);
+      }
+
+      // a [delta], [delta2], [rle] or [xor] list through the adata kernels, only its size when stream is null
+      template<typename ty>
+      int32_t encode_list_as(const member_layout& mb, const value * v, zero_copy_buffer * stream)
+      {
+        const std::vector<value>& items = v->items();
+        std::vector<ty> list(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+          list[i] = is_signed_type(mb.params[0].type) ? to_signed<ty>(items[i]) : to_unsigned<ty>(items[i]);
+        }
+        if (stream)
+        {
+          ::adata::write_list(*stream, list, mb.encoding);
+          return 0;
+        }
+        return ::adata::size_of_list(list, mb.encoding);
+      }
+
+      template<typename ty>
+      int32_t encode_float_list_as(const member_layout& mb, const value * v, zero_copy_buffer * stream)
+      {
+        const std::vector<value>& items = v->items();
+        std::vector<ty> list(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+          list[i] = (ty)items[i].as_float();
+        }
+        if (stream)
+        {
+          ::adata::write_list(*stream, list, mb.encoding);
+          return 0;
+        }
+        return ::adata::size_of_list(list, mb.encoding);
+      }
+
+      inline int32_t encode_list(const member_layout& mb, const value * v, zero_copy_buffer * stream)
+      {
+        switch (mb.params[0].type)
+        {
+        case et_float32: return encode_float_list_as<float>(mb, v, stream);
+        case et_float64: return encode_float_list_as<double>(mb, v, stream);
+        case et_int8: return encode_list_as<int8_t>(mb, v, stream);
+        case et_uint8: return encode_list_as<uint8_t>(mb, v, stream);
+        case et_int16: return encode_list_as<int16_t>(mb, v, stream);
+        case et_uint16: return encode_list_as<uint16_t>(mb, v, stream);
+        case et_int32: return encode_list_as<int32_t>(mb, v, stream);
+        case et_uint32: return encode_list_as<uint32_t>(mb, v, stream);
+        case et_int64: return encode_list_as<int64_t>(mb, v, stream);
+        case et_uint64: return encode_list_as<uint64_t>(mb, v, stream);
+        default: break;
+        }
+        throw exception(undefined_member_protocol_not_compatible);
+      }
+
+      inline int32_t encode_columnar(const member_layout& mb, const value * v, zero_copy_buffer * stream);
+
+      // list or map payload, without the byte length of a sized member
+      inline int32_t size_of_items(const member_layout& mb, const value * v)
+      {
+        if (mb.columnar)
+        {
+          return encode_columnar(mb, v, 0);
+        }
+        if (mb.encoding != list_plain)
+        {
+          return encode_list(mb, v, 0);
+        }
+        int32_t len = (int32_t)v->size();
+        int32_t size = ::adata::size_of(len);
+        const std::vector<value>& items = v->items();
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+          const param_layout& param = mb.params[mb.type == et_map ? i & 1 : 0];
+          size += size_of_value(param.type, &items[i], 0, param.type_define);
+        }
+        return size;
+      }
+
+      // the elements of an array, which has exactly its element count
+      ADATA_INLINE const std::vector<value>& array_items(const member_layout& mb, const value * v, value& def)
+      {
+        if (v == 0 || v->is_null())
+        {
+          def = default_value(mb);
+          v = &def;
+        }
+        if (v->items().size() != (std::size_t)mb.size)
+        {
+          throw exception(number_of_element_not_match);
+        }
+        return v->items();
+      }
+
+      inline int32_t size_of_member(const member_layout& mb, const value * v)
+      {
+        if (mb.type == et_array)
+        {
+          value def;
+          const std::vector<value>& items = array_items(mb, v, def);
+          int32_t size = 0;
+          for (std::size_t i = 0; i < items.size(); ++i)
+          {
+            size += size_of_value(mb.params[0].type, &items[i], 0, mb.params[0].type_define);
+          }
+          return size;
+        }
+        if (mb.type == et_list || mb.type == et_map)
+        {
+          value def;
+          if (v == 0 || v->is_null())
+          {
+            def = default_value(mb);
+            v = &def;
+          }
+          int32_t size = size_of_items(mb, v);
+          if (mb.sized)
+          {
+            size += ::adata::size_of(size);
+          }
+          return size;
+        }
+        return size_of_value(mb.type, v, &mb, mb.type_define);
+      }
+
+      // presence bit of every member index, v null means every member default.
+      // return the tag on the wire, members 0 to 62 and ext_tag_bit if any other is present
+      inline uint64_t object_tag(const type_layout& type, const value * v, std::vector<uint64_t>& words)
+      {
+        words.assign((type.members.size() + 63) / 64, 0);
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          const member_layout& mb = type.members[i];
+          if (!mb.deleted && is_present(mb, v ? &v->items()[i] : 0))
+          {
+            words[i / 64] |= (uint64_t)1 << (i % 64);
+          }
+        }
+        if (words.empty())
+        {
+          return 0;
+        }
+        uint64_t tag = words[0] & ~ext_tag_bit;
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+          if (words[w] & (w == 0 ? ext_tag_bit : ~(uint64_t)0))
+          {
+            tag |= ext_tag_bit;
+            break;
+          }
+        }
+        return tag;
+      }
+
+      // the value of a [quant] float before it is quantized, a float32 one is a float first as in the generated code
+      ADATA_INLINE double quant_source(const member_layout& mb, const value * v)
+      {
+        double source = v == 0 || v->is_null() ? mb.default_float : v->as_float();
+        return mb.type == et_float32 ? (double)(float)source : source;
+      }
+
+      // bytes of the run of [bits] members from first
+      inline int32_t size_of_bit_run(const type_layout& type, const member_layout& first, const uint64_t * words)
+      {
+        int32_t bit_count = 0;
+        for (uint32_t i = first.index; i < first.bit_run_end; ++i)
+        {
+          if (::adata::detail::ext_tag_test(words, i))
+          {
+            bit_count += type.members[i].bit_width;
+          }
+        }
+        return ::adata::size_of_bit_run(bit_count);
+      }
+
+      inline void write_bit_run(zero_copy_buffer& stream, const type_layout& type, const member_layout& first, const uint64_t * words, const value * v)
+      {
+        bit_writer<zero_copy_buffer> bits(stream);
+        for (uint32_t i = first.index; i < first.bit_run_end; ++i)
+        {
+          if (!::adata::detail::ext_tag_test(words, i))
+          {
+            continue;
+          }
+          const member_layout& mb = type.members[i];
+          const value * item = &v->items()[i];
+          if (mb.quant)
+          {
+            bits.write_quant(quant_source(mb, item), mb.bit_width, mb.quant_step, mb.quant_min, mb.quant_max);
+          }
+          else if (is_signed_type(mb.type))
+          {
+            bits.write_signed(to_signed<int64_t>(*item), mb.bit_width);
+          }
+          else
+          {
+            bits.write_unsigned(to_unsigned<uint64_t>(*item), mb.bit_width);
+          }
+        }
+        bits.flush();
+      }
+
+      inline int32_t size_of_object(const type_layout& type, const value * v)
+      {
+        if (v != 0 && (v->kind() != value::object_kind || v->type() != &type))
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+        if (type.packed)
+        {
+          return type.packed_size;
+        }
+        if (type.is_union)
+        {
+          const member_layout * mb = union_member(type, v);
+          if (mb == 0)
+          {
+            return ::adata::size_of((uint32_t)0);
+          }
+          return ::adata::size_of(mb->index + 1) + size_of_object(*mb->type_define, &v->items()[mb->index]);
+        }
+        std::vector<uint64_t> words;
+        uint64_t tag = object_tag(type, v, words);
+        int32_t size = 0;
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          if (type.members[i].bit_run_end)
+          {
+            size += size_of_bit_run(type, type.members[i], &words[0]);
+          }
+          else if (type.members[i].bit_width == 0 && ::adata::detail::ext_tag_test(&words[0], i))
+          {
+            size += size_of_member(type.members[i], v ? &v->items()[i] : 0);
+          }
+        }
+        if (tag & ext_tag_bit)
+        {
+          size += size_of_ext_tag(&words[0], words.size());
+        }
+        size += ::adata::size_of(tag);
+        size += ::adata::size_of(size + ::adata::size_of(size));
+        return size;
+      }
+
+      inline void write_object(zero_copy_buffer& stream, const type_layout& type, const value * v);
+      inline void write_member(zero_copy_buffer& stream, const member_layout& mb, const value * item);
+
+      inline void write_value(zero_copy_buffer& stream, int32_t type, const value * v, const member_layout * mb, const type_layout * sub)
+      {
+        value def;
+        if ((v == 0 || v->is_null()) && mb != 0 && type != et_type)
+        {
+          def = default_value(*mb);
+          v = &def;
+        }
+        if (mb != 0)
+        {
+          check_enum_value(mb->enum_define, *v);
+        }
+        switch (type)
+        {
+        case et_fix_int8: ::adata::fix_write(stream, to_signed<int8_t>(*v)); break;
+        case et_fix_uint8: ::adata::fix_write(stream, to_unsigned<uint8_t>(*v)); break;
+        case et_fix_int16: ::adata::fix_write(stream, to_signed<int16_t>(*v)); break;
+        case et_fix_uint16: ::adata::fix_write(stream, to_unsigned<uint16_t>(*v)); break;
+        case et_fix_int32: ::adata::fix_write(stream, to_signed<int32_t>(*v)); break;
+        case et_fix_uint32: ::adata::fix_write(stream, to_unsigned<uint32_t>(*v)); break;
+        case et_fix_int64: ::adata::fix_write(stream, to_signed<int64_t>(*v)); break;
+        case et_fix_uint64: ::adata::fix_write(stream, to_unsigned<uint64_t>(*v)); break;
+        case et_int8: ::adata::write(stream, to_signed<int8_t>(*v)); break;
+        case et_uint8: ::adata::write(stream, to_unsigned<uint8_t>(*v)); break;
+        case et_int16: ::adata::write(stream, to_signed<int16_t>(*v)); break;
+        case et_uint16: ::adata::write(stream, to_unsigned<uint16_t>(*v)); break;
+        case et_int32: ::adata::write(stream, to_signed<int32_t>(*v)); break;
+        case et_uint32: ::adata::write(stream, to_unsigned<uint32_t>(*v)); break;
+        case et_int64: ::adata::write(stream, to_signed<int64_t>(*v)); break;
+        case et_uint64: ::adata::write(stream, to_unsigned<uint64_t>(*v)); break;
+        case et_float32: ::adata::write(stream, (float)v->as_float()); break;
+        case et_float64: ::adata::write(stream, v->as_float()); break;
+        case et_string:
+        {
+          if (mb && mb->dict)
+          {
+            write_dict_string(stream, v->as_string());
+            break;
+          }
+          const std::string& str = v->as_string();
+          write_bytes(stream, str.data(), str.size(), mb ? mb->align : 0);
+          break;
+        }
+        case et_type: write_object(stream, *sub, (v && !v->is_null()) ? v : 0); break;
+        case et_bool: break;
+        case et_bits:
+        {
+          std::vector<bool> bits((std::size_t)mb->size);
+          for (std::size_t i = 0; i < bits.size() && i < v->items().size(); ++i)
+          {
+            bits[i] = to_unsigned<uint64_t>(v->items()[i]) != 0;
+          }
+          ::adata::detail::write_bit_items(stream, bits, bits.size());
+          break;
+        }
+        default: throw exception(undefined_member_protocol_not_compatible);
+        }
+      }
+
+      inline void write_object(zero_copy_buffer& stream, const type_layout& type, const value * v)
+      {
+        if (type.packed)
+        {
+          if (v != 0 && (v->kind() != value::object_kind || v->type() != &type))
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          for (std::size_t i = 0; i < type.members.size(); ++i)
+          {
+            const member_layout& mb = type.members[i];
+            write_value(stream, mb.type, v ? &v->items()[i] : 0, &mb, mb.type_define);
+          }
+          return;
+        }
+        if (type.is_union)
+        {
+          if (v != 0 && (v->kind() != value::object_kind || v->type() != &type))
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          const member_layout * mb = union_member(type, v);
+          if (mb == 0)
+          {
+            ::adata::write(stream, (uint32_t)0);
+            return;
+          }
+          ::adata::write(stream, mb->index + 1);
+          write_object(stream, *mb->type_define, &v->items()[mb->index]);
+          return;
+        }
+        std::vector<uint64_t> words;
+        uint64_t tag = object_tag(type, v, words);
+        ::adata::write(stream, tag);
+        ::adata::write(stream, size_of_object(type, v));
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          if (i == 63 && (tag & ext_tag_bit))
+          {
+            ::adata::write_ext_tag(stream, &words[0], words.size());
+          }
+          if (type.members[i].bit_run_end && v != 0)
+          {
+            write_bit_run(stream, type, type.members[i], &words[0], v);
+            continue;
+          }
+          if (type.members[i].bit_width > 0 || !::adata::detail::ext_tag_test(&words[0], i))
+          {
+            continue;
+          }
+          write_member(stream, type.members[i], v ? &v->items()[i] : 0);
+        }
+      }
+
+      inline void write_member(zero_copy_buffer& stream, const member_layout& mb, const value * item)
+      {
+        if (mb.type == et_array)
+        {
+          value def;
+          const std::vector<value>& items = array_items(mb, item, def);
+          for (std::size_t n = 0; n < items.size(); ++n)
+          {
+            check_enum_value(mb.params[0].enum_define, items[n]);
+            write_value(stream, mb.params[0].type, &items[n], 0, mb.params[0].type_define);
+          }
+          return;
+        }
+        if (mb.type != et_list && mb.type != et_map)
+        {
+          write_value(stream, mb.type, item, &mb, mb.type_define);
+          return;
+        }
+        value def;
+        if (item == 0 || item->is_null())
+        {
+          def = default_value(mb);
+          item = &def;
+        }
+        if (mb.sized)
+        {
+          ::adata::write(stream, size_of_items(mb, item));
+        }
+        if (mb.columnar)
+        {
+          encode_columnar(mb, item, &stream);
+          return;
+        }
+        if (mb.encoding != list_plain)
+        {
+          encode_list(mb, item, &stream);
+          return;
+        }
+        ::adata::write(stream, (int32_t)item->size());
+        const std::vector<value>& items = item->items();
+        for (std::size_t n = 0; n < items.size(); ++n)
+        {
+          const param_layout& param = mb.params[mb.type == et_map ? n & 1 : 0];
+          check_enum_value(param.enum_define, items[n]);
+          write_value(stream, param.type, &items[n], 0, param.type_define);
+        }
+      }
+
+      // member i of element k of a [columnar] list, null for the member default
+      ADATA_INLINE const value * column_cell(const std::vector<value>& items, std::size_t k, std::size_t i)
+      {
+        return items[k].is_null() ? 0 : &items[k].items()[i];
+      }
+
+      template<typename ty>
+      int32_t encode_column_as(const member_layout& mb, const std::vector<value>& items, std::size_t i, zero_copy_buffer * stream)
+      {
+        value def = default_value(mb);
+        std::vector<ty> column(items.size());
+        for (std::size_t k = 0; k < items.size(); ++k)
+        {
+          const value * cell = column_cell(items, k, i);
+          if (cell == 0 || cell->is_null())
+          {
+            cell = &def;
+          }
+          check_enum_value(mb.enum_define, *cell);
+          column[k] = is_signed_type(mb.type) ? to_signed<ty>(*cell) : to_unsigned<ty>(*cell);
+        }
+        if (stream)
+        {
+          ::adata::write_column(*stream, column);
+          return 0;
+        }
+        return ::adata::size_of_column(column);
+      }
+
+      inline int32_t encode_bool_column(const member_layout& mb, const std::vector<value>& items, std::size_t i, zero_copy_buffer * stream)
+      {
+        std::vector<bool> column(items.size(), mb.default_uint != 0);
+        for (std::size_t k = 0; k < items.size(); ++k)
+        {
+          const value * cell = column_cell(items, k, i);
+          if (cell != 0 && !cell->is_null())
+          {
+            column[k] = to_unsigned<uint64_t>(*cell) != 0;
+          }
+        }
+        if (stream)
+        {
+          ::adata::write_bool_column(*stream, column);
+          return 0;
+        }
+        return ::adata::size_of_bool_column((int32_t)items.size());
+      }
+
+      inline int32_t encode_quant_column(const member_layout& mb, const std::vector<value>& items, std::size_t i, zero_copy_buffer * stream)
+      {
+        std::vector<uint64_t> column(items.size());
+        for (std::size_t k = 0; k < items.size(); ++k)
+        {
+          column[k] = ::adata::quantize(quant_source(mb, column_cell(items, k, i)), mb.quant_step, mb.quant_min, mb.quant_max);
+        }
+        if (stream)
+        {
+          ::adata::write_column(*stream, column);
+          return 0;
+        }
+        return ::adata::size_of_column(column);
+      }
+
+      // one column of a [columnar] list, only its size when stream is null
+      inline int32_t encode_column(const member_layout& mb, const std::vector<value>& items, std::size_t i, zero_copy_buffer * stream)
+      {
+        if (mb.quant)
+        {
+          return encode_quant_column(mb, items, i, stream);
+        }
+        switch (mb.type)
+        {
+        case et_int8: return encode_column_as<int8_t>(mb, items, i, stream);
+        case et_uint8: return encode_column_as<uint8_t>(mb, items, i, stream);
+        case et_int16: return encode_column_as<int16_t>(mb, items, i, stream);
+        case et_uint16: return encode_column_as<uint16_t>(mb, items, i, stream);
+        case et_int32: return encode_column_as<int32_t>(mb, items, i, stream);
+        case et_uint32: return encode_column_as<uint32_t>(mb, items, i, stream);
+        case et_int64: return encode_column_as<int64_t>(mb, items, i, stream);
+        case et_uint64: return encode_column_as<uint64_t>(mb, items, i, stream);
+        case et_bool: return encode_bool_column(mb, items, i, stream);
+        default: break;
+        }
+        int32_t size = 0;
+        for (std::size_t k = 0; k < items.size(); ++k)
+        {
+          if (stream)
+          {
+            write_member(*stream, mb, column_cell(items, k, i));
+          }
+          else
+          {
+            size += size_of_member(mb, column_cell(items, k, i));
+          }
+        }
+        return size;
+      }
+
+      // a [columnar] list, see adata::write_columnar. only its size when stream is null
+      inline int32_t encode_columnar(const member_layout& mb, const value * v, zero_copy_buffer * stream)
+      {
+        const type_layout& type = *mb.params[0].type_define;
+        if (type.members.size() > 63)
+        {
+          throw exception(undefined_member_protocol_not_compatible);
+        }
+        const std::vector<value>& items = v->items();
+        int32_t len = (int32_t)items.size();
+        if (stream)
+        {
+          ::adata::write(*stream, len);
+        }
+        if (len == 0)
+        {
+          return ::adata::size_of(len);
+        }
+        uint64_t tag = 0;
+        for (std::size_t k = 0; k < items.size(); ++k)
+        {
+          const value& item = items[k];
+          if (!item.is_null() && (item.kind() != value::object_kind || item.type() != &type))
+          {
+            throw exception(undefined_member_protocol_not_compatible);
+          }
+          for (std::size_t i = 0; i < type.members.size(); ++i)
+          {
+            if (!type.members[i].deleted && is_present(type.members[i], column_cell(items, k, i)))
+            {
+              tag |= (uint64_t)1 << i;
+            }
+          }
+        }
+        int32_t size = 0;
+        for (std::size_t i = 0; i < type.members.size(); ++i)
+        {
+          if (tag & ((uint64_t)1 << i))
+          {
+            size += encode_column(type.members[i], items, i, 0);
+          }
+        }
+        size += ::adata::size_of(tag);
+        size += ::adata::size_of(size + ::adata::size_of(size));
+        if (stream)
+        {
+          ::adata::write(*stream, tag);
+          ::adata::write(*stream, size);
+          for (std::size_t i = 0; i < type.members.size(); ++i)
+          {
+            if (tag & ((uint64_t)1 << i))
+            {
+              encode_column(type.members[i], items, i, stream);
+            }
+          }
+        }
+        return ::adata::size_of(len) + size;
+      }
+    }
+
+    // encoded size of an object value, same as the generated size_of
+    ADATA_INLINE int32_t size_of(const value& v)
+    {
+      if (v.type() == 0)
+      {
+        throw exception(undefined_member_protocol_not_compatible);
+      }
+      return detail::size_of_object(*v.type(), &v);
+    }
+
+    // encode an object value, same bytes as the generated write
+    ADATA_INLINE void write(zero_copy_buffer& stream, const value& v)
+    {
+      if (v.type() == 0)
+      {
+        throw exception(undefined_member_protocol_not_compatible);
+      }
+      detail::write_object(stream, *v.type(), &v);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,618 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_FLAT_HPP_HEADER_
+#define ADATA_FLAT_HPP_HEADER_
+
+#include "adata.hpp"
+
+#include <algorithm>
+
+// flat layout, read in place without decoding, all integers and floats little endian and every
+// offset counted from the start of the buffer:
+//
+//   header : magic(u32) layout(u32) size(u32) root(u32)
+//   record : the live members of a type in declared order, each aligned to its own size. an
+//            integer, float, bool (u8) or enum at its width, bits<N> in (N+7)/8 bytes, an array
+//            as its elements, an optional number as a presence byte then the number, and a
+//            string, bytes, list, map or type as the u32 offset of its block, where 0 is an empty
+//            string, list or map, or an optional that isn't set
+//   string : length(u32) 0(u32) bytes 0(u8)
+//   list   : count(u32) 0(u32) elements, a type or string element is an offset too
+//   map    : count(u32) 0(u32) keys in ascending order padded to 8 bytes, values
+//
+// blocks start at a multiple of 8, so do the elements of a list and the bytes of a string.
+// layout is a hash of the declared types, a buffer is read only as the type it was written as.
+
+namespace adata
+{
+  enum
+  {
+    flat_magic = 0x31464441, // "ADF1"
+    flat_header_size = 16,
+    flat_block_header_size = 8,
+    flat_max_depth = 64,
+  };
+
+  // specialized by adatac for each "flat = type;" declaration
+  template<typename T>
+  struct flat_traits;
+
+  template<typename ty>
+  ADATA_INLINE ty flat_load(const char * ptr)
+  {
+    ty value;
+#ifdef __LITTLE_ENDIAN__
+    std::memcpy(&value, ptr, sizeof(ty));
+#else
+    char bytes[sizeof(ty)];
+    for (std::size_t i = 0; i < sizeof(ty); ++i)
+    {
+      bytes[i] = ptr[sizeof(ty) - 1 - i];
+    }
+    std::memcpy(&value, bytes, sizeof(ty));
+#endif
+    return value;
+  }
+
+  template<typename ty>
+  ADATA_INLINE void flat_store(char * ptr, ty value)
+  {
+#ifdef __LITTLE_ENDIAN__
+    std::memcpy(ptr, &value, sizeof(ty));
+#else
+    char bytes[sizeof(ty)];
+    std::memcpy(bytes, &value, sizeof(ty));
+    for (std::size_t i = 0; i < sizeof(ty); ++i)
+    {
+      ptr[i] = bytes[sizeof(ty) - 1 - i];
+    }
+#endif
+  }
+
+  ADATA_INLINE uint32_t flat_align(uint32_t size, uint32_t align)
+  {
+    return (size + align - 1) & ~(align - 1);
+  }
+
+  // offset of the values from the block of a map
+  ADATA_INLINE uint32_t flat_map_values(uint32_t count, uint32_t key_size)
+  {
+    return flat_block_header_size + flat_align(count * key_size, 8);
+  }
+
+  // a slot of a list, map or array: value_type, slot_size and load_slot. adatac generates
+  // <type>_flat views with the same three for a type element
+  template<typename ty>
+  struct flat_scalar
+  {
+    typedef ty value_type;
+    static const uint32_t slot_size = sizeof(ty);
+
+    ADATA_INLINE static value_type load_slot(const char * base, uint32_t offset)
+    {
+      return flat_load<ty>(base + offset);
+    }
+  };
+
+  template<>
+  struct flat_scalar<bool>
+  {
+    typedef bool value_type;
+    static const uint32_t slot_size = 1;
+
+    ADATA_INLINE static value_type load_slot(const char * base, uint32_t offset)
+    {
+      return base[offset] != 0;
+    }
+  };
+
+  // an enum stored as its integer_ty
+  template<typename enum_ty, typename integer_ty>
+  struct flat_enum
+  {
+    typedef enum_ty value_type;
+    typedef integer_ty integer_type;
+    static const uint32_t slot_size = sizeof(integer_type);
+
+    ADATA_INLINE static value_type load_slot(const char * base, uint32_t offset)
+    {
+      return (value_type)flat_load<integer_type>(base + offset);
+    }
+  };
+
+  // a string or bytes in a flat buffer, its bytes are followed by a 0
+  class flat_string
+  {
+  public:
+    typedef flat_string value_type;
+    static const uint32_t slot_size = 4;
+
+    flat_string()
+      : m_data("")
+      , m_size(0)
+    {
+    }
+
+    // the string block at offset, 0 is an empty string
+    flat_string(const char * base, uint32_t offset)
+      : m_data(offset ? base + offset + flat_block_header_size : "")
+      , m_size(offset ? flat_load<uint32_t>(base + offset) : 0)
+    {
+    }
+
+    ADATA_INLINE static value_type load_slot(const char * base, uint32_t offset)
+    {
+      return flat_string(base, flat_load<uint32_t>(base + offset));
+    }
+
+    ADATA_INLINE const char * data() const { return m_data; }
+    ADATA_INLINE const char * c_str() const { return m_data; }
+    ADATA_INLINE uint32_t size() const { return m_size; }
+    ADATA_INLINE bool empty() const { return m_size == 0; }
+    ADATA_INLINE std::string str() const { return std::string(m_data, m_size); }
+
+    ADATA_INLINE int compare(const char * data, std::size_t size) const
+    {
+      std::size_t len = (std::size_t)m_size < size ? (std::size_t)m_size : size;
+      int result = len ? std::memcmp(m_data, data, len) : 0;
+      if (result != 0)
+      {
+        return result;
+      }
+      return (std::size_t)m_size < size ? -1 : (std::size_t)m_size > size ? 1 : 0;
+    }
+
+    ADATA_INLINE int compare(const flat_string& other) const { return compare(other.m_data, other.m_size); }
+    ADATA_INLINE int compare(const std::string& other) const { return compare(other.data(), other.size()); }
+    ADATA_INLINE int compare(const char * other) const { return compare(other, std::strlen(other)); }
+
+  private:
+    const char * m_data;
+    uint32_t m_size;
+  };
+
+  // byte order of std::string, so a map is sorted the same way by the writer and the reader
+  template<typename other_ty>
+  ADATA_INLINE bool operator<(const flat_string& lhs, const other_ty& rhs) { return lhs.compare(rhs) < 0; }
+  template<typename other_ty>
+  ADATA_INLINE bool operator<(const other_ty& lhs, const flat_string& rhs) { return rhs.compare(lhs) > 0; }
+  ADATA_INLINE bool operator<(const flat_string& lhs, const flat_string& rhs) { return lhs.compare(rhs) < 0; }
+  template<typename other_ty>
+  ADATA_INLINE bool operator==(const flat_string& lhs, const other_ty& rhs) { return lhs.compare(rhs) == 0; }
+  ADATA_INLINE bool operator==(const flat_string& lhs, const flat_string& rhs) { return lhs.compare(rhs) == 0; }
+  template<typename other_ty>
+  ADATA_INLINE bool operator!=(const flat_string& lhs, const other_ty& rhs) { return lhs.compare(rhs) != 0; }
+
+  // a list of slot_ty in a flat buffer, or the elements of an array member
+  template<typename slot_ty>
+  class flat_list
+  {
+  public:
+    typedef typename slot_ty::value_type value_type;
+
+    // holds where the slots are, not the list, so it outlives a list returned by value
+    class const_iterator
+    {
+    public:
+      const_iterator(const char * base, uint32_t data, uint32_t index) : m_base(base), m_data(data), m_index(index) {}
+      ADATA_INLINE value_type operator*() const { return slot_ty::load_slot(m_base, m_data + m_index * slot_ty::slot_size); }
+      ADATA_INLINE const_iterator& operator++() { ++m_index; return *this; }
+      ADATA_INLINE bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+      ADATA_INLINE bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+    private:
+      const char * m_base;
+      uint32_t m_data;
+      uint32_t m_index;
+    };
+
+    flat_list()
+      : m_base(0)
+      , m_data(0)
+      , m_size(0)
+    {
+    }
+
+    // the list block at offset, 0 is an empty list
+    flat_list(const char * base, uint32_t offset)
+      : m_base(base)
+      , m_data(offset + flat_block_header_size)
+      , m_size(offset ? flat_load<uint32_t>(base + offset) : 0)
+    {
+    }
+
+    // count slots in a record at offset
+    flat_list(const char * base, uint32_t offset, uint32_t count)
+      : m_base(base)
+      , m_data(offset)
+      , m_size(count)
+    {
+    }
+
+    ADATA_INLINE uint32_t size() const { return m_size; }
+    ADATA_INLINE bool empty() const { return m_size == 0; }
+
+    ADATA_INLINE value_type operator[](uint32_t index) const
+    {
+      return slot_ty::load_slot(m_base, m_data + index * slot_ty::slot_size);
+    }
+
+    // the slots as they are stored, little endian numbers can be used in place
+    ADATA_INLINE const char * data() const { return m_base + m_data; }
+
+    ADATA_INLINE const_iterator begin() const { return const_iterator(m_base, m_data, 0); }
+    ADATA_INLINE const_iterator end() const { return const_iterator(m_base, m_data, m_size); }
+
+  private:
+    const char * m_base;
+    uint32_t m_data;
+    uint32_t m_size;
+  };
+
+  // a map in a flat buffer, keys are sorted so a key is found by binary search in place
+  template<typename key_slot_ty, typename value_slot_ty>
+  class flat_map
+  {
+  public:
+    typedef typename key_slot_ty::value_type key_type;
+    typedef typename value_slot_ty::value_type mapped_type;
+
+    flat_map()
+      : m_base(0)
+      , m_keys(0)
+      , m_values(0)
+      , m_size(0)
+    {
+    }
+
+    // the map block at offset, 0 is an empty map
+    flat_map(const char * base, uint32_t offset)
+      : m_base(base)
+      , m_keys(offset + flat_block_header_size)
+      , m_size(offset ? flat_load<uint32_t>(base + offset) : 0)
+    {
+      m_values = offset + flat_map_values(m_size, key_slot_ty::slot_size);
+    }
+
+    ADATA_INLINE uint32_t size() const { return m_size; }
+    ADATA_INLINE bool empty() const { return m_size == 0; }
+
+    ADATA_INLINE key_type key(uint32_t index) const
+    {
+      return key_slot_ty::load_slot(m_base, m_keys + index * key_slot_ty::slot_size);
+    }
+
+    ADATA_INLINE mapped_type value(uint32_t index) const
+    {
+      return value_slot_ty::load_slot(m_base, m_values + index * value_slot_ty::slot_size);
+    }
+
+    // index of the first key not less than key
+    template<typename key_arg_ty>
+    ADATA_INLINE uint32_t lower_bound(const key_arg_ty& key) const
+    {
+      uint32_t first = 0;
+      uint32_t count = m_size;
+      while (count > 0)
+      {
+        uint32_t step = count / 2;
+        if (this->key(first + step) < key)
+        {
+          first += step + 1;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+      return first;
+    }
+
+    // index of key, size() if it isn't in the map
+    template<typename key_arg_ty>
+    ADATA_INLINE uint32_t find(const key_arg_ty& key) const
+    {
+      uint32_t index = lower_bound(key);
+      return index < m_size && !(key < this->key(index)) ? index : m_size;
+    }
+
+    template<typename key_arg_ty>
+    ADATA_INLINE bool contains(const key_arg_ty& key) const { return find(key) != m_size; }
+
+  private:
+    const char * m_base;
+    uint32_t m_keys;
+    uint32_t m_values;
+    uint32_t m_size;
+  };
+
+  template<std::size_t bit_count>
+  class flat_bits
+  {
+  public:
+    explicit flat_bits(const char * data) : m_data((const unsigned char *)data) {}
+
+    ADATA_INLINE std::size_t size() const { return bit_count; }
+    ADATA_INLINE bool test(std::size_t index) const { return ((m_data[index >> 3] >> (index & 7)) & 1) != 0; }
+
+    ADATA_INLINE std::bitset<bit_count> to_bitset() const
+    {
+      std::bitset<bit_count> value;
+      for (std::size_t i = 0; i < bit_count; ++i)
+      {
+        value[i] = test(i);
+      }
+      return value;
+    }
+
+  private:
+    const unsigned char * m_data;
+  };
+
+  // builds a flat buffer. blocks are appended at the end and filled in by offset, pointers into
+  // the buffer don't last as it grows
+  class flat_writer
+  {
+  public:
+    flat_writer()
+      : m_buffer((std::size_t)flat_header_size, '\0')
+    {
+    }
+
+    // size zero bytes aligned to align, throw sequence_length_overflow past 4GB
+    uint32_t alloc(uint32_t size, uint32_t align)
+    {
+      uint64_t offset = ((uint64_t)m_buffer.size() + align - 1) & ~(uint64_t)(align - 1);
+      if (offset + size > 0xffffffffULL)
+      {
+        throw exception(sequence_length_overflow);
+      }
+      m_buffer.resize((std::size_t)(offset + size), '\0');
+      return (uint32_t)offset;
+    }
+
+    template<typename ty>
+    ADATA_INLINE void put(uint32_t offset, ty value)
+    {
+      flat_store(&m_buffer[offset], value);
+    }
+
+    ADATA_INLINE void put(uint32_t offset, bool value)
+    {
+      m_buffer[offset] = value ? 1 : 0;
+    }
+
+    ADATA_INLINE void set_bit(uint32_t offset, std::size_t index)
+    {
+      m_buffer[offset + (index >> 3)] |= (char)(1 << (index & 7));
+    }
+
+    // 0 for an empty string unless keep_empty, an optional one that is set
+    uint32_t add_string(const char * data, std::size_t size, bool keep_empty = false)
+    {
+      if (size == 0 && !keep_empty)
+      {
+        return 0;
+      }
+      if (size > 0xffffffffULL - flat_block_header_size - 1)
+      {
+        throw exception(sequence_length_overflow);
+      }
+      uint32_t offset = alloc((uint32_t)size + flat_block_header_size + 1, 8);
+      put(offset, (uint32_t)size);
+      if (size)
+      {
+        std::memcpy(&m_buffer[offset + flat_block_header_size], data, size);
+      }
+      return offset;
+    }
+
+    // the block of count slots, 0 if count is 0
+    uint32_t add_list(std::size_t count, uint32_t slot_size)
+    {
+      if (count == 0)
+      {
+        return 0;
+      }
+      uint32_t offset = alloc(block_size(count, slot_size, flat_block_header_size), 8);
+      put(offset, (uint32_t)count);
+      return offset;
+    }
+
+    // the block of count keys and values, 0 if count is 0
+    uint32_t add_map(std::size_t count, uint32_t key_size, uint32_t value_size)
+    {
+      if (count == 0)
+      {
+        return 0;
+      }
+      uint32_t keys = block_size(count, key_size, flat_block_header_size);
+      uint32_t offset = alloc(block_size(count, value_size, flat_align(keys, 8)), 8);
+      put(offset, (uint32_t)count);
+      return offset;
+    }
+
+    // a record of T, filled in by flat_traits<T>::write
+    template<typename T>
+    uint32_t add(const T& value)
+    {
+      uint32_t offset = alloc(flat_traits<T>::size, flat_traits<T>::align);
+      flat_traits<T>::write(*this, offset, value);
+      return offset;
+    }
+
+    // write the header for a root of T at offset, and take the buffer
+    template<typename T>
+    void finish(uint32_t root, std::string& buffer)
+    {
+      put(0, (uint32_t)flat_magic);
+      put(4, (uint32_t)flat_traits<T>::layout);
+      put(8, (uint32_t)m_buffer.size());
+      put(12, root);
+      buffer.swap(m_buffer);
+      m_buffer.assign((std::size_t)flat_header_size, '\0');
+    }
+
+    ADATA_INLINE std::size_t size() const { return m_buffer.size(); }
+
+  private:
+    static uint32_t block_size(std::size_t count, uint32_t slot_size, uint32_t header)
+    {
+      uint64_t size = (uint64_t)count * slot_size + header;
+      if (size > 0xffffffffULL)
+      {
+        throw exception(sequence_length_overflow);
+      }
+      return (uint32_t)size;
+    }
+
+    std::string m_buffer;
+  };
+
+  // checks a flat buffer from an untrusted source before it is read in place: every block in
+  // bounds, a string ended by its 0, and no more records than the buffer could hold
+  class flat_verifier
+  {
+  public:
+    flat_verifier(const char * data, uint32_t size)
+      : m_data(data)
+      , m_size(size)
+      , m_records(0)
+    {
+    }
+
+    ADATA_INLINE uint32_t ref(uint32_t offset) const
+    {
+      return flat_load<uint32_t>(m_data + offset);
+    }
+
+    // a record of size bytes at offset
+    ADATA_INLINE bool record(uint32_t offset, uint32_t size)
+    {
+      return offset >= flat_header_size && (uint64_t)offset + size <= m_size && ++m_records <= m_size;
+    }
+
+    bool string(uint32_t offset) const
+    {
+      if (offset == 0)
+      {
+        return true;
+      }
+      if (!block(offset))
+      {
+        return false;
+      }
+      uint64_t end = (uint64_t)offset + flat_block_header_size + ref(offset);
+      return end < m_size && m_data[end] == 0;
+    }
+
+    // a list block of count slots, count is 0 for an empty one
+    bool list(uint32_t offset, uint32_t slot_size, uint32_t& count) const
+    {
+      count = 0;
+      if (offset == 0)
+      {
+        return true;
+      }
+      if (!block(offset))
+      {
+        return false;
+      }
+      count = ref(offset);
+      return (uint64_t)offset + flat_block_header_size + (uint64_t)count * slot_size <= m_size;
+    }
+
+    bool map(uint32_t offset, uint32_t key_size, uint32_t value_size, uint32_t& count) const
+    {
+      count = 0;
+      if (offset == 0)
+      {
+        return true;
+      }
+      if (!block(offset))
+      {
+        return false;
+      }
+      count = ref(offset);
+      uint64_t keys = flat_block_header_size + (((uint64_t)count * key_size + 7) & ~(uint64_t)7);
+      return (uint64_t)offset + keys + (uint64_t)count * value_size <= m_size;
+    }
+
+  private:
+    ADATA_INLINE bool block(uint32_t offset) const
+    {
+      return offset >= flat_header_size && (uint64_t)offset + flat_block_header_size <= m_size;
+    }
+
+    const char * m_data;
+    uint32_t m_size;
+    uint32_t m_records;
+  };
+
+  // sorts the entries of a map by key, whatever container it is
+  struct flat_key_less
+  {
+    template<typename iterator_ty>
+    ADATA_INLINE bool operator()(const iterator_ty& lhs, const iterator_ty& rhs) const
+    {
+      return lhs->first < rhs->first;
+    }
+  };
+
+  template<typename T>
+  void flat_encode(const T& value, std::string& buffer)
+  {
+    flat_writer writer;
+    uint32_t root = writer.add(value);
+    writer.finish<T>(root, buffer);
+  }
+
+  // true if data holds a flat T written by flat_encode and all its offsets stay in size bytes
+  template<typename T>
+  bool flat_verify(const char * data, std::size_t size)
+  {
+    if (size < flat_header_size ||
+      flat_load<uint32_t>(data) != (uint32_t)flat_magic ||
+      flat_load<uint32_t>(data + 4) != (uint32_t)flat_traits<T>::layout)
+    {
+      return false;
+    }
+    uint32_t length = flat_load<uint32_t>(data + 8);
+    if (length > size || length < flat_header_size)
+    {
+      return false;
+    }
+    flat_verifier verifier(data, length);
+    return flat_traits<T>::verify(verifier, flat_load<uint32_t>(data + 12), 0);
+  }
+
+  // the root of a flat T without any check, for a buffer that is known good
+  template<typename T>
+  ADATA_INLINE typename flat_traits<T>::view_type flat_root(const char * data)
+  {
+    return typename flat_traits<T>::view_type(data, flat_load<uint32_t>(data + 12));
+  }
+
+  // the root of a flat T, throw flat_format_not_match unless flat_verify passes
+  template<typename T>
+  typename flat_traits<T>::view_type flat_open(const char * data, std::size_t size)
+  {
+    if (!flat_verify<T>(data, size))
+    {
+      throw exception(flat_format_not_match);
+    }
+    return flat_root<T>(data);
+  }
+
+  // copy a flat T out into value, to be written in the wire encoding again
+  template<typename T>
+  void flat_decode(const char * data, T& value)
+  {
+    flat_traits<T>::read(flat_root<T>(data), value);
+  }
+}
+
+#endif
@@ -0,0 +1,221 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_PATCH_HPP_HEADER_
+#define ADATA_PATCH_HPP_HEADER_
+
+#include "adata.hpp"
+
+// rewrite a member of encoded data without decoding it:
+//
+//   adata::member_patcher patcher(data, length, capacity);
+//   if (patcher.seek<player_v1>(adata::member_index<player_v1>::pos) &&
+//     patcher.seek<util::vec3>(adata::member_index<util::vec3>::x))
+//   {
+//     patcher.patch(1.0f);
+//     length = patcher.length();
+//   }
+//
+// seek uses the generated seek_member to skip the members in front. a new value of
+// the same encoded length is copied over the old one. otherwise the bytes behind it
+// are moved and only the len_tag of every enclosing type is rewritten. a member that
+// isn't in the data has no bytes to patch, it is not added: seek fails and absent()
+// tells, then the value is read, changed and written again.
+
+namespace adata
+{
+  class member_patcher
+  {
+  public:
+    enum { max_depth = 16 };
+
+    // data holds one encoded type, capacity is the room a longer value may grow into
+    member_patcher(char * data, std::size_t length, std::size_t capacity)
+      : m_data(data)
+      , m_length(length)
+      , m_capacity(capacity)
+      , m_depth(0)
+      , m_absent(false)
+    {
+      reset();
+    }
+
+    // back to the outermost type
+    ADATA_INLINE void reset()
+    {
+      m_stream.set_read(m_data, m_length);
+      m_depth = 0;
+    }
+
+    ADATA_INLINE std::size_t length() const { return m_length; }
+
+    // true if the last seek failed on a member that isn't in the data: an empty string or
+    // container, a member at its default or an unset optional. seek doesn't add it
+    ADATA_INLINE bool absent() const { return m_absent; }
+
+    // move to member index of the type at the current position. false and back to the
+    // outermost type if it isn't in the data (see absent), can't be patched or is too deep
+    template<typename T>
+    bool seek(int32_t index)
+    {
+      m_absent = false;
+      if (m_depth == max_depth)
+      {
+        reset();
+        return false;
+      }
+      m_headers[m_depth++] = m_stream.read_length();
+      bool absent = false;
+      if (!seek_member(m_stream, (T*)0, index, absent))
+      {
+        reset();
+        m_absent = absent;
+        return false;
+      }
+      return true;
+    }
+
+    // move to element index of the list at the current position, false and back to the
+    // outermost type if the list is shorter
+    template<typename T>
+    bool seek_element(int32_t index)
+    {
+      int32_t len = check_read_size(m_stream);
+      if (index < 0 || index >= len)
+      {
+        reset();
+        return false;
+      }
+      for (int32_t i = 0; i < index; ++i)
+      {
+        skip_value(m_stream, (T*)0);
+      }
+      return true;
+    }
+
+    // replace the value at the current position, T must be the member type, then reset.
+    // false if it doesn't fit the capacity
+    template<typename T>
+    bool patch(const T& value)
+    {
+      std::size_t offset = m_stream.read_length();
+      skip_value(m_stream, (T*)0);
+      std::size_t old_len = m_stream.read_length() - offset;
+      std::string encoded((std::size_t)size_of(value), '\0');
+      zero_copy_buffer stream;
+      stream.set_write(&encoded[0], encoded.size());
+      write(stream, value);
+      return splice(offset, old_len, encoded.data(), encoded.size());
+    }
+
+    // same as patch for a fix_ member
+    template<typename T>
+    bool patch_fixed(T value)
+    {
+      std::size_t offset = m_stream.read_length();
+      char encoded[sizeof(T)];
+      zero_copy_buffer stream;
+      stream.set_write(encoded, sizeof(T));
+      fix_write(stream, value);
+      m_stream.skip_read(sizeof(T));
+      return splice(offset, sizeof(T), encoded, sizeof(T));
+    }
+
+  private:
+    template<typename T>
+    static void skip_value(zero_copy_buffer& stream, T * value)
+    {
+      skip_read(stream, value);
+    }
+
+    static void skip_value(zero_copy_buffer& stream, std::string *)
+    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+
+    static void skip_value(zero_copy_buffer& stream, bytes *)
+    {
+      skip_read_bytes(stream);
+    }
+
+    bool splice(std::size_t offset, std::size_t old_len, const char * value, std::size_t new_len)
+    {
+      struct level
+      {
+        std::size_t len_pos;
+        std::size_t old_width;
+        std::size_t new_width;
+        int32_t len_tag;
+      };
+      level levels[max_depth];
+
+      // new len_tag of each enclosing type, innermost first, they may change length too
+      std::ptrdiff_t delta = (std::ptrdiff_t)new_len - (std::ptrdiff_t)old_len;
+      for (std::size_t d = m_depth; d-- > 0;)
+      {
+        level& lv = levels[d];
+        zero_copy_buffer header;
+        header.set_read(m_data + m_headers[d], m_length - m_headers[d]);
+        int64_t tag = 0;
+        read(header, tag);
+        lv.len_pos = m_headers[d] + header.read_length();
+        int32_t len_tag = 0;
+        read(header, len_tag);
+        lv.old_width = m_headers[d] + header.read_length() - lv.len_pos;
+        lv.new_width = lv.old_width;
+        lv.len_tag = len_tag;
+        if (len_tag < 0)
+        {
+          continue;
+        }
+        // same as the generated size_of: members and tag, then the len_tag itself
+        int32_t size = len_tag - (int32_t)lv.old_width + (int32_t)delta;
+        size += size_of(size + size_of(size));
+        lv.len_tag = size;
+        lv.new_width = (std::size_t)size_of(size);
+        delta += (std::ptrdiff_t)lv.new_width - (std::ptrdiff_t)lv.old_width;
+      }
+      if ((std::ptrdiff_t)m_length + delta > (std::ptrdiff_t)m_capacity)
+      {
+        reset();
+        return false;
+      }
+
+      std::size_t tail = offset + old_len;
+      std::memmove(m_data + offset + new_len, m_data + tail, m_length - tail);
+      std::memcpy(m_data + offset, value, new_len);
+      m_length = m_length - old_len + new_len;
+      for (std::size_t d = m_depth; d-- > 0;)
+      {
+        const level& lv = levels[d];
+        if (lv.len_tag < 0)
+        {
+          continue;
+        }
+        if (lv.new_width != lv.old_width)
+        {
+          std::memmove(m_data + lv.len_pos + lv.new_width, m_data + lv.len_pos + lv.old_width, m_length - lv.len_pos - lv.old_width);
+          m_length = m_length - lv.old_width + lv.new_width;
+        }
+        zero_copy_buffer stream;
+        stream.set_write(m_data + lv.len_pos, lv.new_width);
+        write(stream, lv.len_tag);
+      }
+      reset();
+      return true;
+    }
+
+    char * m_data;
+    std::size_t m_length;
+    std::size_t m_capacity;
+    zero_copy_buffer m_stream;
+    std::size_t m_headers[max_depth];
+    std::size_t m_depth;
+    bool m_absent;
+  };
+}
+
+#endif
@@ -0,0 +1,635 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_TABLE_HPP_HEADER_
+#define ADATA_TABLE_HPP_HEADER_
+
+#include "adata.hpp"
+
+#include <algorithm>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+// table pack layout, all integers little endian:
+//
+//   header  : magic(u32) version(u16) flags(u16) count(u32) bucket_count(u32) min_key(i64) max_key(i64)
+//   slots   : count * { key(i64) offset(u32) length(u32) }, sorted by key
+//   buckets : bucket_count * u32, open addressing hash of slot index + 1 (0 is empty)
+//   records : adata encoded records, slot offset is relative to here
+//
+// dense key range (max_key - min_key + 1 == count) is looked up by direct index,
+// otherwise by the hash buckets, or binary search when no bucket was written.
+
+namespace adata
+{
+  enum
+  {
+    table_magic = 0x42544441, // "ADTB"
+    table_version = 1,
+    table_flag_dense = 0x1,
+    table_flag_hashed = 0x2,
+    table_header_size = 32,
+    table_slot_size = 16,
+  };
+
+  // specialized by adatac for each "table = type(key);" declaration
+  template<typename T>
+  struct table_traits;
+
+  namespace table_detail
+  {
+    ADATA_INLINE uint32_t load_uint32(unsigned char const* ptr)
+    {
+      return (uint32_t)ptr[0] | ((uint32_t)ptr[1] << 8) | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+    }
+
+    ADATA_INLINE uint16_t load_uint16(unsigned char const* ptr)
+    {
+      return (uint16_t)(ptr[0] | (ptr[1] << 8));
+    }
+
+    ADATA_INLINE int64_t load_int64(unsigned char const* ptr)
+    {
+      return (int64_t)((uint64_t)load_uint32(ptr) | ((uint64_t)load_uint32(ptr + 4) << 32));
+    }
+
+    ADATA_INLINE void store_uint32(unsigned char * ptr, uint32_t value)
+    {
+      ptr[0] = (unsigned char)value;
+      ptr[1] = (unsigned char)(value >> 8);
+      ptr[2] = (unsigned char)(value >> 16);
+      ptr[3] = (unsigned char)(value >> 24);
+    }
+
+    ADATA_INLINE void store_uint16(unsigned char * ptr, uint16_t value)
+    {
+      ptr[0] = (unsigned char)value;
+      ptr[1] = (unsigned char)(value >> 8);
+    }
+
+    ADATA_INLINE void store_int64(unsigned char * ptr, int64_t value)
+    {
+      store_uint32(ptr, (uint32_t)(uint64_t)value);
+      store_uint32(ptr + 4, (uint32_t)((uint64_t)value >> 32));
+    }
+
+    ADATA_INLINE uint32_t hash_key(int64_t key)
+    {
+      uint64_t h = (uint64_t)key;
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ULL;
+      h ^= h >> 33;
+      return (uint32_t)h;
+    }
+  }
+
+  struct table_record
+  {
+    const char * data;
+    uint32_t length;
+  };
+
+  class table_pack
+  {
+  public:
+    static const std::size_t npos = (std::size_t)-1;
+
+    table_pack()
+      : m_data(0)
+      , m_records(0)
+      , m_count(0)
+      , m_bucket_count(0)
+      , m_flags(0)
+      , m_min_key(0)
+      , m_max_key(0)
+    {
+    }
+
+    // data must outlive the pack, throw table_format_not_match on a broken pack
+    void attach(const char * data, std::size_t length)
+    {
+      using namespace table_detail;
+      unsigned char const* ptr = (unsigned char const*)data;
+      if (length < table_header_size || load_uint32(ptr) != table_magic || load_uint16(ptr + 4) != table_version)
+      {
+        throw exception(table_format_not_match);
+      }
+      uint32_t count = load_uint32(ptr + 8);
+      uint32_t bucket_count = load_uint32(ptr + 12);
+      uint64_t records_offset = table_header_size + (uint64_t)count * table_slot_size + (uint64_t)bucket_count * 4;
+      if (records_offset > length || (bucket_count & (bucket_count - 1)) != 0)
+      {
+        throw exception(table_format_not_match);
+      }
+      std::size_t records_length = length - (std::size_t)records_offset;
+      unsigned char const* slot = ptr + table_header_size;
+      for (uint32_t i = 0; i < count; ++i, slot += table_slot_size)
+      {
+        uint64_t end = (uint64_t)load_uint32(slot + 8) + load_uint32(slot + 12);
+        if (end > records_length)
+        {
+          throw exception(table_format_not_match);
+        }
+      }
+      // a dense pack finds a key by its distance from min_key, which must then be a slot
+      uint16_t flags = load_uint16(ptr + 6);
+      int64_t min_key = load_int64(ptr + 16);
+      int64_t max_key = load_int64(ptr + 24);
+      if ((flags & table_flag_dense) && count && (uint64_t)max_key - (uint64_t)min_key != count - 1)
+      {
+        throw exception(table_format_not_match);
+      }
+      m_data = ptr;
+      m_records = ptr + records_offset;
+      m_count = count;
+      m_bucket_count = bucket_count;
+      m_flags = flags;
+      m_min_key = min_key;
+      m_max_key = max_key;
+    }
+
+    ADATA_INLINE std::size_t size() const { return m_count; }
+
+    ADATA_INLINE bool empty() const { return m_count == 0; }
+
+    ADATA_INLINE int64_t key_at(std::size_t index) const
+    {
+      return table_detail::load_int64(slot_ptr(index));
+    }
+
+    ADATA_INLINE table_record record_at(std::size_t index) const
+    {
+      unsigned char const* slot = slot_ptr(index);
+      table_record record;
+      record.data = (const char *)(m_records + table_detail::load_uint32(slot + 8));
+      record.length = table_detail::load_uint32(slot + 12);
+      return record;
+    }
+
+    ADATA_INLINE std::size_t find_index(int64_t key) const
+    {
+      if (m_count == 0 || key < m_min_key || key > m_max_key)
+      {
+        return npos;
+      }
+      if (m_flags & table_flag_dense)
+      {
+        return (std::size_t)((uint64_t)key - (uint64_t)m_min_key);
+      }
+      if (m_bucket_count)
+      {
+        unsigned char const* buckets = m_data + table_header_size + (std::size_t)m_count * table_slot_size;
+        uint32_t mask = m_bucket_count - 1;
+        uint32_t pos = table_detail::hash_key(key) & mask;
+        // every bucket at most once, a pack without an empty bucket doesn't loop forever
+        for (uint32_t probe = 0; probe < m_bucket_count; ++probe, pos = (pos + 1) & mask)
+        {
+          uint32_t index = table_detail::load_uint32(buckets + pos * 4);
+          if (index == 0 || index > m_count)
+          {
+            return npos;
+          }
+          if (key_at(index - 1) == key)
+          {
+            return index - 1;
+          }
+        }
+        return npos;
+      }
+      std::size_t first = 0;
+      std::size_t last = m_count;
+      while (first < last)
+      {
+        std::size_t mid = first + (last - first) / 2;
+        int64_t mid_key = key_at(mid);
+        if (mid_key == key)
+        {
+          return mid;
+        }
+        if (mid_key < key)
+        {
+          first = mid + 1;
+        }
+        else
+        {
+          last = mid;
+        }
+      }
+      return npos;
+    }
+
+    ADATA_INLINE bool find(int64_t key, table_record& record) const
+    {
+      std::size_t index = find_index(key);
+      if (index == npos)
+      {
+        return false;
+      }
+      record = record_at(index);
+      return true;
+    }
+
+  private:
+    ADATA_INLINE unsigned char const* slot_ptr(std::size_t index) const
+    {
+      return m_data + table_header_size + index * table_slot_size;
+    }
+
+    unsigned char const* m_data;
+    unsigned char const* m_records;
+    uint32_t m_count;
+    uint32_t m_bucket_count;
+    uint16_t m_flags;
+    int64_t m_min_key;
+    int64_t m_max_key;
+  };
+
+  template<typename T>
+  class table_view : public table_pack
+  {
+  public:
+    typedef T value_type;
+
+    // throw table_format_not_match unless the record decodes to exactly its slot length
+    ADATA_INLINE void read_at(std::size_t index, value_type& value) const
+    {
+      table_record record = record_at(index);
+      zero_copy_buffer stream;
+      stream.set_read(record.data, record.length);
+      read(stream, value);
+      if (stream.bad() || stream.read_length() != record.length)
+      {
+        throw exception(table_format_not_match);
+      }
+    }
+
+    ADATA_INLINE bool get(int64_t key, value_type& value) const
+    {
+      std::size_t index = find_index(key);
+      if (index == npos)
+      {
+        return false;
+      }
+      read_at(index, value);
+      return true;
+    }
+  };
+
+  template<typename T>
+  class table_builder
+  {
+  public:
+    typedef T value_type;
+    typedef table_traits<T> traits_type;
+
+    void add(const value_type& value)
+    {
+      int32_t length = traits_type::size_of(value);
+      entry e;
+      e.key = traits_type::key(value);
+      e.offset = (uint32_t)m_records.size();
+      e.length = (uint32_t)length;
+      m_records.resize(m_records.size() + length);
+      zero_copy_buffer stream;
+      stream.set_write(&m_records[e.offset], length);
+      write(stream, value);
+      m_entries.push_back(e);
+    }
+
+    ADATA_INLINE std::size_t size() const { return m_entries.size(); }
+
+    void clear()
+    {
+      m_entries.clear();
+      m_records.clear();
+    }
+
+    // throw table_key_duplicated if two records share one key
+    void build(std::string& pack) const
+    {
+      using namespace table_detail;
+      std::vector<entry> entries(m_entries);
+      std::sort(entries.begin(), entries.end(), entry_less());
+      for (std::size_t i = 1; i < entries.size(); ++i)
+      {
+        if (entries[i].key == entries[i - 1].key)
+        {
+          throw exception(table_key_duplicated);
+        }
+      }
+      uint32_t count = (uint32_t)entries.size();
+      uint16_t flags = 0;
+      uint32_t bucket_count = 0;
+      int64_t min_key = count ? entries.front().key : 0;
+      int64_t max_key = count ? entries.back().key : 0;
+      if (count && (uint64_t)max_key - (uint64_t)min_key == count - 1)
+      {
+        flags |= table_flag_dense;
+      }
+      else if (count)
+      {
+        flags |= table_flag_hashed;
+        bucket_count = 1;
+        while (bucket_count < count * 2)
+        {
+          bucket_count <<= 1;
+        }
+      }
+
+      std::size_t records_offset = table_header_size + (std::size_t)count * table_slot_size + (std::size_t)bucket_count * 4;
+      pack.assign(records_offset + m_records.size(), '\0');
+      unsigned char * ptr = (unsigned char *)&pack[0];
+      store_uint32(ptr, table_magic);
+      store_uint16(ptr + 4, table_version);
+      store_uint16(ptr + 6, flags);
+      store_uint32(ptr + 8, count);
+      store_uint32(ptr + 12, bucket_count);
+      store_int64(ptr + 16, min_key);
+      store_int64(ptr + 24, max_key);
+
+      unsigned char * slot = ptr + table_header_size;
+      unsigned char * buckets = slot + (std::size_t)count * table_slot_size;
+      unsigned char * records = buckets + (std::size_t)bucket_count * 4;
+      uint32_t offset = 0;
+      for (uint32_t i = 0; i < count; ++i, slot += table_slot_size)
+      {
+        const entry& e = entries[i];
+        store_int64(slot, e.key);
+        store_uint32(slot + 8, offset);
+        store_uint32(slot + 12, e.length);
+        if (e.length)
+        {
+          std::memcpy(records + offset, &m_records[e.offset], e.length);
+        }
+        offset += e.length;
+        if (bucket_count)
+        {
+          uint32_t mask = bucket_count - 1;
+          uint32_t pos = hash_key(e.key) & mask;
+          while (load_uint32(buckets + pos * 4) != 0)
+          {
+            pos = (pos + 1) & mask;
+          }
+          store_uint32(buckets + pos * 4, i + 1);
+        }
+      }
+    }
+
+  private:
+    struct entry
+    {
+      int64_t key;
+      uint32_t offset;
+      uint32_t length;
+    };
+
+    struct entry_less
+    {
+      bool operator()(const entry& lhs, const entry& rhs) const { return lhs.key < rhs.key; }
+    };
+
+    std::vector<entry> m_entries;
+    std::vector<char> m_records;
+  };
+
+  // read only memory map of a whole file
+  class mapped_file
+  {
+  public:
+    mapped_file()
+      : m_data(0)
+      , m_size(0)
+#ifdef _WIN32
+      , m_file(INVALID_HANDLE_VALUE)
+      , m_mapping(NULL)
+#endif
+    {
+    }
+
+    ~mapped_file()
+    {
+      close();
+    }
+
+    bool open(const char * path)
+    {
+      close();
+#ifdef _WIN32
+      m_file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (m_file == INVALID_HANDLE_VALUE)
+      {
+        return false;
+      }
+      LARGE_INTEGER file_size;
+      if (!::GetFileSizeEx(m_file, &file_size) || file_size.QuadPart == 0)
+      {
+        close();
+        return false;
+      }
+      m_mapping = ::CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (m_mapping == NULL)
+      {
+        close();
+        return false;
+      }
+      m_data = (const char *)::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+      if (m_data == NULL)
+      {
+        close();
+        return false;
+      }
+      m_size = (std::size_t)file_size.QuadPart;
+#else
+      int fd = ::open(path, O_RDONLY);
+      if (fd < 0)
+      {
+        return false;
+      }
+      struct stat st;
+      if (::fstat(fd, &st) != 0 || st.st_size == 0)
+      {
+        ::close(fd);
+        return false;
+      }
+      void * addr = ::mmap(0, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (addr == MAP_FAILED)
+      {
+        return false;
+      }
+      m_data = (const char *)addr;
+      m_size = (std::size_t)st.st_size;
+#endif
+      return true;
+    }
+
+    void close()
+    {
+#ifdef _WIN32
+      if (m_data)
+      {
+        ::UnmapViewOfFile(m_data);
+      }
+      if (m_mapping != NULL)
+      {
+        ::CloseHandle(m_mapping);
+        m_mapping = NULL;
+      }
+      if (m_file != INVALID_HANDLE_VALUE)
+      {
+        ::CloseHandle(m_file);
+        m_file = INVALID_HANDLE_VALUE;
+      }
+#else
+      if (m_data)
+      {
+        ::munmap((void *)m_data, m_size);
+      }
+#endif
+      m_data = 0;
+      m_size = 0;
+    }
+
+    ADATA_INLINE const char * data() const { return m_data; }
+    ADATA_INLINE std::size_t size() const { return m_size; }
+    ADATA_INLINE bool is_open() const { return m_data != 0; }
+
+  private:
+    mapped_file(const mapped_file&);
+    mapped_file& operator=(const mapped_file&);
+
+    const char * m_data;
+    std::size_t m_size;
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#endif
+  };
+
+  // table over a mapped pack file (or caller owned memory), records are decoded on first lookup
+  template<typename T>
+  class table
+  {
+  public:
+    typedef T value_type;
+
+    table()
+    {
+    }
+
+    ~table()
+    {
+      reset_cache();
+    }
+
+    // return false if the file can't be mapped, throw table_format_not_match on a broken pack
+    bool open(const char * path)
+    {
+      close();
+      if (!m_file.open(path))
+      {
+        return false;
+      }
+      try
+      {
+        m_view.attach(m_file.data(), m_file.size());
+      }
+      catch (...)
+      {
+        m_file.close();
+        throw;
+      }
+      m_cache.resize(m_view.size(), (value_type *)0);
+      return true;
+    }
+
+    // data must outlive the table
+    void attach(const char * data, std::size_t length)
+    {
+      close();
+      m_view.attach(data, length);
+      m_cache.resize(m_view.size(), (value_type *)0);
+    }
+
+    void close()
+    {
+      reset_cache();
+      m_view = table_view<value_type>();
+      m_file.close();
+    }
+
+    ADATA_INLINE std::size_t size() const { return m_view.size(); }
+
+    ADATA_INLINE const table_view<value_type>& view() const { return m_view; }
+
+    // return null if key not found
+    const value_type * find(int64_t key)
+    {
+      std::size_t index = m_view.find_index(key);
+      if (index == table_pack::npos)
+      {
+        return 0;
+      }
+      return &at(index);
+    }
+
+    const value_type& at(std::size_t index)
+    {
+      value_type *& value = m_cache[index];
+      if (value == 0)
+      {
+        value_type * decoded = new value_type();
+        try
+        {
+          m_view.read_at(index, *decoded);
+        }
+        catch (...)
+        {
+          delete decoded;
+          throw;
+        }
+        value = decoded;
+      }
+      return *value;
+    }
+
+    // decode every record now, e.g. before sharing the table between threads
+    void decode_all()
+    {
+      for (std::size_t i = 0; i < m_cache.size(); ++i)
+      {
+        at(i);
+      }
+    }
+
+  private:
+    table(const table&);
+    table& operator=(const table&);
+
+    void reset_cache()
+    {
+      for (std::size_t i = 0; i < m_cache.size(); ++i)
+      {
+        delete m_cache[i];
+      }
+      m_cache.clear();
+    }
+
+    mapped_file m_file;
+    table_view<value_type> m_view;
+    std::vector<value_type *> m_cache;
+  };
+}
+
+#endif
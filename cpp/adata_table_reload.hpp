@@ -0,0 +1,452 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_TABLE_RELOAD_HPP_HEADER_
+#define ADATA_TABLE_RELOAD_HPP_HEADER_
+
+#if !defined(_MSC_VER) && __cplusplus < 201103L
+# error "adata_table_reload.hpp requires C++11"
+#endif
+
+#include "adata_table.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+// hot reload of config tables:
+//
+// readers get the current snapshot with one atomic load after announcing the
+// global epoch in their own slot, no lock is taken on the read path. a background
+// thread reads and fully decodes a new pack, then swaps the snapshot pointer.
+// a replaced snapshot is retired with the epoch of the swap and deleted once every
+// reader slot is idle or has announced a later epoch.
+
+namespace adata
+{
+  // a fully decoded, immutable table version, safe to share between threads
+  template<typename T>
+  class table_snapshot
+  {
+  public:
+    typedef T value_type;
+
+    // decode every record now, throw table_format_not_match on a broken pack or record
+    table_snapshot(std::string pack, uint64_t version)
+      : m_pack(std::move(pack))
+      , m_version(version)
+    {
+      m_view.attach(m_pack.data(), m_pack.size());
+      m_values.resize(m_view.size());
+      for (std::size_t i = 0; i < m_values.size(); ++i)
+      {
+        m_view.read_at(i, m_values[i]);
+      }
+    }
+
+    // return null if key not found
+    ADATA_INLINE const value_type * find(int64_t key) const
+    {
+      std::size_t index = m_view.find_index(key);
+      return index == table_pack::npos ? nullptr : &m_values[index];
+    }
+
+    ADATA_INLINE const value_type& at(std::size_t index) const { return m_values[index]; }
+    ADATA_INLINE int64_t key_at(std::size_t index) const { return m_view.key_at(index); }
+    ADATA_INLINE std::size_t size() const { return m_values.size(); }
+    ADATA_INLINE uint64_t version() const { return m_version; }
+
+  private:
+    table_snapshot(const table_snapshot&);
+    table_snapshot& operator=(const table_snapshot&);
+
+    std::string m_pack;
+    table_view<value_type> m_view;
+    std::vector<value_type> m_values;
+    uint64_t m_version;
+  };
+
+  template<typename T>
+  class versioned_table
+  {
+    enum { idle_epoch = 0, cache_line_size = 64 };
+
+    struct reader_slot
+    {
+      std::atomic<uint64_t> epoch;
+      std::atomic<bool> used;
+      char padding[cache_line_size - sizeof(std::atomic<uint64_t>) - sizeof(std::atomic<bool>)];
+    };
+
+    struct retired
+    {
+      const table_snapshot<T> * snapshot;
+      uint64_t epoch;
+    };
+
+  public:
+    typedef T value_type;
+    typedef table_snapshot<T> snapshot_type;
+    // called on the reload thread, error is null on success
+    typedef std::function<void(uint64_t version, const std::exception * error)> reload_callback;
+
+    // one per reader thread, owns an epoch slot of the table
+    class reader
+    {
+    public:
+      explicit reader(versioned_table& table)
+        : m_table(table)
+        , m_slot(table.claim_slot())
+        , m_depth(0)
+      {
+      }
+
+      ~reader()
+      {
+        m_slot->epoch.store(idle_epoch, std::memory_order_release);
+        m_slot->used.store(false, std::memory_order_release);
+      }
+
+      // snapshot stays valid until the matching release(), calls may nest
+      ADATA_INLINE const snapshot_type * acquire()
+      {
+        if (m_depth++ == 0)
+        {
+          m_slot->epoch.store(m_table.m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+        return m_table.m_current.load(std::memory_order_seq_cst);
+      }
+
+      ADATA_INLINE void release()
+      {
+        if (--m_depth == 0)
+        {
+          m_slot->epoch.store(idle_epoch, std::memory_order_release);
+        }
+      }
+
+    private:
+      reader(const reader&);
+      reader& operator=(const reader&);
+
+      versioned_table& m_table;
+      reader_slot * m_slot;
+      std::size_t m_depth;
+    };
+
+    class guard
+    {
+    public:
+      explicit guard(reader& r)
+        : m_reader(r)
+        , m_snapshot(r.acquire())
+      {
+      }
+
+      ~guard()
+      {
+        m_reader.release();
+      }
+
+      ADATA_INLINE const snapshot_type * get() const { return m_snapshot; }
+      ADATA_INLINE const snapshot_type * operator->() const { return m_snapshot; }
+      ADATA_INLINE explicit operator bool() const { return m_snapshot != nullptr; }
+
+    private:
+      guard(const guard&);
+      guard& operator=(const guard&);
+
+      reader& m_reader;
+      const snapshot_type * m_snapshot;
+    };
+
+    explicit versioned_table(std::size_t max_readers = 64)
+      : m_slot_storage(new char[sizeof(reader_slot) * max_readers + cache_line_size])
+      , m_slots(nullptr)
+      , m_slot_count(max_readers)
+      , m_current(nullptr)
+      , m_epoch(1)
+      , m_next_version(0)
+      , m_published_version(0)
+      , m_pending_is_file(false)
+      , m_has_pending(false)
+      , m_stop(false)
+    {
+      // one cache line per slot, readers never share a line
+      std::size_t misalign = (std::size_t)m_slot_storage % cache_line_size;
+      m_slots = (reader_slot *)(m_slot_storage + (misalign ? cache_line_size - misalign : 0));
+      for (std::size_t i = 0; i < m_slot_count; ++i)
+      {
+        new (&m_slots[i]) reader_slot();
+        m_slots[i].epoch.store(idle_epoch, std::memory_order_relaxed);
+        m_slots[i].used.store(false, std::memory_order_relaxed);
+      }
+      m_worker = std::thread(&versioned_table::reload_loop, this);
+    }
+
+    // all readers must be gone
+    ~versioned_table()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_cv.notify_all();
+      m_worker.join();
+      for (auto& r : m_retired)
+      {
+        delete r.snapshot;
+      }
+      delete m_current.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < m_slot_count; ++i)
+      {
+        m_slots[i].~reader_slot();
+      }
+      delete[] m_slot_storage;
+    }
+
+    // decode and publish on the calling thread, throw on a broken pack
+    uint64_t load_pack(std::string pack)
+    {
+      uint64_t version = m_next_version.fetch_add(1, std::memory_order_relaxed) + 1;
+      const snapshot_type * snapshot = new snapshot_type(std::move(pack), version);
+      std::lock_guard<std::mutex> publish_lock(m_publish_mutex);
+      publish(snapshot);
+      return version;
+    }
+
+    // return 0 if the file can't be read
+    uint64_t load_file(const std::string& path)
+    {
+      std::string pack;
+      if (!read_file(path, pack))
+      {
+        return 0;
+      }
+      return load_pack(std::move(pack));
+    }
+
+    // queue a reload on the background thread, a newer request replaces a pending one
+    void reload_pack(std::string pack)
+    {
+      queue_reload(std::move(pack), false);
+    }
+
+    void reload_file(const std::string& path)
+    {
+      queue_reload(path, true);
+    }
+
+    void set_reload_callback(reload_callback callback)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_callback = std::move(callback);
+    }
+
+    // version of the last published snapshot, 0 if none
+    uint64_t version() const
+    {
+      return m_published_version.load(std::memory_order_acquire);
+    }
+
+    // number of replaced snapshots still waiting for readers to quiesce
+    std::size_t retired_count()
+    {
+      std::lock_guard<std::mutex> publish_lock(m_publish_mutex);
+      return m_retired.size();
+    }
+
+  private:
+    versioned_table(const versioned_table&);
+    versioned_table& operator=(const versioned_table&);
+
+    reader_slot * claim_slot()
+    {
+      for (std::size_t i = 0; i < m_slot_count; ++i)
+      {
+        bool expected = false;
+        if (m_slots[i].used.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+          return &m_slots[i];
+        }
+      }
+      throw exception(table_reader_overflow);
+    }
+
+    static bool read_file(const std::string& path, std::string& data)
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs)
+      {
+        return false;
+      }
+      ifs.seekg(0, std::ios::end);
+      std::streamoff size = ifs.tellg();
+      if (size < 0)
+      {
+        return false;
+      }
+      ifs.seekg(0, std::ios::beg);
+      data.resize((std::size_t)size);
+      if (size > 0)
+      {
+        ifs.read(&data[0], size);
+      }
+      return ifs.good();
+    }
+
+    // must hold m_publish_mutex
+    void publish(const snapshot_type * snapshot)
+    {
+      // a slower concurrent load must not replace a newer version
+      if (snapshot->version() < m_published_version.load(std::memory_order_relaxed))
+      {
+        delete snapshot;
+        return;
+      }
+      const snapshot_type * old = m_current.exchange(snapshot, std::memory_order_seq_cst);
+      m_published_version.store(snapshot->version(), std::memory_order_release);
+      if (old != nullptr)
+      {
+        retired r;
+        r.snapshot = old;
+        r.epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        m_retired.push_back(r);
+      }
+      reclaim();
+    }
+
+    // must hold m_publish_mutex
+    void reclaim()
+    {
+      if (m_retired.empty())
+      {
+        return;
+      }
+      uint64_t min_epoch = UINT64_MAX;
+      for (std::size_t i = 0; i < m_slot_count; ++i)
+      {
+        uint64_t epoch = m_slots[i].epoch.load(std::memory_order_seq_cst);
+        if (epoch != idle_epoch && epoch < min_epoch)
+        {
+          min_epoch = epoch;
+        }
+      }
+      std::size_t keep = 0;
+      for (std::size_t i = 0; i < m_retired.size(); ++i)
+      {
+        // readers announced after the swap can only see a newer snapshot
+        if (m_retired[i].epoch < min_epoch)
+        {
+          delete m_retired[i].snapshot;
+        }
+        else
+        {
+          m_retired[keep++] = m_retired[i];
+        }
+      }
+      m_retired.resize(keep);
+    }
+
+    void queue_reload(std::string data, bool is_file)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending = std::move(data);
+        m_pending_is_file = is_file;
+        m_has_pending = true;
+      }
+      m_cv.notify_one();
+    }
+
+    void reload_loop()
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (!m_stop)
+      {
+        if (!m_has_pending)
+        {
+          if (retired_count() != 0)
+          {
+            m_cv.wait_for(lock, std::chrono::milliseconds(10));
+            lock.unlock();
+            {
+              std::lock_guard<std::mutex> publish_lock(m_publish_mutex);
+              reclaim();
+            }
+            lock.lock();
+          }
+          else
+          {
+            m_cv.wait(lock);
+          }
+          continue;
+        }
+        std::string data = std::move(m_pending);
+        bool is_file = m_pending_is_file;
+        m_has_pending = false;
+        reload_callback callback = m_callback;
+        lock.unlock();
+
+        uint64_t version = 0;
+        try
+        {
+          if (is_file)
+          {
+            std::string pack;
+            if (!read_file(data, pack))
+            {
+              throw std::runtime_error("can't read table file " + data);
+            }
+            data.swap(pack);
+          }
+          version = load_pack(std::move(data));
+          if (callback)
+          {
+            callback(version, nullptr);
+          }
+        }
+        catch (std::exception& e)
+        {
+          if (callback)
+          {
+            callback(version, &e);
+          }
+        }
+        lock.lock();
+      }
+    }
+
+    char * m_slot_storage;
+    reader_slot * m_slots;
+    std::size_t m_slot_count;
+    std::atomic<const snapshot_type *> m_current;
+    std::atomic<uint64_t> m_epoch;
+
+    // writer side
+    std::atomic<uint64_t> m_next_version;
+    std::atomic<uint64_t> m_published_version;
+    std::mutex m_publish_mutex;
+    std::vector<retired> m_retired;
+
+    // reload thread
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::string m_pending;
+    bool m_pending_is_file;
+    bool m_has_pending;
+    bool m_stop;
+    reload_callback m_callback;
+    std::thread m_worker;
+  };
+}
+
+#endif
@@ -0,0 +1,238 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_TRANSCODE_HPP_HEADER_
+#define ADATA_TRANSCODE_HPP_HEADER_
+
+#include "adata.hpp"
+
+// schema migration on encoded bytes:
+//
+// "transcode = player_v1 : player_v2;" in an adl makes adatac specialize
+// adata::transcoder< player_v1, player_v2 >. it reads the tag of a player_v1,
+// copies the bytes of every member that player_v2 keeps under the same name,
+// drops deleted and unknown members, and writes a new tag and len_tag. only nested
+// types that differ between the two versions are transcoded member by member.
+
+namespace adata
+{
+  // specialized by generated code
+  template<typename from_ty, typename to_ty>
+  struct transcoder;
+
+  // growable output of a transcoder, adjacent copies of the input are merged
+  class transcode_buffer
+  {
+  public:
+    // tag (9 bytes) + len_tag (5 bytes) at most
+    enum { max_header_size = 14 };
+    // int32 varint at most
+    enum { max_sized_size = 5 };
+
+    transcode_buffer()
+      : m_copy_ptr(0)
+      , m_copy_len(0)
+    {
+    }
+
+    ADATA_INLINE void clear()
+    {
+      m_data.clear();
+      m_copy_ptr = 0;
+      m_copy_len = 0;
+    }
+
+    ADATA_INLINE void reserve(std::size_t len) { m_data.reserve(len); }
+
+    ADATA_INLINE const std::string& data()
+    {
+      flush();
+      return m_data;
+    }
+
+    ADATA_INLINE std::size_t size() const { return m_data.size() + m_copy_len; }
+
+    ADATA_INLINE void append(const unsigned char * ptr, std::size_t len)
+    {
+      if (m_copy_ptr + m_copy_len == ptr)
+      {
+        m_copy_len += len;
+        return;
+      }
+      flush();
+      m_copy_ptr = ptr;
+      m_copy_len = len;
+    }
+
+    template<typename ty>
+    ADATA_INLINE void write_value(ty value)
+    {
+      flush();
+      char buffer[max_header_size];
+      zero_copy_buffer stream;
+      stream.set_write(buffer, sizeof(buffer));
+      write(stream, value);
+      m_data.append(buffer, stream.write_length());
+    }
+
+    template<typename ty>
+    ADATA_INLINE void fix_write_value(ty value)
+    {
+      flush();
+      char buffer[sizeof(ty)];
+      zero_copy_buffer stream;
+      stream.set_write(buffer, sizeof(buffer));
+      fix_write(stream, value);
+      m_data.append(buffer, sizeof(buffer));
+    }
+
+    // a list of a [delta], [delta2] or [rle] member, see adata::write_list
+    template<typename list_ty>
+    ADATA_INLINE void write_list(const list_ty& value, int encoding)
+    {
+      flush();
+      std::size_t pos = m_data.size();
+      m_data.resize(pos + (std::size_t)size_of_list(value, encoding));
+      zero_copy_buffer stream;
+      stream.set_write(&m_data[pos], m_data.size() - pos);
+      adata::write_list(stream, value, encoding);
+    }
+
+    // room for len bytes the caller writes through stream, the decoded elements of a list
+    ADATA_INLINE void reserve_write(zero_copy_buffer& stream, std::size_t len)
+    {
+      flush();
+      std::size_t pos = m_data.size();
+      m_data.resize(pos + len);
+      stream.set_write(&m_data[pos], len);
+    }
+
+    // reserve room for the header of a type, return its position
+    ADATA_INLINE std::size_t begin_type()
+    {
+      flush();
+      std::size_t header = m_data.size();
+      m_data.append((std::size_t)max_header_size, '\0');
+      return header;
+    }
+
+    // presence of members 63 and up of a wide type, in front of member 63
+    ADATA_INLINE void write_ext_tag(const uint64_t * words, std::size_t count)
+    {
+      flush();
+      std::size_t pos = m_data.size();
+      m_data.resize(pos + (std::size_t)size_of_ext_tag(words, count));
+      zero_copy_buffer stream;
+      stream.set_write(&m_data[pos], m_data.size() - pos);
+      adata::write_ext_tag(stream, words, count);
+    }
+
+    // write tag and len_tag in front of the members written since begin_type
+    ADATA_INLINE void end_type(std::size_t header, uint64_t tag)
+    {
+      flush();
+      std::size_t body = m_data.size() - header - max_header_size;
+      int32_t size = (int32_t)body + size_of(tag);
+      size += size_of(size + size_of(size));
+      char buffer[max_header_size];
+      zero_copy_buffer stream;
+      stream.set_write(buffer, sizeof(buffer));
+      write(stream, tag);
+      write(stream, size);
+      std::size_t header_len = stream.write_length();
+      std::memcpy(&m_data[header], buffer, header_len);
+      if (header_len < (std::size_t)max_header_size)
+      {
+        std::memmove(&m_data[header + header_len], &m_data[header + max_header_size], body);
+        m_data.resize(header + header_len + body);
+      }
+    }
+
+    // reserve room for the byte length of a [sized] list or map, return its position
+    ADATA_INLINE std::size_t begin_sized()
+    {
+      flush();
+      std::size_t header = m_data.size();
+      m_data.append((std::size_t)max_sized_size, '\0');
+      return header;
+    }
+
+    // write the byte length of what was written since begin_sized
+    ADATA_INLINE void end_sized(std::size_t header)
+    {
+      flush();
+      std::size_t body = m_data.size() - header - max_sized_size;
+      char buffer[max_sized_size];
+      zero_copy_buffer stream;
+      stream.set_write(buffer, sizeof(buffer));
+      write(stream, (int32_t)body);
+      std::size_t header_len = stream.write_length();
+      std::memcpy(&m_data[header], buffer, header_len);
+      if (header_len < (std::size_t)max_sized_size)
+      {
+        std::memmove(&m_data[header + header_len], &m_data[header + max_sized_size], body);
+        m_data.resize(header + header_len + body);
+      }
+    }
+
+  private:
+    ADATA_INLINE void flush()
+    {
+      if (m_copy_len)
+      {
+        m_data.append((const char *)m_copy_ptr, m_copy_len);
+        m_copy_len = 0;
+      }
+      m_copy_ptr = 0;
+    }
+
+    std::string m_data;
+    const unsigned char * m_copy_ptr;
+    std::size_t m_copy_len;
+  };
+
+  typedef void (*transcode_function)(zero_copy_buffer& stream, transcode_buffer& out);
+
+  template<typename from_ty, typename to_ty>
+  ADATA_INLINE void transcode(zero_copy_buffer& stream, transcode_buffer& out)
+  {
+    transcoder<from_ty, to_ty>::transcode(stream, out);
+  }
+
+  // encoded length of the type at data, from its len_tag
+  ADATA_INLINE std::size_t record_length(const char * data, std::size_t len)
+  {
+    zero_copy_buffer stream;
+    stream.set_read(data, len);
+    int64_t tag = 0;
+    read(stream, tag);
+    int32_t len_tag = 0;
+    read(stream, len_tag);
+    if (len_tag < (int32_t)stream.read_length() || (std::size_t)len_tag > len)
+    {
+      throw exception(stream_buffer_overflow);
+    }
+    return (std::size_t)len_tag;
+  }
+
+  // transcode back to back records, return the record count
+  inline std::size_t transcode_records(const char * data, std::size_t len, transcode_buffer& out, transcode_function func)
+  {
+    std::size_t count = 0;
+    zero_copy_buffer stream;
+    while (len > 0)
+    {
+      std::size_t record_len = record_length(data, len);
+      stream.set_read(data, record_len);
+      func(stream, out);
+      data += record_len;
+      len -= record_len;
+      ++count;
+    }
+    return count;
+  }
+}
+
+#endif
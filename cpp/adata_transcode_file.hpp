@@ -0,0 +1,187 @@
+// (C) Copyright Ning Ding 2014.8
+// lordoffox@gmail.com
+// Distributed under the boost Software License, Version 1.0. (See accompany-
+// ing file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef ADATA_TRANSCODE_FILE_HPP_HEADER_
+#define ADATA_TRANSCODE_FILE_HPP_HEADER_
+
+#if !defined(_MSC_VER) && __cplusplus < 201103L
+# error "adata_transcode_file.hpp requires C++11"
+#endif
+
+#include "adata_transcode.hpp"
+#include "adata_table.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// transcode a file of back to back records on all cores:
+//
+// the input is mapped and cut into chunks at record boundaries, worker threads
+// transcode chunks into their own buffers and the calling thread writes them out
+// in input order. at most two chunks per worker are in flight, so memory stays
+// bounded however large the file is.
+
+namespace adata
+{
+  struct transcode_file_stats
+  {
+    std::size_t records;
+    std::size_t read_bytes;
+    std::size_t write_bytes;
+
+    transcode_file_stats() : records(0), read_bytes(0), write_bytes(0) {}
+  };
+
+  // return false if a file can't be opened, throw on a broken record
+  inline bool transcode_file(const std::string& in_path, const std::string& out_path, transcode_function func,
+    transcode_file_stats * stats = nullptr, unsigned threads = 0, std::size_t chunk_size = 4 * 1024 * 1024)
+  {
+    mapped_file input;
+    if (!input.open(in_path.c_str()))
+    {
+      return false;
+    }
+    std::ofstream output(out_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!output)
+    {
+      return false;
+    }
+    if (threads == 0)
+    {
+      threads = std::thread::hardware_concurrency();
+      if (threads == 0) threads = 1;
+    }
+
+    struct chunk
+    {
+      std::string data;
+      std::size_t records;
+    };
+
+    const char * data = input.data();
+    const std::size_t size = input.size();
+    const std::size_t window = threads * 2;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t next_offset = 0;
+    std::size_t next_index = 0;
+    std::size_t written = 0;
+    std::map<std::size_t, chunk> done;
+    std::exception_ptr error;
+
+    auto work = [&]()
+    {
+      transcode_buffer out;
+      for (;;)
+      {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::size_t index = 0;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv.wait(lock, [&]{ return error || next_offset == size || next_index < written + window; });
+          if (error || next_offset == size)
+          {
+            return;
+          }
+          // cut at the first record boundary after chunk_size bytes
+          begin = next_offset;
+          end = begin;
+          try
+          {
+            do
+            {
+              end += record_length(data + end, size - end);
+            } while (end < size && end - begin < chunk_size);
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+            cv.notify_all();
+            return;
+          }
+          next_offset = end;
+          index = next_index++;
+        }
+
+        chunk c;
+        try
+        {
+          out.clear();
+          out.reserve(end - begin + (end - begin) / 4);
+          c.records = transcode_records(data + begin, end - begin, out, func);
+          c.data = out.data();
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!error) error = std::current_exception();
+          cv.notify_all();
+          return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        done[index] = std::move(c);
+        cv.notify_all();
+      }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; ++i)
+    {
+      workers.emplace_back(work);
+    }
+
+    transcode_file_stats result;
+    result.read_bytes = size;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      for (;;)
+      {
+        cv.wait(lock, [&]{ return error || done.count(written) || (next_offset == size && written == next_index); });
+        if (error || (next_offset == size && written == next_index))
+        {
+          break;
+        }
+        chunk c = std::move(done[written]);
+        done.erase(written);
+        lock.unlock();
+        output.write(c.data.data(), (std::streamsize)c.data.size());
+        result.records += c.records;
+        result.write_bytes += c.data.size();
+        lock.lock();
+        ++written;
+        cv.notify_all();
+      }
+    }
+    for (auto& t : workers)
+    {
+      t.join();
+    }
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+    output.close();
+    if (stats)
+    {
+      *stats = result;
+    }
+    return !output.fail();
+  }
+
+  template<typename from_ty, typename to_ty>
+  ADATA_INLINE bool transcode_file(const std::string& in_path, const std::string& out_path,
+    transcode_file_stats * stats = nullptr, unsigned threads = 0)
+  {
+    return transcode_file(in_path, out_path, &transcoder<from_ty, to_ty>::transcode, stats, threads);
+  }
+}
+
+#endif
@@ -0,0 +1,105 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+// reading a few fields of stored records: decoding each one from the wire encoding against
+// reading them in place from a flat buffer
+
+#include <my/game/config.adl.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  my::game::skill_config make_skill(int32_t i)
+  {
+    my::game::skill_config skill;
+    skill.id = i;
+    skill.name = "skill of the ancient order";
+    skill.cooldown = 1.5f + (float)(i % 7);
+    for (int32_t e = 0; e < 8; ++e)
+    {
+      skill.effects.push_back(i * 8 + e);
+    }
+    return skill;
+  }
+}
+
+int bench_flat(int argc, char ** argv)
+{
+  int32_t records = argc > 0 ? std::atoi(argv[0]) : 10000;
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 20;
+  if (records <= 0 || rounds <= 0)
+  {
+    std::cerr << "bad argument" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::string> wire((std::size_t)records);
+  std::vector<std::string> flat((std::size_t)records);
+  std::size_t wire_bytes = 0;
+  std::size_t flat_bytes = 0;
+  for (int32_t i = 0; i < records; ++i)
+  {
+    my::game::skill_config skill = make_skill(i);
+    std::string& buffer = wire[(std::size_t)i];
+    buffer.resize((std::size_t)adata::size_of(skill));
+    adata::zero_copy_buffer stream;
+    stream.set_write(&buffer[0], buffer.size());
+    adata::write(stream, skill);
+    adata::flat_encode(skill, flat[(std::size_t)i]);
+    wire_bytes += buffer.size();
+    flat_bytes += flat[(std::size_t)i].size();
+  }
+
+  // the cooldown and the last effect of every record
+  double wire_sum = 0;
+  my::game::skill_config skill;
+  auto start = clock_type::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (auto const& buffer : wire)
+    {
+      adata::zero_copy_buffer stream;
+      stream.set_read(buffer.data(), buffer.size());
+      adata::read(stream, skill);
+      wire_sum += skill.cooldown + skill.effects.back();
+    }
+  }
+  auto wire_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+
+  double flat_sum = 0;
+  start = clock_type::now();
+  for (int r = 0; r < rounds; ++r)
+  {
+    for (auto const& buffer : flat)
+    {
+      my::game::skill_config_flat view = adata::flat_root<my::game::skill_config>(buffer.data());
+      adata::flat_list< adata::flat_scalar<int32_t> > effects = view.effects();
+      flat_sum += view.cooldown() + effects[effects.size() - 1];
+    }
+  }
+  auto flat_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+
+  double reads = (double)rounds * (double)records;
+  std::cout << "records: " << records << ", rounds: " << rounds << std::endl;
+  std::cout << "wire " << (double)wire_bytes / records << " bytes/record, decode " << (double)wire_ns / reads << "ns" << std::endl;
+  std::cout << "flat " << (double)flat_bytes / records << " bytes/record, in place " << (double)flat_ns / reads << "ns" << std::endl;
+  if (wire_sum != flat_sum)
+  {
+    std::cout << "mismatch" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,177 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+// reader latency of adata::versioned_table while packs are reloaded in background
+
+#include <my/game/config.adl.h>
+#include <adata_table_reload.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  // log2 buckets of nanoseconds
+  struct latency_histogram
+  {
+    enum { bucket_count = 40 };
+    uint64_t buckets[bucket_count];
+    uint64_t max_ns;
+
+    latency_histogram() : max_ns(0)
+    {
+      for (auto& b : buckets) b = 0;
+    }
+
+    void add(uint64_t ns)
+    {
+      int b = 0;
+      while ((ns >> b) > 1 && b < bucket_count - 1) ++b;
+      ++buckets[b];
+      if (ns > max_ns) max_ns = ns;
+    }
+
+    void merge(const latency_histogram& other)
+    {
+      for (int i = 0; i < bucket_count; ++i) buckets[i] += other.buckets[i];
+      if (other.max_ns > max_ns) max_ns = other.max_ns;
+    }
+
+    uint64_t total() const
+    {
+      uint64_t n = 0;
+      for (auto b : buckets) n += b;
+      return n;
+    }
+
+    // upper bound of the bucket holding the percentile
+    uint64_t percentile(double p) const
+    {
+      uint64_t target = (uint64_t)(total() * p);
+      uint64_t n = 0;
+      for (int i = 0; i < bucket_count; ++i)
+      {
+        n += buckets[i];
+        if (n > target) return 2ULL << i;
+      }
+      return max_ns;
+    }
+  };
+
+  std::string make_pack(int32_t records, int32_t generation)
+  {
+    adata::table_builder<my::game::item_config> builder;
+    for (int32_t i = 0; i < records; ++i)
+    {
+      my::game::item_config item;
+      item.id = i;
+      item.name = "item";
+      item.level = generation;
+      item.price = i * 10;
+      builder.add(item);
+    }
+    std::string pack;
+    builder.build(pack);
+    return pack;
+  }
+}
+
+int bench_reload(int argc, char ** argv)
+{
+  int readers = argc > 0 ? std::atoi(argv[0]) : 4;
+  int seconds = argc > 1 ? std::atoi(argv[1]) : 3;
+  int reload_ms = argc > 2 ? std::atoi(argv[2]) : 5;
+  int32_t records = argc > 3 ? std::atoi(argv[3]) : 10000;
+  if (readers <= 0 || seconds <= 0 || reload_ms <= 0 || records <= 0)
+  {
+    std::cerr << "bad argument" << std::endl;
+    return 1;
+  }
+
+  // build packs before timing, the reload thread only decodes and publishes
+  std::vector<std::string> packs;
+  for (int32_t g = 0; g < 4; ++g)
+  {
+    packs.push_back(make_pack(records, g));
+  }
+
+  adata::versioned_table<my::game::item_config> table(readers + 1);
+  table.load_pack(packs[0]);
+
+  std::atomic<bool> stop(false);
+  std::atomic<uint64_t> reloads(0);
+  table.set_reload_callback([&](uint64_t, const std::exception * error)
+  {
+    if (error == nullptr) ++reloads;
+  });
+
+  std::vector<latency_histogram> histograms(readers);
+  std::vector<uint64_t> checksums(readers, 0);
+  std::vector<std::thread> threads;
+  for (int r = 0; r < readers; ++r)
+  {
+    threads.emplace_back([&, r]()
+    {
+      adata::versioned_table<my::game::item_config>::reader reader(table);
+      latency_histogram& hist = histograms[r];
+      uint64_t sum = 0;
+      uint32_t key = (uint32_t)r * 7919;
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        key = key * 1103515245 + 12345;
+        auto start = clock_type::now();
+        {
+          adata::versioned_table<my::game::item_config>::guard snapshot(reader);
+          const my::game::item_config * item = snapshot->find((int64_t)(key % (uint32_t)records));
+          sum += item ? (uint64_t)item->price + (uint64_t)item->level : 0;
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+        hist.add((uint64_t)ns);
+      }
+      checksums[r] = sum;
+    });
+  }
+
+  auto deadline = clock_type::now() + std::chrono::seconds(seconds);
+  for (std::size_t g = 1; clock_type::now() < deadline; ++g)
+  {
+    table.reload_pack(packs[g % packs.size()]);
+    std::this_thread::sleep_for(std::chrono::milliseconds(reload_ms));
+  }
+  stop = true;
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+
+  latency_histogram all;
+  for (auto const& h : histograms)
+  {
+    all.merge(h);
+  }
+  uint64_t checksum = 0;
+  for (auto c : checksums)
+  {
+    checksum += c;
+  }
+
+  std::cout << "readers: " << readers << ", records: " << records << ", reload every " << reload_ms << "ms" << std::endl;
+  std::cout << "lookups: " << all.total() << " (" << all.total() / seconds << "/s)" << std::endl;
+  std::cout << "reloads: " << reloads.load() << ", last version: " << table.version() << ", retired pending: " << table.retired_count() << std::endl;
+  std::cout << "latency ns p50<=" << all.percentile(0.5) << " p99<=" << all.percentile(0.99)
+    << " p99.9<=" << all.percentile(0.999) << " max=" << all.max_ns << std::endl;
+  std::cout << "checksum: " << checksum << std::endl;
+  return 0;
+}
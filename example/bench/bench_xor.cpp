@@ -0,0 +1,151 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+// size and speed of [xor] float lists against plain ones, on sample streams shaped like
+// stored metrics and replays
+
+#include <adata.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  // a room temperature sampled every second, 0.1 degree resolution
+  std::vector<double> make_gauge(int32_t samples, std::mt19937& rnd)
+  {
+    std::normal_distribution<double> noise(0.0, 0.05);
+    std::vector<double> values((std::size_t)samples);
+    for (int32_t i = 0; i < samples; ++i)
+    {
+      double v = 21.5 + 2.0 * std::sin(i / 3600.0) + noise(rnd);
+      values[(std::size_t)i] = std::round(v * 10.0) / 10.0;
+    }
+    return values;
+  }
+
+  // a request total, it stays the same for a while then grows
+  std::vector<double> make_counter(int32_t samples, std::mt19937& rnd)
+  {
+    std::vector<double> values((std::size_t)samples);
+    double total = 1000000.0;
+    for (int32_t i = 0; i < samples; ++i)
+    {
+      if (rnd() % 4 == 0)
+      {
+        total += (double)(rnd() % 50);
+      }
+      values[(std::size_t)i] = total;
+    }
+    return values;
+  }
+
+  // a cpu percentage in steps of 0.5, changing now and then
+  std::vector<double> make_cpu(int32_t samples, std::mt19937& rnd)
+  {
+    std::vector<double> values((std::size_t)samples);
+    double cpu = 12.5;
+    for (int32_t i = 0; i < samples; ++i)
+    {
+      if (rnd() % 8 == 0)
+      {
+        cpu = (double)(rnd() % 200) * 0.5;
+      }
+      values[(std::size_t)i] = cpu;
+    }
+    return values;
+  }
+
+  // the x of a unit in a replay, ticks of a walk at a constant speed with a turn now and then
+  std::vector<float> make_replay(int32_t samples, std::mt19937& rnd)
+  {
+    std::vector<float> values((std::size_t)samples);
+    float x = 100.0f;
+    float speed = 0.25f;
+    for (int32_t i = 0; i < samples; ++i)
+    {
+      if (rnd() % 64 == 0)
+      {
+        speed = rnd() % 3 == 0 ? 0.0f : (float)((int)(rnd() % 9) - 4) * 0.125f;
+      }
+      x += speed;
+      values[(std::size_t)i] = x;
+    }
+    return values;
+  }
+
+  template<typename list_ty>
+  void run(const char * name, const list_ty& values, int rounds)
+  {
+    std::cout << name << ":";
+    std::size_t sizes[2] = { 0, 0 };
+    for (int encoding = adata::list_plain; encoding <= adata::list_xor; encoding += adata::list_xor)
+    {
+      std::string buffer((std::size_t)adata::size_of_list(values, encoding), '\0');
+      adata::zero_copy_buffer stream;
+      auto start = clock_type::now();
+      for (int r = 0; r < rounds; ++r)
+      {
+        stream.set_write(&buffer[0], buffer.size());
+        adata::write_list(stream, values, encoding);
+      }
+      auto write_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+
+      list_ty decoded;
+      start = clock_type::now();
+      for (int r = 0; r < rounds; ++r)
+      {
+        stream.set_read(buffer.data(), buffer.size());
+        adata::read_list(stream, decoded, encoding);
+      }
+      auto read_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+      if (decoded.size() != values.size() ||
+        std::memcmp(decoded.data(), values.data(), values.size() * sizeof(values[0])) != 0)
+      {
+        std::cout << " mismatch" << std::endl;
+        return;
+      }
+
+      double per_value = (double)rounds * (double)values.size();
+      sizes[encoding == adata::list_xor] = buffer.size();
+      std::cout << (encoding == adata::list_plain ? " plain " : ", xor ") << buffer.size() << " bytes"
+        << " (" << (double)buffer.size() / (double)values.size() << "/value"
+        << ", write " << (double)write_ns / per_value << "ns"
+        << ", read " << (double)read_ns / per_value << "ns)";
+    }
+    std::cout << ", " << (double)sizes[0] / (double)sizes[1] << "x smaller" << std::endl;
+  }
+}
+
+int bench_xor(int argc, char ** argv)
+{
+  int32_t samples = argc > 0 ? std::atoi(argv[0]) : 50000;
+  int rounds = argc > 1 ? std::atoi(argv[1]) : 20;
+  if (samples <= 0 || samples > MAX_ADATA_LEN || rounds <= 0)
+  {
+    std::cerr << "bad argument, samples at most " << MAX_ADATA_LEN << std::endl;
+    return 1;
+  }
+
+  std::mt19937 rnd(42);
+  std::cout << "samples: " << samples << ", rounds: " << rounds << std::endl;
+  run("gauge   float64", make_gauge(samples, rnd), rounds);
+  run("counter float64", make_counter(samples, rnd), rounds);
+  run("cpu     float64", make_cpu(samples, rnd), rounds);
+  run("replay  float32", make_replay(samples, rnd), rounds);
+  return 0;
+}
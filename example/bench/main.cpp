@@ -0,0 +1,50 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <iostream>
+#include <cstring>
+
+int bench_reload(int argc, char ** argv);
+int bench_xor(int argc, char ** argv);
+int bench_flat(int argc, char ** argv);
+
+struct bench_command
+{
+  const char * name;
+  int(*run)(int argc, char ** argv);
+  const char * usage;
+};
+
+static const bench_command commands[] =
+{
+  { "reload", bench_reload, "reload [readers=4] [seconds=3] [reload_ms=5] [records=10000]" },
+  { "xor", bench_xor, "xor [samples=50000] [rounds=20]" },
+  { "flat", bench_flat, "flat [records=10000] [rounds=20]" },
+};
+
+int main(int argc, char ** argv)
+{
+  if (argc >= 2)
+  {
+    for (auto const& cmd : commands)
+    {
+      if (std::strcmp(argv[1], cmd.name) == 0)
+      {
+        return cmd.run(argc - 2, argv + 2);
+      }
+    }
+  }
+  std::cerr << "usage:" << std::endl;
+  for (auto const& cmd : commands)
+  {
+    std::cerr << "  bench " << cmd.usage << std::endl;
+  }
+  return 1;
+}
@@ -1,5 +1,5 @@
-#ifndef quest_adl_h_adata_header_define
-#define quest_adl_h_adata_header_define
+#ifndef my_game_quest_adl_h_adata_header_define
+#define my_game_quest_adl_h_adata_header_define
 
 #include <adata.hpp>
 
@@ -16,36 +16,108 @@ namespace my {namespace game {
 
 }}
 
+namespace adata
+{
+template<>
+struct is_adata<my::game::quest>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::quest >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    description = 2,
+    member_count = 3
+  };
+};
+
+}
 namespace adata
 {
   template<typename stream_ty>
   ADATA_INLINE void read( stream_ty& stream, ::my::game::quest& value)
   {
     ::std::size_t offset = stream.read_length();
-    uint64_t tag = 0;
+    int64_t tag = 0;
     read(stream,tag);
-    if(stream.error()){return;}
     int32_t len_tag = 0;
     read(stream,len_tag);
-    if(stream.error()){return;}
 
-    if(tag&1ULL)    {read(stream,value.id);{if(stream.error()){stream.trace_error("id",-1);return;}}}
-    if(tag&2ULL)
-    {
-      uint32_t len = check_read_size(stream);
-      {if(stream.error()){stream.trace_error("name",-1);return;}}
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
       value.name.resize(len);
       stream.read((char *)value.name.data(),len);
-      {if(stream.error()){stream.trace_error("name",-1);return;}}
     }
-    if(tag&4ULL)
-    {
-      uint32_t len = check_read_size(stream);
-      {if(stream.error()){stream.trace_error("description",-1);return;}}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
       value.description.resize(len);
       stream.read((char *)value.description.data(),len);
-      {if(stream.error()){stream.trace_error("description",-1);return;}}
     }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.description.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::quest& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.description.resize(len);
+          stream.read((char *)value.description.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.description.clear();}
     if(len_tag >= 0)
     {
       ::std::size_t read_len = stream.read_length() - offset;
@@ -55,64 +127,269 @@ namespace adata
   }
 
   template <typename stream_ty>
-  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::quest* value)
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::quest* )
   {
-    (value);
     skip_read_compatible(stream);
   }
 
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::quest* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::quest& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!value.description.empty()) return false;
+    return true;
+  }
+
   ADATA_INLINE int32_t size_of(const ::my::game::quest& value)
   {
     int32_t size = 0;
-    uint64_t tag = 1ULL;
-    if(!value.name.empty()){tag|=2ULL;}
-    if(!value.description.empty()){tag|=4ULL;}
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!value.description.empty()){tag|=4LL;}
+    if(tag&1LL)
     {
       size += size_of(value.id);
     }
-    if(tag&2ULL)
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.description).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::quest& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!value.description.empty()){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.description).size();
+      write(stream,len);
+      stream.write((value.description).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::game::quest >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::quest& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!value.description.empty()){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::quest& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::quest& value = values[k];
+          {
+            int32_t len = (int32_t)(value.description).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::quest& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::quest& value = values[k];
+          {
+            int32_t len = (int32_t)(value.description).size();
+            write(stream,len);
+            stream.write((value.description).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::quest& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::quest& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.description.resize(len);
+            stream.read((char *)value.description.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::quest& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.description.resize(len);
+      stream.read((char *)value.description.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::quest& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
     {
       int32_t len = (int32_t)(value.name).size();
       size += size_of(len);
       size += len;
     }
-    if(tag&4ULL)
     {
       int32_t len = (int32_t)(value.description).size();
       size += size_of(len);
       size += len;
     }
-    size += size_of(tag);
-    size += size_of(size + size_of(size));
     return size;
   }
 
   template<typename stream_ty>
-  ADATA_INLINE void write(stream_ty& stream , const ::my::game::quest&value)
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::quest& value)
   {
-    uint64_t tag = 1ULL;
-    if(!value.name.empty()){tag|=2ULL;}
-    if(!value.description.empty()){tag|=4ULL;}
-    write(stream,tag);
-    if(stream.error()){return;}
-    write(stream,size_of(value));
-    if(stream.error()){return;}
-    {write(stream,value.id);{if(stream.error()){stream.trace_error("id",-1);return;}}}
-    if(tag&2ULL)
+    write(stream,value.id);
     {
-      uint32_t len = (uint32_t)(value.name).size();
+      int32_t len = (int32_t)(value.name).size();
       write(stream,len);
       stream.write((value.name).data(),len);
-      {if(stream.error()){stream.trace_error("name",-1);return;}}
     }
-    if(tag&4ULL)
     {
-      uint32_t len = (uint32_t)(value.description).size();
+      int32_t len = (int32_t)(value.description).size();
       write(stream,len);
       stream.write((value.description).data(),len);
-      {if(stream.error()){stream.trace_error("description",-1);return;}}
     }
-    return;
   }
 
 }
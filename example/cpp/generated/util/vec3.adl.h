@@ -1,5 +1,5 @@
-#ifndef vec3_adl_h_adata_header_define
-#define vec3_adl_h_adata_header_define
+#ifndef util_vec3_adl_h_adata_header_define
+#define util_vec3_adl_h_adata_header_define
 
 #include <adata.hpp>
 
@@ -18,22 +18,86 @@ namespace util {
 
 }
 
+namespace adata
+{
+template<>
+struct is_adata<util::vec3>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::util::vec3 >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    z = 2,
+    member_count = 3
+  };
+};
+
+}
 namespace adata
 {
   template<typename stream_ty>
   ADATA_INLINE void read( stream_ty& stream, ::util::vec3& value)
   {
     ::std::size_t offset = stream.read_length();
-    uint64_t tag = 0;
+    int64_t tag = 0;
     read(stream,tag);
-    if(stream.error()){return;}
     int32_t len_tag = 0;
     read(stream,len_tag);
-    if(stream.error()){return;}
 
-    if(tag&1ULL)    {read(stream,value.x);{if(stream.error()){stream.trace_error("x",-1);return;}}}
-    if(tag&2ULL)    {read(stream,value.y);{if(stream.error()){stream.trace_error("y",-1);return;}}}
-    if(tag&4ULL)    {read(stream,value.z);{if(stream.error()){stream.trace_error("z",-1);return;}}}
+    if(tag&1LL)    {read(stream,value.x);}
+    if(tag&2LL)    {read(stream,value.y);}
+    if(tag&4LL)    {read(stream,value.z);}
+    if(!(tag&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL)){value.y = (float)0.0f;}
+    if(!(tag&4LL)){value.z = (float)0.0f;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::util::vec3& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.x);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.y);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.z);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL) && (mask&2LL)){value.y = (float)0.0f;}
+    if(!(tag&4LL) && (mask&4LL)){value.z = (float)0.0f;}
     if(len_tag >= 0)
     {
       ::std::size_t read_len = stream.read_length() - offset;
@@ -43,22 +107,52 @@ namespace adata
   }
 
   template <typename stream_ty>
-  ADATA_INLINE void skip_read(stream_ty& stream, ::util::vec3* value)
+  ADATA_INLINE void skip_read(stream_ty& stream, ::util::vec3* )
   {
-    (value);
     skip_read_compatible(stream);
   }
 
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::util::vec3* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::util::vec3& value)
+  {
+    if(!is_default(value.x,(float)0.0f)) return false;
+    if(!is_default(value.y,(float)0.0f)) return false;
+    if(!is_default(value.z,(float)0.0f)) return false;
+    return true;
+  }
+
   ADATA_INLINE int32_t size_of(const ::util::vec3& value)
   {
     int32_t size = 0;
-    uint64_t tag = 7ULL;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.z,(float)0.0f)){tag|=4LL;}
+    if(tag&1LL)
     {
       size += size_of(value.x);
     }
+    if(tag&2LL)
     {
       size += size_of(value.y);
     }
+    if(tag&4LL)
     {
       size += size_of(value.z);
     }
@@ -68,17 +162,153 @@ namespace adata
   }
 
   template<typename stream_ty>
-  ADATA_INLINE void write(stream_ty& stream , const ::util::vec3&value)
+  ADATA_INLINE void write(stream_ty& stream , const ::util::vec3& value)
   {
-    uint64_t tag = 7ULL;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.z,(float)0.0f)){tag|=4LL;}
     write(stream,tag);
-    if(stream.error()){return;}
     write(stream,size_of(value));
-    if(stream.error()){return;}
-    {write(stream,value.x);{if(stream.error()){stream.trace_error("x",-1);return;}}}
-    {write(stream,value.y);{if(stream.error()){stream.trace_error("y",-1);return;}}}
-    {write(stream,value.z);{if(stream.error()){stream.trace_error("z",-1);return;}}}
-    return;
+    if(tag&1LL)    write(stream,value.x);
+    if(tag&2LL)    write(stream,value.y);
+    if(tag&4LL)    write(stream,value.z);
+  }
+
+  template<>
+  struct columns< ::util::vec3 >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::util::vec3& value = values[k];
+        if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+        if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+        if(!is_default(value.z,(float)0.0f)){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          size += size_of(value.x);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          size += size_of(value.y);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          size += size_of(value.z);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          write(stream,value.x);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          write(stream,value.y);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::util::vec3& value = values[k];
+          write(stream,value.z);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::util::vec3& value = values[k];
+          {read(stream,value.x);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::util::vec3& value = values[k];
+          {read(stream,value.y);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::util::vec3& value = values[k];
+          {read(stream,value.z);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::util::vec3& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+    read(stream,value.z);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::util::vec3& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    size += size_of(value.z);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::util::vec3& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    write(stream,value.z);
   }
 
 }
@@ -0,0 +1,127 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/game/player.adl.h>
+#include <adata_dynamic.hpp>
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <cstring>
+
+// print every decode event, indented by nesting
+class printer : public adata::dynamic::visitor
+{
+public:
+  printer() : m_depth(0) {}
+
+  void begin_type(const adata::dynamic::type_layout& type) { line() << type.fullname << " {" << std::endl; ++m_depth; }
+  void end_type(const adata::dynamic::type_layout&) { --m_depth; line() << "}" << std::endl; }
+  void field(const adata::dynamic::member_layout& mb) { line() << mb.name << ":" << std::endl; }
+  void on_int(int64_t v) { line() << v << std::endl; }
+  void on_uint(uint64_t v) { line() << v << std::endl; }
+  void on_float(double v) { line() << v << std::endl; }
+  void on_string(const char * str, std::size_t len) { line() << "\"" << std::string(str, len) << "\"" << std::endl; }
+  void begin_list(uint32_t len) { line() << "[" << len << std::endl; ++m_depth; }
+  void end_list() { --m_depth; line() << "]" << std::endl; }
+
+private:
+  std::ostream& line()
+  {
+    return std::cout << std::string(m_depth * 2, ' ');
+  }
+
+  int m_depth;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    // layouts written by adatac -Gadt, no generated code needed from here on
+    adata::dynamic::schema schema;
+    std::string adt_file = argc > 1 ? argv[1] : SOURCE_DIR "/generated/game.adt";
+    if (!schema.load_file(adt_file.c_str()))
+    {
+      std::cerr << "can't load " << adt_file << std::endl;
+      return 1;
+    }
+    const adata::dynamic::type_layout * player = schema.find_type("my.game.player_v1");
+    assert(player != 0);
+
+    // encode with the generated code
+    my::game::player_v1 pv1;
+    pv1.id = 1;
+    pv1.age = 22;
+    pv1.factor = 2.0f;
+    pv1.name = "pv1";
+    my::game::item itm;
+    itm.id = 11;
+    itm.level = 321110;
+    itm.type = 3;
+    pv1.inventory.push_back(itm);
+    my::game::quest qst;
+    qst.id = 50;
+    qst.name = "quest1";
+    qst.description = "There are something unusual...";
+    pv1.quests.push_back(qst);
+
+    char buff[4096];
+    adata::zero_copy_buffer stream;
+    int32_t buf_len = adata::size_of(pv1);
+    stream.set_write(buff, buf_len);
+    adata::write(stream, pv1);
+
+    // walk it with a visitor
+    printer p;
+    stream.set_read(buff, buf_len);
+    adata::dynamic::decode(stream, *player, p);
+
+    // decode to a document, modify and encode again
+    adata::dynamic::value doc;
+    stream.set_read(buff, buf_len);
+    adata::dynamic::read(stream, *player, doc);
+    assert(doc.field("name")->as_string() == "pv1");
+    assert(doc.field("inventory")->items()[0].field("level")->as_int() == 321110);
+
+    char buff2[4096];
+    int32_t doc_len = adata::dynamic::size_of(doc);
+    assert(doc_len == buf_len);
+    stream.set_write(buff2, doc_len);
+    adata::dynamic::write(stream, doc);
+    assert(std::memcmp(buff, buff2, buf_len) == 0);
+
+    *doc.field("age") = adata::dynamic::value((int64_t)23);
+    doc_len = adata::dynamic::size_of(doc);
+    stream.set_write(buff2, doc_len);
+    adata::dynamic::write(stream, doc);
+
+    my::game::player_v1 pv1_other;
+    stream.set_read(buff2, doc_len);
+    adata::read(stream, pv1_other);
+    assert(pv1_other.age == 23);
+    assert(pv1_other.inventory.size() == 1 && pv1_other.quests[0].name == "quest1");
+
+    // the same bytes read as the newer layout, deleted members are skipped
+    const adata::dynamic::type_layout * player_v2 = schema.find_type("my.game.player_v2");
+    adata::dynamic::value doc2;
+    stream.set_read(buff, buf_len);
+    adata::dynamic::read(stream, *player_v2, doc2);
+    assert(doc2.field("age") == 0);
+    assert(doc2.field("friends")->size() == 0);
+
+    std::cout << "done." << std::endl;
+  }
+  catch (std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/bitrun.adl.h>
+#include "features.hpp"
+
+// [bits=k] runs split by a plain member, a signed level, and values that don't fit their bits
+void feature_bitrun()
+{
+  my::feature::avatar avatar;
+  avatar.level = 127;
+  avatar.job = 5;
+  avatar.dir = 2;
+  avatar.name = "tauren";
+  avatar.tint = 0xabc;
+  avatar.stamp = 0xfedcba9876ULL;
+
+  my::feature::avatar other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.avatar", avatar, other, doc, data);
+  assert(other.level == 127 && other.job == 5 && other.dir == 2 && other.tint == 0xabc && other.stamp == 0xfedcba9876ULL);
+  assert(doc.field("level")->as_int() == 127 && doc.field("stamp")->as_uint() == 0xfedcba9876ULL);
+
+  // only the members off their default are in a run: job alone takes a byte
+  my::feature::avatar sparse;
+  my::feature::avatar sparse_other;
+  sparse.job = 4;
+  round_trip("my.feature.avatar", sparse, sparse_other, doc, data);
+  assert(data.size() == 3 && sparse_other.job == 4 && sparse_other.level == 1 && doc.field("level")->as_int() == 1);
+
+  my::feature::crowd crowd;
+  for (int32_t i = 0; i < 20; ++i)
+  {
+    avatar.level = i * 6;
+    avatar.job = (uint8_t)(i % 8);
+    avatar.stamp = i * 1000000007ULL;
+    crowd.avatars.push_back(avatar);
+    crowd.columns.push_back(avatar);
+  }
+  my::feature::crowd crowd_other;
+  round_trip("my.feature.crowd", crowd, crowd_other, doc, data);
+  assert(crowd_other.avatars[19].level == 114 && crowd_other.columns[19].stamp == 19 * 1000000007ULL);
+  assert(doc.field("columns")->items()[7].field("job")->as_uint() == 7);
+
+  // level takes 0 to 127 in its 7 bits though it is signed, 128 and -1 throw
+  int32_t out_of_range[] = { 128, -1 };
+  for (int32_t level : out_of_range)
+  {
+    my::feature::avatar too_large;
+    too_large.level = level;
+    std::vector<char> buffer(64);
+    adata::zero_copy_buffer stream;
+    stream.set_write(&buffer[0], buffer.size());
+    bool thrown = false;
+    try
+    {
+      adata::write(stream, too_large);
+    }
+    catch (adata::exception& ex)
+    {
+      thrown = ex.error_code() == adata::value_too_large_to_integer_number;
+    }
+    assert(thrown);
+    (void)thrown;
+  }
+}
@@ -0,0 +1,82 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/chunk.adl.h>
+#include "features.hpp"
+#include <algorithm>
+#include <cstring>
+
+// bytes members copied, [align]ed from the start of the data, and [view]s of the read buffer
+void feature_chunk()
+{
+  my::feature::chunk chunk;
+  chunk.id = 1;
+  std::string raw(300, '\0');
+  for (std::size_t i = 0; i < raw.size(); ++i)
+  {
+    raw[i] = (char)(i * 7);
+  }
+  chunk.raw.assign(raw.data(), 5);
+  chunk.samples.assign(raw.data(), 48);
+  chunk.frame.assign(raw.data() + 10, 290);
+  chunk.pixels.assign(raw.data() + 1, 33);
+  chunk.name = "after the payloads";
+
+  // other views data, which lives as long as other here
+  my::feature::chunk other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.chunk", chunk, other, doc, data);
+  assert(other.raw == chunk.raw && other.samples == chunk.samples && other.frame == chunk.frame && other.pixels == chunk.pixels);
+  assert(!other.raw.is_view() && !other.samples.is_view() && other.frame.is_view() && other.pixels.is_view());
+  assert(other.frame.data() >= &data[0] && other.frame.data() < &data[0] + data.size());
+  assert((other.pixels.data() - &data[0]) % 64 == 0 && other.name == chunk.name);
+  assert(doc.field("samples")->as_string() == std::string(raw.data(), 48));
+  assert(doc.field("pixels")->as_string() == std::string(raw.data() + 1, 33));
+
+  // the payload of samples is aligned too, only its copy was moved
+  const char * samples = std::search(&data[0], &data[0] + data.size(), raw.data(), raw.data() + 48);
+  assert((samples - &data[0]) % 16 == 0);
+
+  // own() keeps the frame once the buffer is gone
+  other.frame.own();
+  std::memset(&data[0], 0, data.size());
+  assert(!other.frame.is_view() && other.frame == chunk.frame);
+  (void)samples;
+
+  // a negative length is rejected, not taken as a huge one, when reading or skipping bytes
+  char bad[16] = {};
+  adata::zero_copy_buffer stream;
+  stream.set_write(bad, sizeof(bad));
+  adata::write(stream, (int32_t)-1);
+  bool read_thrown = false;
+  try
+  {
+    stream.set_read(bad, sizeof(bad));
+    adata::read_bytes(stream, other.frame, 0, true);
+  }
+  catch (adata::exception& ex)
+  {
+    read_thrown = ex.error_code() == adata::number_of_element_not_match;
+  }
+  bool skip_thrown = false;
+  try
+  {
+    stream.set_read(bad, sizeof(bad));
+    adata::skip_read_bytes(stream, 16);
+  }
+  catch (adata::exception& ex)
+  {
+    skip_thrown = ex.error_code() == adata::number_of_element_not_match;
+  }
+  assert(read_thrown && skip_thrown);
+  (void)read_thrown;
+  (void)skip_thrown;
+}
@@ -0,0 +1,49 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/columnar.adl.h>
+#include "features.hpp"
+
+// [columnar] lists of a type, integer columns plain or as [delta], members left at the default
+void feature_columnar()
+{
+  my::feature::grid grid;
+  grid.id = 1;
+  for (int32_t i = 0; i < 40; ++i)
+  {
+    my::feature::cell cell;
+    cell.x = i;
+    cell.y = i % 4 == 0 ? -1 : 1000000 - i * 7;
+    cell.tag = i % 5 == 0 ? "" : "tag";
+    cell.weight = i * 0.25;
+    if (i == 3)
+    {
+      cell.marks.push_back(3);
+      cell.marks.push_back(-3);
+    }
+    cell.owner = (uint64_t)i << 40;
+    grid.cells.push_back(cell);
+  }
+  grid.sized_cells.assign(grid.cells.begin(), grid.cells.begin() + 5);
+
+  my::feature::grid other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.grid", grid, other, doc, data);
+  assert(other.cells.size() == 40 && other.sized_cells.size() == 5);
+  assert(other.cells[8].y == -1 && other.cells[9].y == 1000000 - 63 && other.cells[3].marks.size() == 2);
+  assert(other.cells[39].owner == (uint64_t)39 << 40 && other.cells[10].tag.empty());
+
+  const adata::dynamic::value& cell = doc.field("cells")->items()[9];
+  assert(cell.field("x")->as_int() == 9 && cell.field("y")->as_int() == 1000000 - 63);
+  assert(cell.field("weight")->as_float() == 2.25 && cell.field("tag")->as_string() == "tag");
+  assert(doc.field("cells")->items()[8].field("y")->as_int() == -1);
+  (void)cell;
+}
@@ -0,0 +1,54 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/command.adl.h>
+#include "features.hpp"
+
+// unions holding each member or none, and a setter given the member it already holds
+void feature_command()
+{
+  my::feature::command_queue queue;
+  queue.commands.resize(4);
+  my::feature::walk& walk = queue.commands[0].set_walk();
+  walk.x = -3;
+  walk.path.push_back(7);
+  my::feature::cast cast;
+  cast.spell_id = 133;
+  cast.target = "boss";
+  queue.commands[1].set_cast(cast);
+  queue.commands[2].set_say().text = "hello";
+  queue.current = queue.commands[1];
+  queue.after = 8;
+
+  my::feature::command_queue other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.command_queue", queue, other, doc, data);
+  assert(other.commands[0].kind() == my::feature::command::walk_kind && other.commands[0].get_walk()->path == walk.path);
+  assert(other.commands[1].get_cast()->target == "boss" && other.commands[2].get_say()->text == "hello");
+  assert(other.commands[3].empty() && other.idle.empty() && other.current.get_cast()->spell_id == 133);
+  const adata::dynamic::value& second = doc.field("commands")->items()[1];
+  assert(second.field("cast")->field("spell_id")->as_int() == 133 && second.field("walk")->is_null());
+  (void)second;
+
+  // set_ given the member held copies it before reset destroys it
+  my::feature::command& current = queue.current;
+  current.set_cast(*current.get_cast());
+  assert(current.get_cast()->target == "boss" && current.get_cast()->spell_id == 133);
+  current.set_cast(std::move(*current.get_cast()));
+  assert(current.get_cast()->target == "boss");
+  my::feature::command& first = queue.commands[0];
+  first.set_walk(*first.get_walk());
+  assert(first.get_walk()->x == -3 && first.get_walk()->path.size() == 1 && first.get_walk()->path[0] == 7);
+
+  my::feature::command_queue again;
+  round_trip("my.feature.command_queue", queue, again, doc, data);
+  assert(again.current.get_cast()->target == "boss" && again.commands[0].get_walk()->path[0] == 7);
+}
@@ -0,0 +1,61 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/defaults.adl.h>
+#include "features.hpp"
+
+// members at their default, nested types included, are left out and read back as the default
+void feature_defaults()
+{
+  my::feature::unit unit;
+  my::feature::unit other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.unit", unit, other, doc, data);
+  // only the tag and len_tag
+  assert(data.size() == 2);
+  assert(doc.field("exp")->as_int() == -1);
+  assert(doc.field("base")->field("hp")->as_int() == 100 && doc.field("base")->field("lives")->as_int() == 3);
+  assert(other.base.hp == 100 && other.exp == -1);
+
+  // a value off the default is written, zero included
+  unit.base.hp = 0;
+  unit.exp = 0;
+  round_trip("my.feature.unit", unit, other, doc, data);
+  assert(data.size() > 2);
+  assert(doc.field("base")->field("hp")->as_int() == 0 && doc.field("base")->field("speed")->as_float() == 1.5);
+  assert(doc.field("exp")->as_int() == 0);
+  assert(other.base.hp == 0 && other.base.speed == 1.5f && other.exp == 0);
+
+  // reading the defaults into a used object puts every member left out back to its default
+  std::vector<char> defaults((std::size_t)adata::size_of(my::feature::unit()));
+  adata::zero_copy_buffer stream;
+  stream.set_write(&defaults[0], defaults.size());
+  adata::write(stream, my::feature::unit());
+  other.id = 7;
+  other.name = "used";
+  other.base.speed = 9.0f;
+  stream.set_read(&defaults[0], defaults.size());
+  adata::read(stream, other);
+  assert(other.id == 0 && other.name.empty() && other.exp == -1);
+  assert(other.base.hp == 100 && other.base.speed == 1.5f && other.base.lives == 3);
+
+  // a projected read resets only the members of its mask
+  typedef adata::member_index<my::feature::unit> unit_member;
+  other.id = 7;
+  other.name = "kept";
+  stream.set_read(&defaults[0], defaults.size());
+  adata::read_projected(stream, other, 1LL << unit_member::id);
+  assert(other.id == 0 && other.name == "kept");
+
+  // and a document left at the defaults writes nothing for them either
+  adata::dynamic::value empty = adata::dynamic::value::make_object(*feature_schema().find_type("my.feature.unit"));
+  assert(adata::dynamic::size_of(empty) == 2);
+}
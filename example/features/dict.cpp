@@ -0,0 +1,61 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/dict.adl.h>
+#include "features.hpp"
+
+// [dict] strings without a dictionary, with one collected by size_of, and one missing a string
+void feature_dict()
+{
+  static const char * items[] = { "sword", "shield", "potion" };
+  my::feature::loot_log log;
+  for (int32_t i = 0; i < 30; ++i)
+  {
+    my::feature::loot loot;
+    loot.item = items[i % 3];
+    loot.owner = i % 2 ? "odd" : "even";
+    loot.count = i;
+    loot.note = "not coded";
+    log.drops.push_back(loot);
+  }
+  log.zone = "deadmines";
+
+  my::feature::loot_log other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.loot_log", log, other, doc, data);
+  assert(other.drops[29].item == "potion" && other.zone == "deadmines");
+  std::size_t uncoded = data.size();
+
+  adata::string_dict dict;
+  {
+    adata::string_dict::scope collect(dict, true);
+    adata::size_of(log);
+  }
+  assert(dict.size() == 6);
+
+  my::feature::loot_log coded;
+  {
+    adata::string_dict::scope use(dict);
+    round_trip("my.feature.loot_log", log, coded, doc, data);
+  }
+  assert(data.size() + 30 * 6 < uncoded);
+  assert(coded.drops[13].item == "shield" && coded.drops[13].owner == "odd" && coded.zone == "deadmines");
+  assert(doc.field("drops")->items()[13].field("item")->as_string() == "shield");
+
+  // a string that isn't in the dictionary is written as code 0 and the string
+  log.drops[4].owner = "stranger";
+  my::feature::loot_log partly;
+  {
+    adata::string_dict::scope use(dict);
+    round_trip("my.feature.loot_log", log, partly, doc, data);
+  }
+  assert(partly.drops[4].owner == "stranger" && partly.drops[5].owner == "odd");
+}
@@ -0,0 +1,41 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/encoded.adl.h>
+#include "features.hpp"
+#include <limits>
+
+// [delta], [delta2] and [rle] integer lists, differences wrapping at the ends of the type
+void feature_encoded()
+{
+  my::feature::series series;
+  for (int64_t i = 0; i < 50; ++i)
+  {
+    series.times.push_back(1420070400000LL + i * 1000);
+    series.ticks.push_back((int32_t)(i * i));
+    series.levels.push_back((uint16_t)(i < 40 ? 7 : i));
+  }
+  series.times.push_back(std::numeric_limits<int64_t>::min());
+  series.times.push_back(std::numeric_limits<int64_t>::max());
+  series.ticks.push_back(std::numeric_limits<int32_t>::min());
+  series.levels.push_back(std::numeric_limits<uint16_t>::max());
+  series.small.push_back(127);
+  series.small.push_back(-128);
+  series.small.push_back(0);
+
+  my::feature::series other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.series", series, other, doc, data);
+  assert(other.times == series.times && other.ticks == series.ticks);
+  assert(other.levels == series.levels && other.small == series.small);
+  assert(doc.field("times")->items()[51].as_int() == std::numeric_limits<int64_t>::max());
+  assert(doc.field("levels")->items()[39].as_uint() == 7 && doc.field("small")->items()[1].as_int() == -128);
+}
@@ -0,0 +1,74 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/faction.adl.h>
+#include "features.hpp"
+#include <cstring>
+
+// enum members, defaults, list and map elements, a [columnar] column and a value that is no enumerator
+void feature_faction()
+{
+  my::feature::faction faction;
+  assert(faction.home == my::feature::side::south && faction.level == my::feature::depth::abyss);
+  faction.home = my::feature::side::east;
+  faction.level = my::feature::depth::sky;
+  faction.allies.push_back(my::feature::side::north);
+  faction.allies.push_back(my::feature::side::south);
+  faction.scores[my::feature::side::east] = -9;
+  for (int32_t i = 0; i < 12; ++i)
+  {
+    my::feature::outpost outpost;
+    outpost.owner = adata::enum_traits<my::feature::side>::value(i % 3);
+    outpost.guards = i;
+    faction.outposts.push_back(outpost);
+  }
+
+  my::feature::faction other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.faction", faction, other, doc, data);
+  assert(other.home == my::feature::side::east && other.level == my::feature::depth::sky);
+  assert(other.allies == faction.allies && other.scores == faction.scores && other.outposts[11].owner == my::feature::side::east);
+  assert(doc.field("home")->as_int() == 6 && doc.field("level")->as_int() == 40000);
+  assert(doc.field("allies")->items()[1].as_int() == 5 && doc.field("outposts")->items()[10].field("owner")->as_int() == 5);
+  assert(std::strcmp(adata::to_string(other.allies[1]), "south") == 0);
+
+  // the data of faction_raw has the same tags, home 7 is no side
+  my::feature::faction_raw raw;
+  raw.home = 7;
+  std::vector<char> raw_data((std::size_t)adata::size_of(raw));
+  adata::zero_copy_buffer stream;
+  stream.set_write(&raw_data[0], raw_data.size());
+  adata::write(stream, raw);
+
+  bool generated_thrown = false;
+  try
+  {
+    stream.set_read(&raw_data[0], raw_data.size());
+    adata::read(stream, other);
+  }
+  catch (adata::exception& ex)
+  {
+    generated_thrown = ex.error_code() == adata::enum_value_undefined;
+  }
+  bool dynamic_thrown = false;
+  try
+  {
+    stream.set_read(&raw_data[0], raw_data.size());
+    adata::dynamic::read(stream, *feature_schema().find_type("my.feature.faction"), doc);
+  }
+  catch (adata::exception& ex)
+  {
+    dynamic_thrown = ex.error_code() == adata::enum_value_undefined;
+  }
+  assert(generated_thrown && dynamic_thrown);
+  (void)generated_thrown;
+  (void)dynamic_thrown;
+}
@@ -0,0 +1,56 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#ifndef EXAMPLE_FEATURES_HPP_HEADER_
+#define EXAMPLE_FEATURES_HPP_HEADER_
+
+#include <adata_dynamic.hpp>
+#include <cassert>
+#include <vector>
+
+// the layouts of every adl in example/adl/my/feature, packed in one adt
+const adata::dynamic::schema& feature_schema();
+
+// the generated code writes value, the dynamic codec reads it into doc and writes it again
+// to the same bytes, which the generated code reads into other and writes once more.
+// data keeps the bytes other was read from
+template<typename ty>
+void round_trip(const char * type_name, const ty& value, ty& other, adata::dynamic::value& doc, std::vector<char>& data)
+{
+  const adata::dynamic::type_layout * layout = feature_schema().find_type(type_name);
+  assert(layout != 0);
+  adata::zero_copy_buffer stream;
+
+  std::vector<char> written((std::size_t)adata::size_of(value));
+  stream.set_write(&written[0], written.size());
+  adata::write(stream, value);
+  assert(!stream.bad() && stream.write_length() == written.size());
+
+  stream.set_read(&written[0], written.size());
+  adata::dynamic::read(stream, *layout, doc);
+  assert(!stream.bad() && stream.read_length() == written.size());
+
+  data.assign((std::size_t)adata::dynamic::size_of(doc), 0);
+  assert(data.size() == written.size());
+  stream.set_write(&data[0], data.size());
+  adata::dynamic::write(stream, doc);
+  assert(data == written);
+
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, other);
+  assert(!stream.bad() && stream.read_length() == data.size());
+
+  std::vector<char> again((std::size_t)adata::size_of(other));
+  stream.set_write(&again[0], again.size());
+  adata::write(stream, other);
+  assert(again == data);
+}
+
+#endif
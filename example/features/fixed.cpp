@@ -0,0 +1,43 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/fixed.adl.h>
+#include "features.hpp"
+
+// array<T,N> of numbers, fix_ integers, strings and data structs, and arrays left out at zero
+void feature_fixed()
+{
+  my::feature::loadout loadout;
+  loadout.pos[0] = 1.5f;
+  loadout.pos[2] = -3.25f;
+  loadout.tints[3] = -7;
+  loadout.scores[1] = -1234567890123LL;
+  loadout.tags[1] = "second";
+  loadout.hotbar[2].item_id = 42;
+  loadout.hotbar[2].count = 9;
+  loadout.after = 11;
+
+  my::feature::loadout other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.loadout", loadout, other, doc, data);
+  assert(other.pos == loadout.pos && other.tints == loadout.tints && other.scores == loadout.scores && other.tags == loadout.tags);
+  assert(other.hotbar[2].item_id == 42 && other.hotbar[2].count == 9 && other.hotbar[0].count == 1);
+  assert(doc.field("pos")->size() == 3 && doc.field("pos")->items()[2].as_float() == -3.25);
+  assert(doc.field("tints")->items()[3].as_int() == -7 && doc.field("scores")->items()[1].as_int() == loadout.scores[1]);
+  assert(doc.field("tags")->items()[0].as_string().empty() && doc.field("hotbar")->items()[2].field("count")->as_int() == 9);
+
+  // every element at zero, empty or default: only after is in the data
+  my::feature::loadout empty;
+  my::feature::loadout empty_other;
+  empty.after = 1;
+  round_trip("my.feature.loadout", empty, empty_other, doc, data);
+  assert(data.size() == 3 && empty_other.hotbar[3].count == 1);
+}
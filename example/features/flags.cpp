@@ -0,0 +1,69 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/flags.adl.h>
+#include "features.hpp"
+
+// bool members only in the tag, bits<N> rows, and both as [columnar] columns
+void feature_flags()
+{
+  my::feature::panel panel;
+  panel.single.on = true;
+  panel.single.visible = false;
+  panel.single.mask.set(0).set(11);
+  panel.single.wide_mask.set(69);
+  panel.single.after = 5;
+  for (int32_t i = 0; i < 11; ++i)
+  {
+    my::feature::switches row;
+    row.on = i % 2 == 0;
+    row.visible = i % 3 != 0;
+    row.mask.set((std::size_t)i);
+    row.after = i;
+    panel.rows.push_back(row);
+  }
+
+  my::feature::panel other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.panel", panel, other, doc, data);
+  assert(other.single.on && !other.single.visible && other.single.mask == panel.single.mask);
+  assert(other.single.wide_mask.count() == 1 && other.single.wide_mask.test(69));
+  assert(other.rows[3].on == false && other.rows[3].visible == false && other.rows[4].visible && other.rows[10].mask.test(10));
+
+  const adata::dynamic::value& single = *doc.field("single");
+  assert(single.field("on")->as_uint() == 1 && single.field("visible")->as_uint() == 0);
+  assert(single.field("mask")->size() == 12 && single.field("mask")->items()[11].as_uint() == 1 && single.field("mask")->items()[1].as_uint() == 0);
+  assert(single.field("wide_mask")->items()[69].as_uint() == 1);
+  assert(doc.field("rows")->items()[6].field("visible")->as_uint() == 0 && doc.field("rows")->items()[7].field("on")->as_uint() == 0);
+  (void)single;
+
+  // a bool off its default is still no byte of the data
+  my::feature::switches one;
+  my::feature::switches one_other;
+  one.on = true;
+  one.visible = false;
+  round_trip("my.feature.switches", one, one_other, doc, data);
+  assert(data.size() == 2 && one_other.on && !one_other.visible);
+
+  // and reading the defaults into a used object sets both back
+  adata::zero_copy_buffer stream;
+  std::vector<char> defaults((std::size_t)adata::size_of(my::feature::switches()));
+  stream.set_write(&defaults[0], defaults.size());
+  adata::write(stream, my::feature::switches());
+  stream.set_read(&defaults[0], defaults.size());
+  adata::read(stream, one_other);
+  assert(!one_other.on && one_other.visible);
+  one_other.on = true;
+  one_other.visible = false;
+  stream.set_read(&defaults[0], defaults.size());
+  adata::read_projected(stream, one_other, 1LL << adata::member_index<my::feature::switches>::visible);
+  assert(one_other.on && one_other.visible);
+}
@@ -0,0 +1,109 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/flat.adl.h>
+#include "features.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+  my::feature::ware make_ware(int32_t id, const char * name, my::feature::ware_kind kind)
+  {
+    my::feature::ware ware;
+    ware.id = id;
+    ware.name = name;
+    ware.kind = kind;
+    ware.marks.set((std::size_t)id % 10);
+    ware.size[0] = (int16_t)id;
+    ware.size[2] = -7;
+    return ware;
+  }
+}
+
+// a store read in place from its flat encoding, decoded back to the same wire bytes, and
+// flat_verify on a buffer that was cut or overwritten
+void feature_flat()
+{
+  my::feature::store store;
+  store.title = "general goods";
+  store.featured = make_ware(3, "ruby", my::feature::ware_kind::gem);
+  store.featured.discount = 15;
+  for (int32_t i = 0; i < 8; ++i)
+  {
+    my::feature::ware ware = make_ware(100 + i, i % 2 ? "rope" : "bread", i % 2 ? my::feature::ware_kind::tool : my::feature::ware_kind::food);
+    store.wares.push_back(ware);
+    store.by_id[ware.id] = ware;
+    store.sales.push_back(1420070400000LL + i);
+  }
+  store.stock["bread"] = 40;
+  store.stock["rope"] = 3;
+  store.stock["anvil"] = 0;
+
+  my::feature::store other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.store", store, other, doc, data);
+
+  std::string buffer;
+  adata::flat_encode(store, buffer);
+  my::feature::store_flat view = adata::flat_open<my::feature::store>(buffer.data(), buffer.size());
+  assert(view.title() == "general goods" && view.featured().name() == "ruby");
+  assert(view.featured().kind() == my::feature::ware_kind::gem && view.featured().has_discount() && view.featured().discount() == 15);
+  assert(view.wares().size() == 8 && !view.wares()[2].has_discount() && view.wares()[3].kind() == my::feature::ware_kind::tool);
+  assert(view.wares()[5].marks().test(5) && !view.wares()[5].marks().test(4) && view.wares()[5].size()[0] == 105 && view.wares()[5].size()[2] == -7);
+
+  // maps are found in place, by an integer key and by a string one
+  uint32_t at = view.by_id().find(106);
+  assert(at != view.by_id().size() && view.by_id().value(at).name() == "bread");
+  assert(view.by_id().find(99) == view.by_id().size() && !view.stock().contains("nails"));
+  assert(view.stock().value(view.stock().find("rope")) == 3 && view.stock().key(0) == "anvil");
+
+  // iterators of a list returned by value stay valid after the list is gone
+  int64_t sum = 0;
+  for (adata::flat_list< adata::flat_scalar<int64_t> >::const_iterator it = view.sales().begin(), end = view.sales().end(); it != end; ++it)
+  {
+    sum += *it - 1420070400000LL;
+  }
+  assert(sum == 28);
+
+  // decoded, it writes the bytes the store was written to
+  my::feature::store decoded;
+  adata::flat_decode(buffer.data(), decoded);
+  std::vector<char> again((std::size_t)adata::size_of(decoded));
+  adata::zero_copy_buffer stream;
+  stream.set_write(&again[0], again.size());
+  adata::write(stream, decoded);
+  assert(again == data);
+
+  // cut short, an offset out of the buffer, a string without its 0, another type
+  assert(!adata::flat_verify<my::feature::store>(buffer.data(), buffer.size() - 1));
+  std::string corrupt = buffer;
+  std::memset(&corrupt[12], 0xff, 4);
+  assert(!adata::flat_verify<my::feature::store>(corrupt.data(), corrupt.size()));
+  corrupt = buffer;
+  std::size_t ruby = corrupt.find("ruby");
+  corrupt[ruby + 4] = 'x';
+  assert(!adata::flat_verify<my::feature::store>(corrupt.data(), corrupt.size()));
+  assert(!adata::flat_verify<my::feature::ware>(buffer.data(), buffer.size()));
+  bool thrown = false;
+  try
+  {
+    adata::flat_open<my::feature::store>(corrupt.data(), corrupt.size());
+  }
+  catch (adata::exception& ex)
+  {
+    thrown = ex.error_code() == adata::flat_format_not_match;
+  }
+  assert(thrown);
+  (void)at;
+  (void)sum;
+  (void)thrown;
+}
@@ -0,0 +1,49 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/gauge.adl.h>
+#include "features.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// [xor] float lists: repeats, small changes, jumps, signs and a NaN bit for bit
+void feature_gauge()
+{
+  my::feature::gauge gauge;
+  for (int32_t i = 0; i < 64; ++i)
+  {
+    double value = 100.0 + (double)(i / 8);
+    if (i % 16 == 15) value = -value * 1e300;
+    gauge.samples.push_back(value);
+    gauge.levels.push_back(i % 5 == 0 ? 0.0f : (float)i / 3.0f);
+    gauge.plain.push_back(value);
+  }
+  gauge.samples[20] = std::numeric_limits<double>::quiet_NaN();
+  gauge.samples[21] = -0.0;
+  gauge.after = 2;
+
+  my::feature::gauge other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.gauge", gauge, other, doc, data);
+  assert(other.samples.size() == 64 && other.levels == gauge.levels);
+  assert(std::memcmp(&other.samples[0], &gauge.samples[0], gauge.samples.size() * sizeof(double)) == 0);
+  assert(doc.field("samples")->items()[63].as_float() == gauge.samples[63]);
+  assert(std::isnan(doc.field("samples")->items()[20].as_float()));
+  assert(doc.field("levels")->items()[7].as_float() == (double)(7.0f / 3.0f));
+
+  // the repeats make samples a fraction of plain
+  my::feature::gauge samples_only;
+  samples_only.samples = gauge.plain;
+  my::feature::gauge plain_only;
+  plain_only.plain = gauge.plain;
+  assert(adata::size_of(samples_only) * 2 < adata::size_of(plain_only));
+}
@@ -0,0 +1,834 @@
+#ifndef my_feature_bitrun_adl_h_adata_header_define
+#define my_feature_bitrun_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct avatar
+  {
+    uint8_t job;
+    uint8_t dir;
+    uint16_t tint;
+    int32_t level;
+    uint64_t stamp;
+    ::std::string name;
+    avatar()
+    :    job(0),
+    dir(0),
+    tint(0),
+    level(1),
+    stamp(0ULL)
+    {}
+  };
+
+  struct crowd
+  {
+    ::std::vector< ::my::feature::avatar > avatars;
+    ::std::vector< ::my::feature::avatar > columns;
+    crowd()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::avatar>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::avatar >
+{
+  enum
+  {
+    level = 0,
+    job = 1,
+    dir = 2,
+    name = 3,
+    tint = 4,
+    stamp = 5,
+    member_count = 6
+  };
+};
+
+template<>
+struct is_adata<my::feature::crowd>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::crowd >
+{
+  enum
+  {
+    avatars = 0,
+    columns = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::avatar& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if((tag&1LL) || (tag&2LL) || (tag&4LL))
+    {
+      bit_reader<stream_ty> bits(stream);
+      if(tag&1LL){bits.read(value.level,7);}
+      if(tag&2LL){bits.read(value.job,3);}
+      if(tag&4LL){bits.read(value.dir,2);}
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if((tag&16LL) || (tag&32LL))
+    {
+      bit_reader<stream_ty> bits(stream);
+      if(tag&16LL){bits.read(value.tint,12);}
+      if(tag&32LL){bits.read(value.stamp,40);}
+    }
+    if(!(tag&1LL)){value.level = (int32_t)1;}
+    if(!(tag&2LL)){value.job = (uint8_t)0;}
+    if(!(tag&4LL)){value.dir = (uint8_t)0;}
+    if(!(tag&8LL)){value.name.clear();}
+    if(!(tag&16LL)){value.tint = (uint16_t)0;}
+    if(!(tag&32LL)){value.stamp = (uint64_t)0ULL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::avatar& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if((tag&1LL) || (tag&2LL) || (tag&4LL))
+      {
+        bit_reader<stream_ty> bits(stream);
+        if(tag&1LL){if(mask&1LL)bits.read(value.level,7);else bits.skip(7);}
+        if(tag&2LL){if(mask&2LL)bits.read(value.job,3);else bits.skip(3);}
+        if(tag&4LL){if(mask&4LL)bits.read(value.dir,2);else bits.skip(2);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if((tag&16LL) || (tag&32LL))
+      {
+        bit_reader<stream_ty> bits(stream);
+        if(tag&16LL){if(mask&16LL)bits.read(value.tint,12);else bits.skip(12);}
+        if(tag&32LL){if(mask&32LL)bits.read(value.stamp,40);else bits.skip(40);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.level = (int32_t)1;}
+    if(!(tag&2LL) && (mask&2LL)){value.job = (uint8_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.dir = (uint8_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.name.clear();}
+    if(!(tag&16LL) && (mask&16LL)){value.tint = (uint16_t)0;}
+    if(!(tag&32LL) && (mask&32LL)){value.stamp = (uint64_t)0ULL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::avatar* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::avatar* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index >= 0 && index < 3) return false;
+    {
+      int32_t bit_count = 0;
+      if(tag&1LL){bit_count += 7;}
+      if(tag&2LL){bit_count += 3;}
+      if(tag&4LL){bit_count += 2;}
+      stream.skip_read((::std::size_t)size_of_bit_run(bit_count));
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index >= 4 && index < 6) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::avatar& value)
+  {
+    if(!is_default(value.level,(int32_t)1)) return false;
+    if(!is_default(value.job,(uint8_t)0)) return false;
+    if(!is_default(value.dir,(uint8_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.tint,(uint16_t)0)) return false;
+    if(!is_default(value.stamp,(uint64_t)0ULL)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::avatar& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.level,(int32_t)1)){tag|=1LL;}
+    if(!is_default(value.job,(uint8_t)0)){tag|=2LL;}
+    if(!is_default(value.dir,(uint8_t)0)){tag|=4LL;}
+    if(!value.name.empty()){tag|=8LL;}
+    if(!is_default(value.tint,(uint16_t)0)){tag|=16LL;}
+    if(!is_default(value.stamp,(uint64_t)0ULL)){tag|=32LL;}
+    {
+      int32_t bit_count = 0;
+      if(tag&1LL){bit_count += 7;}
+      if(tag&2LL){bit_count += 3;}
+      if(tag&4LL){bit_count += 2;}
+      size += size_of_bit_run(bit_count);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    {
+      int32_t bit_count = 0;
+      if(tag&16LL){bit_count += 12;}
+      if(tag&32LL){bit_count += 40;}
+      size += size_of_bit_run(bit_count);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::avatar& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.level,(int32_t)1)){tag|=1LL;}
+    if(!is_default(value.job,(uint8_t)0)){tag|=2LL;}
+    if(!is_default(value.dir,(uint8_t)0)){tag|=4LL;}
+    if(!value.name.empty()){tag|=8LL;}
+    if(!is_default(value.tint,(uint16_t)0)){tag|=16LL;}
+    if(!is_default(value.stamp,(uint64_t)0ULL)){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if((tag&1LL) || (tag&2LL) || (tag&4LL))
+    {
+      bit_writer<stream_ty> bits(stream);
+      if(tag&1LL){bits.write(value.level,7);}
+      if(tag&2LL){bits.write(value.job,3);}
+      if(tag&4LL){bits.write(value.dir,2);}
+      bits.flush();
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if((tag&16LL) || (tag&32LL))
+    {
+      bit_writer<stream_ty> bits(stream);
+      if(tag&16LL){bits.write(value.tint,12);}
+      if(tag&32LL){bits.write(value.stamp,40);}
+      bits.flush();
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::avatar >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::avatar& value = values[k];
+        if(!is_default(value.level,(int32_t)1)){tag|=1LL;}
+        if(!is_default(value.job,(uint8_t)0)){tag|=2LL;}
+        if(!is_default(value.dir,(uint8_t)0)){tag|=4LL;}
+        if(!value.name.empty()){tag|=8LL;}
+        if(!is_default(value.tint,(uint16_t)0)){tag|=16LL;}
+        if(!is_default(value.stamp,(uint64_t)0ULL)){tag|=32LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].job;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].dir;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::avatar& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::avatar& value = values[k];
+          size += fix_size_of(value.tint);
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].stamp;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].job;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].dir;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::avatar& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::avatar& value = values[k];
+          fix_write(stream,value.tint);
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].stamp;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].level = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].job = column[k];}
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].dir = column[k];}
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::avatar& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::avatar& value = values[k];
+          {fix_read(stream,value.tint);}
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].stamp = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::avatar& value)
+  {
+    read(stream,value.level);
+    read(stream,value.job);
+    read(stream,value.dir);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    fix_read(stream,value.tint);
+    read(stream,value.stamp);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::avatar& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.level);
+    size += size_of(value.job);
+    size += size_of(value.dir);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += fix_size_of(value.tint);
+    size += size_of(value.stamp);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::avatar& value)
+  {
+    write(stream,value.level);
+    write(stream,value.job);
+    write(stream,value.dir);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    fix_write(stream,value.tint);
+    write(stream,value.stamp);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::crowd& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.avatars.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.avatars[i]);}
+      }
+    }
+    if(tag&2LL)    {read_columnar(stream,value.columns);}
+    if(!(tag&1LL)){value.avatars.clear();}
+    if(!(tag&2LL)){value.columns.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::crowd& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.avatars.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.avatars[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::avatar* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_columnar(stream,value.columns);}
+        else        {skip_read_columnar(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.avatars.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.columns.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::crowd* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::crowd* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::avatar* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 1) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::crowd& value)
+  {
+    if(!value.avatars.empty()) return false;
+    if(!value.columns.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::crowd& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.avatars.empty()){tag|=1LL;}
+    if(!value.columns.empty()){tag|=2LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.avatars).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&2LL)
+    {
+      size += size_of_columnar(value.columns);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::crowd& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.avatars.empty()){tag|=1LL;}
+    if(!value.columns.empty()){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.avatars).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&2LL)    write_columnar(stream,value.columns);
+  }
+
+  template<>
+  struct columns< ::my::feature::crowd >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::crowd& value = values[k];
+        if(!value.avatars.empty()){tag|=1LL;}
+        if(!value.columns.empty()){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::crowd& value = values[k];
+          {
+            int32_t len = (int32_t)(value.avatars).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::crowd& value = values[k];
+          size += size_of_columnar(value.columns);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::crowd& value = values[k];
+          {
+            int32_t len = (int32_t)(value.avatars).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::crowd& value = values[k];
+          write_columnar(stream,value.columns);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::crowd& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.avatars.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.avatars[i]);}
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::crowd& value = values[k];
+          {read_columnar(stream,value.columns);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::crowd& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.avatars.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.avatars[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.columns.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.columns[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::crowd& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.avatars).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.columns).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::avatar >::const_iterator i = value.columns.begin() ; i != value.columns.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::crowd& value)
+  {
+    {
+      int32_t len = (int32_t)(value.avatars).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::avatar >::const_iterator i = value.avatars.begin() ; i != value.avatars.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.columns).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::avatar >::const_iterator i = value.columns.begin() ; i != value.columns.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,498 @@
+#ifndef my_feature_chunk_adl_h_adata_header_define
+#define my_feature_chunk_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct chunk
+  {
+    int32_t id;
+    ::adata::bytes raw;
+    ::adata::bytes samples;
+    ::adata::bytes frame;
+    ::adata::bytes pixels;
+    ::std::string name;
+    chunk()
+    :    id(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::chunk>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::chunk >
+{
+  enum
+  {
+    id = 0,
+    raw = 1,
+    samples = 2,
+    frame = 3,
+    pixels = 4,
+    name = 5,
+    member_count = 6
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::chunk& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read_bytes(stream,value.raw,0,false);}
+    if(tag&4LL)    {read_bytes(stream,value.samples,16,false);}
+    if(tag&8LL)    {read_bytes(stream,value.frame,0,true);}
+    if(tag&16LL)    {read_bytes(stream,value.pixels,64,true);}
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.raw.clear();}
+    if(!(tag&4LL)){value.samples.clear();}
+    if(!(tag&8LL)){value.frame.clear();}
+    if(!(tag&16LL)){value.pixels.clear();}
+    if(!(tag&32LL)){value.name.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::chunk& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_bytes(stream,value.raw,0,false);}
+        else        {skip_read_bytes(stream,0);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read_bytes(stream,value.samples,16,false);}
+        else        {skip_read_bytes(stream,16);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read_bytes(stream,value.frame,0,true);}
+        else        {skip_read_bytes(stream,0);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read_bytes(stream,value.pixels,64,true);}
+        else        {skip_read_bytes(stream,64);}
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.raw.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.samples.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.frame.clear();}
+    if(!(tag&16LL) && (mask&16LL)){value.pixels.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.name.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::chunk* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::chunk* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {skip_read_bytes(stream,0);}
+    if(index == 2) return false;
+    if(tag&4LL)    {skip_read_bytes(stream,16);}
+    if(index == 3) return true;
+    if(tag&8LL)    {skip_read_bytes(stream,0);}
+    if(index == 4) return false;
+    if(tag&16LL)    {skip_read_bytes(stream,64);}
+    if(index == 5) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::chunk& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.raw.empty()) return false;
+    if(!value.samples.empty()) return false;
+    if(!value.frame.empty()) return false;
+    if(!value.pixels.empty()) return false;
+    if(!value.name.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::chunk& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.raw.empty()){tag|=2LL;}
+    if(!value.samples.empty()){tag|=4LL;}
+    if(!value.frame.empty()){tag|=8LL;}
+    if(!value.pixels.empty()){tag|=16LL;}
+    if(!value.name.empty()){tag|=32LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_bytes(value.raw,0);
+    }
+    if(tag&4LL)
+    {
+      size += size_of_bytes(value.samples,16);
+    }
+    if(tag&8LL)
+    {
+      size += size_of_bytes(value.frame,0);
+    }
+    if(tag&16LL)
+    {
+      size += size_of_bytes(value.pixels,64);
+    }
+    if(tag&32LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::chunk& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.raw.empty()){tag|=2LL;}
+    if(!value.samples.empty()){tag|=4LL;}
+    if(!value.frame.empty()){tag|=8LL;}
+    if(!value.pixels.empty()){tag|=16LL;}
+    if(!value.name.empty()){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write_bytes(stream,value.raw,0);
+    if(tag&4LL)    write_bytes(stream,value.samples,16);
+    if(tag&8LL)    write_bytes(stream,value.frame,0);
+    if(tag&16LL)    write_bytes(stream,value.pixels,64);
+    if(tag&32LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::chunk >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::chunk& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.raw.empty()){tag|=2LL;}
+        if(!value.samples.empty()){tag|=4LL;}
+        if(!value.frame.empty()){tag|=8LL;}
+        if(!value.pixels.empty()){tag|=16LL;}
+        if(!value.name.empty()){tag|=32LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          size += size_of_bytes(value.raw,0);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          size += size_of_bytes(value.samples,16);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          size += size_of_bytes(value.frame,0);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          size += size_of_bytes(value.pixels,64);
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          write_bytes(stream,value.raw,0);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          write_bytes(stream,value.samples,16);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          write_bytes(stream,value.frame,0);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          write_bytes(stream,value.pixels,64);
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::chunk& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::chunk& value = values[k];
+          {read_bytes(stream,value.raw,0,false);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::chunk& value = values[k];
+          {read_bytes(stream,value.samples,16,false);}
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::chunk& value = values[k];
+          {read_bytes(stream,value.frame,0,true);}
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::chunk& value = values[k];
+          {read_bytes(stream,value.pixels,64,true);}
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::chunk& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::chunk& value)
+  {
+    read(stream,value.id);
+    read_bytes(stream,value.raw,0,false);
+    read_bytes(stream,value.samples,16,false);
+    read_bytes(stream,value.frame,0,true);
+    read_bytes(stream,value.pixels,64,true);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::chunk& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += size_of_bytes(value.raw,0);
+    size += size_of_bytes(value.samples,16);
+    size += size_of_bytes(value.frame,0);
+    size += size_of_bytes(value.pixels,64);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::chunk& value)
+  {
+    write(stream,value.id);
+    write_bytes(stream,value.raw,0);
+    write_bytes(stream,value.samples,16);
+    write_bytes(stream,value.frame,0);
+    write_bytes(stream,value.pixels,64);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,939 @@
+#ifndef my_feature_columnar_adl_h_adata_header_define
+#define my_feature_columnar_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct cell
+  {
+    int32_t x;
+    int32_t y;
+    double weight;
+    uint64_t owner;
+    ::std::string tag;
+    ::std::vector< int32_t > marks;
+    cell()
+    :    x(0),
+    y(-1),
+    weight(0.0),
+    owner(0ULL)
+    {}
+  };
+
+  struct grid
+  {
+    int32_t id;
+    ::std::vector< ::my::feature::cell > cells;
+    ::std::vector< ::my::feature::cell > sized_cells;
+    grid()
+    :    id(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::cell>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::cell >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    tag = 2,
+    weight = 3,
+    marks = 4,
+    owner = 5,
+    member_count = 6
+  };
+};
+
+template<>
+struct is_adata<my::feature::grid>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::grid >
+{
+  enum
+  {
+    id = 0,
+    cells = 1,
+    sized_cells = 2,
+    member_count = 3
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::cell& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.x);}
+    if(tag&2LL)    {read(stream,value.y);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.tag.resize(len);
+      stream.read((char *)value.tag.data(),len);
+    }
+    if(tag&8LL)    {read(stream,value.weight);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.marks.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.marks[i]);}
+      }
+    }
+    if(tag&32LL)    {read(stream,value.owner);}
+    if(!(tag&1LL)){value.x = (int32_t)0;}
+    if(!(tag&2LL)){value.y = (int32_t)-1;}
+    if(!(tag&4LL)){value.tag.clear();}
+    if(!(tag&8LL)){value.weight = (double)0.0;}
+    if(!(tag&16LL)){value.marks.clear();}
+    if(!(tag&32LL)){value.owner = (uint64_t)0ULL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::cell& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.x);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.y);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.tag.resize(len);
+          stream.read((char *)value.tag.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.weight);}
+        else        {double* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.marks.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.marks[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {read(stream,value.owner);}
+        else        {uint64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.x = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.y = (int32_t)-1;}
+    if(!(tag&4LL) && (mask&4LL)){value.tag.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.weight = (double)0.0;}
+    if(!(tag&16LL) && (mask&16LL)){value.marks.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.owner = (uint64_t)0ULL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::cell* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::cell* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {double* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 5) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::cell& value)
+  {
+    if(!is_default(value.x,(int32_t)0)) return false;
+    if(!is_default(value.y,(int32_t)-1)) return false;
+    if(!value.tag.empty()) return false;
+    if(!is_default(value.weight,(double)0.0)) return false;
+    if(!value.marks.empty()) return false;
+    if(!is_default(value.owner,(uint64_t)0ULL)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::cell& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.y,(int32_t)-1)){tag|=2LL;}
+    if(!value.tag.empty()){tag|=4LL;}
+    if(!is_default(value.weight,(double)0.0)){tag|=8LL;}
+    if(!value.marks.empty()){tag|=16LL;}
+    if(!is_default(value.owner,(uint64_t)0ULL)){tag|=32LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.x);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.y);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.tag).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.weight);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.marks).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&32LL)
+    {
+      size += size_of(value.owner);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::cell& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.y,(int32_t)-1)){tag|=2LL;}
+    if(!value.tag.empty()){tag|=4LL;}
+    if(!is_default(value.weight,(double)0.0)){tag|=8LL;}
+    if(!value.marks.empty()){tag|=16LL;}
+    if(!is_default(value.owner,(uint64_t)0ULL)){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.x);
+    if(tag&2LL)    write(stream,value.y);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.tag).size();
+      write(stream,len);
+      stream.write((value.tag).data(),len);
+    }
+    if(tag&8LL)    write(stream,value.weight);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.marks).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&32LL)    write(stream,value.owner);
+  }
+
+  template<>
+  struct columns< ::my::feature::cell >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::cell& value = values[k];
+        if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.y,(int32_t)-1)){tag|=2LL;}
+        if(!value.tag.empty()){tag|=4LL;}
+        if(!is_default(value.weight,(double)0.0)){tag|=8LL;}
+        if(!value.marks.empty()){tag|=16LL;}
+        if(!is_default(value.owner,(uint64_t)0ULL)){tag|=32LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].x;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].y;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          {
+            int32_t len = (int32_t)(value.tag).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          size += size_of(value.weight);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          {
+            int32_t len = (int32_t)(value.marks).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].owner;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].x;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].y;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          {
+            int32_t len = (int32_t)(value.tag).size();
+            write(stream,len);
+            stream.write((value.tag).data(),len);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          write(stream,value.weight);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cell& value = values[k];
+          {
+            int32_t len = (int32_t)(value.marks).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].owner;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].x = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].y = column[k];}
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::cell& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.tag.resize(len);
+            stream.read((char *)value.tag.data(),len);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::cell& value = values[k];
+          {read(stream,value.weight);}
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::cell& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.marks.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.marks[i]);}
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< uint64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].owner = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::cell& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+    {
+      int32_t len = check_read_size(stream);
+      value.tag.resize(len);
+      stream.read((char *)value.tag.data(),len);
+    }
+    read(stream,value.weight);
+    {
+      int32_t len = check_read_size(stream);
+      value.marks.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.marks[i]);
+      }
+    }
+    read(stream,value.owner);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::cell& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    {
+      int32_t len = (int32_t)(value.tag).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.weight);
+    {
+      int32_t len = (int32_t)(value.marks).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.owner);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::cell& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    {
+      int32_t len = (int32_t)(value.tag).size();
+      write(stream,len);
+      stream.write((value.tag).data(),len);
+    }
+    write(stream,value.weight);
+    {
+      int32_t len = (int32_t)(value.marks).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.owner);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::grid& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read_columnar(stream,value.cells);}
+    if(tag&4LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {read_columnar(stream,value.sized_cells);}
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.cells.clear();}
+    if(!(tag&4LL)){value.sized_cells.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::grid& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_columnar(stream,value.cells);}
+        else        {skip_read_columnar(stream);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {read_columnar(stream,value.sized_cells);}
+        }
+        else        {skip_read_sized(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.cells.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.sized_cells.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::grid* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::grid* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_columnar(stream);}
+    if(index == 2) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::grid& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.cells.empty()) return false;
+    if(!value.sized_cells.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::grid& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.cells.empty()){tag|=2LL;}
+    if(!value.sized_cells.empty()){tag|=4LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_columnar(value.cells);
+    }
+    if(tag&4LL)
+    {
+      int32_t payload_len = size;
+      size += size_of_columnar(value.sized_cells);
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::grid& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.cells.empty()){tag|=2LL;}
+    if(!value.sized_cells.empty()){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write_columnar(stream,value.cells);
+    if(tag&4LL)
+    {
+      {
+        int32_t size = 0;
+        size += size_of_columnar(value.sized_cells);
+        write(stream,size);
+      }
+      write_columnar(stream,value.sized_cells);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::grid >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::grid& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.cells.empty()){tag|=2LL;}
+        if(!value.sized_cells.empty()){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::grid& value = values[k];
+          size += size_of_columnar(value.cells);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::grid& value = values[k];
+          int32_t payload_len = size;
+          size += size_of_columnar(value.sized_cells);
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::grid& value = values[k];
+          write_columnar(stream,value.cells);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::grid& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              size += size_of_columnar(value.sized_cells);
+              write(stream,size);
+            }
+            write_columnar(stream,value.sized_cells);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::grid& value = values[k];
+          {read_columnar(stream,value.cells);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::grid& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {read_columnar(stream,value.sized_cells);}
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::grid& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.cells.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.cells[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.sized_cells.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.sized_cells[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::grid& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.cells).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::cell >::const_iterator i = value.cells.begin() ; i != value.cells.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.sized_cells).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::cell >::const_iterator i = value.sized_cells.begin() ; i != value.sized_cells.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::grid& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.cells).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::cell >::const_iterator i = value.cells.begin() ; i != value.cells.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.sized_cells).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::cell >::const_iterator i = value.sized_cells.begin() ; i != value.sized_cells.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,686 @@
+#ifndef my_feature_defaults_adl_h_adata_header_define
+#define my_feature_defaults_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct stats
+  {
+    uint8_t lives;
+    int32_t hp;
+    float speed;
+    stats()
+    :    lives(3),
+    hp(100),
+    speed(1.5f)
+    {}
+  };
+
+  struct unit
+  {
+    int32_t id;
+    int64_t exp;
+    ::my::feature::stats base;
+    ::std::string name;
+    unit()
+    :    id(0),
+    exp(-1LL)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::stats>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::stats >
+{
+  enum
+  {
+    hp = 0,
+    speed = 1,
+    lives = 2,
+    member_count = 3
+  };
+};
+
+template<>
+struct is_adata<my::feature::unit>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::unit >
+{
+  enum
+  {
+    id = 0,
+    base = 1,
+    name = 2,
+    exp = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::stats& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.hp);}
+    if(tag&2LL)    {read(stream,value.speed);}
+    if(tag&4LL)    {read(stream,value.lives);}
+    if(!(tag&1LL)){value.hp = (int32_t)100;}
+    if(!(tag&2LL)){value.speed = (float)1.5f;}
+    if(!(tag&4LL)){value.lives = (uint8_t)3;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::stats& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.hp);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.speed);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.lives);}
+        else        {uint8_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.hp = (int32_t)100;}
+    if(!(tag&2LL) && (mask&2LL)){value.speed = (float)1.5f;}
+    if(!(tag&4LL) && (mask&4LL)){value.lives = (uint8_t)3;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::stats* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::stats* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::stats& value)
+  {
+    if(!is_default(value.hp,(int32_t)100)) return false;
+    if(!is_default(value.speed,(float)1.5f)) return false;
+    if(!is_default(value.lives,(uint8_t)3)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::stats& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.hp,(int32_t)100)){tag|=1LL;}
+    if(!is_default(value.speed,(float)1.5f)){tag|=2LL;}
+    if(!is_default(value.lives,(uint8_t)3)){tag|=4LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.hp);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.speed);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.lives);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::stats& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.hp,(int32_t)100)){tag|=1LL;}
+    if(!is_default(value.speed,(float)1.5f)){tag|=2LL;}
+    if(!is_default(value.lives,(uint8_t)3)){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.hp);
+    if(tag&2LL)    write(stream,value.speed);
+    if(tag&4LL)    write(stream,value.lives);
+  }
+
+  template<>
+  struct columns< ::my::feature::stats >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::stats& value = values[k];
+        if(!is_default(value.hp,(int32_t)100)){tag|=1LL;}
+        if(!is_default(value.speed,(float)1.5f)){tag|=2LL;}
+        if(!is_default(value.lives,(uint8_t)3)){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].hp;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::stats& value = values[k];
+          size += size_of(value.speed);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].lives;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].hp;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::stats& value = values[k];
+          write(stream,value.speed);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].lives;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].hp = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::stats& value = values[k];
+          {read(stream,value.speed);}
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].lives = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::stats& value)
+  {
+    read(stream,value.hp);
+    read(stream,value.speed);
+    read(stream,value.lives);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::stats& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.hp);
+    size += size_of(value.speed);
+    size += size_of(value.lives);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::stats& value)
+  {
+    write(stream,value.hp);
+    write(stream,value.speed);
+    write(stream,value.lives);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::unit& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read(stream,value.base);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&8LL)    {read(stream,value.exp);}
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.base = ::my::feature::stats();}
+    if(!(tag&4LL)){value.name.clear();}
+    if(!(tag&8LL)){value.exp = (int64_t)-1LL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::unit& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.base);}
+        else        {::my::feature::stats* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.exp);}
+        else        {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.base = ::my::feature::stats();}
+    if(!(tag&4LL) && (mask&4LL)){value.name.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.exp = (int64_t)-1LL;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::unit* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::unit* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::stats* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::unit& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!is_default(value.base)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.exp,(int64_t)-1LL)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::unit& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.base)){tag|=2LL;}
+    if(!value.name.empty()){tag|=4LL;}
+    if(!is_default(value.exp,(int64_t)-1LL)){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.base);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.exp);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::unit& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.base)){tag|=2LL;}
+    if(!value.name.empty()){tag|=4LL;}
+    if(!is_default(value.exp,(int64_t)-1LL)){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write(stream,value.base);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&8LL)    write(stream,value.exp);
+  }
+
+  template<>
+  struct columns< ::my::feature::unit >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::unit& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.base)){tag|=2LL;}
+        if(!value.name.empty()){tag|=4LL;}
+        if(!is_default(value.exp,(int64_t)-1LL)){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::unit& value = values[k];
+          size += size_of(value.base);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::unit& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].exp;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::unit& value = values[k];
+          write(stream,value.base);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::unit& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].exp;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::unit& value = values[k];
+          {read(stream,value.base);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::unit& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].exp = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::unit& value)
+  {
+    read(stream,value.id);
+    raw_read(stream,value.base);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    read(stream,value.exp);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::unit& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += raw_size_of(value.base);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.exp);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::unit& value)
+  {
+    write(stream,value.id);
+    raw_write(stream,value.base);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    write(stream,value.exp);
+  }
+
+}
+
+#endif
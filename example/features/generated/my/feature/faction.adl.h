@@ -0,0 +1,1204 @@
+#ifndef my_feature_faction_adl_h_adata_header_define
+#define my_feature_faction_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  enum class side : uint8_t
+  {
+    north = 0,
+    south = 5,
+    east = 6
+  };
+
+  enum class depth : int32_t
+  {
+    abyss = -300,
+    ground = 0,
+    sky = 40000
+  };
+
+  struct outpost
+  {
+    ::my::feature::side owner;
+    int32_t guards;
+    outpost()
+    :    owner(::my::feature::side::north),
+    guards(0)
+    {}
+  };
+
+  struct faction
+  {
+    ::my::feature::side home;
+    ::my::feature::depth level;
+    ::std::vector< ::my::feature::side > allies;
+    ::std::map< ::my::feature::side,int32_t > scores;
+    ::std::vector< ::my::feature::outpost > outposts;
+    faction()
+    :    home(::my::feature::side::south),
+    level(::my::feature::depth::abyss)
+    {}
+  };
+
+  struct faction_raw
+  {
+    uint8_t home;
+    int32_t level;
+    faction_raw()
+    :    home(5),
+    level(-300)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct enum_traits< ::my::feature::side >
+{
+  typedef uint8_t value_type;
+  enum { count = 3 };
+
+  ADATA_INLINE static const char * name(int32_t index)
+  {
+    static const char * const names[] = {"north","south","east"};
+    return names[index];
+  }
+
+  ADATA_INLINE static ::my::feature::side value(int32_t index)
+  {
+    static const ::my::feature::side values[] = {::my::feature::side::north,::my::feature::side::south,::my::feature::side::east};
+    return values[index];
+  }
+
+  // -1 if value is not an enumerator
+  ADATA_INLINE static int32_t index_of(::my::feature::side value)
+  {
+    static const int8_t indexes[] = {0,-1,-1,-1,-1,1,2};
+    uint64_t offset = (uint64_t)(int64_t)value - (uint64_t)0LL;
+    return offset < 7ULL ? indexes[offset] : -1;
+  }
+};
+
+ADATA_INLINE int32_t size_of(const ::my::feature::side& value)
+{
+  return size_of_enum(value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void read(stream_ty& stream, ::my::feature::side& value)
+{
+  read_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void write(stream_ty& stream, const ::my::feature::side& value)
+{
+  write_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::side * value)
+{
+  skip_read_enum(stream, value);
+}
+
+template<>
+struct enum_traits< ::my::feature::depth >
+{
+  typedef int32_t value_type;
+  enum { count = 3 };
+
+  ADATA_INLINE static const char * name(int32_t index)
+  {
+    static const char * const names[] = {"abyss","ground","sky"};
+    return names[index];
+  }
+
+  ADATA_INLINE static ::my::feature::depth value(int32_t index)
+  {
+    static const ::my::feature::depth values[] = {::my::feature::depth::abyss,::my::feature::depth::ground,::my::feature::depth::sky};
+    return values[index];
+  }
+
+  // -1 if value is not an enumerator
+  ADATA_INLINE static int32_t index_of(::my::feature::depth value)
+  {
+    switch ((int64_t)value)
+    {
+    case -300LL: return 0;
+    case 0LL: return 1;
+    case 40000LL: return 2;
+    default: return -1;
+    }
+  }
+};
+
+ADATA_INLINE int32_t size_of(const ::my::feature::depth& value)
+{
+  return size_of_enum(value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void read(stream_ty& stream, ::my::feature::depth& value)
+{
+  read_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void write(stream_ty& stream, const ::my::feature::depth& value)
+{
+  write_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::depth * value)
+{
+  skip_read_enum(stream, value);
+}
+
+template<>
+struct is_adata<my::feature::outpost>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::outpost >
+{
+  enum
+  {
+    owner = 0,
+    guards = 1,
+    member_count = 2
+  };
+};
+
+template<>
+struct is_adata<my::feature::faction>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::faction >
+{
+  enum
+  {
+    home = 0,
+    level = 1,
+    allies = 2,
+    scores = 3,
+    outposts = 4,
+    member_count = 5
+  };
+};
+
+template<>
+struct is_adata<my::feature::faction_raw>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::faction_raw >
+{
+  enum
+  {
+    home = 0,
+    level = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::outpost& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.owner);}
+    if(tag&2LL)    {read(stream,value.guards);}
+    if(!(tag&1LL)){value.owner = (::my::feature::side)::my::feature::side::north;}
+    if(!(tag&2LL)){value.guards = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::outpost& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.owner);}
+        else        {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.guards);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.owner = (::my::feature::side)::my::feature::side::north;}
+    if(!(tag&2LL) && (mask&2LL)){value.guards = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::outpost* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::outpost* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::outpost& value)
+  {
+    if(!is_default(value.owner,(::my::feature::side)::my::feature::side::north)) return false;
+    if(!is_default(value.guards,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::outpost& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.owner,(::my::feature::side)::my::feature::side::north)){tag|=1LL;}
+    if(!is_default(value.guards,(int32_t)0)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.owner);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.guards);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::outpost& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.owner,(::my::feature::side)::my::feature::side::north)){tag|=1LL;}
+    if(!is_default(value.guards,(int32_t)0)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.owner);
+    if(tag&2LL)    write(stream,value.guards);
+  }
+
+  template<>
+  struct columns< ::my::feature::outpost >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::outpost& value = values[k];
+        if(!is_default(value.owner,(::my::feature::side)::my::feature::side::north)){tag|=1LL;}
+        if(!is_default(value.guards,(int32_t)0)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (uint8_t)values[k].owner;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].guards;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (uint8_t)values[k].owner;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].guards;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].owner = to_enum< ::my::feature::side >(column[k]);}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].guards = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::outpost& value)
+  {
+    read(stream,value.owner);
+    read(stream,value.guards);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::outpost& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.owner);
+    size += size_of(value.guards);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::outpost& value)
+  {
+    write(stream,value.owner);
+    write(stream,value.guards);
+  }
+
+  template<typename stream_ty>
+  inline void read( stream_ty& stream, ::my::feature::faction& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.home);}
+    if(tag&2LL)    {read(stream,value.level);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.allies.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.allies[i]);}
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.scores.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        ::my::feature::side first_element;
+        int32_t second_element;
+        {read(stream,first_element);}
+        {read(stream,second_element);}
+        value.scores.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    if(tag&16LL)    {read_columnar(stream,value.outposts);}
+    if(!(tag&1LL)){value.home = (::my::feature::side)::my::feature::side::south;}
+    if(!(tag&2LL)){value.level = (::my::feature::depth)::my::feature::depth::abyss;}
+    if(!(tag&4LL)){value.allies.clear();}
+    if(!(tag&8LL)){value.scores.clear();}
+    if(!(tag&16LL)){value.outposts.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read_projected( stream_ty& stream, ::my::feature::faction& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.home);}
+        else        {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.level);}
+        else        {::my::feature::depth* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.allies.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.allies[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.scores.clear();
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            ::my::feature::side first_element;
+            int32_t second_element;
+            {read(stream,first_element);}
+            {read(stream,second_element);}
+            value.scores.insert(::std::make_pair(first_element,second_element));
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read_columnar(stream,value.outposts);}
+        else        {skip_read_columnar(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.home = (::my::feature::side)::my::feature::side::south;}
+    if(!(tag&2LL) && (mask&2LL)){value.level = (::my::feature::depth)::my::feature::depth::abyss;}
+    if(!(tag&4LL) && (mask&4LL)){value.allies.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.scores.clear();}
+    if(!(tag&16LL) && (mask&16LL)){value.outposts.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  inline void skip_read(stream_ty& stream, ::my::feature::faction* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  inline bool seek_member(stream_ty& stream, ::my::feature::faction* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::depth* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::side* dummy_value = 0;skip_read(stream,dummy_value);}
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 4) return false;
+    return false;
+  }
+
+  inline bool is_default(const ::my::feature::faction& value)
+  {
+    if(!is_default(value.home,(::my::feature::side)::my::feature::side::south)) return false;
+    if(!is_default(value.level,(::my::feature::depth)::my::feature::depth::abyss)) return false;
+    if(!value.allies.empty()) return false;
+    if(!value.scores.empty()) return false;
+    if(!value.outposts.empty()) return false;
+    return true;
+  }
+
+  inline int32_t size_of(const ::my::feature::faction& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.home,(::my::feature::side)::my::feature::side::south)){tag|=1LL;}
+    if(!is_default(value.level,(::my::feature::depth)::my::feature::depth::abyss)){tag|=2LL;}
+    if(!value.allies.empty()){tag|=4LL;}
+    if(!value.scores.empty()){tag|=8LL;}
+    if(!value.outposts.empty()){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.home);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.level);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.allies).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.scores).size();
+        size += size_of(len);
+        for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+        {
+          size += size_of(i->first);
+          size += size_of(i->second);
+        }
+      }
+    }
+    if(tag&16LL)
+    {
+      size += size_of_columnar(value.outposts);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void write(stream_ty& stream , const ::my::feature::faction& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.home,(::my::feature::side)::my::feature::side::south)){tag|=1LL;}
+    if(!is_default(value.level,(::my::feature::depth)::my::feature::depth::abyss)){tag|=2LL;}
+    if(!value.allies.empty()){tag|=4LL;}
+    if(!value.scores.empty()){tag|=8LL;}
+    if(!value.outposts.empty()){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.home);
+    if(tag&2LL)    write(stream,value.level);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.allies).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.scores).size();
+      write(stream,len);
+      for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        write(stream,i->first);
+        write(stream,i->second);
+      }
+    }
+    if(tag&16LL)    write_columnar(stream,value.outposts);
+  }
+
+  template<>
+  struct columns< ::my::feature::faction >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::faction& value = values[k];
+        if(!is_default(value.home,(::my::feature::side)::my::feature::side::south)){tag|=1LL;}
+        if(!is_default(value.level,(::my::feature::depth)::my::feature::depth::abyss)){tag|=2LL;}
+        if(!value.allies.empty()){tag|=4LL;}
+        if(!value.scores.empty()){tag|=8LL;}
+        if(!value.outposts.empty()){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (uint8_t)values[k].home;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (int32_t)values[k].level;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          {
+            int32_t len = (int32_t)(value.allies).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          {
+            int32_t len = (int32_t)(value.scores).size();
+            size += size_of(len);
+            for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+            {
+              size += size_of(i->first);
+              size += size_of(i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          size += size_of_columnar(value.outposts);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (uint8_t)values[k].home;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = (int32_t)values[k].level;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          {
+            int32_t len = (int32_t)(value.allies).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          {
+            int32_t len = (int32_t)(value.scores).size();
+            write(stream,len);
+            for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+            {
+              write(stream,i->first);
+              write(stream,i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::faction& value = values[k];
+          write_columnar(stream,value.outposts);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].home = to_enum< ::my::feature::side >(column[k]);}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].level = to_enum< ::my::feature::depth >(column[k]);}
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::faction& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.allies.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.allies[i]);}
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::faction& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.scores.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              ::my::feature::side first_element;
+              int32_t second_element;
+              {read(stream,first_element);}
+              {read(stream,second_element);}
+              value.scores.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::faction& value = values[k];
+          {read_columnar(stream,value.outposts);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  inline void raw_read( stream_ty& stream, ::my::feature::faction& value)
+  {
+    read(stream,value.home);
+    read(stream,value.level);
+    {
+      int32_t len = check_read_size(stream);
+      value.allies.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.allies[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.scores.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        ::my::feature::side first_element;
+        int32_t second_element;
+        read(stream,first_element);
+        read(stream,second_element);
+        value.scores.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.outposts.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.outposts[i]);
+      }
+    }
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::faction& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.home);
+    size += size_of(value.level);
+    {
+      int32_t len = (int32_t)(value.allies).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.scores).size();
+      size += size_of(len);
+      for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        size += size_of(i->first);
+        size += size_of(i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.outposts).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::outpost >::const_iterator i = value.outposts.begin() ; i != value.outposts.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void raw_write(stream_ty& stream , const ::my::feature::faction& value)
+  {
+    write(stream,value.home);
+    write(stream,value.level);
+    {
+      int32_t len = (int32_t)(value.allies).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::side >::const_iterator i = value.allies.begin() ; i != value.allies.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.scores).size();
+      write(stream,len);
+      for (::std::map< ::my::feature::side,int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        write(stream,i->first);
+        write(stream,i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.outposts).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::outpost >::const_iterator i = value.outposts.begin() ; i != value.outposts.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::faction_raw& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.home);}
+    if(tag&2LL)    {read(stream,value.level);}
+    if(!(tag&1LL)){value.home = (uint8_t)5;}
+    if(!(tag&2LL)){value.level = (int32_t)-300;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::faction_raw& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.home);}
+        else        {uint8_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.level);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.home = (uint8_t)5;}
+    if(!(tag&2LL) && (mask&2LL)){value.level = (int32_t)-300;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::faction_raw* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::faction_raw* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {uint8_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::faction_raw& value)
+  {
+    if(!is_default(value.home,(uint8_t)5)) return false;
+    if(!is_default(value.level,(int32_t)-300)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::faction_raw& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.home,(uint8_t)5)){tag|=1LL;}
+    if(!is_default(value.level,(int32_t)-300)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.home);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.level);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::faction_raw& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.home,(uint8_t)5)){tag|=1LL;}
+    if(!is_default(value.level,(int32_t)-300)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.home);
+    if(tag&2LL)    write(stream,value.level);
+  }
+
+  template<>
+  struct columns< ::my::feature::faction_raw >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::faction_raw& value = values[k];
+        if(!is_default(value.home,(uint8_t)5)){tag|=1LL;}
+        if(!is_default(value.level,(int32_t)-300)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].home;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].home;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].home = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].level = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::faction_raw& value)
+  {
+    read(stream,value.home);
+    read(stream,value.level);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::faction_raw& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.home);
+    size += size_of(value.level);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::faction_raw& value)
+  {
+    write(stream,value.home);
+    write(stream,value.level);
+  }
+
+}
+
+#endif
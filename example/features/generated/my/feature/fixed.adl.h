@@ -0,0 +1,852 @@
+#ifndef my_feature_fixed_adl_h_adata_header_define
+#define my_feature_fixed_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct slot
+  {
+    int16_t count;
+    int32_t item_id;
+    slot()
+    :    count(1),
+    item_id(0)
+    {}
+  };
+
+  struct loadout
+  {
+    int32_t after;
+    ::std::array< float,3 > pos;
+    ::std::array< int32_t,4 > tints;
+    ::std::array< int64_t,5 > scores;
+    ::std::array< ::std::string,2 > tags;
+    ::std::array< ::my::feature::slot,4 > hotbar;
+    loadout()
+    :    after(0),
+    pos(),
+    tints(),
+    scores(),
+    tags(),
+    hotbar()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::slot>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::slot >
+{
+  enum
+  {
+    item_id = 0,
+    count = 1,
+    member_count = 2
+  };
+};
+
+template<>
+struct is_adata<my::feature::loadout>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::loadout >
+{
+  enum
+  {
+    pos = 0,
+    tints = 1,
+    scores = 2,
+    tags = 3,
+    hotbar = 4,
+    after = 5,
+    member_count = 6
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::slot& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.item_id);}
+    if(tag&2LL)    {read(stream,value.count);}
+    if(!(tag&1LL)){value.item_id = (int32_t)0;}
+    if(!(tag&2LL)){value.count = (int16_t)1;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::slot& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.item_id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.count);}
+        else        {int16_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.item_id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.count = (int16_t)1;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::slot* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::slot* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::slot& value)
+  {
+    if(!is_default(value.item_id,(int32_t)0)) return false;
+    if(!is_default(value.count,(int16_t)1)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::slot& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.item_id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.count,(int16_t)1)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.item_id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.count);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::slot& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.item_id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.count,(int16_t)1)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.item_id);
+    if(tag&2LL)    write(stream,value.count);
+  }
+
+  template<>
+  struct columns< ::my::feature::slot >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::slot& value = values[k];
+        if(!is_default(value.item_id,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.count,(int16_t)1)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].item_id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].count;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].item_id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].count;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].item_id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].count = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::slot& value)
+  {
+    read(stream,value.item_id);
+    read(stream,value.count);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::slot& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.item_id);
+    size += size_of(value.count);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::slot& value)
+  {
+    write(stream,value.item_id);
+    write(stream,value.count);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::loadout& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_fixed_array(stream,value.pos);}
+    if(tag&2LL)    {read_fixed_array(stream,value.tints);}
+    if(tag&4LL)    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      {read(stream,value.scores[i]);}
+    }
+    if(tag&8LL)    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = check_read_size(stream);
+        value.tags[i].resize(len);
+        stream.read((char *)value.tags[i].data(),len);
+      }
+    }
+    if(tag&16LL)    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      {read(stream,value.hotbar[i]);}
+    }
+    if(tag&32LL)    {read(stream,value.after);}
+    if(!(tag&1LL)){value.pos = ::std::array< float,3 >();}
+    if(!(tag&2LL)){value.tints = ::std::array< int32_t,4 >();}
+    if(!(tag&4LL)){value.scores = ::std::array< int64_t,5 >();}
+    if(!(tag&8LL)){value.tags = ::std::array< ::std::string,2 >();}
+    if(!(tag&16LL)){value.hotbar = ::std::array< ::my::feature::slot,4 >();}
+    if(!(tag&32LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::loadout& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_fixed_array(stream,value.pos);}
+        else        {stream.skip_read(12);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_fixed_array(stream,value.tints);}
+        else        {stream.skip_read(16);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        for (int32_t i = 0 ; i < 5 ; ++i)
+        {
+          {read(stream,value.scores[i]);}
+        }
+        else        for (int32_t i = 0 ; i < 5 ; ++i)
+        {
+          {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        for (int32_t i = 0 ; i < 2 ; ++i)
+        {
+          {
+            int32_t len = check_read_size(stream);
+            value.tags[i].resize(len);
+            stream.read((char *)value.tags[i].data(),len);
+          }
+        }
+        else        for (int32_t i = 0 ; i < 2 ; ++i)
+        {
+          {
+            int32_t len = check_read_size(stream);
+            stream.skip_read(len);
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        for (int32_t i = 0 ; i < 4 ; ++i)
+        {
+          {read(stream,value.hotbar[i]);}
+        }
+        else        for (int32_t i = 0 ; i < 4 ; ++i)
+        {
+          {::my::feature::slot* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {read(stream,value.after);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.pos = ::std::array< float,3 >();}
+    if(!(tag&2LL) && (mask&2LL)){value.tints = ::std::array< int32_t,4 >();}
+    if(!(tag&4LL) && (mask&4LL)){value.scores = ::std::array< int64_t,5 >();}
+    if(!(tag&8LL) && (mask&8LL)){value.tags = ::std::array< ::std::string,2 >();}
+    if(!(tag&16LL) && (mask&16LL)){value.hotbar = ::std::array< ::my::feature::slot,4 >();}
+    if(!(tag&32LL) && (mask&32LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::loadout* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::loadout* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {stream.skip_read(12);}
+    if(index == 1) return true;
+    if(tag&2LL)    {stream.skip_read(16);}
+    if(index == 2) return true;
+    if(tag&4LL)    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = check_read_size(stream);
+        stream.skip_read(len);
+      }
+    }
+    if(index == 4) return true;
+    if(tag&16LL)    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      {::my::feature::slot* dummy_value = 0;skip_read(stream,dummy_value);}
+    }
+    if(index == 5) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::loadout& value)
+  {
+    if(!is_default(value.pos,float())) return false;
+    if(!is_default(value.tints,int32_t())) return false;
+    if(!is_default(value.scores,int64_t())) return false;
+    if(!is_default(value.tags,::std::string())) return false;
+    if(!is_default(value.hotbar,&is_default)) return false;
+    if(!is_default(value.after,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::loadout& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.pos,float())){tag|=1LL;}
+    if(!is_default(value.tints,int32_t())){tag|=2LL;}
+    if(!is_default(value.scores,int64_t())){tag|=4LL;}
+    if(!is_default(value.tags,::std::string())){tag|=8LL;}
+    if(!is_default(value.hotbar,&is_default)){tag|=16LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=32LL;}
+    if(tag&1LL)
+    {
+      size += 12;
+    }
+    if(tag&2LL)
+    {
+      size += 16;
+    }
+    if(tag&4LL)
+    {
+      for (int32_t i = 0 ; i < 5 ; ++i)
+      {
+        size += size_of(value.scores[i]);
+      }
+    }
+    if(tag&8LL)
+    {
+      for (int32_t i = 0 ; i < 2 ; ++i)
+      {
+        {
+          int32_t len = (int32_t)(value.tags[i]).size();
+          size += size_of(len);
+          size += len;
+        }
+      }
+    }
+    if(tag&16LL)
+    {
+      for (int32_t i = 0 ; i < 4 ; ++i)
+      {
+        size += size_of(value.hotbar[i]);
+      }
+    }
+    if(tag&32LL)
+    {
+      size += size_of(value.after);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::loadout& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.pos,float())){tag|=1LL;}
+    if(!is_default(value.tints,int32_t())){tag|=2LL;}
+    if(!is_default(value.scores,int64_t())){tag|=4LL;}
+    if(!is_default(value.tags,::std::string())){tag|=8LL;}
+    if(!is_default(value.hotbar,&is_default)){tag|=16LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_fixed_array(stream,value.pos);
+    if(tag&2LL)    write_fixed_array(stream,value.tints);
+    if(tag&4LL)    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      write(stream,value.scores[i]);
+    }
+    if(tag&8LL)    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = (int32_t)(value.tags[i]).size();
+        write(stream,len);
+        stream.write((value.tags[i]).data(),len);
+      }
+    }
+    if(tag&16LL)    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      write(stream,value.hotbar[i]);
+    }
+    if(tag&32LL)    write(stream,value.after);
+  }
+
+  template<>
+  struct columns< ::my::feature::loadout >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::loadout& value = values[k];
+        if(!is_default(value.pos,float())){tag|=1LL;}
+        if(!is_default(value.tints,int32_t())){tag|=2LL;}
+        if(!is_default(value.scores,int64_t())){tag|=4LL;}
+        if(!is_default(value.tags,::std::string())){tag|=8LL;}
+        if(!is_default(value.hotbar,&is_default)){tag|=16LL;}
+        if(!is_default(value.after,(int32_t)0)){tag|=32LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          size += 12;
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          size += 16;
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 5 ; ++i)
+          {
+            size += size_of(value.scores[i]);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 2 ; ++i)
+          {
+            {
+              int32_t len = (int32_t)(value.tags[i]).size();
+              size += size_of(len);
+              size += len;
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 4 ; ++i)
+          {
+            size += size_of(value.hotbar[i]);
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          write_fixed_array(stream,value.pos);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          write_fixed_array(stream,value.tints);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 5 ; ++i)
+          {
+            write(stream,value.scores[i]);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 2 ; ++i)
+          {
+            {
+              int32_t len = (int32_t)(value.tags[i]).size();
+              write(stream,len);
+              stream.write((value.tags[i]).data(),len);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 4 ; ++i)
+          {
+            write(stream,value.hotbar[i]);
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loadout& value = values[k];
+          {read_fixed_array(stream,value.pos);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loadout& value = values[k];
+          {read_fixed_array(stream,value.tints);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 5 ; ++i)
+          {
+            {read(stream,value.scores[i]);}
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 2 ; ++i)
+          {
+            {
+              int32_t len = check_read_size(stream);
+              value.tags[i].resize(len);
+              stream.read((char *)value.tags[i].data(),len);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loadout& value = values[k];
+          for (int32_t i = 0 ; i < 4 ; ++i)
+          {
+            {read(stream,value.hotbar[i]);}
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].after = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::loadout& value)
+  {
+    read_fixed_array(stream,value.pos);
+    read_fixed_array(stream,value.tints);
+    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      read(stream,value.scores[i]);
+    }
+    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = check_read_size(stream);
+        value.tags[i].resize(len);
+        stream.read((char *)value.tags[i].data(),len);
+      }
+    }
+    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      raw_read(stream,value.hotbar[i]);
+    }
+    read(stream,value.after);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::loadout& value)
+  {
+    int32_t size = 0;
+    size += 12;
+    size += 16;
+    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      size += size_of(value.scores[i]);
+    }
+    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = (int32_t)(value.tags[i]).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      size += raw_size_of(value.hotbar[i]);
+    }
+    size += size_of(value.after);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::loadout& value)
+  {
+    write_fixed_array(stream,value.pos);
+    write_fixed_array(stream,value.tints);
+    for (int32_t i = 0 ; i < 5 ; ++i)
+    {
+      write(stream,value.scores[i]);
+    }
+    for (int32_t i = 0 ; i < 2 ; ++i)
+    {
+      {
+        int32_t len = (int32_t)(value.tags[i]).size();
+        write(stream,len);
+        stream.write((value.tags[i]).data(),len);
+      }
+    }
+    for (int32_t i = 0 ; i < 4 ; ++i)
+    {
+      raw_write(stream,value.hotbar[i]);
+    }
+    write(stream,value.after);
+  }
+
+}
+
+#endif
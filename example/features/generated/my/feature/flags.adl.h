@@ -0,0 +1,643 @@
+#ifndef my_feature_flags_adl_h_adata_header_define
+#define my_feature_flags_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct switches
+  {
+    bool on;
+    bool visible;
+    int32_t after;
+    ::std::bitset< 12 > mask;
+    ::std::bitset< 70 > wide_mask;
+    switches()
+    :    on(false),
+    visible(true),
+    after(0)
+    {}
+  };
+
+  struct panel
+  {
+    ::std::vector< ::my::feature::switches > rows;
+    ::my::feature::switches single;
+    panel()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::switches>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::switches >
+{
+  enum
+  {
+    on = 0,
+    visible = 1,
+    mask = 2,
+    wide_mask = 3,
+    after = 4,
+    member_count = 5
+  };
+};
+
+template<>
+struct is_adata<my::feature::panel>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::panel >
+{
+  enum
+  {
+    rows = 0,
+    single = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::switches& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    value.on = ((tag&1LL) != 0) != false;
+    value.visible = ((tag&2LL) != 0) != true;
+    if(tag&4LL)    {read(stream,value.mask);}
+    if(tag&8LL)    {read(stream,value.wide_mask);}
+    if(tag&16LL)    {read(stream,value.after);}
+    if(!(tag&4LL)){value.mask.reset();}
+    if(!(tag&8LL)){value.wide_mask.reset();}
+    if(!(tag&16LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::switches& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.mask);}
+        else        {::std::bitset< 12 >* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.wide_mask);}
+        else        {::std::bitset< 70 >* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read(stream,value.after);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(mask&1LL){value.on = ((tag&1LL) != 0) != false;}
+    if(mask&2LL){value.visible = ((tag&2LL) != 0) != true;}
+    if(!(tag&4LL) && (mask&4LL)){value.mask.reset();}
+    if(!(tag&8LL) && (mask&8LL)){value.wide_mask.reset();}
+    if(!(tag&16LL) && (mask&16LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::switches* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::switches* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {}
+    if(index == 1) return false;
+    if(tag&2LL)    {}
+    if(index == 2) return true;
+    if(tag&4LL)    {::std::bitset< 12 >* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {::std::bitset< 70 >* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::switches& value)
+  {
+    if((bool)(value.on) != false) return false;
+    if((bool)(value.visible) != true) return false;
+    if(value.mask.any()) return false;
+    if(value.wide_mask.any()) return false;
+    if(!is_default(value.after,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::switches& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if((bool)(value.on) != false){tag|=1LL;}
+    if((bool)(value.visible) != true){tag|=2LL;}
+    if(value.mask.any()){tag|=4LL;}
+    if(value.wide_mask.any()){tag|=8LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+    //value.on bool , in the tag only.
+    //value.visible bool , in the tag only.
+    if(tag&4LL)
+    {
+      size += size_of(value.mask);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.wide_mask);
+    }
+    if(tag&16LL)
+    {
+      size += size_of(value.after);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::switches& value)
+  {
+    int64_t tag = 0LL;
+    if((bool)(value.on) != false){tag|=1LL;}
+    if((bool)(value.visible) != true){tag|=2LL;}
+    if(value.mask.any()){tag|=4LL;}
+    if(value.wide_mask.any()){tag|=8LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    //value.on bool , in the tag only.
+    //value.visible bool , in the tag only.
+    if(tag&4LL)    write(stream,value.mask);
+    if(tag&8LL)    write(stream,value.wide_mask);
+    if(tag&16LL)    write(stream,value.after);
+  }
+
+  template<>
+  struct columns< ::my::feature::switches >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::switches& value = values[k];
+        if((bool)(value.on) != false){tag|=1LL;}
+        if((bool)(value.visible) != true){tag|=2LL;}
+        if(value.mask.any()){tag|=4LL;}
+        if(value.wide_mask.any()){tag|=8LL;}
+        if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        size += size_of_bool_column(count);
+      }
+      if(tag&2LL)
+      {
+        size += size_of_bool_column(count);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::switches& value = values[k];
+          size += size_of(value.mask);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::switches& value = values[k];
+          size += size_of(value.wide_mask);
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector<bool> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].on;}
+        write_bool_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector<bool> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].visible;}
+        write_bool_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::switches& value = values[k];
+          write(stream,value.mask);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::switches& value = values[k];
+          write(stream,value.wide_mask);
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector<bool> column;
+        read_bool_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].on = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector<bool> column;
+        read_bool_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].visible = column[k];}
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::switches& value = values[k];
+          {read(stream,value.mask);}
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::switches& value = values[k];
+          {read(stream,value.wide_mask);}
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].after = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::switches& value)
+  {
+    read(stream,value.on);
+    read(stream,value.visible);
+    read(stream,value.mask);
+    read(stream,value.wide_mask);
+    read(stream,value.after);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::switches& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.on);
+    size += size_of(value.visible);
+    size += size_of(value.mask);
+    size += size_of(value.wide_mask);
+    size += size_of(value.after);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::switches& value)
+  {
+    write(stream,value.on);
+    write(stream,value.visible);
+    write(stream,value.mask);
+    write(stream,value.wide_mask);
+    write(stream,value.after);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::panel& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_columnar(stream,value.rows);}
+    if(tag&2LL)    {read(stream,value.single);}
+    if(!(tag&1LL)){value.rows.clear();}
+    if(!(tag&2LL)){value.single = ::my::feature::switches();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::panel& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_columnar(stream,value.rows);}
+        else        {skip_read_columnar(stream);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.single);}
+        else        {::my::feature::switches* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.rows.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.single = ::my::feature::switches();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::panel* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::panel* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {skip_read_columnar(stream);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::panel& value)
+  {
+    if(!value.rows.empty()) return false;
+    if(!is_default(value.single)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::panel& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.rows.empty()){tag|=1LL;}
+    if(!is_default(value.single)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of_columnar(value.rows);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.single);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::panel& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.rows.empty()){tag|=1LL;}
+    if(!is_default(value.single)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_columnar(stream,value.rows);
+    if(tag&2LL)    write(stream,value.single);
+  }
+
+  template<>
+  struct columns< ::my::feature::panel >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::panel& value = values[k];
+        if(!value.rows.empty()){tag|=1LL;}
+        if(!is_default(value.single)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::panel& value = values[k];
+          size += size_of_columnar(value.rows);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::panel& value = values[k];
+          size += size_of(value.single);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::panel& value = values[k];
+          write_columnar(stream,value.rows);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::panel& value = values[k];
+          write(stream,value.single);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::panel& value = values[k];
+          {read_columnar(stream,value.rows);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::panel& value = values[k];
+          {read(stream,value.single);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::panel& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.rows.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.rows[i]);
+      }
+    }
+    raw_read(stream,value.single);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::panel& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.rows).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::switches >::const_iterator i = value.rows.begin() ; i != value.rows.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    size += raw_size_of(value.single);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::panel& value)
+  {
+    {
+      int32_t len = (int32_t)(value.rows).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::switches >::const_iterator i = value.rows.begin() ; i != value.rows.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    raw_write(stream,value.single);
+  }
+
+}
+
+#endif
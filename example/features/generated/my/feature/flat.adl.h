@@ -0,0 +1,1580 @@
+#ifndef my_feature_flat_adl_h_adata_header_define
+#define my_feature_flat_adl_h_adata_header_define
+
+#include <adata.hpp>
+#include <adata_flat.hpp>
+
+namespace my {namespace feature {
+  enum class ware_kind : uint8_t
+  {
+    food = 0,
+    tool = 1,
+    gem = 2
+  };
+
+  struct ware
+  {
+    ::my::feature::ware_kind kind;
+    int32_t id;
+    ::adata::optional< int32_t > discount;
+    ::std::string name;
+    ::std::bitset< 10 > marks;
+    ::std::array< int16_t,3 > size;
+    ware()
+    :    kind(::my::feature::ware_kind::food),
+    id(0),
+    size()
+    {}
+  };
+
+  struct store
+  {
+    ::std::string title;
+    ::my::feature::ware featured;
+    ::std::vector< ::my::feature::ware > wares;
+    ::std::map< int32_t,::my::feature::ware > by_id;
+    ::std::map< ::std::string,int32_t > stock;
+    ::std::vector< int64_t > sales;
+    store()
+    {}
+  };
+
+  struct ware_flat
+  {
+    typedef ware_flat value_type;
+    static const uint32_t slot_size = 4;
+
+    ware_flat() : m_base(0), m_offset(0) {}
+    ware_flat(const char * base, uint32_t offset) : m_base(base), m_offset(offset) {}
+    static ware_flat load_slot(const char * base, uint32_t offset) { return ware_flat(base, ::adata::flat_load<uint32_t>(base + offset)); }
+
+    int32_t id() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 0); }
+    ::adata::flat_string name() const { return ::adata::flat_string::load_slot(m_base, m_offset + 4); }
+    ::my::feature::ware_kind kind() const { return ::adata::flat_enum< ::my::feature::ware_kind, uint8_t >::load_slot(m_base, m_offset + 8); }
+    bool has_discount() const { return m_base[m_offset + 12] != 0; }
+    int32_t discount() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 16); }
+    ::adata::flat_bits< 10 > marks() const { return ::adata::flat_bits< 10 >(m_base + m_offset + 20); }
+    ::adata::flat_list< ::adata::flat_scalar< int16_t > > size() const { return ::adata::flat_list< ::adata::flat_scalar< int16_t > >(m_base, m_offset + 22, 3); }
+  private:
+    const char * m_base;
+    uint32_t m_offset;
+  };
+
+  struct store_flat
+  {
+    typedef store_flat value_type;
+    static const uint32_t slot_size = 4;
+
+    store_flat() : m_base(0), m_offset(0) {}
+    store_flat(const char * base, uint32_t offset) : m_base(base), m_offset(offset) {}
+    static store_flat load_slot(const char * base, uint32_t offset) { return store_flat(base, ::adata::flat_load<uint32_t>(base + offset)); }
+
+    ::adata::flat_string title() const { return ::adata::flat_string::load_slot(m_base, m_offset + 0); }
+    ::my::feature::ware_flat featured() const { return ::my::feature::ware_flat::load_slot(m_base, m_offset + 4); }
+    ::adata::flat_list< ::my::feature::ware_flat > wares() const { return ::adata::flat_list< ::my::feature::ware_flat >(m_base, ::adata::flat_load<uint32_t>(m_base + m_offset + 8)); }
+    ::adata::flat_map< ::adata::flat_scalar< int32_t >, ::my::feature::ware_flat > by_id() const { return ::adata::flat_map< ::adata::flat_scalar< int32_t >, ::my::feature::ware_flat >(m_base, ::adata::flat_load<uint32_t>(m_base + m_offset + 12)); }
+    ::adata::flat_map< ::adata::flat_string, ::adata::flat_scalar< int32_t > > stock() const { return ::adata::flat_map< ::adata::flat_string, ::adata::flat_scalar< int32_t > >(m_base, ::adata::flat_load<uint32_t>(m_base + m_offset + 16)); }
+    ::adata::flat_list< ::adata::flat_scalar< int64_t > > sales() const { return ::adata::flat_list< ::adata::flat_scalar< int64_t > >(m_base, ::adata::flat_load<uint32_t>(m_base + m_offset + 20)); }
+  private:
+    const char * m_base;
+    uint32_t m_offset;
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct enum_traits< ::my::feature::ware_kind >
+{
+  typedef uint8_t value_type;
+  enum { count = 3 };
+
+  ADATA_INLINE static const char * name(int32_t index)
+  {
+    static const char * const names[] = {"food","tool","gem"};
+    return names[index];
+  }
+
+  ADATA_INLINE static ::my::feature::ware_kind value(int32_t index)
+  {
+    static const ::my::feature::ware_kind values[] = {::my::feature::ware_kind::food,::my::feature::ware_kind::tool,::my::feature::ware_kind::gem};
+    return values[index];
+  }
+
+  // -1 if value is not an enumerator
+  ADATA_INLINE static int32_t index_of(::my::feature::ware_kind value)
+  {
+    static const int8_t indexes[] = {0,1,2};
+    uint64_t offset = (uint64_t)(int64_t)value - (uint64_t)0LL;
+    return offset < 3ULL ? indexes[offset] : -1;
+  }
+};
+
+ADATA_INLINE int32_t size_of(const ::my::feature::ware_kind& value)
+{
+  return size_of_enum(value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void read(stream_ty& stream, ::my::feature::ware_kind& value)
+{
+  read_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void write(stream_ty& stream, const ::my::feature::ware_kind& value)
+{
+  write_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::ware_kind * value)
+{
+  skip_read_enum(stream, value);
+}
+
+template<>
+struct is_adata<my::feature::ware>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::ware >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    kind = 2,
+    discount = 3,
+    marks = 4,
+    size = 5,
+    member_count = 6
+  };
+};
+
+template<>
+struct is_adata<my::feature::store>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::store >
+{
+  enum
+  {
+    title = 0,
+    featured = 1,
+    wares = 2,
+    by_id = 3,
+    stock = 4,
+    sales = 5,
+    member_count = 6
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::ware& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {read(stream,value.kind);}
+    if(tag&8LL)    {
+      value.discount.emplace();
+      {read(stream,(*value.discount));}
+    }
+    if(tag&16LL)    {read(stream,value.marks);}
+    if(tag&32LL)    for (int32_t i = 0 ; i < 3 ; ++i)
+    {
+      {read(stream,value.size[i]);}
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.kind = (::my::feature::ware_kind)::my::feature::ware_kind::food;}
+    if(!(tag&8LL)){value.discount.reset();}
+    if(!(tag&16LL)){value.marks.reset();}
+    if(!(tag&32LL)){value.size = ::std::array< int16_t,3 >();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::ware& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.kind);}
+        else        {::my::feature::ware_kind* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          value.discount.emplace();
+          {read(stream,(*value.discount));}
+        }
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read(stream,value.marks);}
+        else        {::std::bitset< 10 >* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        for (int32_t i = 0 ; i < 3 ; ++i)
+        {
+          {read(stream,value.size[i]);}
+        }
+        else        for (int32_t i = 0 ; i < 3 ; ++i)
+        {
+          {int16_t* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.kind = (::my::feature::ware_kind)::my::feature::ware_kind::food;}
+    if(!(tag&8LL) && (mask&8LL)){value.discount.reset();}
+    if(!(tag&16LL) && (mask&16LL)){value.marks.reset();}
+    if(!(tag&32LL) && (mask&32LL)){value.size = ::std::array< int16_t,3 >();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::ware* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::ware* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {::my::feature::ware_kind* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {::std::bitset< 10 >* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 5) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::ware& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.kind,(::my::feature::ware_kind)::my::feature::ware_kind::food)) return false;
+    if(value.discount.has_value()) return false;
+    if(value.marks.any()) return false;
+    if(!is_default(value.size,int16_t())) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::ware& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.kind,(::my::feature::ware_kind)::my::feature::ware_kind::food)){tag|=4LL;}
+    if(value.discount.has_value()){tag|=8LL;}
+    if(value.marks.any()){tag|=16LL;}
+    if(!is_default(value.size,int16_t())){tag|=32LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.kind);
+    }
+    if(tag&8LL)
+    {
+      size += size_of((*value.discount));
+    }
+    if(tag&16LL)
+    {
+      size += size_of(value.marks);
+    }
+    if(tag&32LL)
+    {
+      for (int32_t i = 0 ; i < 3 ; ++i)
+      {
+        size += size_of(value.size[i]);
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::ware& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.kind,(::my::feature::ware_kind)::my::feature::ware_kind::food)){tag|=4LL;}
+    if(value.discount.has_value()){tag|=8LL;}
+    if(value.marks.any()){tag|=16LL;}
+    if(!is_default(value.size,int16_t())){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    write(stream,value.kind);
+    if(tag&8LL)    write(stream,(*value.discount));
+    if(tag&16LL)    write(stream,value.marks);
+    if(tag&32LL)    for (int32_t i = 0 ; i < 3 ; ++i)
+    {
+      write(stream,value.size[i]);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::ware& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    read(stream,value.kind);
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.discount.emplace();
+        read(stream,(*value.discount));
+      }
+      else{value.discount.reset();}
+    }
+    read(stream,value.marks);
+    for (int32_t i = 0 ; i < 3 ; ++i)
+    {
+      read(stream,value.size[i]);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::ware& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.kind);
+    size += 1;
+    if(value.discount.has_value())
+    {
+      size += size_of((*value.discount));
+    }
+    size += size_of(value.marks);
+    for (int32_t i = 0 ; i < 3 ; ++i)
+    {
+      size += size_of(value.size[i]);
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::ware& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    write(stream,value.kind);
+    write(stream,(uint8_t)(value.discount.has_value() ? 1 : 0));
+    if(value.discount.has_value())
+    {
+      write(stream,(*value.discount));
+    }
+    write(stream,value.marks);
+    for (int32_t i = 0 ; i < 3 ; ++i)
+    {
+      write(stream,value.size[i]);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read( stream_ty& stream, ::my::feature::store& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+    if(tag&2LL)    {read(stream,value.featured);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.wares.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.wares[i]);}
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.by_id.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::my::feature::ware second_element;
+        {read(stream,first_element);}
+        {read(stream,second_element);}
+        value.by_id.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.stock.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        ::std::string first_element;
+        int32_t second_element;
+        {
+          int32_t len = check_read_size(stream);
+          first_element.resize(len);
+          stream.read((char *)first_element.data(),len);
+        }
+        {read(stream,second_element);}
+        value.stock.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      value.sales.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.sales[i]);}
+      }
+    }
+    if(!(tag&1LL)){value.title.clear();}
+    if(!(tag&2LL)){value.featured = ::my::feature::ware();}
+    if(!(tag&4LL)){value.wares.clear();}
+    if(!(tag&8LL)){value.by_id.clear();}
+    if(!(tag&16LL)){value.stock.clear();}
+    if(!(tag&32LL)){value.sales.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read_projected( stream_ty& stream, ::my::feature::store& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.title.resize(len);
+          stream.read((char *)value.title.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.featured);}
+        else        {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.wares.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.wares[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.by_id.clear();
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            int32_t first_element;
+            ::my::feature::ware second_element;
+            {read(stream,first_element);}
+            {read(stream,second_element);}
+            value.by_id.insert(::std::make_pair(first_element,second_element));
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+            {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.stock.clear();
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            ::std::string first_element;
+            int32_t second_element;
+            {
+              int32_t len = check_read_size(stream);
+              first_element.resize(len);
+              stream.read((char *)first_element.data(),len);
+            }
+            {read(stream,second_element);}
+            value.stock.insert(::std::make_pair(first_element,second_element));
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {
+              int32_t len = check_read_size(stream);
+              stream.skip_read(len);
+            }
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {
+          int32_t len = check_read_size(stream);
+          value.sales.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.sales[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.title.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.featured = ::my::feature::ware();}
+    if(!(tag&4LL) && (mask&4LL)){value.wares.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.by_id.clear();}
+    if(!(tag&16LL) && (mask&16LL)){value.stock.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.sales.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  inline void skip_read(stream_ty& stream, ::my::feature::store* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  inline bool seek_member(stream_ty& stream, ::my::feature::store* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+        {::my::feature::ware* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 5) return true;
+    return false;
+  }
+
+  inline bool is_default(const ::my::feature::store& value)
+  {
+    if(!value.title.empty()) return false;
+    if(!is_default(value.featured)) return false;
+    if(!value.wares.empty()) return false;
+    if(!value.by_id.empty()) return false;
+    if(!value.stock.empty()) return false;
+    if(!value.sales.empty()) return false;
+    return true;
+  }
+
+  inline int32_t size_of(const ::my::feature::store& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.title.empty()){tag|=1LL;}
+    if(!is_default(value.featured)){tag|=2LL;}
+    if(!value.wares.empty()){tag|=4LL;}
+    if(!value.by_id.empty()){tag|=8LL;}
+    if(!value.stock.empty()){tag|=16LL;}
+    if(!value.sales.empty()){tag|=32LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.title).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.featured);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.wares).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.by_id).size();
+        size += size_of(len);
+        for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+        {
+          size += size_of(i->first);
+          size += size_of(i->second);
+        }
+      }
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.stock).size();
+        size += size_of(len);
+        for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+        {
+          {
+            int32_t len = (int32_t)(i->first).size();
+            size += size_of(len);
+            size += len;
+          }
+          size += size_of(i->second);
+        }
+      }
+    }
+    if(tag&32LL)
+    {
+      {
+        int32_t len = (int32_t)(value.sales).size();
+        size += size_of(len);
+        for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void write(stream_ty& stream , const ::my::feature::store& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.title.empty()){tag|=1LL;}
+    if(!is_default(value.featured)){tag|=2LL;}
+    if(!value.wares.empty()){tag|=4LL;}
+    if(!value.by_id.empty()){tag|=8LL;}
+    if(!value.stock.empty()){tag|=16LL;}
+    if(!value.sales.empty()){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+    if(tag&2LL)    write(stream,value.featured);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.wares).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.by_id).size();
+      write(stream,len);
+      for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+      {
+        write(stream,i->first);
+        write(stream,i->second);
+      }
+    }
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.stock).size();
+      write(stream,len);
+      for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+      {
+        {
+          int32_t len = (int32_t)(i->first).size();
+          write(stream,len);
+          stream.write((i->first).data(),len);
+        }
+        write(stream,i->second);
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = (int32_t)(value.sales).size();
+      write(stream,len);
+      for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::store >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::store& value = values[k];
+        if(!value.title.empty()){tag|=1LL;}
+        if(!is_default(value.featured)){tag|=2LL;}
+        if(!value.wares.empty()){tag|=4LL;}
+        if(!value.by_id.empty()){tag|=8LL;}
+        if(!value.stock.empty()){tag|=16LL;}
+        if(!value.sales.empty()){tag|=32LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          size += size_of(value.featured);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.wares).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.by_id).size();
+            size += size_of(len);
+            for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+            {
+              size += size_of(i->first);
+              size += size_of(i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.stock).size();
+            size += size_of(len);
+            for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+            {
+              {
+                int32_t len = (int32_t)(i->first).size();
+                size += size_of(len);
+                size += len;
+              }
+              size += size_of(i->second);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.sales).size();
+            size += size_of(len);
+            for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            write(stream,len);
+            stream.write((value.title).data(),len);
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          write(stream,value.featured);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.wares).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.by_id).size();
+            write(stream,len);
+            for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+            {
+              write(stream,i->first);
+              write(stream,i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.stock).size();
+            write(stream,len);
+            for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+            {
+              {
+                int32_t len = (int32_t)(i->first).size();
+                write(stream,len);
+                stream.write((i->first).data(),len);
+              }
+              write(stream,i->second);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::store& value = values[k];
+          {
+            int32_t len = (int32_t)(value.sales).size();
+            write(stream,len);
+            for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.title.resize(len);
+            stream.read((char *)value.title.data(),len);
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {read(stream,value.featured);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.wares.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.wares[i]);}
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.by_id.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              int32_t first_element;
+              ::my::feature::ware second_element;
+              {read(stream,first_element);}
+              {read(stream,second_element);}
+              value.by_id.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.stock.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              ::std::string first_element;
+              int32_t second_element;
+              {
+                int32_t len = check_read_size(stream);
+                first_element.resize(len);
+                stream.read((char *)first_element.data(),len);
+              }
+              {read(stream,second_element);}
+              value.stock.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::store& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.sales.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.sales[i]);}
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  inline void raw_read( stream_ty& stream, ::my::feature::store& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+    raw_read(stream,value.featured);
+    {
+      int32_t len = check_read_size(stream);
+      value.wares.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.wares[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.by_id.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::my::feature::ware second_element;
+        read(stream,first_element);
+        raw_read(stream,second_element);
+        value.by_id.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.stock.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        ::std::string first_element;
+        int32_t second_element;
+        {
+          int32_t len = check_read_size(stream);
+          first_element.resize(len);
+          stream.read((char *)first_element.data(),len);
+        }
+        read(stream,second_element);
+        value.stock.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.sales.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.sales[i]);
+      }
+    }
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::store& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.title).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += raw_size_of(value.featured);
+    {
+      int32_t len = (int32_t)(value.wares).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.by_id).size();
+      size += size_of(len);
+      for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+      {
+        size += size_of(i->first);
+        size += raw_size_of(i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.stock).size();
+      size += size_of(len);
+      for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+      {
+        {
+          int32_t len = (int32_t)(i->first).size();
+          size += size_of(len);
+          size += len;
+        }
+        size += size_of(i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.sales).size();
+      size += size_of(len);
+      for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void raw_write(stream_ty& stream , const ::my::feature::store& value)
+  {
+    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+    raw_write(stream,value.featured);
+    {
+      int32_t len = (int32_t)(value.wares).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.by_id).size();
+      write(stream,len);
+      for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+      {
+        write(stream,i->first);
+        raw_write(stream,i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.stock).size();
+      write(stream,len);
+      for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+      {
+        {
+          int32_t len = (int32_t)(i->first).size();
+          write(stream,len);
+          stream.write((i->first).data(),len);
+        }
+        write(stream,i->second);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.sales).size();
+      write(stream,len);
+      for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+namespace adata
+{
+  template<>
+  struct flat_traits< ::my::feature::ware >
+  {
+    typedef ::my::feature::ware value_type;
+    typedef ::my::feature::ware_flat view_type;
+    enum { size = 28, align = 4, layout = 0x296e18efU };
+
+    static void write(::adata::flat_writer& out, uint32_t offset, const value_type& value)
+    {
+      out.put(offset + 0, (int32_t)value.id);
+      out.put(offset + 4, out.add_string(value.name.data(), value.name.size()));
+      out.put(offset + 8, (uint8_t)value.kind);
+      if (value.discount.has_value())
+      {
+        out.put(offset + 12, true);
+        out.put(offset + 16, (int32_t)(*value.discount));
+      }
+      for (::std::size_t k = 0; k < 10; ++k)
+      {
+        if (value.marks[k]) out.set_bit(offset + 20, k);
+      }
+      for (uint32_t k = 0; k < 3; ++k)
+      {
+        out.put(offset + 22 + k * 2, (int16_t)value.size[k]);
+      }
+    }
+
+    static void read(const view_type& view, value_type& value)
+    {
+      value.id = view.id();
+      { ::adata::flat_string s = view.name(); value.name.assign(s.data(), s.size()); }
+      value.kind = view.kind();
+      if (view.has_discount())
+      {
+        value.discount.emplace();
+        (*value.discount) = view.discount();
+      }
+      else
+      {
+        value.discount.reset();
+      }
+      value.marks = view.marks().to_bitset();
+      {
+        ::adata::flat_list< ::adata::flat_scalar< int16_t > > list = view.size();
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+          value.size[k] = list[k];
+        }
+      }
+    }
+
+    static bool verify(::adata::flat_verifier& v, uint32_t offset, int32_t depth)
+    {
+      if (depth > ::adata::flat_max_depth || !v.record(offset, size)) return false;
+      if (!v.string(v.ref(offset + 4))) return false;
+      return true;
+    }
+  };
+
+  template<>
+  struct flat_traits< ::my::feature::store >
+  {
+    typedef ::my::feature::store value_type;
+    typedef ::my::feature::store_flat view_type;
+    enum { size = 24, align = 4, layout = 0x840dd208U };
+
+    static void write(::adata::flat_writer& out, uint32_t offset, const value_type& value)
+    {
+      out.put(offset + 0, out.add_string(value.title.data(), value.title.size()));
+      out.put(offset + 4, out.add(value.featured));
+      {
+        uint32_t list = out.add_list(value.wares.size(), 4);
+        uint32_t at = list + ::adata::flat_block_header_size;
+        for (::std::vector< ::my::feature::ware >::const_iterator i = value.wares.begin() ; i != value.wares.end() ; ++i, at += 4)
+        {
+          out.put(at, out.add((*i)));
+        }
+        out.put(offset + 8, list);
+      }
+      {
+        ::std::vector< ::std::map< int32_t,::my::feature::ware >::const_iterator > items;
+        items.reserve(value.by_id.size());
+        for (::std::map< int32_t,::my::feature::ware >::const_iterator i = value.by_id.begin() ; i != value.by_id.end() ; ++i)
+        {
+          items.push_back(i);
+        }
+        ::std::sort(items.begin(), items.end(), ::adata::flat_key_less());
+        uint32_t map = out.add_map(items.size(), 4, 4);
+        uint32_t key_at = map + ::adata::flat_block_header_size;
+        uint32_t value_at = map + ::adata::flat_map_values((uint32_t)items.size(), 4);
+        for (::std::size_t k = 0; k < items.size(); ++k, key_at += 4, value_at += 4)
+        {
+          out.put(key_at, (int32_t)items[k]->first);
+          out.put(value_at, out.add(items[k]->second));
+        }
+        out.put(offset + 12, map);
+      }
+      {
+        ::std::vector< ::std::map< ::std::string,int32_t >::const_iterator > items;
+        items.reserve(value.stock.size());
+        for (::std::map< ::std::string,int32_t >::const_iterator i = value.stock.begin() ; i != value.stock.end() ; ++i)
+        {
+          items.push_back(i);
+        }
+        ::std::sort(items.begin(), items.end(), ::adata::flat_key_less());
+        uint32_t map = out.add_map(items.size(), 4, 4);
+        uint32_t key_at = map + ::adata::flat_block_header_size;
+        uint32_t value_at = map + ::adata::flat_map_values((uint32_t)items.size(), 4);
+        for (::std::size_t k = 0; k < items.size(); ++k, key_at += 4, value_at += 4)
+        {
+          out.put(key_at, out.add_string(items[k]->first.data(), items[k]->first.size()));
+          out.put(value_at, (int32_t)items[k]->second);
+        }
+        out.put(offset + 16, map);
+      }
+      {
+        uint32_t list = out.add_list(value.sales.size(), 8);
+        uint32_t at = list + ::adata::flat_block_header_size;
+        for (::std::vector< int64_t >::const_iterator i = value.sales.begin() ; i != value.sales.end() ; ++i, at += 8)
+        {
+          out.put(at, (int64_t)(*i));
+        }
+        out.put(offset + 20, list);
+      }
+    }
+
+    static void read(const view_type& view, value_type& value)
+    {
+      { ::adata::flat_string s = view.title(); value.title.assign(s.data(), s.size()); }
+      ::adata::flat_traits< ::my::feature::ware >::read(view.featured(), value.featured);
+      {
+        ::adata::flat_list< ::my::feature::ware_flat > list = view.wares();
+        value.wares.resize(list.size());
+        ::std::vector< ::my::feature::ware >::iterator i = value.wares.begin();
+        for (uint32_t k = 0; k < list.size(); ++k, ++i)
+        {
+          ::adata::flat_traits< ::my::feature::ware >::read(list[k], (*i));
+        }
+      }
+      {
+        ::adata::flat_map< ::adata::flat_scalar< int32_t >, ::my::feature::ware_flat > map = view.by_id();
+        value.by_id.clear();
+        for (uint32_t k = 0; k < map.size(); ++k)
+        {
+          ::std::map< int32_t,::my::feature::ware >::key_type key;
+          key = map.key(k);
+          ::std::map< int32_t,::my::feature::ware >::mapped_type& item = value.by_id[key];
+          ::adata::flat_traits< ::my::feature::ware >::read(map.value(k), item);
+        }
+      }
+      {
+        ::adata::flat_map< ::adata::flat_string, ::adata::flat_scalar< int32_t > > map = view.stock();
+        value.stock.clear();
+        for (uint32_t k = 0; k < map.size(); ++k)
+        {
+          ::std::map< ::std::string,int32_t >::key_type key;
+          { ::adata::flat_string s = map.key(k); key.assign(s.data(), s.size()); }
+          ::std::map< ::std::string,int32_t >::mapped_type& item = value.stock[key];
+          item = map.value(k);
+        }
+      }
+      {
+        ::adata::flat_list< ::adata::flat_scalar< int64_t > > list = view.sales();
+        value.sales.resize(list.size());
+        ::std::vector< int64_t >::iterator i = value.sales.begin();
+        for (uint32_t k = 0; k < list.size(); ++k, ++i)
+        {
+          (*i) = list[k];
+        }
+      }
+    }
+
+    static bool verify(::adata::flat_verifier& v, uint32_t offset, int32_t depth)
+    {
+      if (depth > ::adata::flat_max_depth || !v.record(offset, size)) return false;
+      if (!v.string(v.ref(offset + 0))) return false;
+      if (!::adata::flat_traits< ::my::feature::ware >::verify(v, v.ref(offset + 4), depth + 1)) return false;
+      {
+        uint32_t count = 0;
+        uint32_t list = v.ref(offset + 8);
+        if (!v.list(list, 4, count)) return false;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+          if (!::adata::flat_traits< ::my::feature::ware >::verify(v, v.ref(list + ::adata::flat_block_header_size + k * 4), depth + 1)) return false;
+        }
+      }
+      {
+        uint32_t count = 0;
+        uint32_t map = v.ref(offset + 12);
+        if (!v.map(map, 4, 4, count)) return false;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+          if (!::adata::flat_traits< ::my::feature::ware >::verify(v, v.ref(map + ::adata::flat_map_values(count, 4) + k * 4), depth + 1)) return false;
+        }
+      }
+      {
+        uint32_t count = 0;
+        uint32_t map = v.ref(offset + 16);
+        if (!v.map(map, 4, 4, count)) return false;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+          if (!v.string(v.ref(map + ::adata::flat_block_header_size + k * 4))) return false;
+        }
+      }
+      {
+        uint32_t count = 0;
+        uint32_t list = v.ref(offset + 20);
+        if (!v.list(list, 8, count)) return false;
+      }
+      return true;
+    }
+  };
+
+}
+
+#endif
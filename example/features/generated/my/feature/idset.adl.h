@@ -0,0 +1,385 @@
+#ifndef my_feature_idset_adl_h_adata_header_define
+#define my_feature_idset_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct guild
+  {
+    int32_t id;
+    ::adata::id_set members;
+    ::adata::id_set banned;
+    guild()
+    :    id(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::guild>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::guild >
+{
+  enum
+  {
+    id = 0,
+    members = 1,
+    banned = 2,
+    member_count = 3
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::guild& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read_list(stream,value.members,list_bitmap);}
+    if(tag&4LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {read_list(stream,value.banned,list_bitmap);}
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.members.clear();}
+    if(!(tag&4LL)){value.banned.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::guild& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_list(stream,value.members,list_bitmap);}
+        else        {skip_read_list<uint32_t>(stream,list_bitmap);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {read_list(stream,value.banned,list_bitmap);}
+        }
+        else        {skip_read_sized(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.members.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.banned.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::guild* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::guild* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_list<uint32_t>(stream,list_bitmap);}
+    if(index == 2) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::guild& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.members.empty()) return false;
+    if(!value.banned.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::guild& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.members.empty()){tag|=2LL;}
+    if(!value.banned.empty()){tag|=4LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_list(value.members,list_bitmap);
+    }
+    if(tag&4LL)
+    {
+      int32_t payload_len = size;
+      size += size_of_list(value.banned,list_bitmap);
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::guild& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.members.empty()){tag|=2LL;}
+    if(!value.banned.empty()){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write_list(stream,value.members,list_bitmap);
+    if(tag&4LL)
+    {
+      {
+        int32_t size = 0;
+        size += size_of_list(value.banned,list_bitmap);
+        write(stream,size);
+      }
+      write_list(stream,value.banned,list_bitmap);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::guild >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::guild& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.members.empty()){tag|=2LL;}
+        if(!value.banned.empty()){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::guild& value = values[k];
+          size += size_of_list(value.members,list_bitmap);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::guild& value = values[k];
+          int32_t payload_len = size;
+          size += size_of_list(value.banned,list_bitmap);
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::guild& value = values[k];
+          write_list(stream,value.members,list_bitmap);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::guild& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              size += size_of_list(value.banned,list_bitmap);
+              write(stream,size);
+            }
+            write_list(stream,value.banned,list_bitmap);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::guild& value = values[k];
+          {read_list(stream,value.members,list_bitmap);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::guild& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {read_list(stream,value.banned,list_bitmap);}
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::guild& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.members.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        uint32_t id = 0;
+        read(stream,id);
+        value.members.insert(id);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.banned.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        uint32_t id = 0;
+        read(stream,id);
+        value.banned.insert(id);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::guild& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.members).size();
+      size += size_of(len);
+      for (::adata::id_set::const_iterator i = value.members.begin() ; i != value.members.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.banned).size();
+      size += size_of(len);
+      for (::adata::id_set::const_iterator i = value.banned.begin() ; i != value.banned.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::guild& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.members).size();
+      write(stream,len);
+      for (::adata::id_set::const_iterator i = value.members.begin() ; i != value.members.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.banned).size();
+      write(stream,len);
+      for (::adata::id_set::const_iterator i = value.banned.begin() ; i != value.banned.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,795 @@
+#ifndef my_feature_packed_adl_h_adata_header_define
+#define my_feature_packed_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct point3
+  {
+    float x;
+    float y;
+    float z;
+    point3()
+    :    x(0.0f),
+    y(0.0f),
+    z(0.0f)
+    {}
+  };
+
+  struct segment
+  {
+    ::my::feature::point3 from;
+    ::my::feature::point3 to;
+    uint16_t color;
+    int8_t layer;
+    segment()
+    :    color(0),
+    layer(0)
+    {}
+  };
+
+  struct drawing
+  {
+    int32_t after;
+    ::my::feature::point3 origin;
+    ::std::vector< ::my::feature::point3 > points;
+    ::std::vector< ::my::feature::segment > segments;
+    ::std::map< int32_t,::my::feature::point3 > marks;
+    drawing()
+    :    after(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::point3>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::point3 >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    z = 2,
+    member_count = 3
+  };
+};
+
+template<>
+struct is_adata<my::feature::segment>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::segment >
+{
+  enum
+  {
+    from = 0,
+    to = 1,
+    color = 2,
+    layer = 3,
+    member_count = 4
+  };
+};
+
+template<>
+struct is_adata<my::feature::drawing>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::drawing >
+{
+  enum
+  {
+    origin = 0,
+    points = 1,
+    segments = 2,
+    marks = 3,
+    after = 4,
+    member_count = 5
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::point3& value)
+  {
+    {read(stream,value.x);}
+    {read(stream,value.y);}
+    {read(stream,value.z);}
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::point3* )
+  {
+    stream.skip_read(12);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& , ::my::feature::point3* , int32_t , bool& )
+  {
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::point3& value)
+  {
+    if(!is_default(value.x,(float)0.0f)) return false;
+    if(!is_default(value.y,(float)0.0f)) return false;
+    if(!is_default(value.z,(float)0.0f)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::point3& )
+  {
+    return 12;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::point3& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    write(stream,value.z);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::point3& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+    read(stream,value.z);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::point3& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    size += size_of(value.z);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::point3& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    write(stream,value.z);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::segment& value)
+  {
+    {read(stream,value.from);}
+    {read(stream,value.to);}
+    {fix_read(stream,value.color);}
+    {fix_read(stream,value.layer);}
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::segment* )
+  {
+    stream.skip_read(27);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& , ::my::feature::segment* , int32_t , bool& )
+  {
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::segment& value)
+  {
+    if(!is_default(value.from)) return false;
+    if(!is_default(value.to)) return false;
+    if(!is_default(value.color,(uint16_t)0)) return false;
+    if(!is_default(value.layer,(int8_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::segment& )
+  {
+    return 27;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::segment& value)
+  {
+    write(stream,value.from);
+    write(stream,value.to);
+    fix_write(stream,value.color);
+    fix_write(stream,value.layer);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::segment& value)
+  {
+    raw_read(stream,value.from);
+    raw_read(stream,value.to);
+    fix_read(stream,value.color);
+    fix_read(stream,value.layer);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::segment& value)
+  {
+    int32_t size = 0;
+    size += raw_size_of(value.from);
+    size += raw_size_of(value.to);
+    size += fix_size_of(value.color);
+    size += fix_size_of(value.layer);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::segment& value)
+  {
+    raw_write(stream,value.from);
+    raw_write(stream,value.to);
+    fix_write(stream,value.color);
+    fix_write(stream,value.layer);
+  }
+
+  template<typename stream_ty>
+  inline void read( stream_ty& stream, ::my::feature::drawing& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.origin);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      read_packed_list(stream,value.points,len,12);
+    }
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      read_packed_list(stream,value.segments,len,27);
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.marks.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::my::feature::point3 second_element;
+        {read(stream,first_element);}
+        {read(stream,second_element);}
+        value.marks.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    if(tag&16LL)    {read(stream,value.after);}
+    if(!(tag&1LL)){value.origin = ::my::feature::point3();}
+    if(!(tag&2LL)){value.points.clear();}
+    if(!(tag&4LL)){value.segments.clear();}
+    if(!(tag&8LL)){value.marks.clear();}
+    if(!(tag&16LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read_projected( stream_ty& stream, ::my::feature::drawing& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.origin);}
+        else        {::my::feature::point3* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          read_packed_list(stream,value.points,len,12);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read((::std::size_t)len * 12);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          read_packed_list(stream,value.segments,len,27);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read((::std::size_t)len * 27);
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.marks.clear();
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            int32_t first_element;
+            ::my::feature::point3 second_element;
+            {read(stream,first_element);}
+            {read(stream,second_element);}
+            value.marks.insert(::std::make_pair(first_element,second_element));
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+            {::my::feature::point3* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read(stream,value.after);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.origin = ::my::feature::point3();}
+    if(!(tag&2LL) && (mask&2LL)){value.points.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.segments.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.marks.clear();}
+    if(!(tag&16LL) && (mask&16LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  inline void skip_read(stream_ty& stream, ::my::feature::drawing* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  inline bool seek_member(stream_ty& stream, ::my::feature::drawing* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {::my::feature::point3* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read((::std::size_t)len * 12);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read((::std::size_t)len * 27);
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+        {::my::feature::point3* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 4) return true;
+    return false;
+  }
+
+  inline bool is_default(const ::my::feature::drawing& value)
+  {
+    if(!is_default(value.origin)) return false;
+    if(!value.points.empty()) return false;
+    if(!value.segments.empty()) return false;
+    if(!value.marks.empty()) return false;
+    if(!is_default(value.after,(int32_t)0)) return false;
+    return true;
+  }
+
+  inline int32_t size_of(const ::my::feature::drawing& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.origin)){tag|=1LL;}
+    if(!value.points.empty()){tag|=2LL;}
+    if(!value.segments.empty()){tag|=4LL;}
+    if(!value.marks.empty()){tag|=8LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.origin);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.points).size();
+        size += size_of(len);
+        size += len * 12;
+      }
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.segments).size();
+        size += size_of(len);
+        size += len * 27;
+      }
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.marks).size();
+        size += size_of(len);
+        for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+        {
+          size += size_of(i->first);
+          size += size_of(i->second);
+        }
+      }
+    }
+    if(tag&16LL)
+    {
+      size += size_of(value.after);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void write(stream_ty& stream , const ::my::feature::drawing& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.origin)){tag|=1LL;}
+    if(!value.points.empty()){tag|=2LL;}
+    if(!value.segments.empty()){tag|=4LL;}
+    if(!value.marks.empty()){tag|=8LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.origin);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.points).size();
+      write(stream,len);
+      write_packed_list(stream,value.points,12);
+    }
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.segments).size();
+      write(stream,len);
+      write_packed_list(stream,value.segments,27);
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.marks).size();
+      write(stream,len);
+      for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        write(stream,i->first);
+        write(stream,i->second);
+      }
+    }
+    if(tag&16LL)    write(stream,value.after);
+  }
+
+  template<>
+  struct columns< ::my::feature::drawing >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::drawing& value = values[k];
+        if(!is_default(value.origin)){tag|=1LL;}
+        if(!value.points.empty()){tag|=2LL;}
+        if(!value.segments.empty()){tag|=4LL;}
+        if(!value.marks.empty()){tag|=8LL;}
+        if(!is_default(value.after,(int32_t)0)){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          size += size_of(value.origin);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.points).size();
+            size += size_of(len);
+            size += len * 12;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.segments).size();
+            size += size_of(len);
+            size += len * 27;
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.marks).size();
+            size += size_of(len);
+            for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+            {
+              size += size_of(i->first);
+              size += size_of(i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          write(stream,value.origin);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.points).size();
+            write(stream,len);
+            write_packed_list(stream,value.points,12);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.segments).size();
+            write(stream,len);
+            write_packed_list(stream,value.segments,27);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = (int32_t)(value.marks).size();
+            write(stream,len);
+            for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+            {
+              write(stream,i->first);
+              write(stream,i->second);
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::drawing& value = values[k];
+          {read(stream,value.origin);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            read_packed_list(stream,value.points,len,12);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            read_packed_list(stream,value.segments,len,27);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::drawing& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.marks.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              int32_t first_element;
+              ::my::feature::point3 second_element;
+              {read(stream,first_element);}
+              {read(stream,second_element);}
+              value.marks.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].after = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  inline void raw_read( stream_ty& stream, ::my::feature::drawing& value)
+  {
+    raw_read(stream,value.origin);
+    {
+      int32_t len = check_read_size(stream);
+      read_packed_list(stream,value.points,len,12);
+    }
+    {
+      int32_t len = check_read_size(stream);
+      read_packed_list(stream,value.segments,len,27);
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.marks.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::my::feature::point3 second_element;
+        read(stream,first_element);
+        raw_read(stream,second_element);
+        value.marks.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    read(stream,value.after);
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::drawing& value)
+  {
+    int32_t size = 0;
+    size += raw_size_of(value.origin);
+    {
+      int32_t len = (int32_t)(value.points).size();
+      size += size_of(len);
+      size += len * 12;
+    }
+    {
+      int32_t len = (int32_t)(value.segments).size();
+      size += size_of(len);
+      size += len * 27;
+    }
+    {
+      int32_t len = (int32_t)(value.marks).size();
+      size += size_of(len);
+      for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        size += size_of(i->first);
+        size += raw_size_of(i->second);
+      }
+    }
+    size += size_of(value.after);
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void raw_write(stream_ty& stream , const ::my::feature::drawing& value)
+  {
+    raw_write(stream,value.origin);
+    {
+      int32_t len = (int32_t)(value.points).size();
+      write(stream,len);
+      write_packed_list(stream,value.points,12);
+    }
+    {
+      int32_t len = (int32_t)(value.segments).size();
+      write(stream,len);
+      write_packed_list(stream,value.segments,27);
+    }
+    {
+      int32_t len = (int32_t)(value.marks).size();
+      write(stream,len);
+      for (::std::map< int32_t,::my::feature::point3 >::const_iterator i = value.marks.begin() ; i != value.marks.end() ; ++i)
+      {
+        write(stream,i->first);
+        raw_write(stream,i->second);
+      }
+    }
+    write(stream,value.after);
+  }
+
+}
+
+#endif
@@ -0,0 +1,572 @@
+#ifndef my_feature_projected_adl_h_adata_header_define
+#define my_feature_projected_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct hero
+  {
+    int32_t id;
+    int64_t gold;
+    ::std::string name;
+    ::std::vector< int32_t > scores;
+    ::std::string title;
+    hero()
+    :    id(0),
+    gold(0LL)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::hero>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::hero >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    scores = 2,
+    gold = 3,
+    title = 4,
+    member_count = 5
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::hero& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.scores.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.scores[i]);}
+      }
+    }
+    if(tag&8LL)    {read(stream,value.gold);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.scores.clear();}
+    if(!(tag&8LL)){value.gold = (int64_t)0LL;}
+    if(!(tag&16LL)){value.title.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::hero& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.scores.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.scores[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.gold);}
+        else        {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.title.resize(len);
+          stream.read((char *)value.title.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.scores.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.gold = (int64_t)0LL;}
+    if(!(tag&16LL) && (mask&16LL)){value.title.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::hero* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::hero* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 3) return true;
+    if(tag&8LL)    {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::hero& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!value.scores.empty()) return false;
+    if(!is_default(value.gold,(int64_t)0LL)) return false;
+    if(!value.title.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::hero& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!value.scores.empty()){tag|=4LL;}
+    if(!is_default(value.gold,(int64_t)0LL)){tag|=8LL;}
+    if(!value.title.empty()){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.scores).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.gold);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.title).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::hero& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!value.scores.empty()){tag|=4LL;}
+    if(!is_default(value.gold,(int64_t)0LL)){tag|=8LL;}
+    if(!value.title.empty()){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.scores).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&8LL)    write(stream,value.gold);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::hero >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::hero& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!value.scores.empty()){tag|=4LL;}
+        if(!is_default(value.gold,(int64_t)0LL)){tag|=8LL;}
+        if(!value.title.empty()){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.scores).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].gold;}
+        size += size_of_column(column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.scores).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].gold;}
+        write_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::hero& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            write(stream,len);
+            stream.write((value.title).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::hero& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::hero& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.scores.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.scores[i]);}
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].gold = column[k];}
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::hero& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.title.resize(len);
+            stream.read((char *)value.title.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::hero& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.scores.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.scores[i]);
+      }
+    }
+    read(stream,value.gold);
+    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::hero& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    {
+      int32_t len = (int32_t)(value.scores).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.gold);
+    {
+      int32_t len = (int32_t)(value.title).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::hero& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    {
+      int32_t len = (int32_t)(value.scores).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.scores.begin() ; i != value.scores.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.gold);
+    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,690 @@
+#ifndef my_feature_quant_adl_h_adata_header_define
+#define my_feature_quant_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct waypoint
+  {
+    uint8_t kind;
+    float x;
+    float y;
+    double heading;
+    ::std::string label;
+    waypoint()
+    :    kind(0),
+    x(0.0f),
+    y(0.0f),
+    heading(0.0)
+    {}
+  };
+
+  struct route
+  {
+    ::std::vector< ::my::feature::waypoint > points;
+    ::my::feature::waypoint start;
+    route()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::waypoint>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::waypoint >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    kind = 2,
+    heading = 3,
+    label = 4,
+    member_count = 5
+  };
+};
+
+template<>
+struct is_adata<my::feature::route>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::route >
+{
+  enum
+  {
+    points = 0,
+    start = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::waypoint& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if((tag&1LL) || (tag&2LL) || (tag&4LL) || (tag&8LL))
+    {
+      bit_reader<stream_ty> bits(stream);
+      if(tag&1LL){bits.read_quant(value.x,21,0.01,-8192);}
+      if(tag&2LL){bits.read_quant(value.y,21,0.01,-8192);}
+      if(tag&4LL){bits.read(value.kind,3);}
+      if(tag&8LL){bits.read_quant(value.heading,10,0.5,0);}
+    }
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.label.resize(len);
+      stream.read((char *)value.label.data(),len);
+    }
+    if(!(tag&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL)){value.y = (float)0.0f;}
+    if(!(tag&4LL)){value.kind = (uint8_t)0;}
+    if(!(tag&8LL)){value.heading = (double)0.0;}
+    if(!(tag&16LL)){value.label.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::waypoint& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if((tag&1LL) || (tag&2LL) || (tag&4LL) || (tag&8LL))
+      {
+        bit_reader<stream_ty> bits(stream);
+        if(tag&1LL){if(mask&1LL)bits.read_quant(value.x,21,0.01,-8192);else bits.skip(21);}
+        if(tag&2LL){if(mask&2LL)bits.read_quant(value.y,21,0.01,-8192);else bits.skip(21);}
+        if(tag&4LL){if(mask&4LL)bits.read(value.kind,3);else bits.skip(3);}
+        if(tag&8LL){if(mask&8LL)bits.read_quant(value.heading,10,0.5,0);else bits.skip(10);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.label.resize(len);
+          stream.read((char *)value.label.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL) && (mask&2LL)){value.y = (float)0.0f;}
+    if(!(tag&4LL) && (mask&4LL)){value.kind = (uint8_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.heading = (double)0.0;}
+    if(!(tag&16LL) && (mask&16LL)){value.label.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::waypoint* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::waypoint* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index >= 0 && index < 4) return false;
+    {
+      int32_t bit_count = 0;
+      if(tag&1LL){bit_count += 21;}
+      if(tag&2LL){bit_count += 21;}
+      if(tag&4LL){bit_count += 3;}
+      if(tag&8LL){bit_count += 10;}
+      stream.skip_read((::std::size_t)size_of_bit_run(bit_count));
+    }
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::waypoint& value)
+  {
+    if(!is_default(value.x,(float)0.0f)) return false;
+    if(!is_default(value.y,(float)0.0f)) return false;
+    if(!is_default(value.kind,(uint8_t)0)) return false;
+    if(!is_default(value.heading,(double)0.0)) return false;
+    if(!value.label.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::waypoint& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.kind,(uint8_t)0)){tag|=4LL;}
+    if(!is_default(value.heading,(double)0.0)){tag|=8LL;}
+    if(!value.label.empty()){tag|=16LL;}
+    {
+      int32_t bit_count = 0;
+      if(tag&1LL){bit_count += 21;}
+      if(tag&2LL){bit_count += 21;}
+      if(tag&4LL){bit_count += 3;}
+      if(tag&8LL){bit_count += 10;}
+      size += size_of_bit_run(bit_count);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.label).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::waypoint& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.kind,(uint8_t)0)){tag|=4LL;}
+    if(!is_default(value.heading,(double)0.0)){tag|=8LL;}
+    if(!value.label.empty()){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if((tag&1LL) || (tag&2LL) || (tag&4LL) || (tag&8LL))
+    {
+      bit_writer<stream_ty> bits(stream);
+      if(tag&1LL){bits.write_quant(value.x,21,0.01,-8192,8192);}
+      if(tag&2LL){bits.write_quant(value.y,21,0.01,-8192,8192);}
+      if(tag&4LL){bits.write(value.kind,3);}
+      if(tag&8LL){bits.write_quant(value.heading,10,0.5,0,360);}
+      bits.flush();
+    }
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.label).size();
+      write(stream,len);
+      stream.write((value.label).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::waypoint >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::waypoint& value = values[k];
+        if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+        if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+        if(!is_default(value.kind,(uint8_t)0)){tag|=4LL;}
+        if(!is_default(value.heading,(double)0.0)){tag|=8LL;}
+        if(!value.label.empty()){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].x,0.01,-8192,8192);}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].y,0.01,-8192,8192);}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].kind;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].heading,0.5,0,360);}
+        size += size_of_column(column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::waypoint& value = values[k];
+          {
+            int32_t len = (int32_t)(value.label).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].x,0.01,-8192,8192);}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].y,0.01,-8192,8192);}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].kind;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector<uint64_t> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = quantize(values[k].heading,0.5,0,360);}
+        write_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::waypoint& value = values[k];
+          {
+            int32_t len = (int32_t)(value.label).size();
+            write(stream,len);
+            stream.write((value.label).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector<uint64_t> column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].x = (float)dequantize(column[k],0.01,-8192);}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector<uint64_t> column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].y = (float)dequantize(column[k],0.01,-8192);}
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< uint8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].kind = column[k];}
+      }
+      if(tag&8LL)
+      {
+        ::std::vector<uint64_t> column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].heading = (double)dequantize(column[k],0.5,0);}
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::waypoint& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.label.resize(len);
+            stream.read((char *)value.label.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::waypoint& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+    read(stream,value.kind);
+    read(stream,value.heading);
+    {
+      int32_t len = check_read_size(stream);
+      value.label.resize(len);
+      stream.read((char *)value.label.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::waypoint& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    size += size_of(value.kind);
+    size += size_of(value.heading);
+    {
+      int32_t len = (int32_t)(value.label).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::waypoint& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    write(stream,value.kind);
+    write(stream,value.heading);
+    {
+      int32_t len = (int32_t)(value.label).size();
+      write(stream,len);
+      stream.write((value.label).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::route& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_columnar(stream,value.points);}
+    if(tag&2LL)    {read(stream,value.start);}
+    if(!(tag&1LL)){value.points.clear();}
+    if(!(tag&2LL)){value.start = ::my::feature::waypoint();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::route& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_columnar(stream,value.points);}
+        else        {skip_read_columnar(stream);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.start);}
+        else        {::my::feature::waypoint* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.points.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.start = ::my::feature::waypoint();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::route* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::route* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {skip_read_columnar(stream);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::route& value)
+  {
+    if(!value.points.empty()) return false;
+    if(!is_default(value.start)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::route& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.points.empty()){tag|=1LL;}
+    if(!is_default(value.start)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of_columnar(value.points);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.start);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::route& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.points.empty()){tag|=1LL;}
+    if(!is_default(value.start)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_columnar(stream,value.points);
+    if(tag&2LL)    write(stream,value.start);
+  }
+
+  template<>
+  struct columns< ::my::feature::route >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::route& value = values[k];
+        if(!value.points.empty()){tag|=1LL;}
+        if(!is_default(value.start)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::route& value = values[k];
+          size += size_of_columnar(value.points);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::route& value = values[k];
+          size += size_of(value.start);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::route& value = values[k];
+          write_columnar(stream,value.points);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::route& value = values[k];
+          write(stream,value.start);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::route& value = values[k];
+          {read_columnar(stream,value.points);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::route& value = values[k];
+          {read(stream,value.start);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::route& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.points.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.points[i]);
+      }
+    }
+    raw_read(stream,value.start);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::route& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.points).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::waypoint >::const_iterator i = value.points.begin() ; i != value.points.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    size += raw_size_of(value.start);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::route& value)
+  {
+    {
+      int32_t len = (int32_t)(value.points).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::waypoint >::const_iterator i = value.points.begin() ; i != value.points.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    raw_write(stream,value.start);
+  }
+
+}
+
+#endif
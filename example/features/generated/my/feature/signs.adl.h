@@ -0,0 +1,467 @@
+#ifndef my_feature_signs_adl_h_adata_header_define
+#define my_feature_signs_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct signs
+  {
+    int8_t tiny;
+    int16_t small;
+    int32_t medium;
+    int64_t large;
+    ::std::vector< int32_t > deltas;
+    signs()
+    :    tiny(0),
+    small(0),
+    medium(0),
+    large(0LL)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::signs>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::signs >
+{
+  enum
+  {
+    tiny = 0,
+    small = 1,
+    medium = 2,
+    large = 3,
+    deltas = 4,
+    member_count = 5
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::signs& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.tiny);}
+    if(tag&2LL)    {read(stream,value.small);}
+    if(tag&4LL)    {read(stream,value.medium);}
+    if(tag&8LL)    {read(stream,value.large);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.deltas.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.deltas[i]);}
+      }
+    }
+    if(!(tag&1LL)){value.tiny = (int8_t)0;}
+    if(!(tag&2LL)){value.small = (int16_t)0;}
+    if(!(tag&4LL)){value.medium = (int32_t)0;}
+    if(!(tag&8LL)){value.large = (int64_t)0LL;}
+    if(!(tag&16LL)){value.deltas.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::signs& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.tiny);}
+        else        {int8_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.small);}
+        else        {int16_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.medium);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.large);}
+        else        {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.deltas.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.deltas[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.tiny = (int8_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.small = (int16_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.medium = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.large = (int64_t)0LL;}
+    if(!(tag&16LL) && (mask&16LL)){value.deltas.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::signs* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::signs* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int8_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int16_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::signs& value)
+  {
+    if(!is_default(value.tiny,(int8_t)0)) return false;
+    if(!is_default(value.small,(int16_t)0)) return false;
+    if(!is_default(value.medium,(int32_t)0)) return false;
+    if(!is_default(value.large,(int64_t)0LL)) return false;
+    if(!value.deltas.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::signs& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.tiny,(int8_t)0)){tag|=1LL;}
+    if(!is_default(value.small,(int16_t)0)){tag|=2LL;}
+    if(!is_default(value.medium,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.large,(int64_t)0LL)){tag|=8LL;}
+    if(!value.deltas.empty()){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.tiny);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.small);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.medium);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.large);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.deltas).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::signs& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.tiny,(int8_t)0)){tag|=1LL;}
+    if(!is_default(value.small,(int16_t)0)){tag|=2LL;}
+    if(!is_default(value.medium,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.large,(int64_t)0LL)){tag|=8LL;}
+    if(!value.deltas.empty()){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.tiny);
+    if(tag&2LL)    write(stream,value.small);
+    if(tag&4LL)    write(stream,value.medium);
+    if(tag&8LL)    write(stream,value.large);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.deltas).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::signs >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::signs& value = values[k];
+        if(!is_default(value.tiny,(int8_t)0)){tag|=1LL;}
+        if(!is_default(value.small,(int16_t)0)){tag|=2LL;}
+        if(!is_default(value.medium,(int32_t)0)){tag|=4LL;}
+        if(!is_default(value.large,(int64_t)0LL)){tag|=8LL;}
+        if(!value.deltas.empty()){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].tiny;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].small;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].medium;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].large;}
+        size += size_of_column(column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::signs& value = values[k];
+          {
+            int32_t len = (int32_t)(value.deltas).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int8_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].tiny;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].small;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].medium;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].large;}
+        write_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::signs& value = values[k];
+          {
+            int32_t len = (int32_t)(value.deltas).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int8_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].tiny = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int16_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].small = column[k];}
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].medium = column[k];}
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].large = column[k];}
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::signs& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.deltas.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.deltas[i]);}
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::signs& value)
+  {
+    read(stream,value.tiny);
+    read(stream,value.small);
+    read(stream,value.medium);
+    read(stream,value.large);
+    {
+      int32_t len = check_read_size(stream);
+      value.deltas.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.deltas[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::signs& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.tiny);
+    size += size_of(value.small);
+    size += size_of(value.medium);
+    size += size_of(value.large);
+    {
+      int32_t len = (int32_t)(value.deltas).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::signs& value)
+  {
+    write(stream,value.tiny);
+    write(stream,value.small);
+    write(stream,value.medium);
+    write(stream,value.large);
+    {
+      int32_t len = (int32_t)(value.deltas).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.deltas.begin() ; i != value.deltas.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
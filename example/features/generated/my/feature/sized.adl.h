@@ -0,0 +1,1243 @@
+#ifndef my_feature_sized_adl_h_adata_header_define
+#define my_feature_sized_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct bag
+  {
+    int32_t id;
+    ::std::vector< int32_t > items;
+    ::std::map< int32_t,::std::string > names;
+    ::std::string note;
+    bag()
+    :    id(0)
+    {}
+  };
+
+  struct bag_v2
+  {
+    int32_t id;
+    //items deleted , skip define.
+    ::std::map< int32_t,::std::string > names;
+    ::std::string note;
+    bag_v2()
+    :    id(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::bag>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::bag >
+{
+  enum
+  {
+    id = 0,
+    items = 1,
+    names = 2,
+    note = 3,
+    member_count = 4
+  };
+};
+
+template<>
+struct is_adata<my::feature::bag_v2>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::bag_v2 >
+{
+  enum
+  {
+    id = 0,
+    //items deleted
+    names = 2,
+    note = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  inline void read( stream_ty& stream, ::my::feature::bag& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {
+        int32_t len = check_read_size(stream);
+        value.items.resize(len);
+        for (int32_t i = 0 ; i < len ; ++i)
+        {
+          {read(stream,value.items[i]);}
+        }
+      }
+    }
+    if(tag&4LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {
+        int32_t len = check_read_size(stream);
+        value.names.clear();
+        for (int32_t i = 0 ; i < len ; ++i)
+        {
+          int32_t first_element;
+          ::std::string second_element;
+          {read(stream,first_element);}
+          {
+            int32_t len = check_read_size(stream);
+            second_element.resize(len);
+            stream.read((char *)second_element.data(),len);
+          }
+          value.names.insert(::std::make_pair(first_element,second_element));
+        }
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.items.clear();}
+    if(!(tag&4LL)){value.names.clear();}
+    if(!(tag&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read_projected( stream_ty& stream, ::my::feature::bag& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {
+            int32_t len = check_read_size(stream);
+            value.items.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.items[i]);}
+            }
+          }
+        }
+        else        {skip_read_sized(stream);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {
+            int32_t len = check_read_size(stream);
+            value.names.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              int32_t first_element;
+              ::std::string second_element;
+              {read(stream,first_element);}
+              {
+                int32_t len = check_read_size(stream);
+                second_element.resize(len);
+                stream.read((char *)second_element.data(),len);
+              }
+              value.names.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+        else        {skip_read_sized(stream);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.note.resize(len);
+          stream.read((char *)value.note.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.items.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.names.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  inline void skip_read(stream_ty& stream, ::my::feature::bag* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  inline bool seek_member(stream_ty& stream, ::my::feature::bag* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_sized(stream);}
+    if(index == 2) return false;
+    if(tag&4LL)    {skip_read_sized(stream);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  inline bool is_default(const ::my::feature::bag& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.items.empty()) return false;
+    if(!value.names.empty()) return false;
+    if(!value.note.empty()) return false;
+    return true;
+  }
+
+  inline int32_t size_of(const ::my::feature::bag& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.items.empty()){tag|=2LL;}
+    if(!value.names.empty()){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      int32_t payload_len = size;
+      {
+        int32_t len = (int32_t)(value.items).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    if(tag&4LL)
+    {
+      int32_t payload_len = size;
+      {
+        int32_t len = (int32_t)(value.names).size();
+        size += size_of(len);
+        for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+        {
+          size += size_of(i->first);
+          {
+            int32_t len = (int32_t)(i->second).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.note).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void write(stream_ty& stream , const ::my::feature::bag& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.items.empty()){tag|=2LL;}
+    if(!value.names.empty()){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)
+    {
+      {
+        int32_t size = 0;
+        {
+          int32_t len = (int32_t)(value.items).size();
+          size += size_of(len);
+          for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+          {
+            size += size_of(*i);
+          }
+        }
+        write(stream,size);
+      }
+      {
+        int32_t len = (int32_t)(value.items).size();
+        write(stream,len);
+        for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+        {
+          write(stream,*i);
+        }
+      }
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t size = 0;
+        {
+          int32_t len = (int32_t)(value.names).size();
+          size += size_of(len);
+          for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+          {
+            size += size_of(i->first);
+            {
+              int32_t len = (int32_t)(i->second).size();
+              size += size_of(len);
+              size += len;
+            }
+          }
+        }
+        write(stream,size);
+      }
+      {
+        int32_t len = (int32_t)(value.names).size();
+        write(stream,len);
+        for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+        {
+          write(stream,i->first);
+          {
+            int32_t len = (int32_t)(i->second).size();
+            write(stream,len);
+            stream.write((i->second).data(),len);
+          }
+        }
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::bag >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::bag& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.items.empty()){tag|=2LL;}
+        if(!value.names.empty()){tag|=4LL;}
+        if(!value.note.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+          int32_t payload_len = size;
+          {
+            int32_t len = (int32_t)(value.items).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+          int32_t payload_len = size;
+          {
+            int32_t len = (int32_t)(value.names).size();
+            size += size_of(len);
+            for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+            {
+              size += size_of(i->first);
+              {
+                int32_t len = (int32_t)(i->second).size();
+                size += size_of(len);
+                size += len;
+              }
+            }
+          }
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              {
+                int32_t len = (int32_t)(value.items).size();
+                size += size_of(len);
+                for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+                {
+                  size += size_of(*i);
+                }
+              }
+              write(stream,size);
+            }
+            {
+              int32_t len = (int32_t)(value.items).size();
+              write(stream,len);
+              for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+              {
+                write(stream,*i);
+              }
+            }
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              {
+                int32_t len = (int32_t)(value.names).size();
+                size += size_of(len);
+                for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+                {
+                  size += size_of(i->first);
+                  {
+int32_t len = (int32_t)(i->second).size();
+size += size_of(len);
+size += len;
+                  }
+                }
+              }
+              write(stream,size);
+            }
+            {
+              int32_t len = (int32_t)(value.names).size();
+              write(stream,len);
+              for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+              {
+                write(stream,i->first);
+                {
+                  int32_t len = (int32_t)(i->second).size();
+                  write(stream,len);
+                  stream.write((i->second).data(),len);
+                }
+              }
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            write(stream,len);
+            stream.write((value.note).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::bag& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {
+              int32_t len = check_read_size(stream);
+              value.items.resize(len);
+              for (int32_t i = 0 ; i < len ; ++i)
+              {
+                {read(stream,value.items[i]);}
+              }
+            }
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::bag& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {
+              int32_t len = check_read_size(stream);
+              value.names.clear();
+              for (int32_t i = 0 ; i < len ; ++i)
+              {
+                int32_t first_element;
+                ::std::string second_element;
+                {read(stream,first_element);}
+                {
+                  int32_t len = check_read_size(stream);
+                  second_element.resize(len);
+                  stream.read((char *)second_element.data(),len);
+                }
+                value.names.insert(::std::make_pair(first_element,second_element));
+              }
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::bag& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.note.resize(len);
+            stream.read((char *)value.note.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  inline void raw_read( stream_ty& stream, ::my::feature::bag& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.items.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.items[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.names.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::std::string second_element;
+        read(stream,first_element);
+        {
+          int32_t len = check_read_size(stream);
+          second_element.resize(len);
+          stream.read((char *)second_element.data(),len);
+        }
+        value.names.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::bag& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.items).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.names).size();
+      size += size_of(len);
+      for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+      {
+        size += size_of(i->first);
+        {
+          int32_t len = (int32_t)(i->second).size();
+          size += size_of(len);
+          size += len;
+        }
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.note).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void raw_write(stream_ty& stream , const ::my::feature::bag& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.items).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.items.begin() ; i != value.items.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.names).size();
+      write(stream,len);
+      for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+      {
+        write(stream,i->first);
+        {
+          int32_t len = (int32_t)(i->second).size();
+          write(stream,len);
+          stream.write((i->second).data(),len);
+        }
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read( stream_ty& stream, ::my::feature::bag_v2& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {skip_read_sized(stream);}
+    if(tag&4LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {
+        int32_t len = check_read_size(stream);
+        value.names.clear();
+        for (int32_t i = 0 ; i < len ; ++i)
+        {
+          int32_t first_element;
+          ::std::string second_element;
+          {read(stream,first_element);}
+          {
+            int32_t len = check_read_size(stream);
+            second_element.resize(len);
+            stream.read((char *)second_element.data(),len);
+          }
+          value.names.insert(::std::make_pair(first_element,second_element));
+        }
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&4LL)){value.names.clear();}
+    if(!(tag&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  inline void read_projected( stream_ty& stream, ::my::feature::bag_v2& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        {skip_read_sized(stream);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {
+            int32_t len = check_read_size(stream);
+            value.names.clear();
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              int32_t first_element;
+              ::std::string second_element;
+              {read(stream,first_element);}
+              {
+                int32_t len = check_read_size(stream);
+                second_element.resize(len);
+                stream.read((char *)second_element.data(),len);
+              }
+              value.names.insert(::std::make_pair(first_element,second_element));
+            }
+          }
+        }
+        else        {skip_read_sized(stream);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.note.resize(len);
+          stream.read((char *)value.note.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.names.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  inline void skip_read(stream_ty& stream, ::my::feature::bag_v2* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  inline bool seek_member(stream_ty& stream, ::my::feature::bag_v2* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_sized(stream);}
+    if(index == 2) return false;
+    if(tag&4LL)    {skip_read_sized(stream);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  inline bool is_default(const ::my::feature::bag_v2& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.names.empty()) return false;
+    if(!value.note.empty()) return false;
+    return true;
+  }
+
+  inline int32_t size_of(const ::my::feature::bag_v2& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.names.empty()){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    //value.items deleted , skip write.
+    if(tag&4LL)
+    {
+      int32_t payload_len = size;
+      {
+        int32_t len = (int32_t)(value.names).size();
+        size += size_of(len);
+        for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+        {
+          size += size_of(i->first);
+          {
+            int32_t len = (int32_t)(i->second).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.note).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void write(stream_ty& stream , const ::my::feature::bag_v2& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.names.empty()){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    //value.items deleted , skip write.
+    if(tag&4LL)
+    {
+      {
+        int32_t size = 0;
+        {
+          int32_t len = (int32_t)(value.names).size();
+          size += size_of(len);
+          for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+          {
+            size += size_of(i->first);
+            {
+              int32_t len = (int32_t)(i->second).size();
+              size += size_of(len);
+              size += len;
+            }
+          }
+        }
+        write(stream,size);
+      }
+      {
+        int32_t len = (int32_t)(value.names).size();
+        write(stream,len);
+        for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+        {
+          write(stream,i->first);
+          {
+            int32_t len = (int32_t)(i->second).size();
+            write(stream,len);
+            stream.write((i->second).data(),len);
+          }
+        }
+      }
+    }
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::bag_v2 >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::bag_v2& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.names.empty()){tag|=4LL;}
+        if(!value.note.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag_v2& value = values[k];
+          int32_t payload_len = size;
+          {
+            int32_t len = (int32_t)(value.names).size();
+            size += size_of(len);
+            for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+            {
+              size += size_of(i->first);
+              {
+                int32_t len = (int32_t)(i->second).size();
+                size += size_of(len);
+                size += len;
+              }
+            }
+          }
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag_v2& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              {
+                int32_t len = (int32_t)(value.names).size();
+                size += size_of(len);
+                for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+                {
+                  size += size_of(i->first);
+                  {
+int32_t len = (int32_t)(i->second).size();
+size += size_of(len);
+size += len;
+                  }
+                }
+              }
+              write(stream,size);
+            }
+            {
+              int32_t len = (int32_t)(value.names).size();
+              write(stream,len);
+              for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+              {
+                write(stream,i->first);
+                {
+                  int32_t len = (int32_t)(i->second).size();
+                  write(stream,len);
+                  stream.write((i->second).data(),len);
+                }
+              }
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::bag_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            write(stream,len);
+            stream.write((value.note).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {skip_read_sized(stream);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::bag_v2& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {
+              int32_t len = check_read_size(stream);
+              value.names.clear();
+              for (int32_t i = 0 ; i < len ; ++i)
+              {
+                int32_t first_element;
+                ::std::string second_element;
+                {read(stream,first_element);}
+                {
+                  int32_t len = check_read_size(stream);
+                  second_element.resize(len);
+                  stream.read((char *)second_element.data(),len);
+                }
+                value.names.insert(::std::make_pair(first_element,second_element));
+              }
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::bag_v2& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.note.resize(len);
+            stream.read((char *)value.note.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  inline void raw_read( stream_ty& stream, ::my::feature::bag_v2& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.names.clear();
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        int32_t first_element;
+        ::std::string second_element;
+        read(stream,first_element);
+        {
+          int32_t len = check_read_size(stream);
+          second_element.resize(len);
+          stream.read((char *)second_element.data(),len);
+        }
+        value.names.insert(::std::make_pair(first_element,second_element));
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::bag_v2& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.names).size();
+      size += size_of(len);
+      for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+      {
+        size += size_of(i->first);
+        {
+          int32_t len = (int32_t)(i->second).size();
+          size += size_of(len);
+          size += len;
+        }
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.note).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  inline void raw_write(stream_ty& stream , const ::my::feature::bag_v2& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.names).size();
+      write(stream,len);
+      for (::std::map< int32_t,::std::string >::const_iterator i = value.names.begin() ; i != value.names.end() ; ++i)
+      {
+        write(stream,i->first);
+        {
+          int32_t len = (int32_t)(i->second).size();
+          write(stream,len);
+          stream.write((i->second).data(),len);
+        }
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,1372 @@
+#ifndef my_feature_soa_adl_h_adata_header_define
+#define my_feature_soa_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct trooper
+  {
+    bool alive;
+    int32_t id;
+    float x;
+    float y;
+    ::std::string name;
+    trooper()
+    :    alive(true),
+    id(0),
+    x(0.0f),
+    y(0.0f)
+    {}
+  };
+
+  struct trooper_soa
+  {
+    ::std::vector< int32_t > id;
+    ::std::vector< float > x;
+    ::std::vector< float > y;
+    ::std::vector< uint8_t > alive;
+    ::std::vector< ::std::string > name;
+
+    ::std::size_t size() const { return this->id.size(); }
+    bool empty() const { return this->id.empty(); }
+
+    void clear()
+    {
+      this->id.clear();
+      this->x.clear();
+      this->y.clear();
+      this->alive.clear();
+      this->name.clear();
+    }
+
+    void resize(::std::size_t count)
+    {
+      this->id.resize(count,(int32_t)0);
+      this->x.resize(count,(float)0.0f);
+      this->y.resize(count,(float)0.0f);
+      this->alive.resize(count,(uint8_t)true);
+      this->name.resize(count);
+    }
+
+    void push_back(const trooper& value)
+    {
+      this->id.push_back(value.id);
+      this->x.push_back(value.x);
+      this->y.push_back(value.y);
+      this->alive.push_back(value.alive);
+      this->name.push_back(value.name);
+    }
+
+    trooper at(::std::size_t i) const
+    {
+      trooper value;
+      value.id = this->id[i];
+      value.x = this->x[i];
+      value.y = this->y[i];
+      value.alive = this->alive[i] != 0;
+      value.name = this->name[i];
+      return value;
+    }
+
+    void set(::std::size_t i, const trooper& value)
+    {
+      this->id[i] = value.id;
+      this->x[i] = value.x;
+      this->y[i] = value.y;
+      this->alive[i] = value.alive;
+      this->name[i] = value.name;
+    }
+  };
+
+  struct squad
+  {
+    ::my::feature::trooper_soa troopers;
+    ::my::feature::trooper_soa reserve;
+    squad()
+    {}
+  };
+
+  struct squad_plain
+  {
+    ::std::vector< ::my::feature::trooper > troopers;
+    ::std::vector< ::my::feature::trooper > reserve;
+    squad_plain()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::trooper>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::trooper >
+{
+  enum
+  {
+    id = 0,
+    x = 1,
+    y = 2,
+    alive = 3,
+    name = 4,
+    member_count = 5
+  };
+};
+
+template<>
+struct is_adata<my::feature::squad>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::squad >
+{
+  enum
+  {
+    troopers = 0,
+    reserve = 1,
+    member_count = 2
+  };
+};
+
+template<>
+struct is_adata<my::feature::squad_plain>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::squad_plain >
+{
+  enum
+  {
+    troopers = 0,
+    reserve = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::trooper& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read(stream,value.x);}
+    if(tag&4LL)    {read(stream,value.y);}
+    value.alive = ((tag&8LL) != 0) != true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.x = (float)0.0f;}
+    if(!(tag&4LL)){value.y = (float)0.0f;}
+    if(!(tag&16LL)){value.name.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::trooper& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.x);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.y);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.x = (float)0.0f;}
+    if(!(tag&4LL) && (mask&4LL)){value.y = (float)0.0f;}
+    if(mask&8LL){value.alive = ((tag&8LL) != 0) != true;}
+    if(!(tag&16LL) && (mask&16LL)){value.name.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::trooper* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::trooper* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return false;
+    if(tag&8LL)    {}
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::trooper& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!is_default(value.x,(float)0.0f)) return false;
+    if(!is_default(value.y,(float)0.0f)) return false;
+    if((bool)(value.alive) != true) return false;
+    if(!value.name.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::trooper& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.x,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=4LL;}
+    if((bool)(value.alive) != true){tag|=8LL;}
+    if(!value.name.empty()){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.x);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.y);
+    }
+    //value.alive bool , in the tag only.
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::trooper& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.x,(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=4LL;}
+    if((bool)(value.alive) != true){tag|=8LL;}
+    if(!value.name.empty()){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write(stream,value.x);
+    if(tag&4LL)    write(stream,value.y);
+    //value.alive bool , in the tag only.
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::trooper >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::trooper& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.x,(float)0.0f)){tag|=2LL;}
+        if(!is_default(value.y,(float)0.0f)){tag|=4LL;}
+        if((bool)(value.alive) != true){tag|=8LL;}
+        if(!value.name.empty()){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          size += size_of(value.x);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          size += size_of(value.y);
+        }
+      }
+      if(tag&8LL)
+      {
+        size += size_of_bool_column(count);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          write(stream,value.x);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          write(stream,value.y);
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector<bool> column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].alive;}
+        write_bool_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::trooper& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::trooper& value = values[k];
+          {read(stream,value.x);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::trooper& value = values[k];
+          {read(stream,value.y);}
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector<bool> column;
+        read_bool_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].alive = column[k];}
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::trooper& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::trooper& value)
+  {
+    read(stream,value.id);
+    read(stream,value.x);
+    read(stream,value.y);
+    read(stream,value.alive);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::trooper& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += size_of(value.x);
+    size += size_of(value.y);
+    size += size_of(value.alive);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::trooper& value)
+  {
+    write(stream,value.id);
+    write(stream,value.x);
+    write(stream,value.y);
+    write(stream,value.alive);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  void read( stream_ty& stream, ::my::feature::trooper_soa& value, int size = 0)
+  {
+    int32_t count = check_read_size(stream,size);
+    value.clear();
+    value.resize(count);
+    for (int32_t k = 0 ; k < count ; ++k)
+    {
+      ::std::size_t offset = stream.read_length();
+      int64_t tag = 0;
+      read(stream,tag);
+      int32_t len_tag = 0;
+      read(stream,len_tag);
+
+      if(tag&1LL)      {read(stream,value.id[k]);}
+      if(tag&2LL)      {read(stream,value.x[k]);}
+      if(tag&4LL)      {read(stream,value.y[k]);}
+      value.alive[k] = ((tag&8LL) != 0) != true;
+      if(tag&16LL)      {
+        int32_t len = check_read_size(stream);
+        value.name[k].resize(len);
+        stream.read((char *)value.name[k].data(),len);
+      }
+      if(len_tag >= 0)
+      {
+        ::std::size_t read_len = stream.read_length() - offset;
+        ::std::size_t len = (::std::size_t)len_tag;
+        if(len > read_len) stream.skip_read(len - read_len);
+      }
+    }
+  }
+
+  inline int32_t size_of_element(const ::my::feature::trooper_soa& value, int32_t k)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id[k],(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.x[k],(float)0.0f)){tag|=2LL;}
+    if(!is_default(value.y[k],(float)0.0f)){tag|=4LL;}
+    if((bool)(value.alive[k]) != true){tag|=8LL;}
+    if(!value.name[k].empty()){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id[k]);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.x[k]);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.y[k]);
+    }
+    //value.alive[k] bool , in the tag only.
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name[k]).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  inline int32_t size_of(const ::my::feature::trooper_soa& value)
+  {
+    int32_t count = (int32_t)value.size();
+    int32_t size = size_of(count);
+    for (int32_t k = 0 ; k < count ; ++k){size += size_of_element(value,k);}
+    return size;
+  }
+
+  template<typename stream_ty>
+  void write(stream_ty& stream , const ::my::feature::trooper_soa& value)
+  {
+    int32_t count = (int32_t)value.size();
+    write(stream,count);
+    for (int32_t k = 0 ; k < count ; ++k)
+    {
+      int64_t tag = 0LL;
+      if(!is_default(value.id[k],(int32_t)0)){tag|=1LL;}
+      if(!is_default(value.x[k],(float)0.0f)){tag|=2LL;}
+      if(!is_default(value.y[k],(float)0.0f)){tag|=4LL;}
+      if((bool)(value.alive[k]) != true){tag|=8LL;}
+      if(!value.name[k].empty()){tag|=16LL;}
+      write(stream,tag);
+      write(stream,size_of_element(value,k));
+      if(tag&1LL)      write(stream,value.id[k]);
+      if(tag&2LL)      write(stream,value.x[k]);
+      if(tag&4LL)      write(stream,value.y[k]);
+      //value.alive[k] bool , in the tag only.
+      if(tag&16LL)      {
+        int32_t len = (int32_t)(value.name[k]).size();
+        write(stream,len);
+        stream.write((value.name[k]).data(),len);
+      }
+    }
+  }
+
+  template<typename stream_ty>
+  void raw_read( stream_ty& stream, ::my::feature::trooper_soa& value, int size = 0)
+  {
+    int32_t count = check_read_size(stream,size);
+    value.clear();
+    value.resize(count);
+    for (int32_t k = 0 ; k < count ; ++k){::my::feature::trooper element;raw_read(stream,element);value.set(k,element);}
+  }
+
+  inline int32_t raw_size_of(const ::my::feature::trooper_soa& value)
+  {
+    int32_t count = (int32_t)value.size();
+    int32_t size = size_of(count);
+    for (int32_t k = 0 ; k < count ; ++k){size += raw_size_of(value.at(k));}
+    return size;
+  }
+
+  template<typename stream_ty>
+  void raw_write(stream_ty& stream , const ::my::feature::trooper_soa& value)
+  {
+    int32_t count = (int32_t)value.size();
+    write(stream,count);
+    for (int32_t k = 0 ; k < count ; ++k){raw_write(stream,value.at(k));}
+  }
+
+  template<>
+  struct columns_of< ::my::feature::trooper_soa >
+  {
+    typedef columns< ::my::feature::trooper_soa > type;
+  };
+
+  template<>
+  struct columns< ::my::feature::trooper_soa >
+  {
+    static int64_t column_tag(const ::my::feature::trooper_soa& value)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)value.size();
+      for (int32_t k = 0 ; k < count ; ++k){if(!is_default(value.id[k],(int32_t)0)){tag|=1LL;break;}}
+      for (int32_t k = 0 ; k < count ; ++k){if(!is_default(value.x[k],(float)0.0f)){tag|=2LL;break;}}
+      for (int32_t k = 0 ; k < count ; ++k){if(!is_default(value.y[k],(float)0.0f)){tag|=4LL;break;}}
+      for (int32_t k = 0 ; k < count ; ++k){if((bool)(value.alive[k]) != true){tag|=8LL;break;}}
+      for (int32_t k = 0 ; k < count ; ++k){if(!value.name[k].empty()){tag|=16LL;break;}}
+      return tag;
+    }
+
+    static int32_t column_size(const ::my::feature::trooper_soa& value, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)value.size();
+      if(tag&1LL)
+      {
+        size += size_of_column(value.id);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          size += size_of(value.x[k]);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          size += size_of(value.y[k]);
+        }
+      }
+      if(tag&8LL)
+      {
+        size += size_of_bool_column(count);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {
+            int32_t len = (int32_t)(value.name[k]).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty>
+    static void write_columns(stream_ty& stream, const ::my::feature::trooper_soa& value, int64_t tag)
+    {
+      int32_t count = (int32_t)value.size();
+      if(tag&1LL)
+      {
+        write_column(stream,value.id);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          write(stream,value.x[k]);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          write(stream,value.y[k]);
+        }
+      }
+      if(tag&8LL)
+      {
+        write_bool_column(stream,value.alive);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {
+            int32_t len = (int32_t)(value.name[k]).size();
+            write(stream,len);
+            stream.write((value.name[k]).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty>
+    static void read_columns(stream_ty& stream, ::my::feature::trooper_soa& value, int64_t tag)
+    {
+      int32_t count = (int32_t)value.size();
+      if(tag&1LL)
+      {
+        read_column(stream,value.id,count);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {read(stream,value.x[k]);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {read(stream,value.y[k]);}
+        }
+      }
+      if(tag&8LL)
+      {
+        read_bool_column(stream,value.alive,count);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {
+            int32_t len = check_read_size(stream);
+            value.name[k].resize(len);
+            stream.read((char *)value.name[k].data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::squad& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.troopers);}
+    if(tag&2LL)    {read_columnar(stream,value.reserve);}
+    if(!(tag&1LL)){value.troopers.clear();}
+    if(!(tag&2LL)){value.reserve.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::squad& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.troopers);}
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::trooper* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_columnar(stream,value.reserve);}
+        else        {skip_read_columnar(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.troopers.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.reserve.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::squad* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::squad* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::trooper* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 1) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::squad& value)
+  {
+    if(!value.troopers.empty()) return false;
+    if(!value.reserve.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::squad& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.troopers.empty()){tag|=1LL;}
+    if(!value.reserve.empty()){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.troopers);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_columnar(value.reserve);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::squad& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.troopers.empty()){tag|=1LL;}
+    if(!value.reserve.empty()){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.troopers);
+    if(tag&2LL)    write_columnar(stream,value.reserve);
+  }
+
+  template<>
+  struct columns< ::my::feature::squad >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::squad& value = values[k];
+        if(!value.troopers.empty()){tag|=1LL;}
+        if(!value.reserve.empty()){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad& value = values[k];
+          size += size_of(value.troopers);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad& value = values[k];
+          size += size_of_columnar(value.reserve);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad& value = values[k];
+          write(stream,value.troopers);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad& value = values[k];
+          write_columnar(stream,value.reserve);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::squad& value = values[k];
+          {read(stream,value.troopers);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::squad& value = values[k];
+          {read_columnar(stream,value.reserve);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::squad& value)
+  {
+    raw_read(stream,value.troopers);
+    raw_read(stream,value.reserve);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::squad& value)
+  {
+    int32_t size = 0;
+    size += raw_size_of(value.troopers);
+    size += raw_size_of(value.reserve);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::squad& value)
+  {
+    raw_write(stream,value.troopers);
+    raw_write(stream,value.reserve);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::squad_plain& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.troopers.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.troopers[i]);}
+      }
+    }
+    if(tag&2LL)    {read_columnar(stream,value.reserve);}
+    if(!(tag&1LL)){value.troopers.clear();}
+    if(!(tag&2LL)){value.reserve.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::squad_plain& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.troopers.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.troopers[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::trooper* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_columnar(stream,value.reserve);}
+        else        {skip_read_columnar(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.troopers.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.reserve.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::squad_plain* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::squad_plain* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::trooper* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 1) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::squad_plain& value)
+  {
+    if(!value.troopers.empty()) return false;
+    if(!value.reserve.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::squad_plain& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.troopers.empty()){tag|=1LL;}
+    if(!value.reserve.empty()){tag|=2LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.troopers).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&2LL)
+    {
+      size += size_of_columnar(value.reserve);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::squad_plain& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.troopers.empty()){tag|=1LL;}
+    if(!value.reserve.empty()){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.troopers).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&2LL)    write_columnar(stream,value.reserve);
+  }
+
+  template<>
+  struct columns< ::my::feature::squad_plain >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::squad_plain& value = values[k];
+        if(!value.troopers.empty()){tag|=1LL;}
+        if(!value.reserve.empty()){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad_plain& value = values[k];
+          {
+            int32_t len = (int32_t)(value.troopers).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad_plain& value = values[k];
+          size += size_of_columnar(value.reserve);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad_plain& value = values[k];
+          {
+            int32_t len = (int32_t)(value.troopers).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::squad_plain& value = values[k];
+          write_columnar(stream,value.reserve);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::squad_plain& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.troopers.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.troopers[i]);}
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::squad_plain& value = values[k];
+          {read_columnar(stream,value.reserve);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::squad_plain& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.troopers.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.troopers[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.reserve.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.reserve[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::squad_plain& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.troopers).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.reserve).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::trooper >::const_iterator i = value.reserve.begin() ; i != value.reserve.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::squad_plain& value)
+  {
+    {
+      int32_t len = (int32_t)(value.troopers).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::trooper >::const_iterator i = value.troopers.begin() ; i != value.troopers.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.reserve).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::trooper >::const_iterator i = value.reserve.begin() ; i != value.reserve.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
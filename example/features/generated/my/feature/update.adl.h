@@ -0,0 +1,1109 @@
+#ifndef my_feature_update_adl_h_adata_header_define
+#define my_feature_update_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  enum class crew : uint8_t
+  {
+    red = 0,
+    blue = 1
+  };
+
+  struct spot
+  {
+    float x;
+    float y;
+    spot()
+    :    x(0.0f),
+    y(0.0f)
+    {}
+  };
+
+  struct update
+  {
+    ::adata::optional< ::my::feature::crew > team;
+    int32_t id;
+    ::adata::optional< int32_t > hp;
+    ::adata::optional< double > speed;
+    ::adata::optional< ::my::feature::spot > pos;
+    ::adata::optional< ::std::string > title;
+    update()
+    :    id(0)
+    {}
+  };
+
+  struct update_plain
+  {
+    int32_t id;
+    int32_t hp;
+    ::my::feature::spot pos;
+    ::std::string title;
+    update_plain()
+    :    id(0),
+    hp(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct enum_traits< ::my::feature::crew >
+{
+  typedef uint8_t value_type;
+  enum { count = 2 };
+
+  ADATA_INLINE static const char * name(int32_t index)
+  {
+    static const char * const names[] = {"red","blue"};
+    return names[index];
+  }
+
+  ADATA_INLINE static ::my::feature::crew value(int32_t index)
+  {
+    static const ::my::feature::crew values[] = {::my::feature::crew::red,::my::feature::crew::blue};
+    return values[index];
+  }
+
+  // -1 if value is not an enumerator
+  ADATA_INLINE static int32_t index_of(::my::feature::crew value)
+  {
+    static const int8_t indexes[] = {0,1};
+    uint64_t offset = (uint64_t)(int64_t)value - (uint64_t)0LL;
+    return offset < 2ULL ? indexes[offset] : -1;
+  }
+};
+
+ADATA_INLINE int32_t size_of(const ::my::feature::crew& value)
+{
+  return size_of_enum(value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void read(stream_ty& stream, ::my::feature::crew& value)
+{
+  read_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void write(stream_ty& stream, const ::my::feature::crew& value)
+{
+  write_enum(stream, value);
+}
+
+template<typename stream_ty>
+ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::crew * value)
+{
+  skip_read_enum(stream, value);
+}
+
+template<>
+struct is_adata<my::feature::spot>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::spot >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    member_count = 2
+  };
+};
+
+template<>
+struct is_adata<my::feature::update>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::update >
+{
+  enum
+  {
+    id = 0,
+    pos = 1,
+    hp = 2,
+    title = 3,
+    team = 4,
+    speed = 5,
+    member_count = 6
+  };
+};
+
+template<>
+struct is_adata<my::feature::update_plain>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::update_plain >
+{
+  enum
+  {
+    id = 0,
+    pos = 1,
+    hp = 2,
+    title = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::spot& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.x);}
+    if(tag&2LL)    {read(stream,value.y);}
+    if(!(tag&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL)){value.y = (float)0.0f;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::spot& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.x);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.y);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.x = (float)0.0f;}
+    if(!(tag&2LL) && (mask&2LL)){value.y = (float)0.0f;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::spot* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::spot* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::spot& value)
+  {
+    if(!is_default(value.x,(float)0.0f)) return false;
+    if(!is_default(value.y,(float)0.0f)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::spot& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.x);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.y);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::spot& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+    if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.x);
+    if(tag&2LL)    write(stream,value.y);
+  }
+
+  template<>
+  struct columns< ::my::feature::spot >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::spot& value = values[k];
+        if(!is_default(value.x,(float)0.0f)){tag|=1LL;}
+        if(!is_default(value.y,(float)0.0f)){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::spot& value = values[k];
+          size += size_of(value.x);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::spot& value = values[k];
+          size += size_of(value.y);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::spot& value = values[k];
+          write(stream,value.x);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::spot& value = values[k];
+          write(stream,value.y);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::spot& value = values[k];
+          {read(stream,value.x);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::spot& value = values[k];
+          {read(stream,value.y);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::spot& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::spot& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::spot& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::update& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      value.pos.emplace();
+      {read(stream,(*value.pos));}
+    }
+    if(tag&4LL)    {
+      value.hp.emplace();
+      {read(stream,(*value.hp));}
+    }
+    if(tag&8LL)    {
+      value.title.emplace();
+      {
+        int32_t len = check_read_size(stream,32);
+        (*value.title).resize(len);
+        stream.read((char *)(*value.title).data(),len);
+      }
+    }
+    if(tag&16LL)    {
+      value.team.emplace();
+      {read(stream,(*value.team));}
+    }
+    if(tag&32LL)    {
+      value.speed.emplace();
+      {read(stream,(*value.speed));}
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.pos.reset();}
+    if(!(tag&4LL)){value.hp.reset();}
+    if(!(tag&8LL)){value.title.reset();}
+    if(!(tag&16LL)){value.team.reset();}
+    if(!(tag&32LL)){value.speed.reset();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::update& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          value.pos.emplace();
+          {read(stream,(*value.pos));}
+        }
+        else        {::my::feature::spot* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          value.hp.emplace();
+          {read(stream,(*value.hp));}
+        }
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          value.title.emplace();
+          {
+            int32_t len = check_read_size(stream,32);
+            (*value.title).resize(len);
+            stream.read((char *)(*value.title).data(),len);
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream,32);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          value.team.emplace();
+          {read(stream,(*value.team));}
+        }
+        else        {::my::feature::crew* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {
+          value.speed.emplace();
+          {read(stream,(*value.speed));}
+        }
+        else        {double* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.pos.reset();}
+    if(!(tag&4LL) && (mask&4LL)){value.hp.reset();}
+    if(!(tag&8LL) && (mask&8LL)){value.title.reset();}
+    if(!(tag&16LL) && (mask&16LL)){value.team.reset();}
+    if(!(tag&32LL) && (mask&32LL)){value.speed.reset();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::update* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::update* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 6) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::spot* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream,32);
+      stream.skip_read(len);
+    }
+    if(index == 4) return true;
+    if(tag&16LL)    {::my::feature::crew* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 5) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::update& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(value.pos.has_value()) return false;
+    if(value.hp.has_value()) return false;
+    if(value.title.has_value()) return false;
+    if(value.team.has_value()) return false;
+    if(value.speed.has_value()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::update& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(value.pos.has_value()){tag|=2LL;}
+    if(value.hp.has_value()){tag|=4LL;}
+    if(value.title.has_value()){tag|=8LL;}
+    if(value.team.has_value()){tag|=16LL;}
+    if(value.speed.has_value()){tag|=32LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of((*value.pos));
+    }
+    if(tag&4LL)
+    {
+      size += size_of((*value.hp));
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)((*value.title)).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&16LL)
+    {
+      size += size_of((*value.team));
+    }
+    if(tag&32LL)
+    {
+      size += size_of((*value.speed));
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::update& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(value.pos.has_value()){tag|=2LL;}
+    if(value.hp.has_value()){tag|=4LL;}
+    if(value.title.has_value()){tag|=8LL;}
+    if(value.team.has_value()){tag|=16LL;}
+    if(value.speed.has_value()){tag|=32LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write(stream,(*value.pos));
+    if(tag&4LL)    write(stream,(*value.hp));
+    if(tag&8LL)    {
+      int32_t len = (int32_t)((*value.title)).size();
+      write(stream,len);
+      stream.write(((*value.title)).data(),len);
+    }
+    if(tag&16LL)    write(stream,(*value.team));
+    if(tag&32LL)    write(stream,(*value.speed));
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::update& value)
+  {
+    read(stream,value.id);
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.pos.emplace();
+        raw_read(stream,(*value.pos));
+      }
+      else{value.pos.reset();}
+    }
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.hp.emplace();
+        read(stream,(*value.hp));
+      }
+      else{value.hp.reset();}
+    }
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.title.emplace();
+        {
+          int32_t len = check_read_size(stream,32);
+          (*value.title).resize(len);
+          stream.read((char *)(*value.title).data(),len);
+        }
+      }
+      else{value.title.reset();}
+    }
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.team.emplace();
+        read(stream,(*value.team));
+      }
+      else{value.team.reset();}
+    }
+    {
+      uint8_t has_value = 0;
+      read(stream,has_value);
+      if(has_value)
+      {
+        value.speed.emplace();
+        read(stream,(*value.speed));
+      }
+      else{value.speed.reset();}
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::update& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += 1;
+    if(value.pos.has_value())
+    {
+      size += raw_size_of((*value.pos));
+    }
+    size += 1;
+    if(value.hp.has_value())
+    {
+      size += size_of((*value.hp));
+    }
+    size += 1;
+    if(value.title.has_value())
+    {
+      {
+        int32_t len = (int32_t)((*value.title)).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += 1;
+    if(value.team.has_value())
+    {
+      size += size_of((*value.team));
+    }
+    size += 1;
+    if(value.speed.has_value())
+    {
+      size += size_of((*value.speed));
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::update& value)
+  {
+    write(stream,value.id);
+    write(stream,(uint8_t)(value.pos.has_value() ? 1 : 0));
+    if(value.pos.has_value())
+    {
+      raw_write(stream,(*value.pos));
+    }
+    write(stream,(uint8_t)(value.hp.has_value() ? 1 : 0));
+    if(value.hp.has_value())
+    {
+      write(stream,(*value.hp));
+    }
+    write(stream,(uint8_t)(value.title.has_value() ? 1 : 0));
+    if(value.title.has_value())
+    {
+      {
+        int32_t len = (int32_t)((*value.title)).size();
+        write(stream,len);
+        stream.write(((*value.title)).data(),len);
+      }
+    }
+    write(stream,(uint8_t)(value.team.has_value() ? 1 : 0));
+    if(value.team.has_value())
+    {
+      write(stream,(*value.team));
+    }
+    write(stream,(uint8_t)(value.speed.has_value() ? 1 : 0));
+    if(value.speed.has_value())
+    {
+      write(stream,(*value.speed));
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::update_plain& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read(stream,value.pos);}
+    if(tag&4LL)    {read(stream,value.hp);}
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.pos = ::my::feature::spot();}
+    if(!(tag&4LL)){value.hp = (int32_t)0;}
+    if(!(tag&8LL)){value.title.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::update_plain& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.pos);}
+        else        {::my::feature::spot* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.hp);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.title.resize(len);
+          stream.read((char *)value.title.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.pos = ::my::feature::spot();}
+    if(!(tag&4LL) && (mask&4LL)){value.hp = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.title.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::update_plain* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::update_plain* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::spot* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::update_plain& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!is_default(value.pos)) return false;
+    if(!is_default(value.hp,(int32_t)0)) return false;
+    if(!value.title.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::update_plain& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.pos)){tag|=2LL;}
+    if(!is_default(value.hp,(int32_t)0)){tag|=4LL;}
+    if(!value.title.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.pos);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.hp);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.title).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::update_plain& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.pos)){tag|=2LL;}
+    if(!is_default(value.hp,(int32_t)0)){tag|=4LL;}
+    if(!value.title.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write(stream,value.pos);
+    if(tag&4LL)    write(stream,value.hp);
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::update_plain >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::update_plain& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.pos)){tag|=2LL;}
+        if(!is_default(value.hp,(int32_t)0)){tag|=4LL;}
+        if(!value.title.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::update_plain& value = values[k];
+          size += size_of(value.pos);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].hp;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::update_plain& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::update_plain& value = values[k];
+          write(stream,value.pos);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].hp;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::update_plain& value = values[k];
+          {
+            int32_t len = (int32_t)(value.title).size();
+            write(stream,len);
+            stream.write((value.title).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::update_plain& value = values[k];
+          {read(stream,value.pos);}
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].hp = column[k];}
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::update_plain& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.title.resize(len);
+            stream.read((char *)value.title.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::update_plain& value)
+  {
+    read(stream,value.id);
+    raw_read(stream,value.pos);
+    read(stream,value.hp);
+    {
+      int32_t len = check_read_size(stream);
+      value.title.resize(len);
+      stream.read((char *)value.title.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::update_plain& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += raw_size_of(value.pos);
+    size += size_of(value.hp);
+    {
+      int32_t len = (int32_t)(value.title).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::update_plain& value)
+  {
+    write(stream,value.id);
+    raw_write(stream,value.pos);
+    write(stream,value.hp);
+    {
+      int32_t len = (int32_t)(value.title).size();
+      write(stream,len);
+      stream.write((value.title).data(),len);
+    }
+  }
+
+}
+
+#endif
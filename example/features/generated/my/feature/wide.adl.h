@@ -0,0 +1,6502 @@
+#ifndef my_feature_wide_adl_h_adata_header_define
+#define my_feature_wide_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct wide
+  {
+    int32_t m0;
+    int32_t m1;
+    int32_t m2;
+    int32_t m3;
+    int32_t m5;
+    int32_t m6;
+    int32_t m8;
+    int32_t m9;
+    int32_t m10;
+    int32_t m11;
+    int32_t m12;
+    int32_t m14;
+    int32_t m15;
+    int32_t m17;
+    int32_t m18;
+    int32_t m19;
+    int32_t m20;
+    int32_t m21;
+    int32_t m23;
+    int32_t m24;
+    int32_t m26;
+    int32_t m27;
+    int32_t m28;
+    int32_t m29;
+    int32_t m30;
+    int32_t m32;
+    int32_t m33;
+    int32_t m35;
+    int32_t m36;
+    int32_t m37;
+    int32_t m38;
+    int32_t m39;
+    int32_t m41;
+    int32_t m42;
+    int32_t m44;
+    int32_t m45;
+    int32_t m46;
+    int32_t m47;
+    int32_t m48;
+    int32_t m50;
+    int32_t m51;
+    int32_t m53;
+    int32_t m54;
+    int32_t m55;
+    int32_t m56;
+    int32_t m57;
+    int32_t m59;
+    int32_t m60;
+    int32_t m62;
+    int32_t m63;
+    int32_t m64;
+    int32_t m65;
+    int32_t m66;
+    int32_t m68;
+    int32_t m69;
+    int32_t m71;
+    ::std::string m4;
+    ::std::vector< int32_t > m7;
+    ::std::string m13;
+    ::std::vector< int32_t > m16;
+    ::std::string m22;
+    ::std::vector< int32_t > m25;
+    ::std::string m31;
+    ::std::vector< int32_t > m34;
+    ::std::string m40;
+    ::std::vector< int32_t > m43;
+    ::std::string m49;
+    ::std::vector< int32_t > m52;
+    ::std::string m58;
+    ::std::vector< int32_t > m61;
+    ::std::string m67;
+    ::std::vector< int32_t > m70;
+    wide()
+    :    m0(0),
+    m1(0),
+    m2(0),
+    m3(0),
+    m5(0),
+    m6(0),
+    m8(0),
+    m9(0),
+    m10(0),
+    m11(0),
+    m12(0),
+    m14(0),
+    m15(0),
+    m17(0),
+    m18(0),
+    m19(0),
+    m20(0),
+    m21(0),
+    m23(0),
+    m24(0),
+    m26(0),
+    m27(0),
+    m28(0),
+    m29(0),
+    m30(0),
+    m32(0),
+    m33(0),
+    m35(0),
+    m36(0),
+    m37(0),
+    m38(0),
+    m39(0),
+    m41(0),
+    m42(0),
+    m44(0),
+    m45(0),
+    m46(0),
+    m47(0),
+    m48(0),
+    m50(0),
+    m51(0),
+    m53(0),
+    m54(0),
+    m55(0),
+    m56(0),
+    m57(0),
+    m59(0),
+    m60(0),
+    m62(0),
+    m63(0),
+    m64(0),
+    m65(0),
+    m66(0),
+    m68(0),
+    m69(0),
+    m71(0)
+    {}
+  };
+
+  struct narrow
+  {
+    int32_t m0;
+    int32_t m1;
+    int32_t m2;
+    int32_t m3;
+    int32_t m5;
+    int32_t m6;
+    int32_t m8;
+    int32_t m9;
+    int32_t m10;
+    int32_t m11;
+    int32_t m12;
+    int32_t m14;
+    int32_t m15;
+    int32_t m17;
+    int32_t m18;
+    int32_t m19;
+    int32_t m20;
+    int32_t m21;
+    int32_t m23;
+    int32_t m24;
+    int32_t m26;
+    int32_t m27;
+    int32_t m28;
+    int32_t m29;
+    int32_t m30;
+    int32_t m32;
+    int32_t m33;
+    int32_t m35;
+    int32_t m36;
+    int32_t m37;
+    int32_t m38;
+    int32_t m39;
+    int32_t m41;
+    int32_t m42;
+    int32_t m44;
+    int32_t m45;
+    int32_t m46;
+    int32_t m47;
+    int32_t m48;
+    int32_t m50;
+    int32_t m51;
+    int32_t m53;
+    int32_t m54;
+    int32_t m55;
+    int32_t m56;
+    int32_t m57;
+    int32_t m59;
+    int32_t m60;
+    int32_t m62;
+    ::std::string m4;
+    ::std::vector< int32_t > m7;
+    ::std::string m13;
+    ::std::vector< int32_t > m16;
+    ::std::string m22;
+    ::std::vector< int32_t > m25;
+    ::std::string m31;
+    ::std::vector< int32_t > m34;
+    ::std::string m40;
+    ::std::vector< int32_t > m43;
+    ::std::string m49;
+    ::std::vector< int32_t > m52;
+    ::std::string m58;
+    ::std::vector< int32_t > m61;
+    narrow()
+    :    m0(0),
+    m1(0),
+    m2(0),
+    m3(0),
+    m5(0),
+    m6(0),
+    m8(0),
+    m9(0),
+    m10(0),
+    m11(0),
+    m12(0),
+    m14(0),
+    m15(0),
+    m17(0),
+    m18(0),
+    m19(0),
+    m20(0),
+    m21(0),
+    m23(0),
+    m24(0),
+    m26(0),
+    m27(0),
+    m28(0),
+    m29(0),
+    m30(0),
+    m32(0),
+    m33(0),
+    m35(0),
+    m36(0),
+    m37(0),
+    m38(0),
+    m39(0),
+    m41(0),
+    m42(0),
+    m44(0),
+    m45(0),
+    m46(0),
+    m47(0),
+    m48(0),
+    m50(0),
+    m51(0),
+    m53(0),
+    m54(0),
+    m55(0),
+    m56(0),
+    m57(0),
+    m59(0),
+    m60(0),
+    m62(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::wide>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::wide >
+{
+  enum
+  {
+    m0 = 0,
+    m1 = 1,
+    m2 = 2,
+    m3 = 3,
+    m4 = 4,
+    m5 = 5,
+    m6 = 6,
+    m7 = 7,
+    m8 = 8,
+    m9 = 9,
+    m10 = 10,
+    m11 = 11,
+    m12 = 12,
+    m13 = 13,
+    m14 = 14,
+    m15 = 15,
+    m16 = 16,
+    m17 = 17,
+    m18 = 18,
+    m19 = 19,
+    m20 = 20,
+    m21 = 21,
+    m22 = 22,
+    m23 = 23,
+    m24 = 24,
+    m25 = 25,
+    m26 = 26,
+    m27 = 27,
+    m28 = 28,
+    m29 = 29,
+    m30 = 30,
+    m31 = 31,
+    m32 = 32,
+    m33 = 33,
+    m34 = 34,
+    m35 = 35,
+    m36 = 36,
+    m37 = 37,
+    m38 = 38,
+    m39 = 39,
+    m40 = 40,
+    m41 = 41,
+    m42 = 42,
+    m43 = 43,
+    m44 = 44,
+    m45 = 45,
+    m46 = 46,
+    m47 = 47,
+    m48 = 48,
+    m49 = 49,
+    m50 = 50,
+    m51 = 51,
+    m52 = 52,
+    m53 = 53,
+    m54 = 54,
+    m55 = 55,
+    m56 = 56,
+    m57 = 57,
+    m58 = 58,
+    m59 = 59,
+    m60 = 60,
+    m61 = 61,
+    m62 = 62,
+    m63 = 63,
+    m64 = 64,
+    m65 = 65,
+    m66 = 66,
+    m67 = 67,
+    m68 = 68,
+    m69 = 69,
+    m70 = 70,
+    m71 = 71,
+    member_count = 72
+  };
+};
+
+template<>
+struct is_adata<my::feature::narrow>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::narrow >
+{
+  enum
+  {
+    m0 = 0,
+    m1 = 1,
+    m2 = 2,
+    m3 = 3,
+    m4 = 4,
+    m5 = 5,
+    m6 = 6,
+    m7 = 7,
+    m8 = 8,
+    m9 = 9,
+    m10 = 10,
+    m11 = 11,
+    m12 = 12,
+    m13 = 13,
+    m14 = 14,
+    m15 = 15,
+    m16 = 16,
+    m17 = 17,
+    m18 = 18,
+    m19 = 19,
+    m20 = 20,
+    m21 = 21,
+    m22 = 22,
+    m23 = 23,
+    m24 = 24,
+    m25 = 25,
+    m26 = 26,
+    m27 = 27,
+    m28 = 28,
+    m29 = 29,
+    m30 = 30,
+    m31 = 31,
+    m32 = 32,
+    m33 = 33,
+    m34 = 34,
+    m35 = 35,
+    m36 = 36,
+    m37 = 37,
+    m38 = 38,
+    m39 = 39,
+    m40 = 40,
+    m41 = 41,
+    m42 = 42,
+    m43 = 43,
+    m44 = 44,
+    m45 = 45,
+    m46 = 46,
+    m47 = 47,
+    m48 = 48,
+    m49 = 49,
+    m50 = 50,
+    m51 = 51,
+    m52 = 52,
+    m53 = 53,
+    m54 = 54,
+    m55 = 55,
+    m56 = 56,
+    m57 = 57,
+    m58 = 58,
+    m59 = 59,
+    m60 = 60,
+    m61 = 61,
+    m62 = 62,
+    member_count = 63
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::wide& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    uint64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    uint64_t ext_tag[2] = {0};
+
+    if(tag&1LL)    {read(stream,value.m0);}
+    if(tag&2LL)    {read(stream,value.m1);}
+    if(tag&4LL)    {read(stream,value.m2);}
+    if(tag&8LL)    {read(stream,value.m3);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.m4.resize(len);
+      stream.read((char *)value.m4.data(),len);
+    }
+    if(tag&32LL)    {read(stream,value.m5);}
+    if(tag&64LL)    {read(stream,value.m6);}
+    if(tag&128LL)    {
+      int32_t len = check_read_size(stream);
+      value.m7.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m7[i]);}
+      }
+    }
+    if(tag&256LL)    {read(stream,value.m8);}
+    if(tag&512LL)    {read(stream,value.m9);}
+    if(tag&1024LL)    {read(stream,value.m10);}
+    if(tag&2048LL)    {read(stream,value.m11);}
+    if(tag&4096LL)    {read(stream,value.m12);}
+    if(tag&8192LL)    {
+      int32_t len = check_read_size(stream);
+      value.m13.resize(len);
+      stream.read((char *)value.m13.data(),len);
+    }
+    if(tag&16384LL)    {read(stream,value.m14);}
+    if(tag&32768LL)    {read(stream,value.m15);}
+    if(tag&65536LL)    {
+      int32_t len = check_read_size(stream);
+      value.m16.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m16[i]);}
+      }
+    }
+    if(tag&131072LL)    {read(stream,value.m17);}
+    if(tag&262144LL)    {read(stream,value.m18);}
+    if(tag&524288LL)    {read(stream,value.m19);}
+    if(tag&1048576LL)    {read(stream,value.m20);}
+    if(tag&2097152LL)    {read(stream,value.m21);}
+    if(tag&4194304LL)    {
+      int32_t len = check_read_size(stream);
+      value.m22.resize(len);
+      stream.read((char *)value.m22.data(),len);
+    }
+    if(tag&8388608LL)    {read(stream,value.m23);}
+    if(tag&16777216LL)    {read(stream,value.m24);}
+    if(tag&33554432LL)    {
+      int32_t len = check_read_size(stream);
+      value.m25.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m25[i]);}
+      }
+    }
+    if(tag&67108864LL)    {read(stream,value.m26);}
+    if(tag&134217728LL)    {read(stream,value.m27);}
+    if(tag&268435456LL)    {read(stream,value.m28);}
+    if(tag&536870912LL)    {read(stream,value.m29);}
+    if(tag&1073741824LL)    {read(stream,value.m30);}
+    if(tag&2147483648LL)    {
+      int32_t len = check_read_size(stream);
+      value.m31.resize(len);
+      stream.read((char *)value.m31.data(),len);
+    }
+    if(tag&4294967296LL)    {read(stream,value.m32);}
+    if(tag&8589934592LL)    {read(stream,value.m33);}
+    if(tag&17179869184LL)    {
+      int32_t len = check_read_size(stream);
+      value.m34.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m34[i]);}
+      }
+    }
+    if(tag&34359738368LL)    {read(stream,value.m35);}
+    if(tag&68719476736LL)    {read(stream,value.m36);}
+    if(tag&137438953472LL)    {read(stream,value.m37);}
+    if(tag&274877906944LL)    {read(stream,value.m38);}
+    if(tag&549755813888LL)    {read(stream,value.m39);}
+    if(tag&1099511627776LL)    {
+      int32_t len = check_read_size(stream);
+      value.m40.resize(len);
+      stream.read((char *)value.m40.data(),len);
+    }
+    if(tag&2199023255552LL)    {read(stream,value.m41);}
+    if(tag&4398046511104LL)    {read(stream,value.m42);}
+    if(tag&8796093022208LL)    {
+      int32_t len = check_read_size(stream);
+      value.m43.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m43[i]);}
+      }
+    }
+    if(tag&17592186044416LL)    {read(stream,value.m44);}
+    if(tag&35184372088832LL)    {read(stream,value.m45);}
+    if(tag&70368744177664LL)    {read(stream,value.m46);}
+    if(tag&140737488355328LL)    {read(stream,value.m47);}
+    if(tag&281474976710656LL)    {read(stream,value.m48);}
+    if(tag&562949953421312LL)    {
+      int32_t len = check_read_size(stream);
+      value.m49.resize(len);
+      stream.read((char *)value.m49.data(),len);
+    }
+    if(tag&1125899906842624LL)    {read(stream,value.m50);}
+    if(tag&2251799813685248LL)    {read(stream,value.m51);}
+    if(tag&4503599627370496LL)    {
+      int32_t len = check_read_size(stream);
+      value.m52.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m52[i]);}
+      }
+    }
+    if(tag&9007199254740992LL)    {read(stream,value.m53);}
+    if(tag&18014398509481984LL)    {read(stream,value.m54);}
+    if(tag&36028797018963968LL)    {read(stream,value.m55);}
+    if(tag&72057594037927936LL)    {read(stream,value.m56);}
+    if(tag&144115188075855872LL)    {read(stream,value.m57);}
+    if(tag&288230376151711744LL)    {
+      int32_t len = check_read_size(stream);
+      value.m58.resize(len);
+      stream.read((char *)value.m58.data(),len);
+    }
+    if(tag&576460752303423488LL)    {read(stream,value.m59);}
+    if(tag&1152921504606846976LL)    {read(stream,value.m60);}
+    if(tag&2305843009213693952LL)    {
+      int32_t len = check_read_size(stream);
+      value.m61.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m61[i]);}
+      }
+    }
+    if(tag&4611686018427387904LL)    {read(stream,value.m62);}
+    if(tag&ext_tag_bit) read_ext_tag(stream,ext_tag,2);
+    if(ext_tag[0]&9223372036854775808ULL)    {read(stream,value.m63);}
+    if(ext_tag[1]&1ULL)    {read(stream,value.m64);}
+    if(ext_tag[1]&2ULL)    {read(stream,value.m65);}
+    if(ext_tag[1]&4ULL)    {read(stream,value.m66);}
+    if(ext_tag[1]&8ULL)    {
+      int32_t len = check_read_size(stream);
+      value.m67.resize(len);
+      stream.read((char *)value.m67.data(),len);
+    }
+    if(ext_tag[1]&16ULL)    {read(stream,value.m68);}
+    if(ext_tag[1]&32ULL)    {read(stream,value.m69);}
+    if(ext_tag[1]&64ULL)    {
+      int32_t len = check_read_size(stream);
+      value.m70.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m70[i]);}
+      }
+    }
+    if(ext_tag[1]&128ULL)    {read(stream,value.m71);}
+    if(!(tag&1LL)){value.m0 = (int32_t)0;}
+    if(!(tag&2LL)){value.m1 = (int32_t)0;}
+    if(!(tag&4LL)){value.m2 = (int32_t)0;}
+    if(!(tag&8LL)){value.m3 = (int32_t)0;}
+    if(!(tag&16LL)){value.m4.clear();}
+    if(!(tag&32LL)){value.m5 = (int32_t)0;}
+    if(!(tag&64LL)){value.m6 = (int32_t)0;}
+    if(!(tag&128LL)){value.m7.clear();}
+    if(!(tag&256LL)){value.m8 = (int32_t)0;}
+    if(!(tag&512LL)){value.m9 = (int32_t)0;}
+    if(!(tag&1024LL)){value.m10 = (int32_t)0;}
+    if(!(tag&2048LL)){value.m11 = (int32_t)0;}
+    if(!(tag&4096LL)){value.m12 = (int32_t)0;}
+    if(!(tag&8192LL)){value.m13.clear();}
+    if(!(tag&16384LL)){value.m14 = (int32_t)0;}
+    if(!(tag&32768LL)){value.m15 = (int32_t)0;}
+    if(!(tag&65536LL)){value.m16.clear();}
+    if(!(tag&131072LL)){value.m17 = (int32_t)0;}
+    if(!(tag&262144LL)){value.m18 = (int32_t)0;}
+    if(!(tag&524288LL)){value.m19 = (int32_t)0;}
+    if(!(tag&1048576LL)){value.m20 = (int32_t)0;}
+    if(!(tag&2097152LL)){value.m21 = (int32_t)0;}
+    if(!(tag&4194304LL)){value.m22.clear();}
+    if(!(tag&8388608LL)){value.m23 = (int32_t)0;}
+    if(!(tag&16777216LL)){value.m24 = (int32_t)0;}
+    if(!(tag&33554432LL)){value.m25.clear();}
+    if(!(tag&67108864LL)){value.m26 = (int32_t)0;}
+    if(!(tag&134217728LL)){value.m27 = (int32_t)0;}
+    if(!(tag&268435456LL)){value.m28 = (int32_t)0;}
+    if(!(tag&536870912LL)){value.m29 = (int32_t)0;}
+    if(!(tag&1073741824LL)){value.m30 = (int32_t)0;}
+    if(!(tag&2147483648LL)){value.m31.clear();}
+    if(!(tag&4294967296LL)){value.m32 = (int32_t)0;}
+    if(!(tag&8589934592LL)){value.m33 = (int32_t)0;}
+    if(!(tag&17179869184LL)){value.m34.clear();}
+    if(!(tag&34359738368LL)){value.m35 = (int32_t)0;}
+    if(!(tag&68719476736LL)){value.m36 = (int32_t)0;}
+    if(!(tag&137438953472LL)){value.m37 = (int32_t)0;}
+    if(!(tag&274877906944LL)){value.m38 = (int32_t)0;}
+    if(!(tag&549755813888LL)){value.m39 = (int32_t)0;}
+    if(!(tag&1099511627776LL)){value.m40.clear();}
+    if(!(tag&2199023255552LL)){value.m41 = (int32_t)0;}
+    if(!(tag&4398046511104LL)){value.m42 = (int32_t)0;}
+    if(!(tag&8796093022208LL)){value.m43.clear();}
+    if(!(tag&17592186044416LL)){value.m44 = (int32_t)0;}
+    if(!(tag&35184372088832LL)){value.m45 = (int32_t)0;}
+    if(!(tag&70368744177664LL)){value.m46 = (int32_t)0;}
+    if(!(tag&140737488355328LL)){value.m47 = (int32_t)0;}
+    if(!(tag&281474976710656LL)){value.m48 = (int32_t)0;}
+    if(!(tag&562949953421312LL)){value.m49.clear();}
+    if(!(tag&1125899906842624LL)){value.m50 = (int32_t)0;}
+    if(!(tag&2251799813685248LL)){value.m51 = (int32_t)0;}
+    if(!(tag&4503599627370496LL)){value.m52.clear();}
+    if(!(tag&9007199254740992LL)){value.m53 = (int32_t)0;}
+    if(!(tag&18014398509481984LL)){value.m54 = (int32_t)0;}
+    if(!(tag&36028797018963968LL)){value.m55 = (int32_t)0;}
+    if(!(tag&72057594037927936LL)){value.m56 = (int32_t)0;}
+    if(!(tag&144115188075855872LL)){value.m57 = (int32_t)0;}
+    if(!(tag&288230376151711744LL)){value.m58.clear();}
+    if(!(tag&576460752303423488LL)){value.m59 = (int32_t)0;}
+    if(!(tag&1152921504606846976LL)){value.m60 = (int32_t)0;}
+    if(!(tag&2305843009213693952LL)){value.m61.clear();}
+    if(!(tag&4611686018427387904LL)){value.m62 = (int32_t)0;}
+    if(!(ext_tag[0]&9223372036854775808ULL)){value.m63 = (int32_t)0;}
+    if(!(ext_tag[1]&1ULL)){value.m64 = (int32_t)0;}
+    if(!(ext_tag[1]&2ULL)){value.m65 = (int32_t)0;}
+    if(!(ext_tag[1]&4ULL)){value.m66 = (int32_t)0;}
+    if(!(ext_tag[1]&8ULL)){value.m67.clear();}
+    if(!(ext_tag[1]&16ULL)){value.m68 = (int32_t)0;}
+    if(!(ext_tag[1]&32ULL)){value.m69 = (int32_t)0;}
+    if(!(ext_tag[1]&64ULL)){value.m70.clear();}
+    if(!(ext_tag[1]&128ULL)){value.m71 = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::wide& value, const uint64_t * mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    uint64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    uint64_t ext_tag[2] = {0};
+
+    do
+    {
+      if(tag&1LL)
+      {
+        if(mask[0]&1ULL)        {read(stream,value.m0);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2LL)
+      {
+        if(mask[0]&2ULL)        {read(stream,value.m1);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&4LL)
+      {
+        if(mask[0]&4ULL)        {read(stream,value.m2);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&8LL)
+      {
+        if(mask[0]&8ULL)        {read(stream,value.m3);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&16LL)
+      {
+        if(mask[0]&16ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m4.resize(len);
+          stream.read((char *)value.m4.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&32LL)
+      {
+        if(mask[0]&32ULL)        {read(stream,value.m5);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&64LL)
+      {
+        if(mask[0]&64ULL)        {read(stream,value.m6);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&128LL)
+      {
+        if(mask[0]&128ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m7.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m7[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&256LL)
+      {
+        if(mask[0]&256ULL)        {read(stream,value.m8);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&512LL)
+      {
+        if(mask[0]&512ULL)        {read(stream,value.m9);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&1024LL)
+      {
+        if(mask[0]&1024ULL)        {read(stream,value.m10);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2048LL)
+      {
+        if(mask[0]&2048ULL)        {read(stream,value.m11);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&4096LL)
+      {
+        if(mask[0]&4096ULL)        {read(stream,value.m12);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&8192LL)
+      {
+        if(mask[0]&8192ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m13.resize(len);
+          stream.read((char *)value.m13.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&16384LL)
+      {
+        if(mask[0]&16384ULL)        {read(stream,value.m14);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&32768LL)
+      {
+        if(mask[0]&32768ULL)        {read(stream,value.m15);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&65536LL)
+      {
+        if(mask[0]&65536ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m16.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m16[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&131072LL)
+      {
+        if(mask[0]&131072ULL)        {read(stream,value.m17);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&262144LL)
+      {
+        if(mask[0]&262144ULL)        {read(stream,value.m18);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&524288LL)
+      {
+        if(mask[0]&524288ULL)        {read(stream,value.m19);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&1048576LL)
+      {
+        if(mask[0]&1048576ULL)        {read(stream,value.m20);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2097152LL)
+      {
+        if(mask[0]&2097152ULL)        {read(stream,value.m21);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&4194304LL)
+      {
+        if(mask[0]&4194304ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m22.resize(len);
+          stream.read((char *)value.m22.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&8388608LL)
+      {
+        if(mask[0]&8388608ULL)        {read(stream,value.m23);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&16777216LL)
+      {
+        if(mask[0]&16777216ULL)        {read(stream,value.m24);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&33554432LL)
+      {
+        if(mask[0]&33554432ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m25.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m25[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&67108864LL)
+      {
+        if(mask[0]&67108864ULL)        {read(stream,value.m26);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&134217728LL)
+      {
+        if(mask[0]&134217728ULL)        {read(stream,value.m27);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&268435456LL)
+      {
+        if(mask[0]&268435456ULL)        {read(stream,value.m28);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&536870912LL)
+      {
+        if(mask[0]&536870912ULL)        {read(stream,value.m29);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&1073741824LL)
+      {
+        if(mask[0]&1073741824ULL)        {read(stream,value.m30);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2147483648LL)
+      {
+        if(mask[0]&2147483648ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m31.resize(len);
+          stream.read((char *)value.m31.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&4294967296LL)
+      {
+        if(mask[0]&4294967296ULL)        {read(stream,value.m32);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&8589934592LL)
+      {
+        if(mask[0]&8589934592ULL)        {read(stream,value.m33);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&17179869184LL)
+      {
+        if(mask[0]&17179869184ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m34.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m34[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&34359738368LL)
+      {
+        if(mask[0]&34359738368ULL)        {read(stream,value.m35);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&68719476736LL)
+      {
+        if(mask[0]&68719476736ULL)        {read(stream,value.m36);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&137438953472LL)
+      {
+        if(mask[0]&137438953472ULL)        {read(stream,value.m37);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&274877906944LL)
+      {
+        if(mask[0]&274877906944ULL)        {read(stream,value.m38);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&549755813888LL)
+      {
+        if(mask[0]&549755813888ULL)        {read(stream,value.m39);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&1099511627776LL)
+      {
+        if(mask[0]&1099511627776ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m40.resize(len);
+          stream.read((char *)value.m40.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&2199023255552LL)
+      {
+        if(mask[0]&2199023255552ULL)        {read(stream,value.m41);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&4398046511104LL)
+      {
+        if(mask[0]&4398046511104ULL)        {read(stream,value.m42);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&8796093022208LL)
+      {
+        if(mask[0]&8796093022208ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m43.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m43[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&17592186044416LL)
+      {
+        if(mask[0]&17592186044416ULL)        {read(stream,value.m44);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&35184372088832LL)
+      {
+        if(mask[0]&35184372088832ULL)        {read(stream,value.m45);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&70368744177664LL)
+      {
+        if(mask[0]&70368744177664ULL)        {read(stream,value.m46);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&140737488355328LL)
+      {
+        if(mask[0]&140737488355328ULL)        {read(stream,value.m47);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&281474976710656LL)
+      {
+        if(mask[0]&281474976710656ULL)        {read(stream,value.m48);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&562949953421312LL)
+      {
+        if(mask[0]&562949953421312ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m49.resize(len);
+          stream.read((char *)value.m49.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&1125899906842624LL)
+      {
+        if(mask[0]&1125899906842624ULL)        {read(stream,value.m50);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2251799813685248LL)
+      {
+        if(mask[0]&2251799813685248ULL)        {read(stream,value.m51);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&4503599627370496LL)
+      {
+        if(mask[0]&4503599627370496ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m52.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m52[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&9007199254740992LL)
+      {
+        if(mask[0]&9007199254740992ULL)        {read(stream,value.m53);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&18014398509481984LL)
+      {
+        if(mask[0]&18014398509481984ULL)        {read(stream,value.m54);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&36028797018963968LL)
+      {
+        if(mask[0]&36028797018963968ULL)        {read(stream,value.m55);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&72057594037927936LL)
+      {
+        if(mask[0]&72057594037927936ULL)        {read(stream,value.m56);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&144115188075855872LL)
+      {
+        if(mask[0]&144115188075855872ULL)        {read(stream,value.m57);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&288230376151711744LL)
+      {
+        if(mask[0]&288230376151711744ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m58.resize(len);
+          stream.read((char *)value.m58.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(tag&576460752303423488LL)
+      {
+        if(mask[0]&576460752303423488ULL)        {read(stream,value.m59);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&1152921504606846976LL)
+      {
+        if(mask[0]&1152921504606846976ULL)        {read(stream,value.m60);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&2305843009213693952LL)
+      {
+        if(mask[0]&2305843009213693952ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m61.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m61[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(tag&4611686018427387904LL)
+      {
+        if(mask[0]&4611686018427387904ULL)        {read(stream,value.m62);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(tag&ext_tag_bit) read_ext_tag(stream,ext_tag,2);
+      if(ext_tag[0]&9223372036854775808ULL)
+      {
+        if(mask[0]&9223372036854775808ULL)        {read(stream,value.m63);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&1ULL)
+      {
+        if(mask[1]&1ULL)        {read(stream,value.m64);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&2ULL)
+      {
+        if(mask[1]&2ULL)        {read(stream,value.m65);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&4ULL)
+      {
+        if(mask[1]&4ULL)        {read(stream,value.m66);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&8ULL)
+      {
+        if(mask[1]&8ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m67.resize(len);
+          stream.read((char *)value.m67.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(ext_tag[1]&16ULL)
+      {
+        if(mask[1]&16ULL)        {read(stream,value.m68);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&32ULL)
+      {
+        if(mask[1]&32ULL)        {read(stream,value.m69);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(ext_tag[1]&64ULL)
+      {
+        if(mask[1]&64ULL)        {
+          int32_t len = check_read_size(stream);
+          value.m70.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m70[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(ext_tag[1]&128ULL)
+      {
+        if(mask[1]&128ULL)        {read(stream,value.m71);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask[0]&1ULL)){value.m0 = (int32_t)0;}
+    if(!(tag&2LL) && (mask[0]&2ULL)){value.m1 = (int32_t)0;}
+    if(!(tag&4LL) && (mask[0]&4ULL)){value.m2 = (int32_t)0;}
+    if(!(tag&8LL) && (mask[0]&8ULL)){value.m3 = (int32_t)0;}
+    if(!(tag&16LL) && (mask[0]&16ULL)){value.m4.clear();}
+    if(!(tag&32LL) && (mask[0]&32ULL)){value.m5 = (int32_t)0;}
+    if(!(tag&64LL) && (mask[0]&64ULL)){value.m6 = (int32_t)0;}
+    if(!(tag&128LL) && (mask[0]&128ULL)){value.m7.clear();}
+    if(!(tag&256LL) && (mask[0]&256ULL)){value.m8 = (int32_t)0;}
+    if(!(tag&512LL) && (mask[0]&512ULL)){value.m9 = (int32_t)0;}
+    if(!(tag&1024LL) && (mask[0]&1024ULL)){value.m10 = (int32_t)0;}
+    if(!(tag&2048LL) && (mask[0]&2048ULL)){value.m11 = (int32_t)0;}
+    if(!(tag&4096LL) && (mask[0]&4096ULL)){value.m12 = (int32_t)0;}
+    if(!(tag&8192LL) && (mask[0]&8192ULL)){value.m13.clear();}
+    if(!(tag&16384LL) && (mask[0]&16384ULL)){value.m14 = (int32_t)0;}
+    if(!(tag&32768LL) && (mask[0]&32768ULL)){value.m15 = (int32_t)0;}
+    if(!(tag&65536LL) && (mask[0]&65536ULL)){value.m16.clear();}
+    if(!(tag&131072LL) && (mask[0]&131072ULL)){value.m17 = (int32_t)0;}
+    if(!(tag&262144LL) && (mask[0]&262144ULL)){value.m18 = (int32_t)0;}
+    if(!(tag&524288LL) && (mask[0]&524288ULL)){value.m19 = (int32_t)0;}
+    if(!(tag&1048576LL) && (mask[0]&1048576ULL)){value.m20 = (int32_t)0;}
+    if(!(tag&2097152LL) && (mask[0]&2097152ULL)){value.m21 = (int32_t)0;}
+    if(!(tag&4194304LL) && (mask[0]&4194304ULL)){value.m22.clear();}
+    if(!(tag&8388608LL) && (mask[0]&8388608ULL)){value.m23 = (int32_t)0;}
+    if(!(tag&16777216LL) && (mask[0]&16777216ULL)){value.m24 = (int32_t)0;}
+    if(!(tag&33554432LL) && (mask[0]&33554432ULL)){value.m25.clear();}
+    if(!(tag&67108864LL) && (mask[0]&67108864ULL)){value.m26 = (int32_t)0;}
+    if(!(tag&134217728LL) && (mask[0]&134217728ULL)){value.m27 = (int32_t)0;}
+    if(!(tag&268435456LL) && (mask[0]&268435456ULL)){value.m28 = (int32_t)0;}
+    if(!(tag&536870912LL) && (mask[0]&536870912ULL)){value.m29 = (int32_t)0;}
+    if(!(tag&1073741824LL) && (mask[0]&1073741824ULL)){value.m30 = (int32_t)0;}
+    if(!(tag&2147483648LL) && (mask[0]&2147483648ULL)){value.m31.clear();}
+    if(!(tag&4294967296LL) && (mask[0]&4294967296ULL)){value.m32 = (int32_t)0;}
+    if(!(tag&8589934592LL) && (mask[0]&8589934592ULL)){value.m33 = (int32_t)0;}
+    if(!(tag&17179869184LL) && (mask[0]&17179869184ULL)){value.m34.clear();}
+    if(!(tag&34359738368LL) && (mask[0]&34359738368ULL)){value.m35 = (int32_t)0;}
+    if(!(tag&68719476736LL) && (mask[0]&68719476736ULL)){value.m36 = (int32_t)0;}
+    if(!(tag&137438953472LL) && (mask[0]&137438953472ULL)){value.m37 = (int32_t)0;}
+    if(!(tag&274877906944LL) && (mask[0]&274877906944ULL)){value.m38 = (int32_t)0;}
+    if(!(tag&549755813888LL) && (mask[0]&549755813888ULL)){value.m39 = (int32_t)0;}
+    if(!(tag&1099511627776LL) && (mask[0]&1099511627776ULL)){value.m40.clear();}
+    if(!(tag&2199023255552LL) && (mask[0]&2199023255552ULL)){value.m41 = (int32_t)0;}
+    if(!(tag&4398046511104LL) && (mask[0]&4398046511104ULL)){value.m42 = (int32_t)0;}
+    if(!(tag&8796093022208LL) && (mask[0]&8796093022208ULL)){value.m43.clear();}
+    if(!(tag&17592186044416LL) && (mask[0]&17592186044416ULL)){value.m44 = (int32_t)0;}
+    if(!(tag&35184372088832LL) && (mask[0]&35184372088832ULL)){value.m45 = (int32_t)0;}
+    if(!(tag&70368744177664LL) && (mask[0]&70368744177664ULL)){value.m46 = (int32_t)0;}
+    if(!(tag&140737488355328LL) && (mask[0]&140737488355328ULL)){value.m47 = (int32_t)0;}
+    if(!(tag&281474976710656LL) && (mask[0]&281474976710656ULL)){value.m48 = (int32_t)0;}
+    if(!(tag&562949953421312LL) && (mask[0]&562949953421312ULL)){value.m49.clear();}
+    if(!(tag&1125899906842624LL) && (mask[0]&1125899906842624ULL)){value.m50 = (int32_t)0;}
+    if(!(tag&2251799813685248LL) && (mask[0]&2251799813685248ULL)){value.m51 = (int32_t)0;}
+    if(!(tag&4503599627370496LL) && (mask[0]&4503599627370496ULL)){value.m52.clear();}
+    if(!(tag&9007199254740992LL) && (mask[0]&9007199254740992ULL)){value.m53 = (int32_t)0;}
+    if(!(tag&18014398509481984LL) && (mask[0]&18014398509481984ULL)){value.m54 = (int32_t)0;}
+    if(!(tag&36028797018963968LL) && (mask[0]&36028797018963968ULL)){value.m55 = (int32_t)0;}
+    if(!(tag&72057594037927936LL) && (mask[0]&72057594037927936ULL)){value.m56 = (int32_t)0;}
+    if(!(tag&144115188075855872LL) && (mask[0]&144115188075855872ULL)){value.m57 = (int32_t)0;}
+    if(!(tag&288230376151711744LL) && (mask[0]&288230376151711744ULL)){value.m58.clear();}
+    if(!(tag&576460752303423488LL) && (mask[0]&576460752303423488ULL)){value.m59 = (int32_t)0;}
+    if(!(tag&1152921504606846976LL) && (mask[0]&1152921504606846976ULL)){value.m60 = (int32_t)0;}
+    if(!(tag&2305843009213693952LL) && (mask[0]&2305843009213693952ULL)){value.m61.clear();}
+    if(!(tag&4611686018427387904LL) && (mask[0]&4611686018427387904ULL)){value.m62 = (int32_t)0;}
+    if(!(ext_tag[0]&9223372036854775808ULL) && (mask[0]&9223372036854775808ULL)){value.m63 = (int32_t)0;}
+    if(!(ext_tag[1]&1ULL) && (mask[1]&1ULL)){value.m64 = (int32_t)0;}
+    if(!(ext_tag[1]&2ULL) && (mask[1]&2ULL)){value.m65 = (int32_t)0;}
+    if(!(ext_tag[1]&4ULL) && (mask[1]&4ULL)){value.m66 = (int32_t)0;}
+    if(!(ext_tag[1]&8ULL) && (mask[1]&8ULL)){value.m67.clear();}
+    if(!(ext_tag[1]&16ULL) && (mask[1]&16ULL)){value.m68 = (int32_t)0;}
+    if(!(ext_tag[1]&32ULL) && (mask[1]&32ULL)){value.m69 = (int32_t)0;}
+    if(!(ext_tag[1]&64ULL) && (mask[1]&64ULL)){value.m70.clear();}
+    if(!(ext_tag[1]&128ULL) && (mask[1]&128ULL)){value.m71 = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::wide* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::wide* , int32_t index, bool& absent)
+  {
+    uint64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    uint64_t ext_tag[2] = {0};
+    if(index < 0 || index >= 72) return false;
+    if(index < 63 && !(tag&(1ULL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 5) return true;
+    if(tag&32LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 6) return true;
+    if(tag&64LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 7) return true;
+    if(tag&128LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 8) return true;
+    if(tag&256LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 9) return true;
+    if(tag&512LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 10) return true;
+    if(tag&1024LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 11) return true;
+    if(tag&2048LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 12) return true;
+    if(tag&4096LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 13) return true;
+    if(tag&8192LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 14) return true;
+    if(tag&16384LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 15) return true;
+    if(tag&32768LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 16) return true;
+    if(tag&65536LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 17) return true;
+    if(tag&131072LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 18) return true;
+    if(tag&262144LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 19) return true;
+    if(tag&524288LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 20) return true;
+    if(tag&1048576LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 21) return true;
+    if(tag&2097152LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 22) return true;
+    if(tag&4194304LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 23) return true;
+    if(tag&8388608LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 24) return true;
+    if(tag&16777216LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 25) return true;
+    if(tag&33554432LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 26) return true;
+    if(tag&67108864LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 27) return true;
+    if(tag&134217728LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 28) return true;
+    if(tag&268435456LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 29) return true;
+    if(tag&536870912LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 30) return true;
+    if(tag&1073741824LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 31) return true;
+    if(tag&2147483648LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 32) return true;
+    if(tag&4294967296LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 33) return true;
+    if(tag&8589934592LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 34) return true;
+    if(tag&17179869184LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 35) return true;
+    if(tag&34359738368LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 36) return true;
+    if(tag&68719476736LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 37) return true;
+    if(tag&137438953472LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 38) return true;
+    if(tag&274877906944LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 39) return true;
+    if(tag&549755813888LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 40) return true;
+    if(tag&1099511627776LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 41) return true;
+    if(tag&2199023255552LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 42) return true;
+    if(tag&4398046511104LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 43) return true;
+    if(tag&8796093022208LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 44) return true;
+    if(tag&17592186044416LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 45) return true;
+    if(tag&35184372088832LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 46) return true;
+    if(tag&70368744177664LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 47) return true;
+    if(tag&140737488355328LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 48) return true;
+    if(tag&281474976710656LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 49) return true;
+    if(tag&562949953421312LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 50) return true;
+    if(tag&1125899906842624LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 51) return true;
+    if(tag&2251799813685248LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 52) return true;
+    if(tag&4503599627370496LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 53) return true;
+    if(tag&9007199254740992LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 54) return true;
+    if(tag&18014398509481984LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 55) return true;
+    if(tag&36028797018963968LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 56) return true;
+    if(tag&72057594037927936LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 57) return true;
+    if(tag&144115188075855872LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 58) return true;
+    if(tag&288230376151711744LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 59) return true;
+    if(tag&576460752303423488LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 60) return true;
+    if(tag&1152921504606846976LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 61) return true;
+    if(tag&2305843009213693952LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 62) return true;
+    if(tag&4611686018427387904LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(tag&ext_tag_bit) read_ext_tag(stream,ext_tag,2);
+    if(!(ext_tag[index>>6]&(1ULL<<(index&63)))){absent = true; return false;}
+    if(index == 63) return true;
+    if(ext_tag[0]&9223372036854775808ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 64) return true;
+    if(ext_tag[1]&1ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 65) return true;
+    if(ext_tag[1]&2ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 66) return true;
+    if(ext_tag[1]&4ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 67) return true;
+    if(ext_tag[1]&8ULL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 68) return true;
+    if(ext_tag[1]&16ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 69) return true;
+    if(ext_tag[1]&32ULL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 70) return true;
+    if(ext_tag[1]&64ULL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 71) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::wide& value)
+  {
+    if(!is_default(value.m0,(int32_t)0)) return false;
+    if(!is_default(value.m1,(int32_t)0)) return false;
+    if(!is_default(value.m2,(int32_t)0)) return false;
+    if(!is_default(value.m3,(int32_t)0)) return false;
+    if(!value.m4.empty()) return false;
+    if(!is_default(value.m5,(int32_t)0)) return false;
+    if(!is_default(value.m6,(int32_t)0)) return false;
+    if(!value.m7.empty()) return false;
+    if(!is_default(value.m8,(int32_t)0)) return false;
+    if(!is_default(value.m9,(int32_t)0)) return false;
+    if(!is_default(value.m10,(int32_t)0)) return false;
+    if(!is_default(value.m11,(int32_t)0)) return false;
+    if(!is_default(value.m12,(int32_t)0)) return false;
+    if(!value.m13.empty()) return false;
+    if(!is_default(value.m14,(int32_t)0)) return false;
+    if(!is_default(value.m15,(int32_t)0)) return false;
+    if(!value.m16.empty()) return false;
+    if(!is_default(value.m17,(int32_t)0)) return false;
+    if(!is_default(value.m18,(int32_t)0)) return false;
+    if(!is_default(value.m19,(int32_t)0)) return false;
+    if(!is_default(value.m20,(int32_t)0)) return false;
+    if(!is_default(value.m21,(int32_t)0)) return false;
+    if(!value.m22.empty()) return false;
+    if(!is_default(value.m23,(int32_t)0)) return false;
+    if(!is_default(value.m24,(int32_t)0)) return false;
+    if(!value.m25.empty()) return false;
+    if(!is_default(value.m26,(int32_t)0)) return false;
+    if(!is_default(value.m27,(int32_t)0)) return false;
+    if(!is_default(value.m28,(int32_t)0)) return false;
+    if(!is_default(value.m29,(int32_t)0)) return false;
+    if(!is_default(value.m30,(int32_t)0)) return false;
+    if(!value.m31.empty()) return false;
+    if(!is_default(value.m32,(int32_t)0)) return false;
+    if(!is_default(value.m33,(int32_t)0)) return false;
+    if(!value.m34.empty()) return false;
+    if(!is_default(value.m35,(int32_t)0)) return false;
+    if(!is_default(value.m36,(int32_t)0)) return false;
+    if(!is_default(value.m37,(int32_t)0)) return false;
+    if(!is_default(value.m38,(int32_t)0)) return false;
+    if(!is_default(value.m39,(int32_t)0)) return false;
+    if(!value.m40.empty()) return false;
+    if(!is_default(value.m41,(int32_t)0)) return false;
+    if(!is_default(value.m42,(int32_t)0)) return false;
+    if(!value.m43.empty()) return false;
+    if(!is_default(value.m44,(int32_t)0)) return false;
+    if(!is_default(value.m45,(int32_t)0)) return false;
+    if(!is_default(value.m46,(int32_t)0)) return false;
+    if(!is_default(value.m47,(int32_t)0)) return false;
+    if(!is_default(value.m48,(int32_t)0)) return false;
+    if(!value.m49.empty()) return false;
+    if(!is_default(value.m50,(int32_t)0)) return false;
+    if(!is_default(value.m51,(int32_t)0)) return false;
+    if(!value.m52.empty()) return false;
+    if(!is_default(value.m53,(int32_t)0)) return false;
+    if(!is_default(value.m54,(int32_t)0)) return false;
+    if(!is_default(value.m55,(int32_t)0)) return false;
+    if(!is_default(value.m56,(int32_t)0)) return false;
+    if(!is_default(value.m57,(int32_t)0)) return false;
+    if(!value.m58.empty()) return false;
+    if(!is_default(value.m59,(int32_t)0)) return false;
+    if(!is_default(value.m60,(int32_t)0)) return false;
+    if(!value.m61.empty()) return false;
+    if(!is_default(value.m62,(int32_t)0)) return false;
+    if(!is_default(value.m63,(int32_t)0)) return false;
+    if(!is_default(value.m64,(int32_t)0)) return false;
+    if(!is_default(value.m65,(int32_t)0)) return false;
+    if(!is_default(value.m66,(int32_t)0)) return false;
+    if(!value.m67.empty()) return false;
+    if(!is_default(value.m68,(int32_t)0)) return false;
+    if(!is_default(value.m69,(int32_t)0)) return false;
+    if(!value.m70.empty()) return false;
+    if(!is_default(value.m71,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::wide& value)
+  {
+    int32_t size = 0;
+    uint64_t tag = 0ULL;
+    uint64_t ext_tag[2] = {0};
+    if(!is_default(value.m0,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.m1,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.m2,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.m3,(int32_t)0)){tag|=8LL;}
+    if(!value.m4.empty()){tag|=16LL;}
+    if(!is_default(value.m5,(int32_t)0)){tag|=32LL;}
+    if(!is_default(value.m6,(int32_t)0)){tag|=64LL;}
+    if(!value.m7.empty()){tag|=128LL;}
+    if(!is_default(value.m8,(int32_t)0)){tag|=256LL;}
+    if(!is_default(value.m9,(int32_t)0)){tag|=512LL;}
+    if(!is_default(value.m10,(int32_t)0)){tag|=1024LL;}
+    if(!is_default(value.m11,(int32_t)0)){tag|=2048LL;}
+    if(!is_default(value.m12,(int32_t)0)){tag|=4096LL;}
+    if(!value.m13.empty()){tag|=8192LL;}
+    if(!is_default(value.m14,(int32_t)0)){tag|=16384LL;}
+    if(!is_default(value.m15,(int32_t)0)){tag|=32768LL;}
+    if(!value.m16.empty()){tag|=65536LL;}
+    if(!is_default(value.m17,(int32_t)0)){tag|=131072LL;}
+    if(!is_default(value.m18,(int32_t)0)){tag|=262144LL;}
+    if(!is_default(value.m19,(int32_t)0)){tag|=524288LL;}
+    if(!is_default(value.m20,(int32_t)0)){tag|=1048576LL;}
+    if(!is_default(value.m21,(int32_t)0)){tag|=2097152LL;}
+    if(!value.m22.empty()){tag|=4194304LL;}
+    if(!is_default(value.m23,(int32_t)0)){tag|=8388608LL;}
+    if(!is_default(value.m24,(int32_t)0)){tag|=16777216LL;}
+    if(!value.m25.empty()){tag|=33554432LL;}
+    if(!is_default(value.m26,(int32_t)0)){tag|=67108864LL;}
+    if(!is_default(value.m27,(int32_t)0)){tag|=134217728LL;}
+    if(!is_default(value.m28,(int32_t)0)){tag|=268435456LL;}
+    if(!is_default(value.m29,(int32_t)0)){tag|=536870912LL;}
+    if(!is_default(value.m30,(int32_t)0)){tag|=1073741824LL;}
+    if(!value.m31.empty()){tag|=2147483648LL;}
+    if(!is_default(value.m32,(int32_t)0)){tag|=4294967296LL;}
+    if(!is_default(value.m33,(int32_t)0)){tag|=8589934592LL;}
+    if(!value.m34.empty()){tag|=17179869184LL;}
+    if(!is_default(value.m35,(int32_t)0)){tag|=34359738368LL;}
+    if(!is_default(value.m36,(int32_t)0)){tag|=68719476736LL;}
+    if(!is_default(value.m37,(int32_t)0)){tag|=137438953472LL;}
+    if(!is_default(value.m38,(int32_t)0)){tag|=274877906944LL;}
+    if(!is_default(value.m39,(int32_t)0)){tag|=549755813888LL;}
+    if(!value.m40.empty()){tag|=1099511627776LL;}
+    if(!is_default(value.m41,(int32_t)0)){tag|=2199023255552LL;}
+    if(!is_default(value.m42,(int32_t)0)){tag|=4398046511104LL;}
+    if(!value.m43.empty()){tag|=8796093022208LL;}
+    if(!is_default(value.m44,(int32_t)0)){tag|=17592186044416LL;}
+    if(!is_default(value.m45,(int32_t)0)){tag|=35184372088832LL;}
+    if(!is_default(value.m46,(int32_t)0)){tag|=70368744177664LL;}
+    if(!is_default(value.m47,(int32_t)0)){tag|=140737488355328LL;}
+    if(!is_default(value.m48,(int32_t)0)){tag|=281474976710656LL;}
+    if(!value.m49.empty()){tag|=562949953421312LL;}
+    if(!is_default(value.m50,(int32_t)0)){tag|=1125899906842624LL;}
+    if(!is_default(value.m51,(int32_t)0)){tag|=2251799813685248LL;}
+    if(!value.m52.empty()){tag|=4503599627370496LL;}
+    if(!is_default(value.m53,(int32_t)0)){tag|=9007199254740992LL;}
+    if(!is_default(value.m54,(int32_t)0)){tag|=18014398509481984LL;}
+    if(!is_default(value.m55,(int32_t)0)){tag|=36028797018963968LL;}
+    if(!is_default(value.m56,(int32_t)0)){tag|=72057594037927936LL;}
+    if(!is_default(value.m57,(int32_t)0)){tag|=144115188075855872LL;}
+    if(!value.m58.empty()){tag|=288230376151711744LL;}
+    if(!is_default(value.m59,(int32_t)0)){tag|=576460752303423488LL;}
+    if(!is_default(value.m60,(int32_t)0)){tag|=1152921504606846976LL;}
+    if(!value.m61.empty()){tag|=2305843009213693952LL;}
+    if(!is_default(value.m62,(int32_t)0)){tag|=4611686018427387904LL;}
+    if(!is_default(value.m63,(int32_t)0)){ext_tag[0]|=9223372036854775808ULL;}
+    if(!is_default(value.m64,(int32_t)0)){ext_tag[1]|=1ULL;}
+    if(!is_default(value.m65,(int32_t)0)){ext_tag[1]|=2ULL;}
+    if(!is_default(value.m66,(int32_t)0)){ext_tag[1]|=4ULL;}
+    if(!value.m67.empty()){ext_tag[1]|=8ULL;}
+    if(!is_default(value.m68,(int32_t)0)){ext_tag[1]|=16ULL;}
+    if(!is_default(value.m69,(int32_t)0)){ext_tag[1]|=32ULL;}
+    if(!value.m70.empty()){ext_tag[1]|=64ULL;}
+    if(!is_default(value.m71,(int32_t)0)){ext_tag[1]|=128ULL;}
+    if(ext_tag[0] || ext_tag[1]){tag|=ext_tag_bit;}
+    if(tag&1LL)
+    {
+      size += size_of(value.m0);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.m1);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.m2);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.m3);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m4).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&32LL)
+    {
+      size += size_of(value.m5);
+    }
+    if(tag&64LL)
+    {
+      size += size_of(value.m6);
+    }
+    if(tag&128LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m7).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&256LL)
+    {
+      size += size_of(value.m8);
+    }
+    if(tag&512LL)
+    {
+      size += size_of(value.m9);
+    }
+    if(tag&1024LL)
+    {
+      size += size_of(value.m10);
+    }
+    if(tag&2048LL)
+    {
+      size += size_of(value.m11);
+    }
+    if(tag&4096LL)
+    {
+      size += size_of(value.m12);
+    }
+    if(tag&8192LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m13).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&16384LL)
+    {
+      size += size_of(value.m14);
+    }
+    if(tag&32768LL)
+    {
+      size += size_of(value.m15);
+    }
+    if(tag&65536LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m16).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&131072LL)
+    {
+      size += size_of(value.m17);
+    }
+    if(tag&262144LL)
+    {
+      size += size_of(value.m18);
+    }
+    if(tag&524288LL)
+    {
+      size += size_of(value.m19);
+    }
+    if(tag&1048576LL)
+    {
+      size += size_of(value.m20);
+    }
+    if(tag&2097152LL)
+    {
+      size += size_of(value.m21);
+    }
+    if(tag&4194304LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m22).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&8388608LL)
+    {
+      size += size_of(value.m23);
+    }
+    if(tag&16777216LL)
+    {
+      size += size_of(value.m24);
+    }
+    if(tag&33554432LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m25).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&67108864LL)
+    {
+      size += size_of(value.m26);
+    }
+    if(tag&134217728LL)
+    {
+      size += size_of(value.m27);
+    }
+    if(tag&268435456LL)
+    {
+      size += size_of(value.m28);
+    }
+    if(tag&536870912LL)
+    {
+      size += size_of(value.m29);
+    }
+    if(tag&1073741824LL)
+    {
+      size += size_of(value.m30);
+    }
+    if(tag&2147483648LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m31).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4294967296LL)
+    {
+      size += size_of(value.m32);
+    }
+    if(tag&8589934592LL)
+    {
+      size += size_of(value.m33);
+    }
+    if(tag&17179869184LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m34).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&34359738368LL)
+    {
+      size += size_of(value.m35);
+    }
+    if(tag&68719476736LL)
+    {
+      size += size_of(value.m36);
+    }
+    if(tag&137438953472LL)
+    {
+      size += size_of(value.m37);
+    }
+    if(tag&274877906944LL)
+    {
+      size += size_of(value.m38);
+    }
+    if(tag&549755813888LL)
+    {
+      size += size_of(value.m39);
+    }
+    if(tag&1099511627776LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m40).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&2199023255552LL)
+    {
+      size += size_of(value.m41);
+    }
+    if(tag&4398046511104LL)
+    {
+      size += size_of(value.m42);
+    }
+    if(tag&8796093022208LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m43).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&17592186044416LL)
+    {
+      size += size_of(value.m44);
+    }
+    if(tag&35184372088832LL)
+    {
+      size += size_of(value.m45);
+    }
+    if(tag&70368744177664LL)
+    {
+      size += size_of(value.m46);
+    }
+    if(tag&140737488355328LL)
+    {
+      size += size_of(value.m47);
+    }
+    if(tag&281474976710656LL)
+    {
+      size += size_of(value.m48);
+    }
+    if(tag&562949953421312LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m49).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&1125899906842624LL)
+    {
+      size += size_of(value.m50);
+    }
+    if(tag&2251799813685248LL)
+    {
+      size += size_of(value.m51);
+    }
+    if(tag&4503599627370496LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m52).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&9007199254740992LL)
+    {
+      size += size_of(value.m53);
+    }
+    if(tag&18014398509481984LL)
+    {
+      size += size_of(value.m54);
+    }
+    if(tag&36028797018963968LL)
+    {
+      size += size_of(value.m55);
+    }
+    if(tag&72057594037927936LL)
+    {
+      size += size_of(value.m56);
+    }
+    if(tag&144115188075855872LL)
+    {
+      size += size_of(value.m57);
+    }
+    if(tag&288230376151711744LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m58).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&576460752303423488LL)
+    {
+      size += size_of(value.m59);
+    }
+    if(tag&1152921504606846976LL)
+    {
+      size += size_of(value.m60);
+    }
+    if(tag&2305843009213693952LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m61).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&4611686018427387904LL)
+    {
+      size += size_of(value.m62);
+    }
+    if(ext_tag[0]&9223372036854775808ULL)
+    {
+      size += size_of(value.m63);
+    }
+    if(ext_tag[1]&1ULL)
+    {
+      size += size_of(value.m64);
+    }
+    if(ext_tag[1]&2ULL)
+    {
+      size += size_of(value.m65);
+    }
+    if(ext_tag[1]&4ULL)
+    {
+      size += size_of(value.m66);
+    }
+    if(ext_tag[1]&8ULL)
+    {
+      {
+        int32_t len = (int32_t)(value.m67).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(ext_tag[1]&16ULL)
+    {
+      size += size_of(value.m68);
+    }
+    if(ext_tag[1]&32ULL)
+    {
+      size += size_of(value.m69);
+    }
+    if(ext_tag[1]&64ULL)
+    {
+      {
+        int32_t len = (int32_t)(value.m70).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m70.begin() ; i != value.m70.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(ext_tag[1]&128ULL)
+    {
+      size += size_of(value.m71);
+    }
+    if(tag&ext_tag_bit){size += size_of_ext_tag(ext_tag,2);}
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::wide& value)
+  {
+    uint64_t tag = 0ULL;
+    uint64_t ext_tag[2] = {0};
+    if(!is_default(value.m0,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.m1,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.m2,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.m3,(int32_t)0)){tag|=8LL;}
+    if(!value.m4.empty()){tag|=16LL;}
+    if(!is_default(value.m5,(int32_t)0)){tag|=32LL;}
+    if(!is_default(value.m6,(int32_t)0)){tag|=64LL;}
+    if(!value.m7.empty()){tag|=128LL;}
+    if(!is_default(value.m8,(int32_t)0)){tag|=256LL;}
+    if(!is_default(value.m9,(int32_t)0)){tag|=512LL;}
+    if(!is_default(value.m10,(int32_t)0)){tag|=1024LL;}
+    if(!is_default(value.m11,(int32_t)0)){tag|=2048LL;}
+    if(!is_default(value.m12,(int32_t)0)){tag|=4096LL;}
+    if(!value.m13.empty()){tag|=8192LL;}
+    if(!is_default(value.m14,(int32_t)0)){tag|=16384LL;}
+    if(!is_default(value.m15,(int32_t)0)){tag|=32768LL;}
+    if(!value.m16.empty()){tag|=65536LL;}
+    if(!is_default(value.m17,(int32_t)0)){tag|=131072LL;}
+    if(!is_default(value.m18,(int32_t)0)){tag|=262144LL;}
+    if(!is_default(value.m19,(int32_t)0)){tag|=524288LL;}
+    if(!is_default(value.m20,(int32_t)0)){tag|=1048576LL;}
+    if(!is_default(value.m21,(int32_t)0)){tag|=2097152LL;}
+    if(!value.m22.empty()){tag|=4194304LL;}
+    if(!is_default(value.m23,(int32_t)0)){tag|=8388608LL;}
+    if(!is_default(value.m24,(int32_t)0)){tag|=16777216LL;}
+    if(!value.m25.empty()){tag|=33554432LL;}
+    if(!is_default(value.m26,(int32_t)0)){tag|=67108864LL;}
+    if(!is_default(value.m27,(int32_t)0)){tag|=134217728LL;}
+    if(!is_default(value.m28,(int32_t)0)){tag|=268435456LL;}
+    if(!is_default(value.m29,(int32_t)0)){tag|=536870912LL;}
+    if(!is_default(value.m30,(int32_t)0)){tag|=1073741824LL;}
+    if(!value.m31.empty()){tag|=2147483648LL;}
+    if(!is_default(value.m32,(int32_t)0)){tag|=4294967296LL;}
+    if(!is_default(value.m33,(int32_t)0)){tag|=8589934592LL;}
+    if(!value.m34.empty()){tag|=17179869184LL;}
+    if(!is_default(value.m35,(int32_t)0)){tag|=34359738368LL;}
+    if(!is_default(value.m36,(int32_t)0)){tag|=68719476736LL;}
+    if(!is_default(value.m37,(int32_t)0)){tag|=137438953472LL;}
+    if(!is_default(value.m38,(int32_t)0)){tag|=274877906944LL;}
+    if(!is_default(value.m39,(int32_t)0)){tag|=549755813888LL;}
+    if(!value.m40.empty()){tag|=1099511627776LL;}
+    if(!is_default(value.m41,(int32_t)0)){tag|=2199023255552LL;}
+    if(!is_default(value.m42,(int32_t)0)){tag|=4398046511104LL;}
+    if(!value.m43.empty()){tag|=8796093022208LL;}
+    if(!is_default(value.m44,(int32_t)0)){tag|=17592186044416LL;}
+    if(!is_default(value.m45,(int32_t)0)){tag|=35184372088832LL;}
+    if(!is_default(value.m46,(int32_t)0)){tag|=70368744177664LL;}
+    if(!is_default(value.m47,(int32_t)0)){tag|=140737488355328LL;}
+    if(!is_default(value.m48,(int32_t)0)){tag|=281474976710656LL;}
+    if(!value.m49.empty()){tag|=562949953421312LL;}
+    if(!is_default(value.m50,(int32_t)0)){tag|=1125899906842624LL;}
+    if(!is_default(value.m51,(int32_t)0)){tag|=2251799813685248LL;}
+    if(!value.m52.empty()){tag|=4503599627370496LL;}
+    if(!is_default(value.m53,(int32_t)0)){tag|=9007199254740992LL;}
+    if(!is_default(value.m54,(int32_t)0)){tag|=18014398509481984LL;}
+    if(!is_default(value.m55,(int32_t)0)){tag|=36028797018963968LL;}
+    if(!is_default(value.m56,(int32_t)0)){tag|=72057594037927936LL;}
+    if(!is_default(value.m57,(int32_t)0)){tag|=144115188075855872LL;}
+    if(!value.m58.empty()){tag|=288230376151711744LL;}
+    if(!is_default(value.m59,(int32_t)0)){tag|=576460752303423488LL;}
+    if(!is_default(value.m60,(int32_t)0)){tag|=1152921504606846976LL;}
+    if(!value.m61.empty()){tag|=2305843009213693952LL;}
+    if(!is_default(value.m62,(int32_t)0)){tag|=4611686018427387904LL;}
+    if(!is_default(value.m63,(int32_t)0)){ext_tag[0]|=9223372036854775808ULL;}
+    if(!is_default(value.m64,(int32_t)0)){ext_tag[1]|=1ULL;}
+    if(!is_default(value.m65,(int32_t)0)){ext_tag[1]|=2ULL;}
+    if(!is_default(value.m66,(int32_t)0)){ext_tag[1]|=4ULL;}
+    if(!value.m67.empty()){ext_tag[1]|=8ULL;}
+    if(!is_default(value.m68,(int32_t)0)){ext_tag[1]|=16ULL;}
+    if(!is_default(value.m69,(int32_t)0)){ext_tag[1]|=32ULL;}
+    if(!value.m70.empty()){ext_tag[1]|=64ULL;}
+    if(!is_default(value.m71,(int32_t)0)){ext_tag[1]|=128ULL;}
+    if(ext_tag[0] || ext_tag[1]){tag|=ext_tag_bit;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.m0);
+    if(tag&2LL)    write(stream,value.m1);
+    if(tag&4LL)    write(stream,value.m2);
+    if(tag&8LL)    write(stream,value.m3);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.m4).size();
+      write(stream,len);
+      stream.write((value.m4).data(),len);
+    }
+    if(tag&32LL)    write(stream,value.m5);
+    if(tag&64LL)    write(stream,value.m6);
+    if(tag&128LL)    {
+      int32_t len = (int32_t)(value.m7).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&256LL)    write(stream,value.m8);
+    if(tag&512LL)    write(stream,value.m9);
+    if(tag&1024LL)    write(stream,value.m10);
+    if(tag&2048LL)    write(stream,value.m11);
+    if(tag&4096LL)    write(stream,value.m12);
+    if(tag&8192LL)    {
+      int32_t len = (int32_t)(value.m13).size();
+      write(stream,len);
+      stream.write((value.m13).data(),len);
+    }
+    if(tag&16384LL)    write(stream,value.m14);
+    if(tag&32768LL)    write(stream,value.m15);
+    if(tag&65536LL)    {
+      int32_t len = (int32_t)(value.m16).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&131072LL)    write(stream,value.m17);
+    if(tag&262144LL)    write(stream,value.m18);
+    if(tag&524288LL)    write(stream,value.m19);
+    if(tag&1048576LL)    write(stream,value.m20);
+    if(tag&2097152LL)    write(stream,value.m21);
+    if(tag&4194304LL)    {
+      int32_t len = (int32_t)(value.m22).size();
+      write(stream,len);
+      stream.write((value.m22).data(),len);
+    }
+    if(tag&8388608LL)    write(stream,value.m23);
+    if(tag&16777216LL)    write(stream,value.m24);
+    if(tag&33554432LL)    {
+      int32_t len = (int32_t)(value.m25).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&67108864LL)    write(stream,value.m26);
+    if(tag&134217728LL)    write(stream,value.m27);
+    if(tag&268435456LL)    write(stream,value.m28);
+    if(tag&536870912LL)    write(stream,value.m29);
+    if(tag&1073741824LL)    write(stream,value.m30);
+    if(tag&2147483648LL)    {
+      int32_t len = (int32_t)(value.m31).size();
+      write(stream,len);
+      stream.write((value.m31).data(),len);
+    }
+    if(tag&4294967296LL)    write(stream,value.m32);
+    if(tag&8589934592LL)    write(stream,value.m33);
+    if(tag&17179869184LL)    {
+      int32_t len = (int32_t)(value.m34).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&34359738368LL)    write(stream,value.m35);
+    if(tag&68719476736LL)    write(stream,value.m36);
+    if(tag&137438953472LL)    write(stream,value.m37);
+    if(tag&274877906944LL)    write(stream,value.m38);
+    if(tag&549755813888LL)    write(stream,value.m39);
+    if(tag&1099511627776LL)    {
+      int32_t len = (int32_t)(value.m40).size();
+      write(stream,len);
+      stream.write((value.m40).data(),len);
+    }
+    if(tag&2199023255552LL)    write(stream,value.m41);
+    if(tag&4398046511104LL)    write(stream,value.m42);
+    if(tag&8796093022208LL)    {
+      int32_t len = (int32_t)(value.m43).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&17592186044416LL)    write(stream,value.m44);
+    if(tag&35184372088832LL)    write(stream,value.m45);
+    if(tag&70368744177664LL)    write(stream,value.m46);
+    if(tag&140737488355328LL)    write(stream,value.m47);
+    if(tag&281474976710656LL)    write(stream,value.m48);
+    if(tag&562949953421312LL)    {
+      int32_t len = (int32_t)(value.m49).size();
+      write(stream,len);
+      stream.write((value.m49).data(),len);
+    }
+    if(tag&1125899906842624LL)    write(stream,value.m50);
+    if(tag&2251799813685248LL)    write(stream,value.m51);
+    if(tag&4503599627370496LL)    {
+      int32_t len = (int32_t)(value.m52).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&9007199254740992LL)    write(stream,value.m53);
+    if(tag&18014398509481984LL)    write(stream,value.m54);
+    if(tag&36028797018963968LL)    write(stream,value.m55);
+    if(tag&72057594037927936LL)    write(stream,value.m56);
+    if(tag&144115188075855872LL)    write(stream,value.m57);
+    if(tag&288230376151711744LL)    {
+      int32_t len = (int32_t)(value.m58).size();
+      write(stream,len);
+      stream.write((value.m58).data(),len);
+    }
+    if(tag&576460752303423488LL)    write(stream,value.m59);
+    if(tag&1152921504606846976LL)    write(stream,value.m60);
+    if(tag&2305843009213693952LL)    {
+      int32_t len = (int32_t)(value.m61).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&4611686018427387904LL)    write(stream,value.m62);
+    if(tag&ext_tag_bit){write_ext_tag(stream,ext_tag,2);}
+    if(ext_tag[0]&9223372036854775808ULL)    write(stream,value.m63);
+    if(ext_tag[1]&1ULL)    write(stream,value.m64);
+    if(ext_tag[1]&2ULL)    write(stream,value.m65);
+    if(ext_tag[1]&4ULL)    write(stream,value.m66);
+    if(ext_tag[1]&8ULL)    {
+      int32_t len = (int32_t)(value.m67).size();
+      write(stream,len);
+      stream.write((value.m67).data(),len);
+    }
+    if(ext_tag[1]&16ULL)    write(stream,value.m68);
+    if(ext_tag[1]&32ULL)    write(stream,value.m69);
+    if(ext_tag[1]&64ULL)    {
+      int32_t len = (int32_t)(value.m70).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m70.begin() ; i != value.m70.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(ext_tag[1]&128ULL)    write(stream,value.m71);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::wide& value)
+  {
+    read(stream,value.m0);
+    read(stream,value.m1);
+    read(stream,value.m2);
+    read(stream,value.m3);
+    {
+      int32_t len = check_read_size(stream);
+      value.m4.resize(len);
+      stream.read((char *)value.m4.data(),len);
+    }
+    read(stream,value.m5);
+    read(stream,value.m6);
+    {
+      int32_t len = check_read_size(stream);
+      value.m7.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m7[i]);
+      }
+    }
+    read(stream,value.m8);
+    read(stream,value.m9);
+    read(stream,value.m10);
+    read(stream,value.m11);
+    read(stream,value.m12);
+    {
+      int32_t len = check_read_size(stream);
+      value.m13.resize(len);
+      stream.read((char *)value.m13.data(),len);
+    }
+    read(stream,value.m14);
+    read(stream,value.m15);
+    {
+      int32_t len = check_read_size(stream);
+      value.m16.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m16[i]);
+      }
+    }
+    read(stream,value.m17);
+    read(stream,value.m18);
+    read(stream,value.m19);
+    read(stream,value.m20);
+    read(stream,value.m21);
+    {
+      int32_t len = check_read_size(stream);
+      value.m22.resize(len);
+      stream.read((char *)value.m22.data(),len);
+    }
+    read(stream,value.m23);
+    read(stream,value.m24);
+    {
+      int32_t len = check_read_size(stream);
+      value.m25.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m25[i]);
+      }
+    }
+    read(stream,value.m26);
+    read(stream,value.m27);
+    read(stream,value.m28);
+    read(stream,value.m29);
+    read(stream,value.m30);
+    {
+      int32_t len = check_read_size(stream);
+      value.m31.resize(len);
+      stream.read((char *)value.m31.data(),len);
+    }
+    read(stream,value.m32);
+    read(stream,value.m33);
+    {
+      int32_t len = check_read_size(stream);
+      value.m34.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m34[i]);
+      }
+    }
+    read(stream,value.m35);
+    read(stream,value.m36);
+    read(stream,value.m37);
+    read(stream,value.m38);
+    read(stream,value.m39);
+    {
+      int32_t len = check_read_size(stream);
+      value.m40.resize(len);
+      stream.read((char *)value.m40.data(),len);
+    }
+    read(stream,value.m41);
+    read(stream,value.m42);
+    {
+      int32_t len = check_read_size(stream);
+      value.m43.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m43[i]);
+      }
+    }
+    read(stream,value.m44);
+    read(stream,value.m45);
+    read(stream,value.m46);
+    read(stream,value.m47);
+    read(stream,value.m48);
+    {
+      int32_t len = check_read_size(stream);
+      value.m49.resize(len);
+      stream.read((char *)value.m49.data(),len);
+    }
+    read(stream,value.m50);
+    read(stream,value.m51);
+    {
+      int32_t len = check_read_size(stream);
+      value.m52.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m52[i]);
+      }
+    }
+    read(stream,value.m53);
+    read(stream,value.m54);
+    read(stream,value.m55);
+    read(stream,value.m56);
+    read(stream,value.m57);
+    {
+      int32_t len = check_read_size(stream);
+      value.m58.resize(len);
+      stream.read((char *)value.m58.data(),len);
+    }
+    read(stream,value.m59);
+    read(stream,value.m60);
+    {
+      int32_t len = check_read_size(stream);
+      value.m61.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m61[i]);
+      }
+    }
+    read(stream,value.m62);
+    read(stream,value.m63);
+    read(stream,value.m64);
+    read(stream,value.m65);
+    read(stream,value.m66);
+    {
+      int32_t len = check_read_size(stream);
+      value.m67.resize(len);
+      stream.read((char *)value.m67.data(),len);
+    }
+    read(stream,value.m68);
+    read(stream,value.m69);
+    {
+      int32_t len = check_read_size(stream);
+      value.m70.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m70[i]);
+      }
+    }
+    read(stream,value.m71);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::wide& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.m0);
+    size += size_of(value.m1);
+    size += size_of(value.m2);
+    size += size_of(value.m3);
+    {
+      int32_t len = (int32_t)(value.m4).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m5);
+    size += size_of(value.m6);
+    {
+      int32_t len = (int32_t)(value.m7).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m8);
+    size += size_of(value.m9);
+    size += size_of(value.m10);
+    size += size_of(value.m11);
+    size += size_of(value.m12);
+    {
+      int32_t len = (int32_t)(value.m13).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m14);
+    size += size_of(value.m15);
+    {
+      int32_t len = (int32_t)(value.m16).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m17);
+    size += size_of(value.m18);
+    size += size_of(value.m19);
+    size += size_of(value.m20);
+    size += size_of(value.m21);
+    {
+      int32_t len = (int32_t)(value.m22).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m23);
+    size += size_of(value.m24);
+    {
+      int32_t len = (int32_t)(value.m25).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m26);
+    size += size_of(value.m27);
+    size += size_of(value.m28);
+    size += size_of(value.m29);
+    size += size_of(value.m30);
+    {
+      int32_t len = (int32_t)(value.m31).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m32);
+    size += size_of(value.m33);
+    {
+      int32_t len = (int32_t)(value.m34).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m35);
+    size += size_of(value.m36);
+    size += size_of(value.m37);
+    size += size_of(value.m38);
+    size += size_of(value.m39);
+    {
+      int32_t len = (int32_t)(value.m40).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m41);
+    size += size_of(value.m42);
+    {
+      int32_t len = (int32_t)(value.m43).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m44);
+    size += size_of(value.m45);
+    size += size_of(value.m46);
+    size += size_of(value.m47);
+    size += size_of(value.m48);
+    {
+      int32_t len = (int32_t)(value.m49).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m50);
+    size += size_of(value.m51);
+    {
+      int32_t len = (int32_t)(value.m52).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m53);
+    size += size_of(value.m54);
+    size += size_of(value.m55);
+    size += size_of(value.m56);
+    size += size_of(value.m57);
+    {
+      int32_t len = (int32_t)(value.m58).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m59);
+    size += size_of(value.m60);
+    {
+      int32_t len = (int32_t)(value.m61).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m62);
+    size += size_of(value.m63);
+    size += size_of(value.m64);
+    size += size_of(value.m65);
+    size += size_of(value.m66);
+    {
+      int32_t len = (int32_t)(value.m67).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m68);
+    size += size_of(value.m69);
+    {
+      int32_t len = (int32_t)(value.m70).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m70.begin() ; i != value.m70.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m71);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::wide& value)
+  {
+    write(stream,value.m0);
+    write(stream,value.m1);
+    write(stream,value.m2);
+    write(stream,value.m3);
+    {
+      int32_t len = (int32_t)(value.m4).size();
+      write(stream,len);
+      stream.write((value.m4).data(),len);
+    }
+    write(stream,value.m5);
+    write(stream,value.m6);
+    {
+      int32_t len = (int32_t)(value.m7).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m8);
+    write(stream,value.m9);
+    write(stream,value.m10);
+    write(stream,value.m11);
+    write(stream,value.m12);
+    {
+      int32_t len = (int32_t)(value.m13).size();
+      write(stream,len);
+      stream.write((value.m13).data(),len);
+    }
+    write(stream,value.m14);
+    write(stream,value.m15);
+    {
+      int32_t len = (int32_t)(value.m16).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m17);
+    write(stream,value.m18);
+    write(stream,value.m19);
+    write(stream,value.m20);
+    write(stream,value.m21);
+    {
+      int32_t len = (int32_t)(value.m22).size();
+      write(stream,len);
+      stream.write((value.m22).data(),len);
+    }
+    write(stream,value.m23);
+    write(stream,value.m24);
+    {
+      int32_t len = (int32_t)(value.m25).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m26);
+    write(stream,value.m27);
+    write(stream,value.m28);
+    write(stream,value.m29);
+    write(stream,value.m30);
+    {
+      int32_t len = (int32_t)(value.m31).size();
+      write(stream,len);
+      stream.write((value.m31).data(),len);
+    }
+    write(stream,value.m32);
+    write(stream,value.m33);
+    {
+      int32_t len = (int32_t)(value.m34).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m35);
+    write(stream,value.m36);
+    write(stream,value.m37);
+    write(stream,value.m38);
+    write(stream,value.m39);
+    {
+      int32_t len = (int32_t)(value.m40).size();
+      write(stream,len);
+      stream.write((value.m40).data(),len);
+    }
+    write(stream,value.m41);
+    write(stream,value.m42);
+    {
+      int32_t len = (int32_t)(value.m43).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m44);
+    write(stream,value.m45);
+    write(stream,value.m46);
+    write(stream,value.m47);
+    write(stream,value.m48);
+    {
+      int32_t len = (int32_t)(value.m49).size();
+      write(stream,len);
+      stream.write((value.m49).data(),len);
+    }
+    write(stream,value.m50);
+    write(stream,value.m51);
+    {
+      int32_t len = (int32_t)(value.m52).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m53);
+    write(stream,value.m54);
+    write(stream,value.m55);
+    write(stream,value.m56);
+    write(stream,value.m57);
+    {
+      int32_t len = (int32_t)(value.m58).size();
+      write(stream,len);
+      stream.write((value.m58).data(),len);
+    }
+    write(stream,value.m59);
+    write(stream,value.m60);
+    {
+      int32_t len = (int32_t)(value.m61).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m62);
+    write(stream,value.m63);
+    write(stream,value.m64);
+    write(stream,value.m65);
+    write(stream,value.m66);
+    {
+      int32_t len = (int32_t)(value.m67).size();
+      write(stream,len);
+      stream.write((value.m67).data(),len);
+    }
+    write(stream,value.m68);
+    write(stream,value.m69);
+    {
+      int32_t len = (int32_t)(value.m70).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m70.begin() ; i != value.m70.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m71);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::narrow& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.m0);}
+    if(tag&2LL)    {read(stream,value.m1);}
+    if(tag&4LL)    {read(stream,value.m2);}
+    if(tag&8LL)    {read(stream,value.m3);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.m4.resize(len);
+      stream.read((char *)value.m4.data(),len);
+    }
+    if(tag&32LL)    {read(stream,value.m5);}
+    if(tag&64LL)    {read(stream,value.m6);}
+    if(tag&128LL)    {
+      int32_t len = check_read_size(stream);
+      value.m7.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m7[i]);}
+      }
+    }
+    if(tag&256LL)    {read(stream,value.m8);}
+    if(tag&512LL)    {read(stream,value.m9);}
+    if(tag&1024LL)    {read(stream,value.m10);}
+    if(tag&2048LL)    {read(stream,value.m11);}
+    if(tag&4096LL)    {read(stream,value.m12);}
+    if(tag&8192LL)    {
+      int32_t len = check_read_size(stream);
+      value.m13.resize(len);
+      stream.read((char *)value.m13.data(),len);
+    }
+    if(tag&16384LL)    {read(stream,value.m14);}
+    if(tag&32768LL)    {read(stream,value.m15);}
+    if(tag&65536LL)    {
+      int32_t len = check_read_size(stream);
+      value.m16.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m16[i]);}
+      }
+    }
+    if(tag&131072LL)    {read(stream,value.m17);}
+    if(tag&262144LL)    {read(stream,value.m18);}
+    if(tag&524288LL)    {read(stream,value.m19);}
+    if(tag&1048576LL)    {read(stream,value.m20);}
+    if(tag&2097152LL)    {read(stream,value.m21);}
+    if(tag&4194304LL)    {
+      int32_t len = check_read_size(stream);
+      value.m22.resize(len);
+      stream.read((char *)value.m22.data(),len);
+    }
+    if(tag&8388608LL)    {read(stream,value.m23);}
+    if(tag&16777216LL)    {read(stream,value.m24);}
+    if(tag&33554432LL)    {
+      int32_t len = check_read_size(stream);
+      value.m25.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m25[i]);}
+      }
+    }
+    if(tag&67108864LL)    {read(stream,value.m26);}
+    if(tag&134217728LL)    {read(stream,value.m27);}
+    if(tag&268435456LL)    {read(stream,value.m28);}
+    if(tag&536870912LL)    {read(stream,value.m29);}
+    if(tag&1073741824LL)    {read(stream,value.m30);}
+    if(tag&2147483648LL)    {
+      int32_t len = check_read_size(stream);
+      value.m31.resize(len);
+      stream.read((char *)value.m31.data(),len);
+    }
+    if(tag&4294967296LL)    {read(stream,value.m32);}
+    if(tag&8589934592LL)    {read(stream,value.m33);}
+    if(tag&17179869184LL)    {
+      int32_t len = check_read_size(stream);
+      value.m34.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m34[i]);}
+      }
+    }
+    if(tag&34359738368LL)    {read(stream,value.m35);}
+    if(tag&68719476736LL)    {read(stream,value.m36);}
+    if(tag&137438953472LL)    {read(stream,value.m37);}
+    if(tag&274877906944LL)    {read(stream,value.m38);}
+    if(tag&549755813888LL)    {read(stream,value.m39);}
+    if(tag&1099511627776LL)    {
+      int32_t len = check_read_size(stream);
+      value.m40.resize(len);
+      stream.read((char *)value.m40.data(),len);
+    }
+    if(tag&2199023255552LL)    {read(stream,value.m41);}
+    if(tag&4398046511104LL)    {read(stream,value.m42);}
+    if(tag&8796093022208LL)    {
+      int32_t len = check_read_size(stream);
+      value.m43.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m43[i]);}
+      }
+    }
+    if(tag&17592186044416LL)    {read(stream,value.m44);}
+    if(tag&35184372088832LL)    {read(stream,value.m45);}
+    if(tag&70368744177664LL)    {read(stream,value.m46);}
+    if(tag&140737488355328LL)    {read(stream,value.m47);}
+    if(tag&281474976710656LL)    {read(stream,value.m48);}
+    if(tag&562949953421312LL)    {
+      int32_t len = check_read_size(stream);
+      value.m49.resize(len);
+      stream.read((char *)value.m49.data(),len);
+    }
+    if(tag&1125899906842624LL)    {read(stream,value.m50);}
+    if(tag&2251799813685248LL)    {read(stream,value.m51);}
+    if(tag&4503599627370496LL)    {
+      int32_t len = check_read_size(stream);
+      value.m52.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m52[i]);}
+      }
+    }
+    if(tag&9007199254740992LL)    {read(stream,value.m53);}
+    if(tag&18014398509481984LL)    {read(stream,value.m54);}
+    if(tag&36028797018963968LL)    {read(stream,value.m55);}
+    if(tag&72057594037927936LL)    {read(stream,value.m56);}
+    if(tag&144115188075855872LL)    {read(stream,value.m57);}
+    if(tag&288230376151711744LL)    {
+      int32_t len = check_read_size(stream);
+      value.m58.resize(len);
+      stream.read((char *)value.m58.data(),len);
+    }
+    if(tag&576460752303423488LL)    {read(stream,value.m59);}
+    if(tag&1152921504606846976LL)    {read(stream,value.m60);}
+    if(tag&2305843009213693952LL)    {
+      int32_t len = check_read_size(stream);
+      value.m61.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.m61[i]);}
+      }
+    }
+    if(tag&4611686018427387904LL)    {read(stream,value.m62);}
+    if(!(tag&1LL)){value.m0 = (int32_t)0;}
+    if(!(tag&2LL)){value.m1 = (int32_t)0;}
+    if(!(tag&4LL)){value.m2 = (int32_t)0;}
+    if(!(tag&8LL)){value.m3 = (int32_t)0;}
+    if(!(tag&16LL)){value.m4.clear();}
+    if(!(tag&32LL)){value.m5 = (int32_t)0;}
+    if(!(tag&64LL)){value.m6 = (int32_t)0;}
+    if(!(tag&128LL)){value.m7.clear();}
+    if(!(tag&256LL)){value.m8 = (int32_t)0;}
+    if(!(tag&512LL)){value.m9 = (int32_t)0;}
+    if(!(tag&1024LL)){value.m10 = (int32_t)0;}
+    if(!(tag&2048LL)){value.m11 = (int32_t)0;}
+    if(!(tag&4096LL)){value.m12 = (int32_t)0;}
+    if(!(tag&8192LL)){value.m13.clear();}
+    if(!(tag&16384LL)){value.m14 = (int32_t)0;}
+    if(!(tag&32768LL)){value.m15 = (int32_t)0;}
+    if(!(tag&65536LL)){value.m16.clear();}
+    if(!(tag&131072LL)){value.m17 = (int32_t)0;}
+    if(!(tag&262144LL)){value.m18 = (int32_t)0;}
+    if(!(tag&524288LL)){value.m19 = (int32_t)0;}
+    if(!(tag&1048576LL)){value.m20 = (int32_t)0;}
+    if(!(tag&2097152LL)){value.m21 = (int32_t)0;}
+    if(!(tag&4194304LL)){value.m22.clear();}
+    if(!(tag&8388608LL)){value.m23 = (int32_t)0;}
+    if(!(tag&16777216LL)){value.m24 = (int32_t)0;}
+    if(!(tag&33554432LL)){value.m25.clear();}
+    if(!(tag&67108864LL)){value.m26 = (int32_t)0;}
+    if(!(tag&134217728LL)){value.m27 = (int32_t)0;}
+    if(!(tag&268435456LL)){value.m28 = (int32_t)0;}
+    if(!(tag&536870912LL)){value.m29 = (int32_t)0;}
+    if(!(tag&1073741824LL)){value.m30 = (int32_t)0;}
+    if(!(tag&2147483648LL)){value.m31.clear();}
+    if(!(tag&4294967296LL)){value.m32 = (int32_t)0;}
+    if(!(tag&8589934592LL)){value.m33 = (int32_t)0;}
+    if(!(tag&17179869184LL)){value.m34.clear();}
+    if(!(tag&34359738368LL)){value.m35 = (int32_t)0;}
+    if(!(tag&68719476736LL)){value.m36 = (int32_t)0;}
+    if(!(tag&137438953472LL)){value.m37 = (int32_t)0;}
+    if(!(tag&274877906944LL)){value.m38 = (int32_t)0;}
+    if(!(tag&549755813888LL)){value.m39 = (int32_t)0;}
+    if(!(tag&1099511627776LL)){value.m40.clear();}
+    if(!(tag&2199023255552LL)){value.m41 = (int32_t)0;}
+    if(!(tag&4398046511104LL)){value.m42 = (int32_t)0;}
+    if(!(tag&8796093022208LL)){value.m43.clear();}
+    if(!(tag&17592186044416LL)){value.m44 = (int32_t)0;}
+    if(!(tag&35184372088832LL)){value.m45 = (int32_t)0;}
+    if(!(tag&70368744177664LL)){value.m46 = (int32_t)0;}
+    if(!(tag&140737488355328LL)){value.m47 = (int32_t)0;}
+    if(!(tag&281474976710656LL)){value.m48 = (int32_t)0;}
+    if(!(tag&562949953421312LL)){value.m49.clear();}
+    if(!(tag&1125899906842624LL)){value.m50 = (int32_t)0;}
+    if(!(tag&2251799813685248LL)){value.m51 = (int32_t)0;}
+    if(!(tag&4503599627370496LL)){value.m52.clear();}
+    if(!(tag&9007199254740992LL)){value.m53 = (int32_t)0;}
+    if(!(tag&18014398509481984LL)){value.m54 = (int32_t)0;}
+    if(!(tag&36028797018963968LL)){value.m55 = (int32_t)0;}
+    if(!(tag&72057594037927936LL)){value.m56 = (int32_t)0;}
+    if(!(tag&144115188075855872LL)){value.m57 = (int32_t)0;}
+    if(!(tag&288230376151711744LL)){value.m58.clear();}
+    if(!(tag&576460752303423488LL)){value.m59 = (int32_t)0;}
+    if(!(tag&1152921504606846976LL)){value.m60 = (int32_t)0;}
+    if(!(tag&2305843009213693952LL)){value.m61.clear();}
+    if(!(tag&4611686018427387904LL)){value.m62 = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::narrow& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.m0);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.m1);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.m2);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.m3);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.m4.resize(len);
+          stream.read((char *)value.m4.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {read(stream,value.m5);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 64ULL) break;
+      if(tag&64LL)
+      {
+        if(mask&64LL)        {read(stream,value.m6);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 128ULL) break;
+      if(tag&128LL)
+      {
+        if(mask&128LL)        {
+          int32_t len = check_read_size(stream);
+          value.m7.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m7[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 256ULL) break;
+      if(tag&256LL)
+      {
+        if(mask&256LL)        {read(stream,value.m8);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 512ULL) break;
+      if(tag&512LL)
+      {
+        if(mask&512LL)        {read(stream,value.m9);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 1024ULL) break;
+      if(tag&1024LL)
+      {
+        if(mask&1024LL)        {read(stream,value.m10);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2048ULL) break;
+      if(tag&2048LL)
+      {
+        if(mask&2048LL)        {read(stream,value.m11);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4096ULL) break;
+      if(tag&4096LL)
+      {
+        if(mask&4096LL)        {read(stream,value.m12);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8192ULL) break;
+      if(tag&8192LL)
+      {
+        if(mask&8192LL)        {
+          int32_t len = check_read_size(stream);
+          value.m13.resize(len);
+          stream.read((char *)value.m13.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 16384ULL) break;
+      if(tag&16384LL)
+      {
+        if(mask&16384LL)        {read(stream,value.m14);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 32768ULL) break;
+      if(tag&32768LL)
+      {
+        if(mask&32768LL)        {read(stream,value.m15);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 65536ULL) break;
+      if(tag&65536LL)
+      {
+        if(mask&65536LL)        {
+          int32_t len = check_read_size(stream);
+          value.m16.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m16[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 131072ULL) break;
+      if(tag&131072LL)
+      {
+        if(mask&131072LL)        {read(stream,value.m17);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 262144ULL) break;
+      if(tag&262144LL)
+      {
+        if(mask&262144LL)        {read(stream,value.m18);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 524288ULL) break;
+      if(tag&524288LL)
+      {
+        if(mask&524288LL)        {read(stream,value.m19);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 1048576ULL) break;
+      if(tag&1048576LL)
+      {
+        if(mask&1048576LL)        {read(stream,value.m20);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2097152ULL) break;
+      if(tag&2097152LL)
+      {
+        if(mask&2097152LL)        {read(stream,value.m21);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4194304ULL) break;
+      if(tag&4194304LL)
+      {
+        if(mask&4194304LL)        {
+          int32_t len = check_read_size(stream);
+          value.m22.resize(len);
+          stream.read((char *)value.m22.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 8388608ULL) break;
+      if(tag&8388608LL)
+      {
+        if(mask&8388608LL)        {read(stream,value.m23);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16777216ULL) break;
+      if(tag&16777216LL)
+      {
+        if(mask&16777216LL)        {read(stream,value.m24);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 33554432ULL) break;
+      if(tag&33554432LL)
+      {
+        if(mask&33554432LL)        {
+          int32_t len = check_read_size(stream);
+          value.m25.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m25[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 67108864ULL) break;
+      if(tag&67108864LL)
+      {
+        if(mask&67108864LL)        {read(stream,value.m26);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 134217728ULL) break;
+      if(tag&134217728LL)
+      {
+        if(mask&134217728LL)        {read(stream,value.m27);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 268435456ULL) break;
+      if(tag&268435456LL)
+      {
+        if(mask&268435456LL)        {read(stream,value.m28);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 536870912ULL) break;
+      if(tag&536870912LL)
+      {
+        if(mask&536870912LL)        {read(stream,value.m29);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 1073741824ULL) break;
+      if(tag&1073741824LL)
+      {
+        if(mask&1073741824LL)        {read(stream,value.m30);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2147483648ULL) break;
+      if(tag&2147483648LL)
+      {
+        if(mask&2147483648LL)        {
+          int32_t len = check_read_size(stream);
+          value.m31.resize(len);
+          stream.read((char *)value.m31.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4294967296ULL) break;
+      if(tag&4294967296LL)
+      {
+        if(mask&4294967296LL)        {read(stream,value.m32);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8589934592ULL) break;
+      if(tag&8589934592LL)
+      {
+        if(mask&8589934592LL)        {read(stream,value.m33);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 17179869184ULL) break;
+      if(tag&17179869184LL)
+      {
+        if(mask&17179869184LL)        {
+          int32_t len = check_read_size(stream);
+          value.m34.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m34[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 34359738368ULL) break;
+      if(tag&34359738368LL)
+      {
+        if(mask&34359738368LL)        {read(stream,value.m35);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 68719476736ULL) break;
+      if(tag&68719476736LL)
+      {
+        if(mask&68719476736LL)        {read(stream,value.m36);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 137438953472ULL) break;
+      if(tag&137438953472LL)
+      {
+        if(mask&137438953472LL)        {read(stream,value.m37);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 274877906944ULL) break;
+      if(tag&274877906944LL)
+      {
+        if(mask&274877906944LL)        {read(stream,value.m38);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 549755813888ULL) break;
+      if(tag&549755813888LL)
+      {
+        if(mask&549755813888LL)        {read(stream,value.m39);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 1099511627776ULL) break;
+      if(tag&1099511627776LL)
+      {
+        if(mask&1099511627776LL)        {
+          int32_t len = check_read_size(stream);
+          value.m40.resize(len);
+          stream.read((char *)value.m40.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 2199023255552ULL) break;
+      if(tag&2199023255552LL)
+      {
+        if(mask&2199023255552LL)        {read(stream,value.m41);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4398046511104ULL) break;
+      if(tag&4398046511104LL)
+      {
+        if(mask&4398046511104LL)        {read(stream,value.m42);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8796093022208ULL) break;
+      if(tag&8796093022208LL)
+      {
+        if(mask&8796093022208LL)        {
+          int32_t len = check_read_size(stream);
+          value.m43.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m43[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 17592186044416ULL) break;
+      if(tag&17592186044416LL)
+      {
+        if(mask&17592186044416LL)        {read(stream,value.m44);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 35184372088832ULL) break;
+      if(tag&35184372088832LL)
+      {
+        if(mask&35184372088832LL)        {read(stream,value.m45);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 70368744177664ULL) break;
+      if(tag&70368744177664LL)
+      {
+        if(mask&70368744177664LL)        {read(stream,value.m46);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 140737488355328ULL) break;
+      if(tag&140737488355328LL)
+      {
+        if(mask&140737488355328LL)        {read(stream,value.m47);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 281474976710656ULL) break;
+      if(tag&281474976710656LL)
+      {
+        if(mask&281474976710656LL)        {read(stream,value.m48);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 562949953421312ULL) break;
+      if(tag&562949953421312LL)
+      {
+        if(mask&562949953421312LL)        {
+          int32_t len = check_read_size(stream);
+          value.m49.resize(len);
+          stream.read((char *)value.m49.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 1125899906842624ULL) break;
+      if(tag&1125899906842624LL)
+      {
+        if(mask&1125899906842624LL)        {read(stream,value.m50);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2251799813685248ULL) break;
+      if(tag&2251799813685248LL)
+      {
+        if(mask&2251799813685248LL)        {read(stream,value.m51);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4503599627370496ULL) break;
+      if(tag&4503599627370496LL)
+      {
+        if(mask&4503599627370496LL)        {
+          int32_t len = check_read_size(stream);
+          value.m52.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m52[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 9007199254740992ULL) break;
+      if(tag&9007199254740992LL)
+      {
+        if(mask&9007199254740992LL)        {read(stream,value.m53);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 18014398509481984ULL) break;
+      if(tag&18014398509481984LL)
+      {
+        if(mask&18014398509481984LL)        {read(stream,value.m54);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 36028797018963968ULL) break;
+      if(tag&36028797018963968LL)
+      {
+        if(mask&36028797018963968LL)        {read(stream,value.m55);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 72057594037927936ULL) break;
+      if(tag&72057594037927936LL)
+      {
+        if(mask&72057594037927936LL)        {read(stream,value.m56);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 144115188075855872ULL) break;
+      if(tag&144115188075855872LL)
+      {
+        if(mask&144115188075855872LL)        {read(stream,value.m57);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 288230376151711744ULL) break;
+      if(tag&288230376151711744LL)
+      {
+        if(mask&288230376151711744LL)        {
+          int32_t len = check_read_size(stream);
+          value.m58.resize(len);
+          stream.read((char *)value.m58.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 576460752303423488ULL) break;
+      if(tag&576460752303423488LL)
+      {
+        if(mask&576460752303423488LL)        {read(stream,value.m59);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 1152921504606846976ULL) break;
+      if(tag&1152921504606846976LL)
+      {
+        if(mask&1152921504606846976LL)        {read(stream,value.m60);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2305843009213693952ULL) break;
+      if(tag&2305843009213693952LL)
+      {
+        if(mask&2305843009213693952LL)        {
+          int32_t len = check_read_size(stream);
+          value.m61.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.m61[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 4611686018427387904ULL) break;
+      if(tag&4611686018427387904LL)
+      {
+        if(mask&4611686018427387904LL)        {read(stream,value.m62);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.m0 = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.m1 = (int32_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.m2 = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.m3 = (int32_t)0;}
+    if(!(tag&16LL) && (mask&16LL)){value.m4.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.m5 = (int32_t)0;}
+    if(!(tag&64LL) && (mask&64LL)){value.m6 = (int32_t)0;}
+    if(!(tag&128LL) && (mask&128LL)){value.m7.clear();}
+    if(!(tag&256LL) && (mask&256LL)){value.m8 = (int32_t)0;}
+    if(!(tag&512LL) && (mask&512LL)){value.m9 = (int32_t)0;}
+    if(!(tag&1024LL) && (mask&1024LL)){value.m10 = (int32_t)0;}
+    if(!(tag&2048LL) && (mask&2048LL)){value.m11 = (int32_t)0;}
+    if(!(tag&4096LL) && (mask&4096LL)){value.m12 = (int32_t)0;}
+    if(!(tag&8192LL) && (mask&8192LL)){value.m13.clear();}
+    if(!(tag&16384LL) && (mask&16384LL)){value.m14 = (int32_t)0;}
+    if(!(tag&32768LL) && (mask&32768LL)){value.m15 = (int32_t)0;}
+    if(!(tag&65536LL) && (mask&65536LL)){value.m16.clear();}
+    if(!(tag&131072LL) && (mask&131072LL)){value.m17 = (int32_t)0;}
+    if(!(tag&262144LL) && (mask&262144LL)){value.m18 = (int32_t)0;}
+    if(!(tag&524288LL) && (mask&524288LL)){value.m19 = (int32_t)0;}
+    if(!(tag&1048576LL) && (mask&1048576LL)){value.m20 = (int32_t)0;}
+    if(!(tag&2097152LL) && (mask&2097152LL)){value.m21 = (int32_t)0;}
+    if(!(tag&4194304LL) && (mask&4194304LL)){value.m22.clear();}
+    if(!(tag&8388608LL) && (mask&8388608LL)){value.m23 = (int32_t)0;}
+    if(!(tag&16777216LL) && (mask&16777216LL)){value.m24 = (int32_t)0;}
+    if(!(tag&33554432LL) && (mask&33554432LL)){value.m25.clear();}
+    if(!(tag&67108864LL) && (mask&67108864LL)){value.m26 = (int32_t)0;}
+    if(!(tag&134217728LL) && (mask&134217728LL)){value.m27 = (int32_t)0;}
+    if(!(tag&268435456LL) && (mask&268435456LL)){value.m28 = (int32_t)0;}
+    if(!(tag&536870912LL) && (mask&536870912LL)){value.m29 = (int32_t)0;}
+    if(!(tag&1073741824LL) && (mask&1073741824LL)){value.m30 = (int32_t)0;}
+    if(!(tag&2147483648LL) && (mask&2147483648LL)){value.m31.clear();}
+    if(!(tag&4294967296LL) && (mask&4294967296LL)){value.m32 = (int32_t)0;}
+    if(!(tag&8589934592LL) && (mask&8589934592LL)){value.m33 = (int32_t)0;}
+    if(!(tag&17179869184LL) && (mask&17179869184LL)){value.m34.clear();}
+    if(!(tag&34359738368LL) && (mask&34359738368LL)){value.m35 = (int32_t)0;}
+    if(!(tag&68719476736LL) && (mask&68719476736LL)){value.m36 = (int32_t)0;}
+    if(!(tag&137438953472LL) && (mask&137438953472LL)){value.m37 = (int32_t)0;}
+    if(!(tag&274877906944LL) && (mask&274877906944LL)){value.m38 = (int32_t)0;}
+    if(!(tag&549755813888LL) && (mask&549755813888LL)){value.m39 = (int32_t)0;}
+    if(!(tag&1099511627776LL) && (mask&1099511627776LL)){value.m40.clear();}
+    if(!(tag&2199023255552LL) && (mask&2199023255552LL)){value.m41 = (int32_t)0;}
+    if(!(tag&4398046511104LL) && (mask&4398046511104LL)){value.m42 = (int32_t)0;}
+    if(!(tag&8796093022208LL) && (mask&8796093022208LL)){value.m43.clear();}
+    if(!(tag&17592186044416LL) && (mask&17592186044416LL)){value.m44 = (int32_t)0;}
+    if(!(tag&35184372088832LL) && (mask&35184372088832LL)){value.m45 = (int32_t)0;}
+    if(!(tag&70368744177664LL) && (mask&70368744177664LL)){value.m46 = (int32_t)0;}
+    if(!(tag&140737488355328LL) && (mask&140737488355328LL)){value.m47 = (int32_t)0;}
+    if(!(tag&281474976710656LL) && (mask&281474976710656LL)){value.m48 = (int32_t)0;}
+    if(!(tag&562949953421312LL) && (mask&562949953421312LL)){value.m49.clear();}
+    if(!(tag&1125899906842624LL) && (mask&1125899906842624LL)){value.m50 = (int32_t)0;}
+    if(!(tag&2251799813685248LL) && (mask&2251799813685248LL)){value.m51 = (int32_t)0;}
+    if(!(tag&4503599627370496LL) && (mask&4503599627370496LL)){value.m52.clear();}
+    if(!(tag&9007199254740992LL) && (mask&9007199254740992LL)){value.m53 = (int32_t)0;}
+    if(!(tag&18014398509481984LL) && (mask&18014398509481984LL)){value.m54 = (int32_t)0;}
+    if(!(tag&36028797018963968LL) && (mask&36028797018963968LL)){value.m55 = (int32_t)0;}
+    if(!(tag&72057594037927936LL) && (mask&72057594037927936LL)){value.m56 = (int32_t)0;}
+    if(!(tag&144115188075855872LL) && (mask&144115188075855872LL)){value.m57 = (int32_t)0;}
+    if(!(tag&288230376151711744LL) && (mask&288230376151711744LL)){value.m58.clear();}
+    if(!(tag&576460752303423488LL) && (mask&576460752303423488LL)){value.m59 = (int32_t)0;}
+    if(!(tag&1152921504606846976LL) && (mask&1152921504606846976LL)){value.m60 = (int32_t)0;}
+    if(!(tag&2305843009213693952LL) && (mask&2305843009213693952LL)){value.m61.clear();}
+    if(!(tag&4611686018427387904LL) && (mask&4611686018427387904LL)){value.m62 = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::narrow* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::narrow* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 63) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 5) return true;
+    if(tag&32LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 6) return true;
+    if(tag&64LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 7) return true;
+    if(tag&128LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 8) return true;
+    if(tag&256LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 9) return true;
+    if(tag&512LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 10) return true;
+    if(tag&1024LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 11) return true;
+    if(tag&2048LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 12) return true;
+    if(tag&4096LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 13) return true;
+    if(tag&8192LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 14) return true;
+    if(tag&16384LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 15) return true;
+    if(tag&32768LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 16) return true;
+    if(tag&65536LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 17) return true;
+    if(tag&131072LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 18) return true;
+    if(tag&262144LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 19) return true;
+    if(tag&524288LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 20) return true;
+    if(tag&1048576LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 21) return true;
+    if(tag&2097152LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 22) return true;
+    if(tag&4194304LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 23) return true;
+    if(tag&8388608LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 24) return true;
+    if(tag&16777216LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 25) return true;
+    if(tag&33554432LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 26) return true;
+    if(tag&67108864LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 27) return true;
+    if(tag&134217728LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 28) return true;
+    if(tag&268435456LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 29) return true;
+    if(tag&536870912LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 30) return true;
+    if(tag&1073741824LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 31) return true;
+    if(tag&2147483648LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 32) return true;
+    if(tag&4294967296LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 33) return true;
+    if(tag&8589934592LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 34) return true;
+    if(tag&17179869184LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 35) return true;
+    if(tag&34359738368LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 36) return true;
+    if(tag&68719476736LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 37) return true;
+    if(tag&137438953472LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 38) return true;
+    if(tag&274877906944LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 39) return true;
+    if(tag&549755813888LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 40) return true;
+    if(tag&1099511627776LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 41) return true;
+    if(tag&2199023255552LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 42) return true;
+    if(tag&4398046511104LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 43) return true;
+    if(tag&8796093022208LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 44) return true;
+    if(tag&17592186044416LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 45) return true;
+    if(tag&35184372088832LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 46) return true;
+    if(tag&70368744177664LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 47) return true;
+    if(tag&140737488355328LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 48) return true;
+    if(tag&281474976710656LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 49) return true;
+    if(tag&562949953421312LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 50) return true;
+    if(tag&1125899906842624LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 51) return true;
+    if(tag&2251799813685248LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 52) return true;
+    if(tag&4503599627370496LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 53) return true;
+    if(tag&9007199254740992LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 54) return true;
+    if(tag&18014398509481984LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 55) return true;
+    if(tag&36028797018963968LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 56) return true;
+    if(tag&72057594037927936LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 57) return true;
+    if(tag&144115188075855872LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 58) return true;
+    if(tag&288230376151711744LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 59) return true;
+    if(tag&576460752303423488LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 60) return true;
+    if(tag&1152921504606846976LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 61) return true;
+    if(tag&2305843009213693952LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 62) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::narrow& value)
+  {
+    if(!is_default(value.m0,(int32_t)0)) return false;
+    if(!is_default(value.m1,(int32_t)0)) return false;
+    if(!is_default(value.m2,(int32_t)0)) return false;
+    if(!is_default(value.m3,(int32_t)0)) return false;
+    if(!value.m4.empty()) return false;
+    if(!is_default(value.m5,(int32_t)0)) return false;
+    if(!is_default(value.m6,(int32_t)0)) return false;
+    if(!value.m7.empty()) return false;
+    if(!is_default(value.m8,(int32_t)0)) return false;
+    if(!is_default(value.m9,(int32_t)0)) return false;
+    if(!is_default(value.m10,(int32_t)0)) return false;
+    if(!is_default(value.m11,(int32_t)0)) return false;
+    if(!is_default(value.m12,(int32_t)0)) return false;
+    if(!value.m13.empty()) return false;
+    if(!is_default(value.m14,(int32_t)0)) return false;
+    if(!is_default(value.m15,(int32_t)0)) return false;
+    if(!value.m16.empty()) return false;
+    if(!is_default(value.m17,(int32_t)0)) return false;
+    if(!is_default(value.m18,(int32_t)0)) return false;
+    if(!is_default(value.m19,(int32_t)0)) return false;
+    if(!is_default(value.m20,(int32_t)0)) return false;
+    if(!is_default(value.m21,(int32_t)0)) return false;
+    if(!value.m22.empty()) return false;
+    if(!is_default(value.m23,(int32_t)0)) return false;
+    if(!is_default(value.m24,(int32_t)0)) return false;
+    if(!value.m25.empty()) return false;
+    if(!is_default(value.m26,(int32_t)0)) return false;
+    if(!is_default(value.m27,(int32_t)0)) return false;
+    if(!is_default(value.m28,(int32_t)0)) return false;
+    if(!is_default(value.m29,(int32_t)0)) return false;
+    if(!is_default(value.m30,(int32_t)0)) return false;
+    if(!value.m31.empty()) return false;
+    if(!is_default(value.m32,(int32_t)0)) return false;
+    if(!is_default(value.m33,(int32_t)0)) return false;
+    if(!value.m34.empty()) return false;
+    if(!is_default(value.m35,(int32_t)0)) return false;
+    if(!is_default(value.m36,(int32_t)0)) return false;
+    if(!is_default(value.m37,(int32_t)0)) return false;
+    if(!is_default(value.m38,(int32_t)0)) return false;
+    if(!is_default(value.m39,(int32_t)0)) return false;
+    if(!value.m40.empty()) return false;
+    if(!is_default(value.m41,(int32_t)0)) return false;
+    if(!is_default(value.m42,(int32_t)0)) return false;
+    if(!value.m43.empty()) return false;
+    if(!is_default(value.m44,(int32_t)0)) return false;
+    if(!is_default(value.m45,(int32_t)0)) return false;
+    if(!is_default(value.m46,(int32_t)0)) return false;
+    if(!is_default(value.m47,(int32_t)0)) return false;
+    if(!is_default(value.m48,(int32_t)0)) return false;
+    if(!value.m49.empty()) return false;
+    if(!is_default(value.m50,(int32_t)0)) return false;
+    if(!is_default(value.m51,(int32_t)0)) return false;
+    if(!value.m52.empty()) return false;
+    if(!is_default(value.m53,(int32_t)0)) return false;
+    if(!is_default(value.m54,(int32_t)0)) return false;
+    if(!is_default(value.m55,(int32_t)0)) return false;
+    if(!is_default(value.m56,(int32_t)0)) return false;
+    if(!is_default(value.m57,(int32_t)0)) return false;
+    if(!value.m58.empty()) return false;
+    if(!is_default(value.m59,(int32_t)0)) return false;
+    if(!is_default(value.m60,(int32_t)0)) return false;
+    if(!value.m61.empty()) return false;
+    if(!is_default(value.m62,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::narrow& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.m0,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.m1,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.m2,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.m3,(int32_t)0)){tag|=8LL;}
+    if(!value.m4.empty()){tag|=16LL;}
+    if(!is_default(value.m5,(int32_t)0)){tag|=32LL;}
+    if(!is_default(value.m6,(int32_t)0)){tag|=64LL;}
+    if(!value.m7.empty()){tag|=128LL;}
+    if(!is_default(value.m8,(int32_t)0)){tag|=256LL;}
+    if(!is_default(value.m9,(int32_t)0)){tag|=512LL;}
+    if(!is_default(value.m10,(int32_t)0)){tag|=1024LL;}
+    if(!is_default(value.m11,(int32_t)0)){tag|=2048LL;}
+    if(!is_default(value.m12,(int32_t)0)){tag|=4096LL;}
+    if(!value.m13.empty()){tag|=8192LL;}
+    if(!is_default(value.m14,(int32_t)0)){tag|=16384LL;}
+    if(!is_default(value.m15,(int32_t)0)){tag|=32768LL;}
+    if(!value.m16.empty()){tag|=65536LL;}
+    if(!is_default(value.m17,(int32_t)0)){tag|=131072LL;}
+    if(!is_default(value.m18,(int32_t)0)){tag|=262144LL;}
+    if(!is_default(value.m19,(int32_t)0)){tag|=524288LL;}
+    if(!is_default(value.m20,(int32_t)0)){tag|=1048576LL;}
+    if(!is_default(value.m21,(int32_t)0)){tag|=2097152LL;}
+    if(!value.m22.empty()){tag|=4194304LL;}
+    if(!is_default(value.m23,(int32_t)0)){tag|=8388608LL;}
+    if(!is_default(value.m24,(int32_t)0)){tag|=16777216LL;}
+    if(!value.m25.empty()){tag|=33554432LL;}
+    if(!is_default(value.m26,(int32_t)0)){tag|=67108864LL;}
+    if(!is_default(value.m27,(int32_t)0)){tag|=134217728LL;}
+    if(!is_default(value.m28,(int32_t)0)){tag|=268435456LL;}
+    if(!is_default(value.m29,(int32_t)0)){tag|=536870912LL;}
+    if(!is_default(value.m30,(int32_t)0)){tag|=1073741824LL;}
+    if(!value.m31.empty()){tag|=2147483648LL;}
+    if(!is_default(value.m32,(int32_t)0)){tag|=4294967296LL;}
+    if(!is_default(value.m33,(int32_t)0)){tag|=8589934592LL;}
+    if(!value.m34.empty()){tag|=17179869184LL;}
+    if(!is_default(value.m35,(int32_t)0)){tag|=34359738368LL;}
+    if(!is_default(value.m36,(int32_t)0)){tag|=68719476736LL;}
+    if(!is_default(value.m37,(int32_t)0)){tag|=137438953472LL;}
+    if(!is_default(value.m38,(int32_t)0)){tag|=274877906944LL;}
+    if(!is_default(value.m39,(int32_t)0)){tag|=549755813888LL;}
+    if(!value.m40.empty()){tag|=1099511627776LL;}
+    if(!is_default(value.m41,(int32_t)0)){tag|=2199023255552LL;}
+    if(!is_default(value.m42,(int32_t)0)){tag|=4398046511104LL;}
+    if(!value.m43.empty()){tag|=8796093022208LL;}
+    if(!is_default(value.m44,(int32_t)0)){tag|=17592186044416LL;}
+    if(!is_default(value.m45,(int32_t)0)){tag|=35184372088832LL;}
+    if(!is_default(value.m46,(int32_t)0)){tag|=70368744177664LL;}
+    if(!is_default(value.m47,(int32_t)0)){tag|=140737488355328LL;}
+    if(!is_default(value.m48,(int32_t)0)){tag|=281474976710656LL;}
+    if(!value.m49.empty()){tag|=562949953421312LL;}
+    if(!is_default(value.m50,(int32_t)0)){tag|=1125899906842624LL;}
+    if(!is_default(value.m51,(int32_t)0)){tag|=2251799813685248LL;}
+    if(!value.m52.empty()){tag|=4503599627370496LL;}
+    if(!is_default(value.m53,(int32_t)0)){tag|=9007199254740992LL;}
+    if(!is_default(value.m54,(int32_t)0)){tag|=18014398509481984LL;}
+    if(!is_default(value.m55,(int32_t)0)){tag|=36028797018963968LL;}
+    if(!is_default(value.m56,(int32_t)0)){tag|=72057594037927936LL;}
+    if(!is_default(value.m57,(int32_t)0)){tag|=144115188075855872LL;}
+    if(!value.m58.empty()){tag|=288230376151711744LL;}
+    if(!is_default(value.m59,(int32_t)0)){tag|=576460752303423488LL;}
+    if(!is_default(value.m60,(int32_t)0)){tag|=1152921504606846976LL;}
+    if(!value.m61.empty()){tag|=2305843009213693952LL;}
+    if(!is_default(value.m62,(int32_t)0)){tag|=4611686018427387904LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.m0);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.m1);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.m2);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.m3);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m4).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&32LL)
+    {
+      size += size_of(value.m5);
+    }
+    if(tag&64LL)
+    {
+      size += size_of(value.m6);
+    }
+    if(tag&128LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m7).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&256LL)
+    {
+      size += size_of(value.m8);
+    }
+    if(tag&512LL)
+    {
+      size += size_of(value.m9);
+    }
+    if(tag&1024LL)
+    {
+      size += size_of(value.m10);
+    }
+    if(tag&2048LL)
+    {
+      size += size_of(value.m11);
+    }
+    if(tag&4096LL)
+    {
+      size += size_of(value.m12);
+    }
+    if(tag&8192LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m13).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&16384LL)
+    {
+      size += size_of(value.m14);
+    }
+    if(tag&32768LL)
+    {
+      size += size_of(value.m15);
+    }
+    if(tag&65536LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m16).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&131072LL)
+    {
+      size += size_of(value.m17);
+    }
+    if(tag&262144LL)
+    {
+      size += size_of(value.m18);
+    }
+    if(tag&524288LL)
+    {
+      size += size_of(value.m19);
+    }
+    if(tag&1048576LL)
+    {
+      size += size_of(value.m20);
+    }
+    if(tag&2097152LL)
+    {
+      size += size_of(value.m21);
+    }
+    if(tag&4194304LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m22).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&8388608LL)
+    {
+      size += size_of(value.m23);
+    }
+    if(tag&16777216LL)
+    {
+      size += size_of(value.m24);
+    }
+    if(tag&33554432LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m25).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&67108864LL)
+    {
+      size += size_of(value.m26);
+    }
+    if(tag&134217728LL)
+    {
+      size += size_of(value.m27);
+    }
+    if(tag&268435456LL)
+    {
+      size += size_of(value.m28);
+    }
+    if(tag&536870912LL)
+    {
+      size += size_of(value.m29);
+    }
+    if(tag&1073741824LL)
+    {
+      size += size_of(value.m30);
+    }
+    if(tag&2147483648LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m31).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4294967296LL)
+    {
+      size += size_of(value.m32);
+    }
+    if(tag&8589934592LL)
+    {
+      size += size_of(value.m33);
+    }
+    if(tag&17179869184LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m34).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&34359738368LL)
+    {
+      size += size_of(value.m35);
+    }
+    if(tag&68719476736LL)
+    {
+      size += size_of(value.m36);
+    }
+    if(tag&137438953472LL)
+    {
+      size += size_of(value.m37);
+    }
+    if(tag&274877906944LL)
+    {
+      size += size_of(value.m38);
+    }
+    if(tag&549755813888LL)
+    {
+      size += size_of(value.m39);
+    }
+    if(tag&1099511627776LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m40).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&2199023255552LL)
+    {
+      size += size_of(value.m41);
+    }
+    if(tag&4398046511104LL)
+    {
+      size += size_of(value.m42);
+    }
+    if(tag&8796093022208LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m43).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&17592186044416LL)
+    {
+      size += size_of(value.m44);
+    }
+    if(tag&35184372088832LL)
+    {
+      size += size_of(value.m45);
+    }
+    if(tag&70368744177664LL)
+    {
+      size += size_of(value.m46);
+    }
+    if(tag&140737488355328LL)
+    {
+      size += size_of(value.m47);
+    }
+    if(tag&281474976710656LL)
+    {
+      size += size_of(value.m48);
+    }
+    if(tag&562949953421312LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m49).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&1125899906842624LL)
+    {
+      size += size_of(value.m50);
+    }
+    if(tag&2251799813685248LL)
+    {
+      size += size_of(value.m51);
+    }
+    if(tag&4503599627370496LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m52).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&9007199254740992LL)
+    {
+      size += size_of(value.m53);
+    }
+    if(tag&18014398509481984LL)
+    {
+      size += size_of(value.m54);
+    }
+    if(tag&36028797018963968LL)
+    {
+      size += size_of(value.m55);
+    }
+    if(tag&72057594037927936LL)
+    {
+      size += size_of(value.m56);
+    }
+    if(tag&144115188075855872LL)
+    {
+      size += size_of(value.m57);
+    }
+    if(tag&288230376151711744LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m58).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&576460752303423488LL)
+    {
+      size += size_of(value.m59);
+    }
+    if(tag&1152921504606846976LL)
+    {
+      size += size_of(value.m60);
+    }
+    if(tag&2305843009213693952LL)
+    {
+      {
+        int32_t len = (int32_t)(value.m61).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&4611686018427387904LL)
+    {
+      size += size_of(value.m62);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::narrow& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.m0,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.m1,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.m2,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.m3,(int32_t)0)){tag|=8LL;}
+    if(!value.m4.empty()){tag|=16LL;}
+    if(!is_default(value.m5,(int32_t)0)){tag|=32LL;}
+    if(!is_default(value.m6,(int32_t)0)){tag|=64LL;}
+    if(!value.m7.empty()){tag|=128LL;}
+    if(!is_default(value.m8,(int32_t)0)){tag|=256LL;}
+    if(!is_default(value.m9,(int32_t)0)){tag|=512LL;}
+    if(!is_default(value.m10,(int32_t)0)){tag|=1024LL;}
+    if(!is_default(value.m11,(int32_t)0)){tag|=2048LL;}
+    if(!is_default(value.m12,(int32_t)0)){tag|=4096LL;}
+    if(!value.m13.empty()){tag|=8192LL;}
+    if(!is_default(value.m14,(int32_t)0)){tag|=16384LL;}
+    if(!is_default(value.m15,(int32_t)0)){tag|=32768LL;}
+    if(!value.m16.empty()){tag|=65536LL;}
+    if(!is_default(value.m17,(int32_t)0)){tag|=131072LL;}
+    if(!is_default(value.m18,(int32_t)0)){tag|=262144LL;}
+    if(!is_default(value.m19,(int32_t)0)){tag|=524288LL;}
+    if(!is_default(value.m20,(int32_t)0)){tag|=1048576LL;}
+    if(!is_default(value.m21,(int32_t)0)){tag|=2097152LL;}
+    if(!value.m22.empty()){tag|=4194304LL;}
+    if(!is_default(value.m23,(int32_t)0)){tag|=8388608LL;}
+    if(!is_default(value.m24,(int32_t)0)){tag|=16777216LL;}
+    if(!value.m25.empty()){tag|=33554432LL;}
+    if(!is_default(value.m26,(int32_t)0)){tag|=67108864LL;}
+    if(!is_default(value.m27,(int32_t)0)){tag|=134217728LL;}
+    if(!is_default(value.m28,(int32_t)0)){tag|=268435456LL;}
+    if(!is_default(value.m29,(int32_t)0)){tag|=536870912LL;}
+    if(!is_default(value.m30,(int32_t)0)){tag|=1073741824LL;}
+    if(!value.m31.empty()){tag|=2147483648LL;}
+    if(!is_default(value.m32,(int32_t)0)){tag|=4294967296LL;}
+    if(!is_default(value.m33,(int32_t)0)){tag|=8589934592LL;}
+    if(!value.m34.empty()){tag|=17179869184LL;}
+    if(!is_default(value.m35,(int32_t)0)){tag|=34359738368LL;}
+    if(!is_default(value.m36,(int32_t)0)){tag|=68719476736LL;}
+    if(!is_default(value.m37,(int32_t)0)){tag|=137438953472LL;}
+    if(!is_default(value.m38,(int32_t)0)){tag|=274877906944LL;}
+    if(!is_default(value.m39,(int32_t)0)){tag|=549755813888LL;}
+    if(!value.m40.empty()){tag|=1099511627776LL;}
+    if(!is_default(value.m41,(int32_t)0)){tag|=2199023255552LL;}
+    if(!is_default(value.m42,(int32_t)0)){tag|=4398046511104LL;}
+    if(!value.m43.empty()){tag|=8796093022208LL;}
+    if(!is_default(value.m44,(int32_t)0)){tag|=17592186044416LL;}
+    if(!is_default(value.m45,(int32_t)0)){tag|=35184372088832LL;}
+    if(!is_default(value.m46,(int32_t)0)){tag|=70368744177664LL;}
+    if(!is_default(value.m47,(int32_t)0)){tag|=140737488355328LL;}
+    if(!is_default(value.m48,(int32_t)0)){tag|=281474976710656LL;}
+    if(!value.m49.empty()){tag|=562949953421312LL;}
+    if(!is_default(value.m50,(int32_t)0)){tag|=1125899906842624LL;}
+    if(!is_default(value.m51,(int32_t)0)){tag|=2251799813685248LL;}
+    if(!value.m52.empty()){tag|=4503599627370496LL;}
+    if(!is_default(value.m53,(int32_t)0)){tag|=9007199254740992LL;}
+    if(!is_default(value.m54,(int32_t)0)){tag|=18014398509481984LL;}
+    if(!is_default(value.m55,(int32_t)0)){tag|=36028797018963968LL;}
+    if(!is_default(value.m56,(int32_t)0)){tag|=72057594037927936LL;}
+    if(!is_default(value.m57,(int32_t)0)){tag|=144115188075855872LL;}
+    if(!value.m58.empty()){tag|=288230376151711744LL;}
+    if(!is_default(value.m59,(int32_t)0)){tag|=576460752303423488LL;}
+    if(!is_default(value.m60,(int32_t)0)){tag|=1152921504606846976LL;}
+    if(!value.m61.empty()){tag|=2305843009213693952LL;}
+    if(!is_default(value.m62,(int32_t)0)){tag|=4611686018427387904LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.m0);
+    if(tag&2LL)    write(stream,value.m1);
+    if(tag&4LL)    write(stream,value.m2);
+    if(tag&8LL)    write(stream,value.m3);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.m4).size();
+      write(stream,len);
+      stream.write((value.m4).data(),len);
+    }
+    if(tag&32LL)    write(stream,value.m5);
+    if(tag&64LL)    write(stream,value.m6);
+    if(tag&128LL)    {
+      int32_t len = (int32_t)(value.m7).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&256LL)    write(stream,value.m8);
+    if(tag&512LL)    write(stream,value.m9);
+    if(tag&1024LL)    write(stream,value.m10);
+    if(tag&2048LL)    write(stream,value.m11);
+    if(tag&4096LL)    write(stream,value.m12);
+    if(tag&8192LL)    {
+      int32_t len = (int32_t)(value.m13).size();
+      write(stream,len);
+      stream.write((value.m13).data(),len);
+    }
+    if(tag&16384LL)    write(stream,value.m14);
+    if(tag&32768LL)    write(stream,value.m15);
+    if(tag&65536LL)    {
+      int32_t len = (int32_t)(value.m16).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&131072LL)    write(stream,value.m17);
+    if(tag&262144LL)    write(stream,value.m18);
+    if(tag&524288LL)    write(stream,value.m19);
+    if(tag&1048576LL)    write(stream,value.m20);
+    if(tag&2097152LL)    write(stream,value.m21);
+    if(tag&4194304LL)    {
+      int32_t len = (int32_t)(value.m22).size();
+      write(stream,len);
+      stream.write((value.m22).data(),len);
+    }
+    if(tag&8388608LL)    write(stream,value.m23);
+    if(tag&16777216LL)    write(stream,value.m24);
+    if(tag&33554432LL)    {
+      int32_t len = (int32_t)(value.m25).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&67108864LL)    write(stream,value.m26);
+    if(tag&134217728LL)    write(stream,value.m27);
+    if(tag&268435456LL)    write(stream,value.m28);
+    if(tag&536870912LL)    write(stream,value.m29);
+    if(tag&1073741824LL)    write(stream,value.m30);
+    if(tag&2147483648LL)    {
+      int32_t len = (int32_t)(value.m31).size();
+      write(stream,len);
+      stream.write((value.m31).data(),len);
+    }
+    if(tag&4294967296LL)    write(stream,value.m32);
+    if(tag&8589934592LL)    write(stream,value.m33);
+    if(tag&17179869184LL)    {
+      int32_t len = (int32_t)(value.m34).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&34359738368LL)    write(stream,value.m35);
+    if(tag&68719476736LL)    write(stream,value.m36);
+    if(tag&137438953472LL)    write(stream,value.m37);
+    if(tag&274877906944LL)    write(stream,value.m38);
+    if(tag&549755813888LL)    write(stream,value.m39);
+    if(tag&1099511627776LL)    {
+      int32_t len = (int32_t)(value.m40).size();
+      write(stream,len);
+      stream.write((value.m40).data(),len);
+    }
+    if(tag&2199023255552LL)    write(stream,value.m41);
+    if(tag&4398046511104LL)    write(stream,value.m42);
+    if(tag&8796093022208LL)    {
+      int32_t len = (int32_t)(value.m43).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&17592186044416LL)    write(stream,value.m44);
+    if(tag&35184372088832LL)    write(stream,value.m45);
+    if(tag&70368744177664LL)    write(stream,value.m46);
+    if(tag&140737488355328LL)    write(stream,value.m47);
+    if(tag&281474976710656LL)    write(stream,value.m48);
+    if(tag&562949953421312LL)    {
+      int32_t len = (int32_t)(value.m49).size();
+      write(stream,len);
+      stream.write((value.m49).data(),len);
+    }
+    if(tag&1125899906842624LL)    write(stream,value.m50);
+    if(tag&2251799813685248LL)    write(stream,value.m51);
+    if(tag&4503599627370496LL)    {
+      int32_t len = (int32_t)(value.m52).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&9007199254740992LL)    write(stream,value.m53);
+    if(tag&18014398509481984LL)    write(stream,value.m54);
+    if(tag&36028797018963968LL)    write(stream,value.m55);
+    if(tag&72057594037927936LL)    write(stream,value.m56);
+    if(tag&144115188075855872LL)    write(stream,value.m57);
+    if(tag&288230376151711744LL)    {
+      int32_t len = (int32_t)(value.m58).size();
+      write(stream,len);
+      stream.write((value.m58).data(),len);
+    }
+    if(tag&576460752303423488LL)    write(stream,value.m59);
+    if(tag&1152921504606846976LL)    write(stream,value.m60);
+    if(tag&2305843009213693952LL)    {
+      int32_t len = (int32_t)(value.m61).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&4611686018427387904LL)    write(stream,value.m62);
+  }
+
+  template<>
+  struct columns< ::my::feature::narrow >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::narrow& value = values[k];
+        if(!is_default(value.m0,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.m1,(int32_t)0)){tag|=2LL;}
+        if(!is_default(value.m2,(int32_t)0)){tag|=4LL;}
+        if(!is_default(value.m3,(int32_t)0)){tag|=8LL;}
+        if(!value.m4.empty()){tag|=16LL;}
+        if(!is_default(value.m5,(int32_t)0)){tag|=32LL;}
+        if(!is_default(value.m6,(int32_t)0)){tag|=64LL;}
+        if(!value.m7.empty()){tag|=128LL;}
+        if(!is_default(value.m8,(int32_t)0)){tag|=256LL;}
+        if(!is_default(value.m9,(int32_t)0)){tag|=512LL;}
+        if(!is_default(value.m10,(int32_t)0)){tag|=1024LL;}
+        if(!is_default(value.m11,(int32_t)0)){tag|=2048LL;}
+        if(!is_default(value.m12,(int32_t)0)){tag|=4096LL;}
+        if(!value.m13.empty()){tag|=8192LL;}
+        if(!is_default(value.m14,(int32_t)0)){tag|=16384LL;}
+        if(!is_default(value.m15,(int32_t)0)){tag|=32768LL;}
+        if(!value.m16.empty()){tag|=65536LL;}
+        if(!is_default(value.m17,(int32_t)0)){tag|=131072LL;}
+        if(!is_default(value.m18,(int32_t)0)){tag|=262144LL;}
+        if(!is_default(value.m19,(int32_t)0)){tag|=524288LL;}
+        if(!is_default(value.m20,(int32_t)0)){tag|=1048576LL;}
+        if(!is_default(value.m21,(int32_t)0)){tag|=2097152LL;}
+        if(!value.m22.empty()){tag|=4194304LL;}
+        if(!is_default(value.m23,(int32_t)0)){tag|=8388608LL;}
+        if(!is_default(value.m24,(int32_t)0)){tag|=16777216LL;}
+        if(!value.m25.empty()){tag|=33554432LL;}
+        if(!is_default(value.m26,(int32_t)0)){tag|=67108864LL;}
+        if(!is_default(value.m27,(int32_t)0)){tag|=134217728LL;}
+        if(!is_default(value.m28,(int32_t)0)){tag|=268435456LL;}
+        if(!is_default(value.m29,(int32_t)0)){tag|=536870912LL;}
+        if(!is_default(value.m30,(int32_t)0)){tag|=1073741824LL;}
+        if(!value.m31.empty()){tag|=2147483648LL;}
+        if(!is_default(value.m32,(int32_t)0)){tag|=4294967296LL;}
+        if(!is_default(value.m33,(int32_t)0)){tag|=8589934592LL;}
+        if(!value.m34.empty()){tag|=17179869184LL;}
+        if(!is_default(value.m35,(int32_t)0)){tag|=34359738368LL;}
+        if(!is_default(value.m36,(int32_t)0)){tag|=68719476736LL;}
+        if(!is_default(value.m37,(int32_t)0)){tag|=137438953472LL;}
+        if(!is_default(value.m38,(int32_t)0)){tag|=274877906944LL;}
+        if(!is_default(value.m39,(int32_t)0)){tag|=549755813888LL;}
+        if(!value.m40.empty()){tag|=1099511627776LL;}
+        if(!is_default(value.m41,(int32_t)0)){tag|=2199023255552LL;}
+        if(!is_default(value.m42,(int32_t)0)){tag|=4398046511104LL;}
+        if(!value.m43.empty()){tag|=8796093022208LL;}
+        if(!is_default(value.m44,(int32_t)0)){tag|=17592186044416LL;}
+        if(!is_default(value.m45,(int32_t)0)){tag|=35184372088832LL;}
+        if(!is_default(value.m46,(int32_t)0)){tag|=70368744177664LL;}
+        if(!is_default(value.m47,(int32_t)0)){tag|=140737488355328LL;}
+        if(!is_default(value.m48,(int32_t)0)){tag|=281474976710656LL;}
+        if(!value.m49.empty()){tag|=562949953421312LL;}
+        if(!is_default(value.m50,(int32_t)0)){tag|=1125899906842624LL;}
+        if(!is_default(value.m51,(int32_t)0)){tag|=2251799813685248LL;}
+        if(!value.m52.empty()){tag|=4503599627370496LL;}
+        if(!is_default(value.m53,(int32_t)0)){tag|=9007199254740992LL;}
+        if(!is_default(value.m54,(int32_t)0)){tag|=18014398509481984LL;}
+        if(!is_default(value.m55,(int32_t)0)){tag|=36028797018963968LL;}
+        if(!is_default(value.m56,(int32_t)0)){tag|=72057594037927936LL;}
+        if(!is_default(value.m57,(int32_t)0)){tag|=144115188075855872LL;}
+        if(!value.m58.empty()){tag|=288230376151711744LL;}
+        if(!is_default(value.m59,(int32_t)0)){tag|=576460752303423488LL;}
+        if(!is_default(value.m60,(int32_t)0)){tag|=1152921504606846976LL;}
+        if(!value.m61.empty()){tag|=2305843009213693952LL;}
+        if(!is_default(value.m62,(int32_t)0)){tag|=4611686018427387904LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m0;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m1;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m2;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m3;}
+        size += size_of_column(column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m4).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m5;}
+        size += size_of_column(column);
+      }
+      if(tag&64LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m6;}
+        size += size_of_column(column);
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m7).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&256LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m8;}
+        size += size_of_column(column);
+      }
+      if(tag&512LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m9;}
+        size += size_of_column(column);
+      }
+      if(tag&1024LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m10;}
+        size += size_of_column(column);
+      }
+      if(tag&2048LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m11;}
+        size += size_of_column(column);
+      }
+      if(tag&4096LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m12;}
+        size += size_of_column(column);
+      }
+      if(tag&8192LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m13).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&16384LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m14;}
+        size += size_of_column(column);
+      }
+      if(tag&32768LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m15;}
+        size += size_of_column(column);
+      }
+      if(tag&65536LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m16).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&131072LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m17;}
+        size += size_of_column(column);
+      }
+      if(tag&262144LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m18;}
+        size += size_of_column(column);
+      }
+      if(tag&524288LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m19;}
+        size += size_of_column(column);
+      }
+      if(tag&1048576LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m20;}
+        size += size_of_column(column);
+      }
+      if(tag&2097152LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m21;}
+        size += size_of_column(column);
+      }
+      if(tag&4194304LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m22).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&8388608LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m23;}
+        size += size_of_column(column);
+      }
+      if(tag&16777216LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m24;}
+        size += size_of_column(column);
+      }
+      if(tag&33554432LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m25).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&67108864LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m26;}
+        size += size_of_column(column);
+      }
+      if(tag&134217728LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m27;}
+        size += size_of_column(column);
+      }
+      if(tag&268435456LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m28;}
+        size += size_of_column(column);
+      }
+      if(tag&536870912LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m29;}
+        size += size_of_column(column);
+      }
+      if(tag&1073741824LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m30;}
+        size += size_of_column(column);
+      }
+      if(tag&2147483648LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m31).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4294967296LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m32;}
+        size += size_of_column(column);
+      }
+      if(tag&8589934592LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m33;}
+        size += size_of_column(column);
+      }
+      if(tag&17179869184LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m34).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&34359738368LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m35;}
+        size += size_of_column(column);
+      }
+      if(tag&68719476736LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m36;}
+        size += size_of_column(column);
+      }
+      if(tag&137438953472LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m37;}
+        size += size_of_column(column);
+      }
+      if(tag&274877906944LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m38;}
+        size += size_of_column(column);
+      }
+      if(tag&549755813888LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m39;}
+        size += size_of_column(column);
+      }
+      if(tag&1099511627776LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m40).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&2199023255552LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m41;}
+        size += size_of_column(column);
+      }
+      if(tag&4398046511104LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m42;}
+        size += size_of_column(column);
+      }
+      if(tag&8796093022208LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m43).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&17592186044416LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m44;}
+        size += size_of_column(column);
+      }
+      if(tag&35184372088832LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m45;}
+        size += size_of_column(column);
+      }
+      if(tag&70368744177664LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m46;}
+        size += size_of_column(column);
+      }
+      if(tag&140737488355328LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m47;}
+        size += size_of_column(column);
+      }
+      if(tag&281474976710656LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m48;}
+        size += size_of_column(column);
+      }
+      if(tag&562949953421312LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m49).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&1125899906842624LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m50;}
+        size += size_of_column(column);
+      }
+      if(tag&2251799813685248LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m51;}
+        size += size_of_column(column);
+      }
+      if(tag&4503599627370496LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m52).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&9007199254740992LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m53;}
+        size += size_of_column(column);
+      }
+      if(tag&18014398509481984LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m54;}
+        size += size_of_column(column);
+      }
+      if(tag&36028797018963968LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m55;}
+        size += size_of_column(column);
+      }
+      if(tag&72057594037927936LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m56;}
+        size += size_of_column(column);
+      }
+      if(tag&144115188075855872LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m57;}
+        size += size_of_column(column);
+      }
+      if(tag&288230376151711744LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m58).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&576460752303423488LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m59;}
+        size += size_of_column(column);
+      }
+      if(tag&1152921504606846976LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m60;}
+        size += size_of_column(column);
+      }
+      if(tag&2305843009213693952LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m61).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&4611686018427387904LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m62;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m0;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m1;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m2;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m3;}
+        write_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m4).size();
+            write(stream,len);
+            stream.write((value.m4).data(),len);
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m5;}
+        write_column(stream,column);
+      }
+      if(tag&64LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m6;}
+        write_column(stream,column);
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m7).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&256LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m8;}
+        write_column(stream,column);
+      }
+      if(tag&512LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m9;}
+        write_column(stream,column);
+      }
+      if(tag&1024LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m10;}
+        write_column(stream,column);
+      }
+      if(tag&2048LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m11;}
+        write_column(stream,column);
+      }
+      if(tag&4096LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m12;}
+        write_column(stream,column);
+      }
+      if(tag&8192LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m13).size();
+            write(stream,len);
+            stream.write((value.m13).data(),len);
+          }
+        }
+      }
+      if(tag&16384LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m14;}
+        write_column(stream,column);
+      }
+      if(tag&32768LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m15;}
+        write_column(stream,column);
+      }
+      if(tag&65536LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m16).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&131072LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m17;}
+        write_column(stream,column);
+      }
+      if(tag&262144LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m18;}
+        write_column(stream,column);
+      }
+      if(tag&524288LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m19;}
+        write_column(stream,column);
+      }
+      if(tag&1048576LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m20;}
+        write_column(stream,column);
+      }
+      if(tag&2097152LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m21;}
+        write_column(stream,column);
+      }
+      if(tag&4194304LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m22).size();
+            write(stream,len);
+            stream.write((value.m22).data(),len);
+          }
+        }
+      }
+      if(tag&8388608LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m23;}
+        write_column(stream,column);
+      }
+      if(tag&16777216LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m24;}
+        write_column(stream,column);
+      }
+      if(tag&33554432LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m25).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&67108864LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m26;}
+        write_column(stream,column);
+      }
+      if(tag&134217728LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m27;}
+        write_column(stream,column);
+      }
+      if(tag&268435456LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m28;}
+        write_column(stream,column);
+      }
+      if(tag&536870912LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m29;}
+        write_column(stream,column);
+      }
+      if(tag&1073741824LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m30;}
+        write_column(stream,column);
+      }
+      if(tag&2147483648LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m31).size();
+            write(stream,len);
+            stream.write((value.m31).data(),len);
+          }
+        }
+      }
+      if(tag&4294967296LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m32;}
+        write_column(stream,column);
+      }
+      if(tag&8589934592LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m33;}
+        write_column(stream,column);
+      }
+      if(tag&17179869184LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m34).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&34359738368LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m35;}
+        write_column(stream,column);
+      }
+      if(tag&68719476736LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m36;}
+        write_column(stream,column);
+      }
+      if(tag&137438953472LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m37;}
+        write_column(stream,column);
+      }
+      if(tag&274877906944LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m38;}
+        write_column(stream,column);
+      }
+      if(tag&549755813888LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m39;}
+        write_column(stream,column);
+      }
+      if(tag&1099511627776LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m40).size();
+            write(stream,len);
+            stream.write((value.m40).data(),len);
+          }
+        }
+      }
+      if(tag&2199023255552LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m41;}
+        write_column(stream,column);
+      }
+      if(tag&4398046511104LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m42;}
+        write_column(stream,column);
+      }
+      if(tag&8796093022208LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m43).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&17592186044416LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m44;}
+        write_column(stream,column);
+      }
+      if(tag&35184372088832LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m45;}
+        write_column(stream,column);
+      }
+      if(tag&70368744177664LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m46;}
+        write_column(stream,column);
+      }
+      if(tag&140737488355328LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m47;}
+        write_column(stream,column);
+      }
+      if(tag&281474976710656LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m48;}
+        write_column(stream,column);
+      }
+      if(tag&562949953421312LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m49).size();
+            write(stream,len);
+            stream.write((value.m49).data(),len);
+          }
+        }
+      }
+      if(tag&1125899906842624LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m50;}
+        write_column(stream,column);
+      }
+      if(tag&2251799813685248LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m51;}
+        write_column(stream,column);
+      }
+      if(tag&4503599627370496LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m52).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&9007199254740992LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m53;}
+        write_column(stream,column);
+      }
+      if(tag&18014398509481984LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m54;}
+        write_column(stream,column);
+      }
+      if(tag&36028797018963968LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m55;}
+        write_column(stream,column);
+      }
+      if(tag&72057594037927936LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m56;}
+        write_column(stream,column);
+      }
+      if(tag&144115188075855872LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m57;}
+        write_column(stream,column);
+      }
+      if(tag&288230376151711744LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m58).size();
+            write(stream,len);
+            stream.write((value.m58).data(),len);
+          }
+        }
+      }
+      if(tag&576460752303423488LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m59;}
+        write_column(stream,column);
+      }
+      if(tag&1152921504606846976LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m60;}
+        write_column(stream,column);
+      }
+      if(tag&2305843009213693952LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = (int32_t)(value.m61).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&4611686018427387904LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].m62;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m0 = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m1 = column[k];}
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m2 = column[k];}
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m3 = column[k];}
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m4.resize(len);
+            stream.read((char *)value.m4.data(),len);
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m5 = column[k];}
+      }
+      if(tag&64LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m6 = column[k];}
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m7.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m7[i]);}
+            }
+          }
+        }
+      }
+      if(tag&256LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m8 = column[k];}
+      }
+      if(tag&512LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m9 = column[k];}
+      }
+      if(tag&1024LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m10 = column[k];}
+      }
+      if(tag&2048LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m11 = column[k];}
+      }
+      if(tag&4096LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m12 = column[k];}
+      }
+      if(tag&8192LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m13.resize(len);
+            stream.read((char *)value.m13.data(),len);
+          }
+        }
+      }
+      if(tag&16384LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m14 = column[k];}
+      }
+      if(tag&32768LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m15 = column[k];}
+      }
+      if(tag&65536LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m16.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m16[i]);}
+            }
+          }
+        }
+      }
+      if(tag&131072LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m17 = column[k];}
+      }
+      if(tag&262144LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m18 = column[k];}
+      }
+      if(tag&524288LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m19 = column[k];}
+      }
+      if(tag&1048576LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m20 = column[k];}
+      }
+      if(tag&2097152LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m21 = column[k];}
+      }
+      if(tag&4194304LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m22.resize(len);
+            stream.read((char *)value.m22.data(),len);
+          }
+        }
+      }
+      if(tag&8388608LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m23 = column[k];}
+      }
+      if(tag&16777216LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m24 = column[k];}
+      }
+      if(tag&33554432LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m25.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m25[i]);}
+            }
+          }
+        }
+      }
+      if(tag&67108864LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m26 = column[k];}
+      }
+      if(tag&134217728LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m27 = column[k];}
+      }
+      if(tag&268435456LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m28 = column[k];}
+      }
+      if(tag&536870912LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m29 = column[k];}
+      }
+      if(tag&1073741824LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m30 = column[k];}
+      }
+      if(tag&2147483648LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m31.resize(len);
+            stream.read((char *)value.m31.data(),len);
+          }
+        }
+      }
+      if(tag&4294967296LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m32 = column[k];}
+      }
+      if(tag&8589934592LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m33 = column[k];}
+      }
+      if(tag&17179869184LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m34.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m34[i]);}
+            }
+          }
+        }
+      }
+      if(tag&34359738368LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m35 = column[k];}
+      }
+      if(tag&68719476736LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m36 = column[k];}
+      }
+      if(tag&137438953472LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m37 = column[k];}
+      }
+      if(tag&274877906944LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m38 = column[k];}
+      }
+      if(tag&549755813888LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m39 = column[k];}
+      }
+      if(tag&1099511627776LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m40.resize(len);
+            stream.read((char *)value.m40.data(),len);
+          }
+        }
+      }
+      if(tag&2199023255552LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m41 = column[k];}
+      }
+      if(tag&4398046511104LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m42 = column[k];}
+      }
+      if(tag&8796093022208LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m43.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m43[i]);}
+            }
+          }
+        }
+      }
+      if(tag&17592186044416LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m44 = column[k];}
+      }
+      if(tag&35184372088832LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m45 = column[k];}
+      }
+      if(tag&70368744177664LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m46 = column[k];}
+      }
+      if(tag&140737488355328LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m47 = column[k];}
+      }
+      if(tag&281474976710656LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m48 = column[k];}
+      }
+      if(tag&562949953421312LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m49.resize(len);
+            stream.read((char *)value.m49.data(),len);
+          }
+        }
+      }
+      if(tag&1125899906842624LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m50 = column[k];}
+      }
+      if(tag&2251799813685248LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m51 = column[k];}
+      }
+      if(tag&4503599627370496LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m52.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m52[i]);}
+            }
+          }
+        }
+      }
+      if(tag&9007199254740992LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m53 = column[k];}
+      }
+      if(tag&18014398509481984LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m54 = column[k];}
+      }
+      if(tag&36028797018963968LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m55 = column[k];}
+      }
+      if(tag&72057594037927936LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m56 = column[k];}
+      }
+      if(tag&144115188075855872LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m57 = column[k];}
+      }
+      if(tag&288230376151711744LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m58.resize(len);
+            stream.read((char *)value.m58.data(),len);
+          }
+        }
+      }
+      if(tag&576460752303423488LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m59 = column[k];}
+      }
+      if(tag&1152921504606846976LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m60 = column[k];}
+      }
+      if(tag&2305843009213693952LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::narrow& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.m61.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.m61[i]);}
+            }
+          }
+        }
+      }
+      if(tag&4611686018427387904LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].m62 = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::narrow& value)
+  {
+    read(stream,value.m0);
+    read(stream,value.m1);
+    read(stream,value.m2);
+    read(stream,value.m3);
+    {
+      int32_t len = check_read_size(stream);
+      value.m4.resize(len);
+      stream.read((char *)value.m4.data(),len);
+    }
+    read(stream,value.m5);
+    read(stream,value.m6);
+    {
+      int32_t len = check_read_size(stream);
+      value.m7.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m7[i]);
+      }
+    }
+    read(stream,value.m8);
+    read(stream,value.m9);
+    read(stream,value.m10);
+    read(stream,value.m11);
+    read(stream,value.m12);
+    {
+      int32_t len = check_read_size(stream);
+      value.m13.resize(len);
+      stream.read((char *)value.m13.data(),len);
+    }
+    read(stream,value.m14);
+    read(stream,value.m15);
+    {
+      int32_t len = check_read_size(stream);
+      value.m16.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m16[i]);
+      }
+    }
+    read(stream,value.m17);
+    read(stream,value.m18);
+    read(stream,value.m19);
+    read(stream,value.m20);
+    read(stream,value.m21);
+    {
+      int32_t len = check_read_size(stream);
+      value.m22.resize(len);
+      stream.read((char *)value.m22.data(),len);
+    }
+    read(stream,value.m23);
+    read(stream,value.m24);
+    {
+      int32_t len = check_read_size(stream);
+      value.m25.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m25[i]);
+      }
+    }
+    read(stream,value.m26);
+    read(stream,value.m27);
+    read(stream,value.m28);
+    read(stream,value.m29);
+    read(stream,value.m30);
+    {
+      int32_t len = check_read_size(stream);
+      value.m31.resize(len);
+      stream.read((char *)value.m31.data(),len);
+    }
+    read(stream,value.m32);
+    read(stream,value.m33);
+    {
+      int32_t len = check_read_size(stream);
+      value.m34.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m34[i]);
+      }
+    }
+    read(stream,value.m35);
+    read(stream,value.m36);
+    read(stream,value.m37);
+    read(stream,value.m38);
+    read(stream,value.m39);
+    {
+      int32_t len = check_read_size(stream);
+      value.m40.resize(len);
+      stream.read((char *)value.m40.data(),len);
+    }
+    read(stream,value.m41);
+    read(stream,value.m42);
+    {
+      int32_t len = check_read_size(stream);
+      value.m43.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m43[i]);
+      }
+    }
+    read(stream,value.m44);
+    read(stream,value.m45);
+    read(stream,value.m46);
+    read(stream,value.m47);
+    read(stream,value.m48);
+    {
+      int32_t len = check_read_size(stream);
+      value.m49.resize(len);
+      stream.read((char *)value.m49.data(),len);
+    }
+    read(stream,value.m50);
+    read(stream,value.m51);
+    {
+      int32_t len = check_read_size(stream);
+      value.m52.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m52[i]);
+      }
+    }
+    read(stream,value.m53);
+    read(stream,value.m54);
+    read(stream,value.m55);
+    read(stream,value.m56);
+    read(stream,value.m57);
+    {
+      int32_t len = check_read_size(stream);
+      value.m58.resize(len);
+      stream.read((char *)value.m58.data(),len);
+    }
+    read(stream,value.m59);
+    read(stream,value.m60);
+    {
+      int32_t len = check_read_size(stream);
+      value.m61.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.m61[i]);
+      }
+    }
+    read(stream,value.m62);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::narrow& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.m0);
+    size += size_of(value.m1);
+    size += size_of(value.m2);
+    size += size_of(value.m3);
+    {
+      int32_t len = (int32_t)(value.m4).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m5);
+    size += size_of(value.m6);
+    {
+      int32_t len = (int32_t)(value.m7).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m8);
+    size += size_of(value.m9);
+    size += size_of(value.m10);
+    size += size_of(value.m11);
+    size += size_of(value.m12);
+    {
+      int32_t len = (int32_t)(value.m13).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m14);
+    size += size_of(value.m15);
+    {
+      int32_t len = (int32_t)(value.m16).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m17);
+    size += size_of(value.m18);
+    size += size_of(value.m19);
+    size += size_of(value.m20);
+    size += size_of(value.m21);
+    {
+      int32_t len = (int32_t)(value.m22).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m23);
+    size += size_of(value.m24);
+    {
+      int32_t len = (int32_t)(value.m25).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m26);
+    size += size_of(value.m27);
+    size += size_of(value.m28);
+    size += size_of(value.m29);
+    size += size_of(value.m30);
+    {
+      int32_t len = (int32_t)(value.m31).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m32);
+    size += size_of(value.m33);
+    {
+      int32_t len = (int32_t)(value.m34).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m35);
+    size += size_of(value.m36);
+    size += size_of(value.m37);
+    size += size_of(value.m38);
+    size += size_of(value.m39);
+    {
+      int32_t len = (int32_t)(value.m40).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m41);
+    size += size_of(value.m42);
+    {
+      int32_t len = (int32_t)(value.m43).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m44);
+    size += size_of(value.m45);
+    size += size_of(value.m46);
+    size += size_of(value.m47);
+    size += size_of(value.m48);
+    {
+      int32_t len = (int32_t)(value.m49).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m50);
+    size += size_of(value.m51);
+    {
+      int32_t len = (int32_t)(value.m52).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m53);
+    size += size_of(value.m54);
+    size += size_of(value.m55);
+    size += size_of(value.m56);
+    size += size_of(value.m57);
+    {
+      int32_t len = (int32_t)(value.m58).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.m59);
+    size += size_of(value.m60);
+    {
+      int32_t len = (int32_t)(value.m61).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.m62);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::narrow& value)
+  {
+    write(stream,value.m0);
+    write(stream,value.m1);
+    write(stream,value.m2);
+    write(stream,value.m3);
+    {
+      int32_t len = (int32_t)(value.m4).size();
+      write(stream,len);
+      stream.write((value.m4).data(),len);
+    }
+    write(stream,value.m5);
+    write(stream,value.m6);
+    {
+      int32_t len = (int32_t)(value.m7).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m7.begin() ; i != value.m7.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m8);
+    write(stream,value.m9);
+    write(stream,value.m10);
+    write(stream,value.m11);
+    write(stream,value.m12);
+    {
+      int32_t len = (int32_t)(value.m13).size();
+      write(stream,len);
+      stream.write((value.m13).data(),len);
+    }
+    write(stream,value.m14);
+    write(stream,value.m15);
+    {
+      int32_t len = (int32_t)(value.m16).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m16.begin() ; i != value.m16.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m17);
+    write(stream,value.m18);
+    write(stream,value.m19);
+    write(stream,value.m20);
+    write(stream,value.m21);
+    {
+      int32_t len = (int32_t)(value.m22).size();
+      write(stream,len);
+      stream.write((value.m22).data(),len);
+    }
+    write(stream,value.m23);
+    write(stream,value.m24);
+    {
+      int32_t len = (int32_t)(value.m25).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m25.begin() ; i != value.m25.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m26);
+    write(stream,value.m27);
+    write(stream,value.m28);
+    write(stream,value.m29);
+    write(stream,value.m30);
+    {
+      int32_t len = (int32_t)(value.m31).size();
+      write(stream,len);
+      stream.write((value.m31).data(),len);
+    }
+    write(stream,value.m32);
+    write(stream,value.m33);
+    {
+      int32_t len = (int32_t)(value.m34).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m34.begin() ; i != value.m34.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m35);
+    write(stream,value.m36);
+    write(stream,value.m37);
+    write(stream,value.m38);
+    write(stream,value.m39);
+    {
+      int32_t len = (int32_t)(value.m40).size();
+      write(stream,len);
+      stream.write((value.m40).data(),len);
+    }
+    write(stream,value.m41);
+    write(stream,value.m42);
+    {
+      int32_t len = (int32_t)(value.m43).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m43.begin() ; i != value.m43.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m44);
+    write(stream,value.m45);
+    write(stream,value.m46);
+    write(stream,value.m47);
+    write(stream,value.m48);
+    {
+      int32_t len = (int32_t)(value.m49).size();
+      write(stream,len);
+      stream.write((value.m49).data(),len);
+    }
+    write(stream,value.m50);
+    write(stream,value.m51);
+    {
+      int32_t len = (int32_t)(value.m52).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m52.begin() ; i != value.m52.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m53);
+    write(stream,value.m54);
+    write(stream,value.m55);
+    write(stream,value.m56);
+    write(stream,value.m57);
+    {
+      int32_t len = (int32_t)(value.m58).size();
+      write(stream,len);
+      stream.write((value.m58).data(),len);
+    }
+    write(stream,value.m59);
+    write(stream,value.m60);
+    {
+      int32_t len = (int32_t)(value.m61).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.m61.begin() ; i != value.m61.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.m62);
+  }
+
+}
+
+#endif
@@ -0,0 +1,50 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/idset.adl.h>
+#include "features.hpp"
+
+// [bitmap] id sets with chunks written as gaps, as runs and as a bitmap, read as a sorted list
+void feature_idset()
+{
+  my::feature::guild guild;
+  guild.id = 9;
+  // sparse
+  guild.members.insert(5);
+  guild.members.insert(4000);
+  guild.members.insert(0xffffffffu);
+  // one run
+  for (uint32_t id = 70000; id < 75000; ++id)
+  {
+    guild.members.insert(id);
+  }
+  // every third id of a chunk
+  for (uint32_t id = 0x30000; id < 0x40000; id += 3)
+  {
+    guild.members.insert(id);
+  }
+  guild.banned.insert(42);
+
+  my::feature::guild other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.guild", guild, other, doc, data);
+  assert(other.members.size() == guild.members.size() && other.members.contains(0x3ffff) && !other.members.contains(0x3fffe));
+  assert(other.banned.contains(42));
+
+  const std::vector<adata::dynamic::value>& ids = doc.field("members")->items();
+  assert(ids.size() == guild.members.size());
+  std::size_t i = 0;
+  for (adata::id_set::const_iterator it = guild.members.begin(); it != guild.members.end(); ++it, ++i)
+  {
+    assert(ids[i].as_uint() == *it);
+  }
+  (void)i;
+}
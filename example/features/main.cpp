@@ -0,0 +1,102 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+// every encoding feature written by the generated code and read back by the dynamic codec,
+// and the other way round. "example_features name" runs one of them
+
+#include "features.hpp"
+#include <iostream>
+#include <cstring>
+#include <stdexcept>
+
+void feature_projected();
+void feature_sized();
+void feature_wide();
+void feature_defaults();
+void feature_encoded();
+void feature_idset();
+void feature_columnar();
+void feature_soa();
+void feature_flags();
+void feature_bitrun();
+void feature_fixed();
+void feature_packed();
+void feature_quant();
+void feature_gauge();
+void feature_dict();
+void feature_faction();
+void feature_command();
+void feature_update();
+void feature_chunk();
+void feature_signs();
+void feature_flat();
+
+struct feature_check
+{
+  const char * name;
+  void(*run)();
+};
+
+static const feature_check checks[] =
+{
+  { "projected", feature_projected },
+  { "sized", feature_sized },
+  { "wide", feature_wide },
+  { "defaults", feature_defaults },
+  { "encoded", feature_encoded },
+  { "idset", feature_idset },
+  { "columnar", feature_columnar },
+  { "soa", feature_soa },
+  { "flags", feature_flags },
+  { "bitrun", feature_bitrun },
+  { "fixed", feature_fixed },
+  { "packed", feature_packed },
+  { "quant", feature_quant },
+  { "gauge", feature_gauge },
+  { "dict", feature_dict },
+  { "faction", feature_faction },
+  { "command", feature_command },
+  { "update", feature_update },
+  { "chunk", feature_chunk },
+  { "signs", feature_signs },
+  { "flat", feature_flat },
+};
+
+const adata::dynamic::schema& feature_schema()
+{
+  static adata::dynamic::schema schema;
+  if (schema.type_count() == 0 && !schema.load_file(SOURCE_DIR "/generated/feature.adt"))
+  {
+    throw std::runtime_error("can't load " SOURCE_DIR "/generated/feature.adt");
+  }
+  return schema;
+}
+
+int main(int argc, char ** argv)
+{
+  try
+  {
+    for (auto const& check : checks)
+    {
+      if (argc < 2 || std::strcmp(argv[1], check.name) == 0)
+      {
+        check.run();
+        std::cout << check.name << " ok" << std::endl;
+      }
+    }
+    std::cout << "done." << std::endl;
+  }
+  catch (std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
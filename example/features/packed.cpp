@@ -0,0 +1,48 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/packed.adl.h>
+#include "features.hpp"
+
+// [packed] types as a member, nested, in lists (one memcpy without padding) and as map values
+void feature_packed()
+{
+  my::feature::drawing drawing;
+  drawing.origin.y = 2.5f;
+  for (int32_t i = 0; i < 10; ++i)
+  {
+    my::feature::point3 point;
+    point.x = (float)i;
+    point.z = -(float)i;
+    drawing.points.push_back(point);
+
+    my::feature::segment segment;
+    segment.from = point;
+    segment.to.y = (float)i * 0.5f;
+    segment.color = (uint16_t)(0xf000 + i);
+    segment.layer = (int8_t)-i;
+    drawing.segments.push_back(segment);
+  }
+  drawing.marks[-3].x = 8.0f;
+  drawing.after = 4;
+
+  my::feature::drawing other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.drawing", drawing, other, doc, data);
+  assert(other.origin.y == 2.5f && other.points.size() == 10 && other.points[9].z == -9.0f);
+  assert(other.segments[7].color == 0xf007 && other.segments[7].layer == -7 && other.segments[7].to.y == 3.5f);
+  assert(other.marks[-3].x == 8.0f && other.after == 4);
+  assert(doc.field("segments")->items()[3].field("from")->field("x")->as_float() == 3.0);
+  assert(doc.field("segments")->items()[3].field("layer")->as_int() == -3);
+
+  // no tag and len_tag: 12 bytes for a point3, 27 for a segment
+  assert(adata::size_of(drawing.points[1]) == 12 && adata::size_of(drawing.segments[1]) == 27);
+}
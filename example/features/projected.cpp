@@ -0,0 +1,42 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/projected.adl.h>
+#include "features.hpp"
+
+// read_projected decodes only the masked members, and agrees with the full dynamic read
+void feature_projected()
+{
+  my::feature::hero hero;
+  hero.id = 7;
+  hero.name = "arthas";
+  hero.scores.push_back(3);
+  hero.scores.push_back(-4);
+  hero.gold = -1234567890123LL;
+  hero.title = "king";
+
+  my::feature::hero other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.hero", hero, other, doc, data);
+  assert(doc.field("gold")->as_int() == hero.gold);
+  assert(doc.field("scores")->items()[1].as_int() == -4);
+
+  typedef adata::member_index<my::feature::hero> hero_member;
+  my::feature::hero part;
+  part.name = "kept";
+  part.title = "kept";
+  adata::zero_copy_buffer stream;
+  stream.set_read(&data[0], data.size());
+  adata::read_projected(stream, part, (1LL << hero_member::id) | (1LL << hero_member::gold));
+  assert(!stream.bad());
+  assert(part.id == doc.field("id")->as_int() && part.gold == doc.field("gold")->as_int());
+  assert(part.name == "kept" && part.scores.empty() && part.title == "kept");
+}
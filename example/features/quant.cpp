@@ -0,0 +1,47 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/quant.adl.h>
+#include "features.hpp"
+#include <cmath>
+
+// [quant] floats in a [bits] run and in a [columnar] list, clamped and rounded to their steps
+void feature_quant()
+{
+  my::feature::route route;
+  route.start.x = 12.34f;
+  route.start.y = -9000.0f;
+  route.start.kind = 6;
+  route.start.heading = 90.26;
+  route.start.label = "gate";
+  for (int32_t i = 0; i < 16; ++i)
+  {
+    my::feature::waypoint point;
+    point.x = 100.0f + (float)i * 0.25f;
+    point.y = -50.0f + (float)i * 0.01f;
+    point.heading = (double)(i * 20);
+    route.points.push_back(point);
+  }
+
+  // the generated writer quantizes: the first round trip starts from values on the steps
+  my::feature::route on_steps;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.route", route, on_steps, doc, data);
+  assert(std::fabs(on_steps.start.x - 12.34f) <= 0.005f && on_steps.start.y == -8192.0f);
+  assert(on_steps.start.heading == 90.5 && on_steps.start.kind == 6);
+  assert(std::fabs(on_steps.points[15].x - 103.75f) <= 0.005f && on_steps.points[11].heading == 220.0);
+
+  my::feature::route other;
+  round_trip("my.feature.route", on_steps, other, doc, data);
+  assert(other.start.x == on_steps.start.x && other.points[7].y == on_steps.points[7].y);
+  assert(doc.field("start")->field("heading")->as_float() == 90.5);
+  assert(std::fabs(doc.field("points")->items()[4].field("x")->as_float() - 101.0) <= 0.005);
+}
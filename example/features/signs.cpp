@@ -0,0 +1,67 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/signs.adl.h>
+#include "features.hpp"
+#include <cstring>
+#include <limits>
+
+namespace
+{
+  // a negative varint is a tag byte, 0x80 + the byte count - 1 + 0x20, and its magnitude in little endian
+  template<typename ty>
+  void check_bytes(ty value, const char * expected, std::size_t len)
+  {
+    char buffer[16];
+    adata::zero_copy_buffer stream;
+    stream.set_write(buffer, sizeof(buffer));
+    adata::write(stream, value);
+    assert(!stream.bad() && stream.write_length() == len && adata::size_of(value) == (int32_t)len);
+    assert(std::memcmp(buffer, expected, len) == 0);
+
+    ty other = 0;
+    stream.set_read(buffer, len);
+    adata::read(stream, other);
+    assert(!stream.bad() && other == value);
+    (void)expected;
+    (void)other;
+  }
+}
+
+// negative integers of every width: exact bytes, and through the dynamic codec
+void feature_signs()
+{
+  check_bytes<int8_t>(-1, "\xa0\x01", 2);
+  check_bytes<int8_t>(-128, "\xa0\x80", 2);
+  check_bytes<int16_t>(-1, "\xa0\x01", 2);
+  check_bytes<int16_t>(-300, "\xa1\x2c\x01", 3);
+  check_bytes<int16_t>(std::numeric_limits<int16_t>::min(), "\xa1\x00\x80", 3);
+  check_bytes<int32_t>(-1, "\xa0\x01", 2);
+  check_bytes<int32_t>(-70000, "\xa2\x70\x11\x01", 4);
+  check_bytes<int32_t>(std::numeric_limits<int32_t>::min(), "\xa3\x00\x00\x00\x80", 5);
+  check_bytes<int64_t>(-1, "\xa0\x01", 2);
+  check_bytes<int64_t>(-1234567890123LL, "\xa5\xcb\x04\xfb\x71\x1f\x01", 7);
+  check_bytes<int64_t>(std::numeric_limits<int64_t>::min(), "\xa7\x00\x00\x00\x00\x00\x00\x00\x80", 9);
+
+  my::feature::signs signs;
+  signs.tiny = -128;
+  signs.small = -300;
+  signs.medium = -70000;
+  signs.large = std::numeric_limits<int64_t>::min();
+  signs.deltas.push_back(-1);
+  signs.deltas.push_back(-16777216);
+
+  my::feature::signs other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.signs", signs, other, doc, data);
+  assert(other.tiny == -128 && other.small == -300 && other.medium == -70000 && other.large == signs.large);
+  assert(doc.field("medium")->as_int() == -70000 && doc.field("deltas")->items()[1].as_int() == -16777216);
+}
@@ -0,0 +1,47 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/sized.adl.h>
+#include "features.hpp"
+
+// [sized] lists and maps, and a reader that skips a deleted one by its length
+void feature_sized()
+{
+  my::feature::bag bag;
+  bag.id = 3;
+  for (int32_t i = 0; i < 100; ++i)
+  {
+    bag.items.push_back(i * 1000);
+  }
+  bag.names[1] = "one";
+  bag.names[-2] = "minus two";
+  bag.note = "after the sized members";
+
+  my::feature::bag other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.bag", bag, other, doc, data);
+  assert(doc.field("items")->size() == 100 && doc.field("items")->items()[99].as_int() == 99000);
+  assert(doc.field("names")->size() == 2);
+  assert(other.items == bag.items && other.names == bag.names);
+
+  my::feature::bag_v2 bag_v2;
+  adata::zero_copy_buffer stream;
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, bag_v2);
+  assert(!stream.bad() && stream.read_length() == data.size());
+  assert(bag_v2.note == bag.note && bag_v2.names == bag.names);
+
+  adata::dynamic::value doc_v2;
+  stream.set_read(&data[0], data.size());
+  adata::dynamic::read(stream, *feature_schema().find_type("my.feature.bag_v2"), doc_v2);
+  assert(doc_v2.field("items") == 0);
+  assert(doc_v2.field("note")->as_string() == bag.note);
+}
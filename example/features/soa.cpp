@@ -0,0 +1,51 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/soa.adl.h>
+#include "features.hpp"
+
+// struct of arrays containers encode as the plain and [columnar] lists they stand for
+void feature_soa()
+{
+  my::feature::squad squad;
+  for (int32_t i = 0; i < 20; ++i)
+  {
+    my::feature::trooper trooper;
+    trooper.id = i;
+    trooper.x = i * 1.5f;
+    trooper.y = -i * 0.5f;
+    trooper.alive = i % 3 != 0;
+    trooper.name = i % 2 ? "odd" : "";
+    squad.troopers.push_back(trooper);
+    squad.reserve.push_back(trooper);
+  }
+  // a bool column is bytes, any of them but 0 is true
+  squad.reserve.alive[0] = 2;
+
+  my::feature::squad other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.squad", squad, other, doc, data);
+  assert(other.troopers.size() == 20 && other.reserve.size() == 20);
+  assert(other.troopers.x[7] == 10.5f && other.troopers.alive[9] == 0 && other.troopers.alive[10] == 1);
+  assert(other.reserve.alive[0] == 1 && other.reserve.at(3).alive == false && other.reserve.name[5] == "odd");
+  assert(doc.field("troopers")->items()[7].field("x")->as_float() == 10.5);
+
+  my::feature::squad_plain plain;
+  adata::zero_copy_buffer stream;
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, plain);
+  assert(!stream.bad() && stream.read_length() == data.size());
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    assert(plain.troopers[i].id == other.troopers.id[i] && plain.troopers[i].alive == (other.troopers.alive[i] != 0));
+    assert(plain.reserve[i].y == other.reserve.y[i] && plain.reserve[i].alive == other.reserve.at(i).alive);
+  }
+}
@@ -0,0 +1,58 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/update.adl.h>
+#include "features.hpp"
+
+// optional members set to their default, not set, and read by a plain declaration
+void feature_update()
+{
+  my::feature::update update;
+  update.id = 12;
+  update.hp = 0;
+  update.pos.emplace();
+  update.team = my::feature::crew::red;
+
+  my::feature::update other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.update", update, other, doc, data);
+  assert(other.hp.has_value() && *other.hp == 0 && other.pos.has_value() && other.pos->x == 0.0f);
+  assert(other.team.has_value() && *other.team == my::feature::crew::red);
+  assert(!other.title.has_value() && !other.speed.has_value());
+  assert(doc.field("hp")->as_int() == 0 && doc.field("title")->is_null() && doc.field("speed")->is_null());
+  assert(doc.field("pos")->field("x")->as_float() == 0.0);
+
+  // an update carrying only title: a reader with plain members reads the rest as their defaults
+  my::feature::update rename;
+  rename.id = 12;
+  rename.title = "warchief";
+  my::feature::update rename_other;
+  round_trip("my.feature.update", rename, rename_other, doc, data);
+  assert(!rename_other.hp.has_value() && rename_other.title.value_or("") == "warchief");
+
+  // read into the first update, the members it had set and this one hasn't are reset
+  adata::zero_copy_buffer stream;
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, other);
+  assert(!stream.bad() && other.title.value_or("") == "warchief");
+  assert(!other.hp.has_value() && !other.pos.has_value() && !other.team.has_value());
+  other.hp = 7;
+  other.team = my::feature::crew::red;
+  stream.set_read(&data[0], data.size());
+  adata::read_projected(stream, other, 1LL << adata::member_index<my::feature::update>::hp);
+  assert(!other.hp.has_value() && other.team.has_value());
+
+  my::feature::update_plain plain;
+  plain.hp = 250;
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, plain);
+  assert(!stream.bad() && plain.id == 12 && plain.title == "warchief" && plain.hp == 0);
+}
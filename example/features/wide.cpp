@@ -0,0 +1,54 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/feature/wide.adl.h>
+#include "features.hpp"
+
+// a type of more than 63 members, read whole, projected and by an older reader
+void feature_wide()
+{
+  my::feature::wide wide;
+  wide.m1 = 1;
+  wide.m4 = "four";
+  wide.m62 = 62;
+  wide.m63 = -63;
+  wide.m67 = "sixty seven";
+  wide.m70.push_back(70);
+  wide.m71 = 71;
+
+  my::feature::wide other;
+  adata::dynamic::value doc;
+  std::vector<char> data;
+  round_trip("my.feature.wide", wide, other, doc, data);
+  assert(doc.field("m63")->as_int() == -63 && doc.field("m67")->as_string() == "sixty seven");
+  assert(doc.field("m70")->items()[0].as_int() == 70 && doc.field("m71")->as_int() == 71);
+  assert(doc.field("m64")->as_int() == 0);
+
+  // one mask bit per member index
+  uint64_t mask[2] = { 1ULL << 4, 1ULL << (67 - 64) };
+  my::feature::wide part;
+  adata::zero_copy_buffer stream;
+  stream.set_read(&data[0], data.size());
+  adata::read_projected(stream, part, mask);
+  assert(!stream.bad());
+  assert(part.m4 == "four" && part.m67 == "sixty seven");
+  assert(part.m1 == 0 && part.m63 == 0 && part.m70.empty());
+
+  my::feature::narrow narrow;
+  stream.set_read(&data[0], data.size());
+  adata::read(stream, narrow);
+  assert(!stream.bad() && stream.read_length() == data.size());
+  assert(narrow.m1 == 1 && narrow.m4 == "four" && narrow.m62 == 62);
+
+  adata::dynamic::value doc_narrow;
+  stream.set_read(&data[0], data.size());
+  adata::dynamic::read(stream, *feature_schema().find_type("my.feature.narrow"), doc_narrow);
+  assert(doc_narrow.field("m62")->as_int() == 62 && doc_narrow.field("m63") == 0);
+}
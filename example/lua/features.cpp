@@ -0,0 +1,124 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+// data written by the generated code, read, checked and written again by the lua core, and
+// compared byte for byte: a type for each encoding the lua core adds
+
+#include <my/feature/encoded.adl.h>
+#include <my/feature/gauge.adl.h>
+#include <my/feature/dict.adl.h>
+#include <my/feature/command.adl.h>
+#include <my/feature/update.adl.h>
+#include <adata_corec.hpp>
+
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+  template<typename ty>
+  void lua_round_trip(lua_State * L, const char * type_name, const ty& value, ty& other)
+  {
+    std::string data((std::size_t)adata::size_of(value), '\0');
+    adata::zero_copy_buffer stream;
+    stream.set_write(&data[0], data.size());
+    adata::write(stream, value);
+
+    lua_getglobal(L, "feature_round_trip");
+    lua_pushstring(L, type_name);
+    lua_pushlstring(L, data.data(), data.size());
+    if (lua_pcall(L, 2, 1, 0) != 0)
+    {
+      throw std::runtime_error(lua_tostring(L, -1));
+    }
+    std::size_t len = 0;
+    const char * lua_data = lua_tolstring(L, -1, &len);
+    std::string again(lua_data, len);
+    lua_pop(L, 1);
+    if (again != data)
+    {
+      throw std::runtime_error(std::string(type_name) + " written by lua differs");
+    }
+
+    stream.set_read(&again[0], again.size());
+    adata::read(stream, other);
+    assert(!stream.bad() && stream.read_length() == again.size());
+  }
+}
+
+void lua_features(lua_State * L)
+{
+  my::feature::series series;
+  for (int64_t i = 0; i < 20; ++i)
+  {
+    series.times.push_back(1420070400000LL + i * 1000);
+    series.ticks.push_back((int32_t)(i * i));
+    series.levels.push_back((uint16_t)(i < 12 ? 7 : i));
+  }
+  series.ticks.push_back(std::numeric_limits<int32_t>::min());
+  series.small.push_back(127);
+  series.small.push_back(-128);
+  my::feature::series series_other;
+  lua_round_trip(L, "my.feature.series", series, series_other);
+  assert(series_other.times == series.times && series_other.ticks == series.ticks && series_other.levels == series.levels);
+
+  my::feature::gauge gauge;
+  for (int32_t i = 0; i < 32; ++i)
+  {
+    gauge.samples.push_back(i % 16 == 15 ? -101.5 : 100.0 + (double)(i / 8));
+    gauge.levels.push_back((float)(i % 4) * 0.5f);
+  }
+  gauge.samples[20] = std::numeric_limits<double>::quiet_NaN();
+  gauge.after = 2;
+  my::feature::gauge gauge_other;
+  lua_round_trip(L, "my.feature.gauge", gauge, gauge_other);
+  assert(gauge_other.levels == gauge.levels && gauge_other.samples[31] == -101.5);
+
+  static const char * items[] = { "sword", "shield", "potion" };
+  my::feature::loot_log log;
+  for (int32_t i = 0; i < 6; ++i)
+  {
+    my::feature::loot loot;
+    loot.item = items[i % 3];
+    loot.owner = i % 2 ? "odd" : "even";
+    loot.count = i;
+    log.drops.push_back(loot);
+  }
+  log.zone = "deadmines";
+  my::feature::loot_log log_other;
+  lua_round_trip(L, "my.feature.loot_log", log, log_other);
+  assert(log_other.drops[3].item == "sword" && log_other.zone == "deadmines");
+
+  my::feature::command_queue queue;
+  queue.commands.resize(4);
+  my::feature::walk& walk = queue.commands[0].set_walk();
+  walk.x = -3;
+  walk.path.push_back(7);
+  my::feature::cast& cast = queue.commands[1].set_cast();
+  cast.spell_id = 133;
+  cast.target = "boss";
+  queue.commands[2].set_say().text = "hello";
+  queue.current = queue.commands[1];
+  my::feature::command_queue queue_other;
+  lua_round_trip(L, "my.feature.command_queue", queue, queue_other);
+  assert(queue_other.commands[0].get_walk()->path.size() == 1 && queue_other.commands[3].empty());
+  assert(queue_other.current.get_cast()->target == "boss");
+
+  my::feature::update update;
+  update.id = 12;
+  update.hp = 0;
+  update.pos.emplace();
+  update.team = my::feature::crew::red;
+  my::feature::update update_other;
+  lua_round_trip(L, "my.feature.update", update, update_other);
+  assert(update_other.hp.has_value() && update_other.pos.has_value() && !update_other.title.has_value());
+}
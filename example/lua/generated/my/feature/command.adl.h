@@ -0,0 +1,1596 @@
+#ifndef my_feature_command_adl_h_adata_header_define
+#define my_feature_command_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct walk
+  {
+    int32_t x;
+    int32_t y;
+    ::std::vector< int32_t > path;
+    walk()
+    :    x(0),
+    y(0)
+    {}
+  };
+
+  struct cast
+  {
+    int32_t spell_id;
+    ::std::string target;
+    cast()
+    :    spell_id(0)
+    {}
+  };
+
+  struct say
+  {
+    ::std::string text;
+    say()
+    {}
+  };
+
+  struct command
+  {
+    enum kind_type
+    {
+      none_kind = 0,
+      walk_kind = 1,
+      cast_kind = 2,
+      say_kind = 3,
+    };
+    typedef ::my::feature::walk walk_type;
+    typedef ::my::feature::cast cast_type;
+    typedef ::my::feature::say say_type;
+
+    command() : m_kind(none_kind) {}
+    command(const command& other) : m_kind(none_kind) { assign(other); }
+    command(command&& other) : m_kind(none_kind) { assign(::std::move(other)); }
+    ~command() { reset(); }
+    command& operator=(const command& other)
+    {
+      if(this != &other) { reset(); assign(other); }
+      return *this;
+    }
+    command& operator=(command&& other)
+    {
+      if(this != &other) { reset(); assign(::std::move(other)); }
+      return *this;
+    }
+
+    kind_type kind() const { return m_kind; }
+    bool empty() const { return m_kind == none_kind; }
+    void reset()
+    {
+      switch(m_kind)
+      {
+      case walk_kind: m_walk.~walk_type(); break;
+      case cast_kind: m_cast.~cast_type(); break;
+      case say_kind: m_say.~say_type(); break;
+      default: break;
+      }
+      m_kind = none_kind;
+    }
+
+    walk_type * get_walk() { return m_kind == walk_kind ? &m_walk : nullptr; }
+    const walk_type * get_walk() const { return m_kind == walk_kind ? &m_walk : nullptr; }
+    walk_type& set_walk()
+    {
+      reset();
+      new (&m_walk) walk_type();
+      m_kind = walk_kind;
+      return m_walk;
+    }
+    walk_type& set_walk(const walk_type& value)
+    {
+      walk_type temp(value);
+      reset();
+      new (&m_walk) walk_type(::std::move(temp));
+      m_kind = walk_kind;
+      return m_walk;
+    }
+    walk_type& set_walk(walk_type&& value)
+    {
+      walk_type temp(::std::move(value));
+      reset();
+      new (&m_walk) walk_type(::std::move(temp));
+      m_kind = walk_kind;
+      return m_walk;
+    }
+
+    cast_type * get_cast() { return m_kind == cast_kind ? &m_cast : nullptr; }
+    const cast_type * get_cast() const { return m_kind == cast_kind ? &m_cast : nullptr; }
+    cast_type& set_cast()
+    {
+      reset();
+      new (&m_cast) cast_type();
+      m_kind = cast_kind;
+      return m_cast;
+    }
+    cast_type& set_cast(const cast_type& value)
+    {
+      cast_type temp(value);
+      reset();
+      new (&m_cast) cast_type(::std::move(temp));
+      m_kind = cast_kind;
+      return m_cast;
+    }
+    cast_type& set_cast(cast_type&& value)
+    {
+      cast_type temp(::std::move(value));
+      reset();
+      new (&m_cast) cast_type(::std::move(temp));
+      m_kind = cast_kind;
+      return m_cast;
+    }
+
+    say_type * get_say() { return m_kind == say_kind ? &m_say : nullptr; }
+    const say_type * get_say() const { return m_kind == say_kind ? &m_say : nullptr; }
+    say_type& set_say()
+    {
+      reset();
+      new (&m_say) say_type();
+      m_kind = say_kind;
+      return m_say;
+    }
+    say_type& set_say(const say_type& value)
+    {
+      say_type temp(value);
+      reset();
+      new (&m_say) say_type(::std::move(temp));
+      m_kind = say_kind;
+      return m_say;
+    }
+    say_type& set_say(say_type&& value)
+    {
+      say_type temp(::std::move(value));
+      reset();
+      new (&m_say) say_type(::std::move(temp));
+      m_kind = say_kind;
+      return m_say;
+    }
+
+  private:
+    void assign(const command& other)
+    {
+      switch(other.m_kind)
+      {
+      case walk_kind: set_walk(other.m_walk); break;
+      case cast_kind: set_cast(other.m_cast); break;
+      case say_kind: set_say(other.m_say); break;
+      default: break;
+      }
+    }
+    void assign(command&& other)
+    {
+      switch(other.m_kind)
+      {
+      case walk_kind: set_walk(::std::move(other.m_walk)); break;
+      case cast_kind: set_cast(::std::move(other.m_cast)); break;
+      case say_kind: set_say(::std::move(other.m_say)); break;
+      default: break;
+      }
+    }
+
+    kind_type m_kind;
+    union
+    {
+      walk_type m_walk;
+      cast_type m_cast;
+      say_type m_say;
+    };
+  };
+
+  struct command_queue
+  {
+    int32_t after;
+    ::std::vector< ::my::feature::command > commands;
+    ::my::feature::command current;
+    ::my::feature::command idle;
+    command_queue()
+    :    after(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::walk>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::walk >
+{
+  enum
+  {
+    x = 0,
+    y = 1,
+    path = 2,
+    member_count = 3
+  };
+};
+
+template<>
+struct is_adata<my::feature::cast>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::cast >
+{
+  enum
+  {
+    spell_id = 0,
+    target = 1,
+    member_count = 2
+  };
+};
+
+template<>
+struct is_adata<my::feature::say>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::say >
+{
+  enum
+  {
+    text = 0,
+    member_count = 1
+  };
+};
+
+template<>
+struct is_adata<my::feature::command>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::command >
+{
+  enum
+  {
+    walk = 0,
+    cast = 1,
+    say = 2,
+    member_count = 3
+  };
+};
+
+template<>
+struct is_adata<my::feature::command_queue>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::command_queue >
+{
+  enum
+  {
+    commands = 0,
+    current = 1,
+    idle = 2,
+    after = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::walk& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.x);}
+    if(tag&2LL)    {read(stream,value.y);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.path.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.path[i]);}
+      }
+    }
+    if(!(tag&1LL)){value.x = (int32_t)0;}
+    if(!(tag&2LL)){value.y = (int32_t)0;}
+    if(!(tag&4LL)){value.path.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::walk& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.x);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.y);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.path.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.path[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.x = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.y = (int32_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.path.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::walk* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::walk* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::walk& value)
+  {
+    if(!is_default(value.x,(int32_t)0)) return false;
+    if(!is_default(value.y,(int32_t)0)) return false;
+    if(!value.path.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::walk& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.y,(int32_t)0)){tag|=2LL;}
+    if(!value.path.empty()){tag|=4LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.x);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.y);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.path).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::walk& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+    if(!is_default(value.y,(int32_t)0)){tag|=2LL;}
+    if(!value.path.empty()){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.x);
+    if(tag&2LL)    write(stream,value.y);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.path).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::walk >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::walk& value = values[k];
+        if(!is_default(value.x,(int32_t)0)){tag|=1LL;}
+        if(!is_default(value.y,(int32_t)0)){tag|=2LL;}
+        if(!value.path.empty()){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].x;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].y;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::walk& value = values[k];
+          {
+            int32_t len = (int32_t)(value.path).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].x;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].y;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::walk& value = values[k];
+          {
+            int32_t len = (int32_t)(value.path).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].x = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].y = column[k];}
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::walk& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.path.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.path[i]);}
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::walk& value)
+  {
+    read(stream,value.x);
+    read(stream,value.y);
+    {
+      int32_t len = check_read_size(stream);
+      value.path.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.path[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::walk& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.x);
+    size += size_of(value.y);
+    {
+      int32_t len = (int32_t)(value.path).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::walk& value)
+  {
+    write(stream,value.x);
+    write(stream,value.y);
+    {
+      int32_t len = (int32_t)(value.path).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.path.begin() ; i != value.path.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::cast& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.spell_id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      value.target.resize(len);
+      stream.read((char *)value.target.data(),len);
+    }
+    if(!(tag&1LL)){value.spell_id = (int32_t)0;}
+    if(!(tag&2LL)){value.target.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::cast& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.spell_id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.target.resize(len);
+          stream.read((char *)value.target.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.spell_id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.target.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::cast* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::cast* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::cast& value)
+  {
+    if(!is_default(value.spell_id,(int32_t)0)) return false;
+    if(!value.target.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::cast& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.spell_id,(int32_t)0)){tag|=1LL;}
+    if(!value.target.empty()){tag|=2LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.spell_id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.target).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::cast& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.spell_id,(int32_t)0)){tag|=1LL;}
+    if(!value.target.empty()){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.spell_id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.target).size();
+      write(stream,len);
+      stream.write((value.target).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::cast >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::cast& value = values[k];
+        if(!is_default(value.spell_id,(int32_t)0)){tag|=1LL;}
+        if(!value.target.empty()){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].spell_id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cast& value = values[k];
+          {
+            int32_t len = (int32_t)(value.target).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].spell_id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::cast& value = values[k];
+          {
+            int32_t len = (int32_t)(value.target).size();
+            write(stream,len);
+            stream.write((value.target).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].spell_id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::cast& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.target.resize(len);
+            stream.read((char *)value.target.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::cast& value)
+  {
+    read(stream,value.spell_id);
+    {
+      int32_t len = check_read_size(stream);
+      value.target.resize(len);
+      stream.read((char *)value.target.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::cast& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.spell_id);
+    {
+      int32_t len = (int32_t)(value.target).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::cast& value)
+  {
+    write(stream,value.spell_id);
+    {
+      int32_t len = (int32_t)(value.target).size();
+      write(stream,len);
+      stream.write((value.target).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::say& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.text.resize(len);
+      stream.read((char *)value.text.data(),len);
+    }
+    if(!(tag&1LL)){value.text.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::say& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.text.resize(len);
+          stream.read((char *)value.text.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.text.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::say* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::say* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 1) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::say& value)
+  {
+    if(!value.text.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::say& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.text.empty()){tag|=1LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.text).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::say& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.text.empty()){tag|=1LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.text).size();
+      write(stream,len);
+      stream.write((value.text).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::say >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::say& value = values[k];
+        if(!value.text.empty()){tag|=1LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::say& value = values[k];
+          {
+            int32_t len = (int32_t)(value.text).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::say& value = values[k];
+          {
+            int32_t len = (int32_t)(value.text).size();
+            write(stream,len);
+            stream.write((value.text).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::say& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.text.resize(len);
+            stream.read((char *)value.text.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::say& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.text.resize(len);
+      stream.read((char *)value.text.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::say& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.text).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::say& value)
+  {
+    {
+      int32_t len = (int32_t)(value.text).size();
+      write(stream,len);
+      stream.write((value.text).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::command& value)
+  {
+    uint32_t kind = 0;
+    read(stream,kind);
+    switch(kind)
+    {
+    case 0: value.reset(); break;
+    case 1: read(stream,value.set_walk()); break;
+    case 2: read(stream,value.set_cast()); break;
+    case 3: read(stream,value.set_say()); break;
+    default: value.reset(); skip_read_compatible(stream);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::command* )
+  {
+    uint32_t kind = 0;
+    read(stream,kind);
+    if(kind != 0) skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& , ::my::feature::command* , int32_t , bool& )
+  {
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::command& value)
+  {
+    return value.empty();
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::command& value)
+  {
+    switch(value.kind())
+    {
+    case ::my::feature::command::walk_kind: return size_of((uint32_t)value.kind()) + size_of(*value.get_walk());
+    case ::my::feature::command::cast_kind: return size_of((uint32_t)value.kind()) + size_of(*value.get_cast());
+    case ::my::feature::command::say_kind: return size_of((uint32_t)value.kind()) + size_of(*value.get_say());
+    default: return size_of((uint32_t)0);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::command& value)
+  {
+    write(stream,(uint32_t)value.kind());
+    switch(value.kind())
+    {
+    case ::my::feature::command::walk_kind: write(stream,*value.get_walk()); break;
+    case ::my::feature::command::cast_kind: write(stream,*value.get_cast()); break;
+    case ::my::feature::command::say_kind: write(stream,*value.get_say()); break;
+    default: break;
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::command& value)
+  {
+    uint32_t kind = 0;
+    read(stream,kind);
+    switch(kind)
+    {
+    case 0: value.reset(); break;
+    case 1: raw_read(stream,value.set_walk()); break;
+    case 2: raw_read(stream,value.set_cast()); break;
+    case 3: raw_read(stream,value.set_say()); break;
+    default: throw exception(undefined_member_protocol_not_compatible);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::command& value)
+  {
+    switch(value.kind())
+    {
+    case ::my::feature::command::walk_kind: return size_of((uint32_t)value.kind()) + raw_size_of(*value.get_walk());
+    case ::my::feature::command::cast_kind: return size_of((uint32_t)value.kind()) + raw_size_of(*value.get_cast());
+    case ::my::feature::command::say_kind: return size_of((uint32_t)value.kind()) + raw_size_of(*value.get_say());
+    default: return size_of((uint32_t)0);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::command& value)
+  {
+    write(stream,(uint32_t)value.kind());
+    switch(value.kind())
+    {
+    case ::my::feature::command::walk_kind: raw_write(stream,*value.get_walk()); break;
+    case ::my::feature::command::cast_kind: raw_write(stream,*value.get_cast()); break;
+    case ::my::feature::command::say_kind: raw_write(stream,*value.get_say()); break;
+    default: break;
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::command_queue& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.commands.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.commands[i]);}
+      }
+    }
+    if(tag&2LL)    {read(stream,value.current);}
+    if(tag&4LL)    {read(stream,value.idle);}
+    if(tag&8LL)    {read(stream,value.after);}
+    if(!(tag&1LL)){value.commands.clear();}
+    if(!(tag&2LL)){value.current = ::my::feature::command();}
+    if(!(tag&4LL)){value.idle = ::my::feature::command();}
+    if(!(tag&8LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::command_queue& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.commands.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.commands[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.current);}
+        else        {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.idle);}
+        else        {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.after);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.commands.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.current = ::my::feature::command();}
+    if(!(tag&4LL) && (mask&4LL)){value.idle = ::my::feature::command();}
+    if(!(tag&8LL) && (mask&8LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::command_queue* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::command_queue* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 1) return true;
+    if(tag&2LL)    {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    if(tag&4LL)    {::my::feature::command* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::command_queue& value)
+  {
+    if(!value.commands.empty()) return false;
+    if(!is_default(value.current)) return false;
+    if(!is_default(value.idle)) return false;
+    if(!is_default(value.after,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::command_queue& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.commands.empty()){tag|=1LL;}
+    if(!is_default(value.current)){tag|=2LL;}
+    if(!is_default(value.idle)){tag|=4LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.commands).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.current);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.idle);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.after);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::command_queue& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.commands.empty()){tag|=1LL;}
+    if(!is_default(value.current)){tag|=2LL;}
+    if(!is_default(value.idle)){tag|=4LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.commands).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&2LL)    write(stream,value.current);
+    if(tag&4LL)    write(stream,value.idle);
+    if(tag&8LL)    write(stream,value.after);
+  }
+
+  template<>
+  struct columns< ::my::feature::command_queue >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::command_queue& value = values[k];
+        if(!value.commands.empty()){tag|=1LL;}
+        if(!is_default(value.current)){tag|=2LL;}
+        if(!is_default(value.idle)){tag|=4LL;}
+        if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          {
+            int32_t len = (int32_t)(value.commands).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          size += size_of(value.current);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          size += size_of(value.idle);
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          {
+            int32_t len = (int32_t)(value.commands).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          write(stream,value.current);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::command_queue& value = values[k];
+          write(stream,value.idle);
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::command_queue& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.commands.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.commands[i]);}
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::command_queue& value = values[k];
+          {read(stream,value.current);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::command_queue& value = values[k];
+          {read(stream,value.idle);}
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].after = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::command_queue& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.commands.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.commands[i]);
+      }
+    }
+    raw_read(stream,value.current);
+    raw_read(stream,value.idle);
+    read(stream,value.after);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::command_queue& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.commands).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    size += raw_size_of(value.current);
+    size += raw_size_of(value.idle);
+    size += size_of(value.after);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::command_queue& value)
+  {
+    {
+      int32_t len = (int32_t)(value.commands).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::command >::const_iterator i = value.commands.begin() ; i != value.commands.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    raw_write(stream,value.current);
+    raw_write(stream,value.idle);
+    write(stream,value.after);
+  }
+
+}
+
+#endif
@@ -0,0 +1,766 @@
+#ifndef my_feature_dict_adl_h_adata_header_define
+#define my_feature_dict_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct loot
+  {
+    int32_t count;
+    ::std::string item;
+    ::std::string owner;
+    ::std::string note;
+    loot()
+    :    count(0)
+    {}
+  };
+
+  struct loot_log
+  {
+    ::std::vector< ::my::feature::loot > drops;
+    ::std::string zone;
+    loot_log()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::loot>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::loot >
+{
+  enum
+  {
+    item = 0,
+    owner = 1,
+    count = 2,
+    note = 3,
+    member_count = 4
+  };
+};
+
+template<>
+struct is_adata<my::feature::loot_log>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::loot_log >
+{
+  enum
+  {
+    drops = 0,
+    zone = 1,
+    member_count = 2
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::loot& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_dict_string(stream,value.item);}
+    if(tag&2LL)    {read_dict_string(stream,value.owner);}
+    if(tag&4LL)    {read(stream,value.count);}
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+    if(!(tag&1LL)){value.item.clear();}
+    if(!(tag&2LL)){value.owner.clear();}
+    if(!(tag&4LL)){value.count = (int32_t)0;}
+    if(!(tag&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::loot& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_dict_string(stream,value.item);}
+        else        {skip_read_dict_string(stream);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_dict_string(stream,value.owner);}
+        else        {skip_read_dict_string(stream);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.count);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.note.resize(len);
+          stream.read((char *)value.note.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.item.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.owner.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.count = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.note.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::loot* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::loot* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {skip_read_dict_string(stream);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_dict_string(stream);}
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::loot& value)
+  {
+    if(!value.item.empty()) return false;
+    if(!value.owner.empty()) return false;
+    if(!is_default(value.count,(int32_t)0)) return false;
+    if(!value.note.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::loot& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.item.empty()){tag|=1LL;}
+    if(!value.owner.empty()){tag|=2LL;}
+    if(!is_default(value.count,(int32_t)0)){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of_dict_string(value.item);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_dict_string(value.owner);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.count);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.note).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::loot& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.item.empty()){tag|=1LL;}
+    if(!value.owner.empty()){tag|=2LL;}
+    if(!is_default(value.count,(int32_t)0)){tag|=4LL;}
+    if(!value.note.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_dict_string(stream,value.item);
+    if(tag&2LL)    write_dict_string(stream,value.owner);
+    if(tag&4LL)    write(stream,value.count);
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::loot >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::loot& value = values[k];
+        if(!value.item.empty()){tag|=1LL;}
+        if(!value.owner.empty()){tag|=2LL;}
+        if(!is_default(value.count,(int32_t)0)){tag|=4LL;}
+        if(!value.note.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          size += size_of_dict_string(value.item);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          size += size_of_dict_string(value.owner);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].count;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          write_dict_string(stream,value.item);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          write_dict_string(stream,value.owner);
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].count;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot& value = values[k];
+          {
+            int32_t len = (int32_t)(value.note).size();
+            write(stream,len);
+            stream.write((value.note).data(),len);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loot& value = values[k];
+          {read_dict_string(stream,value.item);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loot& value = values[k];
+          {read_dict_string(stream,value.owner);}
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].count = column[k];}
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loot& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.note.resize(len);
+            stream.read((char *)value.note.data(),len);
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::loot& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.item.resize(len);
+      stream.read((char *)value.item.data(),len);
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.owner.resize(len);
+      stream.read((char *)value.owner.data(),len);
+    }
+    read(stream,value.count);
+    {
+      int32_t len = check_read_size(stream);
+      value.note.resize(len);
+      stream.read((char *)value.note.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::loot& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.item).size();
+      size += size_of(len);
+      size += len;
+    }
+    {
+      int32_t len = (int32_t)(value.owner).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.count);
+    {
+      int32_t len = (int32_t)(value.note).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::loot& value)
+  {
+    {
+      int32_t len = (int32_t)(value.item).size();
+      write(stream,len);
+      stream.write((value.item).data(),len);
+    }
+    {
+      int32_t len = (int32_t)(value.owner).size();
+      write(stream,len);
+      stream.write((value.owner).data(),len);
+    }
+    write(stream,value.count);
+    {
+      int32_t len = (int32_t)(value.note).size();
+      write(stream,len);
+      stream.write((value.note).data(),len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::loot_log& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      value.drops.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.drops[i]);}
+      }
+    }
+    if(tag&2LL)    {read_dict_string(stream,value.zone);}
+    if(!(tag&1LL)){value.drops.clear();}
+    if(!(tag&2LL)){value.zone.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::loot_log& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {
+          int32_t len = check_read_size(stream);
+          value.drops.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.drops[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::feature::loot* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_dict_string(stream,value.zone);}
+        else        {skip_read_dict_string(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.drops.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.zone.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::loot_log* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::loot_log* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 2) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::feature::loot* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 1) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::loot_log& value)
+  {
+    if(!value.drops.empty()) return false;
+    if(!value.zone.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::loot_log& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.drops.empty()){tag|=1LL;}
+    if(!value.zone.empty()){tag|=2LL;}
+    if(tag&1LL)
+    {
+      {
+        int32_t len = (int32_t)(value.drops).size();
+        size += size_of(len);
+        for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&2LL)
+    {
+      size += size_of_dict_string(value.zone);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::loot_log& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.drops.empty()){tag|=1LL;}
+    if(!value.zone.empty()){tag|=2LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    {
+      int32_t len = (int32_t)(value.drops).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&2LL)    write_dict_string(stream,value.zone);
+  }
+
+  template<>
+  struct columns< ::my::feature::loot_log >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::loot_log& value = values[k];
+        if(!value.drops.empty()){tag|=1LL;}
+        if(!value.zone.empty()){tag|=2LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot_log& value = values[k];
+          {
+            int32_t len = (int32_t)(value.drops).size();
+            size += size_of(len);
+            for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot_log& value = values[k];
+          size += size_of_dict_string(value.zone);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot_log& value = values[k];
+          {
+            int32_t len = (int32_t)(value.drops).size();
+            write(stream,len);
+            for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::loot_log& value = values[k];
+          write_dict_string(stream,value.zone);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loot_log& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.drops.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.drops[i]);}
+            }
+          }
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::loot_log& value = values[k];
+          {read_dict_string(stream,value.zone);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::loot_log& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.drops.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.drops[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.zone.resize(len);
+      stream.read((char *)value.zone.data(),len);
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::loot_log& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.drops).size();
+      size += size_of(len);
+      for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.zone).size();
+      size += size_of(len);
+      size += len;
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::loot_log& value)
+  {
+    {
+      int32_t len = (int32_t)(value.drops).size();
+      write(stream,len);
+      for (::std::vector< ::my::feature::loot >::const_iterator i = value.drops.begin() ; i != value.drops.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.zone).size();
+      write(stream,len);
+      stream.write((value.zone).data(),len);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,477 @@
+#ifndef my_feature_encoded_adl_h_adata_header_define
+#define my_feature_encoded_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct series
+  {
+    ::std::vector< int64_t > times;
+    ::std::vector< int32_t > ticks;
+    ::std::vector< uint16_t > levels;
+    ::std::vector< int8_t > small;
+    series()
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::series>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::series >
+{
+  enum
+  {
+    times = 0,
+    ticks = 1,
+    levels = 2,
+    small = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::series& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_list(stream,value.times,list_delta);}
+    if(tag&2LL)    {read_list(stream,value.ticks,list_delta2);}
+    if(tag&4LL)    {read_list(stream,value.levels,list_rle);}
+    if(tag&8LL)    {
+      {int32_t payload_len = 0;read(stream,payload_len);}
+      {read_list(stream,value.small,list_delta);}
+    }
+    if(!(tag&1LL)){value.times.clear();}
+    if(!(tag&2LL)){value.ticks.clear();}
+    if(!(tag&4LL)){value.levels.clear();}
+    if(!(tag&8LL)){value.small.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::series& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_list(stream,value.times,list_delta);}
+        else        {skip_read_list<int64_t>(stream,list_delta);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_list(stream,value.ticks,list_delta2);}
+        else        {skip_read_list<int32_t>(stream,list_delta2);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read_list(stream,value.levels,list_rle);}
+        else        {skip_read_list<uint16_t>(stream,list_rle);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          {int32_t payload_len = 0;read(stream,payload_len);}
+          {read_list(stream,value.small,list_delta);}
+        }
+        else        {skip_read_sized(stream);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.times.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.ticks.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.levels.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.small.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::series* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::series* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {skip_read_list<int64_t>(stream,list_delta);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_list<int32_t>(stream,list_delta2);}
+    if(index == 2) return false;
+    if(tag&4LL)    {skip_read_list<uint16_t>(stream,list_rle);}
+    if(index == 3) return false;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::series& value)
+  {
+    if(!value.times.empty()) return false;
+    if(!value.ticks.empty()) return false;
+    if(!value.levels.empty()) return false;
+    if(!value.small.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::series& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.times.empty()){tag|=1LL;}
+    if(!value.ticks.empty()){tag|=2LL;}
+    if(!value.levels.empty()){tag|=4LL;}
+    if(!value.small.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of_list(value.times,list_delta);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_list(value.ticks,list_delta2);
+    }
+    if(tag&4LL)
+    {
+      size += size_of_list(value.levels,list_rle);
+    }
+    if(tag&8LL)
+    {
+      int32_t payload_len = size;
+      size += size_of_list(value.small,list_delta);
+      payload_len = size - payload_len;
+      size += size_of(payload_len);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::series& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.times.empty()){tag|=1LL;}
+    if(!value.ticks.empty()){tag|=2LL;}
+    if(!value.levels.empty()){tag|=4LL;}
+    if(!value.small.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_list(stream,value.times,list_delta);
+    if(tag&2LL)    write_list(stream,value.ticks,list_delta2);
+    if(tag&4LL)    write_list(stream,value.levels,list_rle);
+    if(tag&8LL)
+    {
+      {
+        int32_t size = 0;
+        size += size_of_list(value.small,list_delta);
+        write(stream,size);
+      }
+      write_list(stream,value.small,list_delta);
+    }
+  }
+
+  template<>
+  struct columns< ::my::feature::series >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::series& value = values[k];
+        if(!value.times.empty()){tag|=1LL;}
+        if(!value.ticks.empty()){tag|=2LL;}
+        if(!value.levels.empty()){tag|=4LL;}
+        if(!value.small.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          size += size_of_list(value.times,list_delta);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          size += size_of_list(value.ticks,list_delta2);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          size += size_of_list(value.levels,list_rle);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          int32_t payload_len = size;
+          size += size_of_list(value.small,list_delta);
+          payload_len = size - payload_len;
+          size += size_of(payload_len);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          write_list(stream,value.times,list_delta);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          write_list(stream,value.ticks,list_delta2);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+          write_list(stream,value.levels,list_rle);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::series& value = values[k];
+
+          {
+            {
+              int32_t size = 0;
+              size += size_of_list(value.small,list_delta);
+              write(stream,size);
+            }
+            write_list(stream,value.small,list_delta);
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::series& value = values[k];
+          {read_list(stream,value.times,list_delta);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::series& value = values[k];
+          {read_list(stream,value.ticks,list_delta2);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::series& value = values[k];
+          {read_list(stream,value.levels,list_rle);}
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::series& value = values[k];
+          {
+            {int32_t payload_len = 0;read(stream,payload_len);}
+            {read_list(stream,value.small,list_delta);}
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::series& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.times.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.times[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.ticks.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.ticks[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.levels.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.levels[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.small.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.small[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::series& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.times).size();
+      size += size_of(len);
+      for (::std::vector< int64_t >::const_iterator i = value.times.begin() ; i != value.times.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.ticks).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.ticks.begin() ; i != value.ticks.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.levels).size();
+      size += size_of(len);
+      for (::std::vector< uint16_t >::const_iterator i = value.levels.begin() ; i != value.levels.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.small).size();
+      size += size_of(len);
+      for (::std::vector< int8_t >::const_iterator i = value.small.begin() ; i != value.small.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::series& value)
+  {
+    {
+      int32_t len = (int32_t)(value.times).size();
+      write(stream,len);
+      for (::std::vector< int64_t >::const_iterator i = value.times.begin() ; i != value.times.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.ticks).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.ticks.begin() ; i != value.ticks.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.levels).size();
+      write(stream,len);
+      for (::std::vector< uint16_t >::const_iterator i = value.levels.begin() ; i != value.levels.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.small).size();
+      write(stream,len);
+      for (::std::vector< int8_t >::const_iterator i = value.small.begin() ; i != value.small.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,481 @@
+#ifndef my_feature_gauge_adl_h_adata_header_define
+#define my_feature_gauge_adl_h_adata_header_define
+
+#include <adata.hpp>
+
+namespace my {namespace feature {
+  struct gauge
+  {
+    int32_t after;
+    ::std::vector< double > samples;
+    ::std::vector< float > levels;
+    ::std::vector< double > plain;
+    gauge()
+    :    after(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::feature::gauge>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::feature::gauge >
+{
+  enum
+  {
+    samples = 0,
+    levels = 1,
+    plain = 2,
+    after = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::feature::gauge& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read_list(stream,value.samples,list_xor);}
+    if(tag&2LL)    {read_list(stream,value.levels,list_xor);}
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      value.plain.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.plain[i]);}
+      }
+    }
+    if(tag&8LL)    {read(stream,value.after);}
+    if(!(tag&1LL)){value.samples.clear();}
+    if(!(tag&2LL)){value.levels.clear();}
+    if(!(tag&4LL)){value.plain.clear();}
+    if(!(tag&8LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::feature::gauge& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read_list(stream,value.samples,list_xor);}
+        else        {skip_read_list<double>(stream,list_xor);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read_list(stream,value.levels,list_xor);}
+        else        {skip_read_list<float>(stream,list_xor);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {
+          int32_t len = check_read_size(stream);
+          value.plain.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.plain[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {double* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.after);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.samples.clear();}
+    if(!(tag&2LL) && (mask&2LL)){value.levels.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.plain.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.after = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::feature::gauge* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::feature::gauge* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return false;
+    if(tag&1LL)    {skip_read_list<double>(stream,list_xor);}
+    if(index == 1) return false;
+    if(tag&2LL)    {skip_read_list<float>(stream,list_xor);}
+    if(index == 2) return true;
+    if(tag&4LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {double* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::feature::gauge& value)
+  {
+    if(!value.samples.empty()) return false;
+    if(!value.levels.empty()) return false;
+    if(!value.plain.empty()) return false;
+    if(!is_default(value.after,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::feature::gauge& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!value.samples.empty()){tag|=1LL;}
+    if(!value.levels.empty()){tag|=2LL;}
+    if(!value.plain.empty()){tag|=4LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of_list(value.samples,list_xor);
+    }
+    if(tag&2LL)
+    {
+      size += size_of_list(value.levels,list_xor);
+    }
+    if(tag&4LL)
+    {
+      {
+        int32_t len = (int32_t)(value.plain).size();
+        size += size_of(len);
+        for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.after);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::feature::gauge& value)
+  {
+    int64_t tag = 0LL;
+    if(!value.samples.empty()){tag|=1LL;}
+    if(!value.levels.empty()){tag|=2LL;}
+    if(!value.plain.empty()){tag|=4LL;}
+    if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write_list(stream,value.samples,list_xor);
+    if(tag&2LL)    write_list(stream,value.levels,list_xor);
+    if(tag&4LL)    {
+      int32_t len = (int32_t)(value.plain).size();
+      write(stream,len);
+      for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&8LL)    write(stream,value.after);
+  }
+
+  template<>
+  struct columns< ::my::feature::gauge >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::feature::gauge& value = values[k];
+        if(!value.samples.empty()){tag|=1LL;}
+        if(!value.levels.empty()){tag|=2LL;}
+        if(!value.plain.empty()){tag|=4LL;}
+        if(!is_default(value.after,(int32_t)0)){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          size += size_of_list(value.samples,list_xor);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          size += size_of_list(value.levels,list_xor);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          {
+            int32_t len = (int32_t)(value.plain).size();
+            size += size_of(len);
+            for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          write_list(stream,value.samples,list_xor);
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          write_list(stream,value.levels,list_xor);
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::feature::gauge& value = values[k];
+          {
+            int32_t len = (int32_t)(value.plain).size();
+            write(stream,len);
+            for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].after;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::gauge& value = values[k];
+          {read_list(stream,value.samples,list_xor);}
+        }
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::gauge& value = values[k];
+          {read_list(stream,value.levels,list_xor);}
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::feature::gauge& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.plain.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.plain[i]);}
+            }
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].after = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::feature::gauge& value)
+  {
+    {
+      int32_t len = check_read_size(stream);
+      value.samples.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.samples[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.levels.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.levels[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.plain.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.plain[i]);
+      }
+    }
+    read(stream,value.after);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::feature::gauge& value)
+  {
+    int32_t size = 0;
+    {
+      int32_t len = (int32_t)(value.samples).size();
+      size += size_of(len);
+      for (::std::vector< double >::const_iterator i = value.samples.begin() ; i != value.samples.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.levels).size();
+      size += size_of(len);
+      for (::std::vector< float >::const_iterator i = value.levels.begin() ; i != value.levels.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.plain).size();
+      size += size_of(len);
+      for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    size += size_of(value.after);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::feature::gauge& value)
+  {
+    {
+      int32_t len = (int32_t)(value.samples).size();
+      write(stream,len);
+      for (::std::vector< double >::const_iterator i = value.samples.begin() ; i != value.samples.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.levels).size();
+      write(stream,len);
+      for (::std::vector< float >::const_iterator i = value.levels.begin() ; i != value.levels.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.plain).size();
+      write(stream,len);
+      for (::std::vector< double >::const_iterator i = value.plain.begin() ; i != value.plain.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    write(stream,value.after);
+  }
+
+}
+
+#endif
@@ -1,5 +1,5 @@
-#ifndef player_adl_cpp2lua_h_
-#define player_adl_cpp2lua_h_
+#ifndef my_game_player_adl_cpp2lua_h_
+#define my_game_player_adl_cpp2lua_h_
 
 #include <adata_cpp2lua.hpp>
 #include "my/game/quest.adl.c2l.h"
@@ -1,5 +1,5 @@
-#ifndef quest_adl_cpp2lua_h_
-#define quest_adl_cpp2lua_h_
+#ifndef my_game_quest_adl_cpp2lua_h_
+#define my_game_quest_adl_cpp2lua_h_
 
 #include <adata_cpp2lua.hpp>
 
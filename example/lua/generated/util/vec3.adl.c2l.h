@@ -1,5 +1,5 @@
-#ifndef vec3_adl_cpp2lua_h_
-#define vec3_adl_cpp2lua_h_
+#ifndef util_vec3_adl_cpp2lua_h_
+#define util_vec3_adl_cpp2lua_h_
 
 #include <adata_cpp2lua.hpp>
 
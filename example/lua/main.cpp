@@ -74,6 +74,8 @@ namespace my
   }
 }
 
+void lua_features(lua_State * L);
+
 int main(int argc, char* argv[])
 {
   lua_State *L = luaL_newstate();
@@ -130,6 +132,9 @@ int main(int argc, char* argv[])
     adata::lua::load(L, pv1_other);
 
     assert(pv1 == pv1_other);
+
+    lua_features(L);
+    std::cout << "features done." << std::endl;
   }
   catch (std::exception& ex)
   {
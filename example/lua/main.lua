@@ -161,7 +161,6 @@ local dump_player_v2 = function(pv2)
   end
 end
 
-local ec = 0
 local pv1 = adata.types['my.game.player_v1']()
 pv1.id = 1
 pv1.age = 22
@@ -186,11 +185,8 @@ table.insert(pv1.quests, qst)
 local buf_len = 4096
 local stream = adata.new(buf_len)
 
-ec = pv1:write(stream)
-if ec > 0 then 
-  -- some error, print it
-  error(stream:trace_info())
-end
+-- write and read raise a lua error when they fail
+pv1:write(stream)
 
 local data = stream:get_write_data()
 
@@ -199,11 +195,7 @@ stream:set_read_data(data)
 
 local pv1_other = adata.types['my.game.player_v1']()
 
-ec = pv1_other:read(stream)
-if ec > 0 then 
-  -- some error, print it
-  error(stream:trace_info())
-end
+pv1_other:read(stream)
 
 assert(player_equals(pv1, pv1_other))
 
@@ -212,11 +204,7 @@ stream:clear()
 local pv2 = adata.types['my.game.player_v2']()
 
 -- forward compat (old data, new struct)
-ec = pv2:read(stream)
-if ec > 0 then 
-  -- some error, print it
-  error(stream:trace_info())
-end
+pv2:read(stream)
 
 assert(player_equals_v2(pv1, pv2))
 
@@ -229,19 +217,11 @@ pv2.name = 'pv2';
 table.insert(pv2.friends, 2)
 table.insert(pv2.friends, 100)
 
-ec = pv2:write(stream)
-if ec > 0 then 
-  -- some error, print it
-  error(stream:trace_info())
-end
+pv2:write(stream)
 
 data = stream:get_write_data()
 stream:set_read_data( data)
-ec = pv1:read(stream)
-if ec > 0 then 
-  -- some error, print it
-  error(stream:trace_info())
-end
+pv1:read(stream)
 
 assert(player_equals_v2(pv1, pv2))
 
@@ -252,11 +232,7 @@ cpp2lua = function (pv1)
   local stream = adata.new(buf_len)
 
   -- serialize
-  ec = pv1:write(stream)
-  if ec > 0 then 
-    -- some error, print it
-    error(stream:trace_info())
-  end
+  pv1:write(stream)
 
   local data = stream:get_write_data()
 
@@ -265,12 +241,57 @@ cpp2lua = function (pv1)
 
   local pv1_other = adata.types['my.game.player_v1']()
 
-  ec = pv1_other:read(stream)
-  if ec > 0 then 
-    -- some error, print it
-    error(stream:trace_info())
-  end
+  pv1_other:read(stream)
 
   assert(pv1 == pv1_other)
   return pv1_other
 end
+
+-- the checks of a type lua reads in feature_round_trip, written by example/lua/features.cpp
+local feature_checks = {
+  ['my.feature.series'] = function(o)
+    assert(#o.times == 20 and o.times[20] == 1420070400000 + 19 * 1000)
+    assert(o.ticks[5] == 16 and o.ticks[21] == -2147483648)
+    assert(o.levels[1] == 7 and o.levels[20] == 19 and o.small[2] == -128)
+  end,
+  ['my.feature.gauge'] = function(o)
+    assert(#o.samples == 32 and o.samples[1] == 100 and o.samples[16] == -101.5)
+    assert(o.samples[21] ~= o.samples[21] and o.levels[4] == 1.5 and o.after == 2)
+  end,
+  ['my.feature.loot_log'] = function(o)
+    assert(#o.drops == 6 and o.drops[2].item == 'shield' and o.drops[2].owner == 'odd')
+    assert(o.drops[6].count == 5 and o.zone == 'deadmines')
+  end,
+  ['my.feature.command_queue'] = function(o)
+    assert(o.commands[1].walk.x == -3 and o.commands[1].walk.path[1] == 7 and o.commands[1].cast == nil)
+    assert(o.commands[2].cast.target == 'boss' and o.commands[3].say.text == 'hello')
+    assert(o.commands[4].walk == nil and o.commands[4].cast == nil and o.commands[4].say == nil)
+    assert(o.current.cast.spell_id == 133 and o.idle.walk == nil)
+  end,
+  ['my.feature.update'] = function(o)
+    assert(o.id == 12 and o.hp == 0 and o.pos.x == 0 and o.team == 0)
+    assert(o.title == nil and o.speed == nil)
+    -- read into a used table, the members not in the data are reset
+    local stream = adata.new(256)
+    o:write(stream)
+    stream:set_read_data(stream:get_write_data())
+    local used = adata.types['my.feature.update']()
+    used.title = 'warchief'
+    used.speed = 3
+    used.id = 5
+    used:read(stream)
+    assert(used.id == 12 and used.hp == 0 and used.title == nil and used.speed == nil)
+  end,
+}
+
+-- reads data written by the generated c++ code and returns it written by lua
+feature_round_trip = function (type_name, data)
+  local stream = adata.new(#data + 64)
+  stream:set_read_data(data)
+  local o = adata.types[type_name]()
+  o:read(stream)
+  feature_checks[type_name](o)
+
+  o:write(stream)
+  return stream:get_write_data()
+end
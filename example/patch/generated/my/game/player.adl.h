@@ -0,0 +1,1754 @@
+#ifndef my_game_player_adl_h_adata_header_define
+#define my_game_player_adl_h_adata_header_define
+
+#include <adata.hpp>
+#include "my/game/quest.adl.h"
+#include "util/vec3.adl.h"
+
+namespace my {namespace game {
+  struct item
+  {
+    int32_t type;
+    int32_t level;
+    int64_t id;
+    item()
+    :    type(0),
+    level(0),
+    id(0LL)
+    {}
+  };
+
+  struct player_v1
+  {
+    int32_t id;
+    int32_t age;
+    float factor;
+    ::std::string name;
+    ::util::vec3 pos;
+    ::std::vector< ::my::game::item > inventory;
+    ::std::vector< ::my::game::quest > quests;
+    player_v1()
+    :    id(0),
+    age(0),
+    factor(1.0f)
+    {}
+  };
+
+  struct player_v2
+  {
+    int32_t id;
+    //age deleted , skip define.
+    //factor deleted , skip define.
+    ::std::string name;
+    ::util::vec3 pos;
+    ::std::vector< ::my::game::item > inventory;
+    ::std::vector< ::my::game::quest > quests;
+    ::std::vector< int32_t > friends;
+    player_v2()
+    :    id(0)
+    {}
+  };
+
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::game::item>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::item >
+{
+  enum
+  {
+    id = 0,
+    type = 1,
+    level = 2,
+    member_count = 3
+  };
+};
+
+template<>
+struct is_adata<my::game::player_v1>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::player_v1 >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    age = 2,
+    pos = 3,
+    inventory = 4,
+    quests = 5,
+    factor = 6,
+    member_count = 7
+  };
+};
+
+template<>
+struct is_adata<my::game::player_v2>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::player_v2 >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    //age deleted
+    pos = 3,
+    inventory = 4,
+    quests = 5,
+    //factor deleted
+    friends = 7,
+    member_count = 8
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::game::item& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {read(stream,value.type);}
+    if(tag&4LL)    {read(stream,value.level);}
+    if(!(tag&1LL)){value.id = (int64_t)0LL;}
+    if(!(tag&2LL)){value.type = (int32_t)0;}
+    if(!(tag&4LL)){value.level = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::item& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {read(stream,value.type);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.level);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int64_t)0LL;}
+    if(!(tag&2LL) && (mask&2LL)){value.type = (int32_t)0;}
+    if(!(tag&4LL) && (mask&4LL)){value.level = (int32_t)0;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::item* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::item* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 3) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 2) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::item& value)
+  {
+    if(!is_default(value.id,(int64_t)0LL)) return false;
+    if(!is_default(value.type,(int32_t)0)) return false;
+    if(!is_default(value.level,(int32_t)0)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::game::item& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+    if(!is_default(value.type,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.level,(int32_t)0)){tag|=4LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      size += size_of(value.type);
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.level);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::item& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+    if(!is_default(value.type,(int32_t)0)){tag|=2LL;}
+    if(!is_default(value.level,(int32_t)0)){tag|=4LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    write(stream,value.type);
+    if(tag&4LL)    write(stream,value.level);
+  }
+
+  template<>
+  struct columns< ::my::game::item >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::item& value = values[k];
+        if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+        if(!is_default(value.type,(int32_t)0)){tag|=2LL;}
+        if(!is_default(value.level,(int32_t)0)){tag|=4LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].type;}
+        size += size_of_column(column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].type;}
+        write_column(stream,column);
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].type = column[k];}
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].level = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::item& value)
+  {
+    read(stream,value.id);
+    read(stream,value.type);
+    read(stream,value.level);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::item& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    size += size_of(value.type);
+    size += size_of(value.level);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::item& value)
+  {
+    write(stream,value.id);
+    write(stream,value.type);
+    write(stream,value.level);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::game::player_v1& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream,30);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {read(stream,value.age);}
+    if(tag&8LL)    {read(stream,value.pos);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.inventory.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.inventory[i]);}
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      value.quests.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.quests[i]);}
+      }
+    }
+    if(tag&64LL)    {read(stream,value.factor);}
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.age = (int32_t)0;}
+    if(!(tag&8LL)){value.pos = ::util::vec3();}
+    if(!(tag&16LL)){value.inventory.clear();}
+    if(!(tag&32LL)){value.quests.clear();}
+    if(!(tag&64LL)){value.factor = (float)1.0f;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::player_v1& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream,30);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream,30);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.age);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.pos);}
+        else        {::util::vec3* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.inventory.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.inventory[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::game::item* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {
+          int32_t len = check_read_size(stream);
+          value.quests.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.quests[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::game::quest* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 64ULL) break;
+      if(tag&64LL)
+      {
+        if(mask&64LL)        {read(stream,value.factor);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.age = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.pos = ::util::vec3();}
+    if(!(tag&16LL) && (mask&16LL)){value.inventory.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.quests.clear();}
+    if(!(tag&64LL) && (mask&64LL)){value.factor = (float)1.0f;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::player_v1* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::player_v1* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 7) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream,30);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {::util::vec3* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::game::item* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 5) return true;
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::game::quest* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 6) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::player_v1& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.age,(int32_t)0)) return false;
+    if(!is_default(value.pos)) return false;
+    if(!value.inventory.empty()) return false;
+    if(!value.quests.empty()) return false;
+    if(!is_default(value.factor,(float)1.0f)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::game::player_v1& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.age,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.pos)){tag|=8LL;}
+    if(!value.inventory.empty()){tag|=16LL;}
+    if(!value.quests.empty()){tag|=32LL;}
+    if(!is_default(value.factor,(float)1.0f)){tag|=64LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.age);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.pos);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.inventory).size();
+        size += size_of(len);
+        for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&32LL)
+    {
+      {
+        int32_t len = (int32_t)(value.quests).size();
+        size += size_of(len);
+        for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&64LL)
+    {
+      size += size_of(value.factor);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::player_v1& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.age,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.pos)){tag|=8LL;}
+    if(!value.inventory.empty()){tag|=16LL;}
+    if(!value.quests.empty()){tag|=32LL;}
+    if(!is_default(value.factor,(float)1.0f)){tag|=64LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    write(stream,value.age);
+    if(tag&8LL)    write(stream,value.pos);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.inventory).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = (int32_t)(value.quests).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&64LL)    write(stream,value.factor);
+  }
+
+  template<>
+  struct columns< ::my::game::player_v1 >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::player_v1& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!is_default(value.age,(int32_t)0)){tag|=4LL;}
+        if(!is_default(value.pos)){tag|=8LL;}
+        if(!value.inventory.empty()){tag|=16LL;}
+        if(!value.quests.empty()){tag|=32LL;}
+        if(!is_default(value.factor,(float)1.0f)){tag|=64LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].age;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          size += size_of(value.pos);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.inventory).size();
+            size += size_of(len);
+            for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.quests).size();
+            size += size_of(len);
+            for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&64LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          size += size_of(value.factor);
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].age;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          write(stream,value.pos);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.inventory).size();
+            write(stream,len);
+            for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = (int32_t)(value.quests).size();
+            write(stream,len);
+            for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&64LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v1& value = values[k];
+          write(stream,value.factor);
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = check_read_size(stream,30);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].age = column[k];}
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v1& value = values[k];
+          {read(stream,value.pos);}
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.inventory.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.inventory[i]);}
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v1& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.quests.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.quests[i]);}
+            }
+          }
+        }
+      }
+      if(tag&64LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v1& value = values[k];
+          {read(stream,value.factor);}
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::player_v1& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream,30);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    read(stream,value.age);
+    raw_read(stream,value.pos);
+    {
+      int32_t len = check_read_size(stream);
+      value.inventory.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.inventory[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.quests.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.quests[i]);
+      }
+    }
+    read(stream,value.factor);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::player_v1& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.age);
+    size += raw_size_of(value.pos);
+    {
+      int32_t len = (int32_t)(value.inventory).size();
+      size += size_of(len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.quests).size();
+      size += size_of(len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    size += size_of(value.factor);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::player_v1& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    write(stream,value.age);
+    raw_write(stream,value.pos);
+    {
+      int32_t len = (int32_t)(value.inventory).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.quests).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    write(stream,value.factor);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::game::player_v2& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream,30);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(tag&8LL)    {read(stream,value.pos);}
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      value.inventory.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.inventory[i]);}
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      value.quests.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.quests[i]);}
+      }
+    }
+    if(tag&64LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(tag&128LL)    {
+      int32_t len = check_read_size(stream);
+      value.friends.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.friends[i]);}
+      }
+    }
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&8LL)){value.pos = ::util::vec3();}
+    if(!(tag&16LL)){value.inventory.clear();}
+    if(!(tag&32LL)){value.quests.clear();}
+    if(!(tag&128LL)){value.friends.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::player_v2& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream,30);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream,30);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.pos);}
+        else        {::util::vec3* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {
+          int32_t len = check_read_size(stream);
+          value.inventory.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.inventory[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::game::item* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 32ULL) break;
+      if(tag&32LL)
+      {
+        if(mask&32LL)        {
+          int32_t len = check_read_size(stream);
+          value.quests.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.quests[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {::my::game::quest* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+      if(len_tag >= 0 && wanted < 64ULL) break;
+      if(tag&64LL)
+      {
+        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 128ULL) break;
+      if(tag&128LL)
+      {
+        if(mask&128LL)        {
+          int32_t len = check_read_size(stream);
+          value.friends.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.friends[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&8LL) && (mask&8LL)){value.pos = ::util::vec3();}
+    if(!(tag&16LL) && (mask&16LL)){value.inventory.clear();}
+    if(!(tag&32LL) && (mask&32LL)){value.quests.clear();}
+    if(!(tag&128LL) && (mask&128LL)){value.friends.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::player_v2* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::player_v2* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 8) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream,30);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {::util::vec3* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    if(tag&16LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::game::item* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 5) return true;
+    if(tag&32LL)    {
+      int32_t len = check_read_size(stream);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {::my::game::quest* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    }
+    if(index == 6) return true;
+    if(tag&64LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 7) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::player_v2& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.pos)) return false;
+    if(!value.inventory.empty()) return false;
+    if(!value.quests.empty()) return false;
+    if(!value.friends.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::game::player_v2& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.pos)){tag|=8LL;}
+    if(!value.inventory.empty()){tag|=16LL;}
+    if(!value.quests.empty()){tag|=32LL;}
+    if(!value.friends.empty()){tag|=128LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    //value.age deleted , skip write.
+    if(tag&8LL)
+    {
+      size += size_of(value.pos);
+    }
+    if(tag&16LL)
+    {
+      {
+        int32_t len = (int32_t)(value.inventory).size();
+        size += size_of(len);
+        for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    if(tag&32LL)
+    {
+      {
+        int32_t len = (int32_t)(value.quests).size();
+        size += size_of(len);
+        for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    //value.factor deleted , skip write.
+    if(tag&128LL)
+    {
+      {
+        int32_t len = (int32_t)(value.friends).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::player_v2& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.pos)){tag|=8LL;}
+    if(!value.inventory.empty()){tag|=16LL;}
+    if(!value.quests.empty()){tag|=32LL;}
+    if(!value.friends.empty()){tag|=128LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    //value.age deleted , skip write.
+    if(tag&8LL)    write(stream,value.pos);
+    if(tag&16LL)    {
+      int32_t len = (int32_t)(value.inventory).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    if(tag&32LL)    {
+      int32_t len = (int32_t)(value.quests).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+    //value.factor deleted , skip write.
+    if(tag&128LL)    {
+      int32_t len = (int32_t)(value.friends).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<>
+  struct columns< ::my::game::player_v2 >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::player_v2& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!is_default(value.pos)){tag|=8LL;}
+        if(!value.inventory.empty()){tag|=16LL;}
+        if(!value.quests.empty()){tag|=32LL;}
+        if(!value.friends.empty()){tag|=128LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          size += size_of(value.pos);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.inventory).size();
+            size += size_of(len);
+            for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.quests).size();
+            size += size_of(len);
+            for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.friends).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          write(stream,value.pos);
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.inventory).size();
+            write(stream,len);
+            for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.quests).size();
+            write(stream,len);
+            for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = (int32_t)(value.friends).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = check_read_size(stream,30);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        skip_read_column< int32_t >(stream,count);
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v2& value = values[k];
+          {read(stream,value.pos);}
+        }
+      }
+      if(tag&16LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.inventory.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.inventory[i]);}
+            }
+          }
+        }
+      }
+      if(tag&32LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.quests.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.quests[i]);}
+            }
+          }
+        }
+      }
+      if(tag&64LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          {float* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+      if(tag&128LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::player_v2& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.friends.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.friends[i]);}
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::player_v2& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream,30);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    raw_read(stream,value.pos);
+    {
+      int32_t len = check_read_size(stream);
+      value.inventory.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.inventory[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.quests.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        raw_read(stream,value.quests[i]);
+      }
+    }
+    {
+      int32_t len = check_read_size(stream);
+      value.friends.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.friends[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::player_v2& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += raw_size_of(value.pos);
+    {
+      int32_t len = (int32_t)(value.inventory).size();
+      size += size_of(len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.quests).size();
+      size += size_of(len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        size += raw_size_of(*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.friends).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::player_v2& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    raw_write(stream,value.pos);
+    {
+      int32_t len = (int32_t)(value.inventory).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::item >::const_iterator i = value.inventory.begin() ; i != value.inventory.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.quests).size();
+      write(stream,len);
+      for (::std::vector< ::my::game::quest >::const_iterator i = value.quests.begin() ; i != value.quests.end() ; ++i)
+      {
+        raw_write(stream,*i);
+      }
+    }
+    {
+      int32_t len = (int32_t)(value.friends).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.friends.begin() ; i != value.friends.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+#endif
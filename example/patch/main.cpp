@@ -0,0 +1,101 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/game/player.adl.h>
+#include <adata_patch.hpp>
+#include <iostream>
+#include <string>
+#include <cassert>
+
+typedef adata::member_index<my::game::player_v1> player_member;
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    my::game::player_v1 pv1;
+    pv1.id = 1;
+    pv1.age = 22;
+    pv1.name = "pv1";
+    pv1.pos.x = 1.0f;
+    my::game::item itm;
+    itm.id = 11;
+    itm.level = 3;
+    pv1.inventory.push_back(itm);
+    itm.id = 12;
+    pv1.inventory.push_back(itm);
+
+    char buff[4096];
+    adata::zero_copy_buffer stream;
+    std::size_t length = adata::size_of(pv1);
+    stream.set_write(buff, length);
+    adata::write(stream, pv1);
+
+    adata::member_patcher patcher(buff, length, sizeof(buff));
+
+    // same encoded length, overwritten in place
+    if (patcher.seek<my::game::player_v1>(player_member::id))
+    {
+      patcher.patch((int32_t)2);
+    }
+    assert(patcher.length() == length);
+
+    // longer value, the bytes behind move and the len_tag chain is fixed up
+    if (patcher.seek<my::game::player_v1>(player_member::id))
+    {
+      patcher.patch((int32_t)100000);
+    }
+    if (patcher.seek<my::game::player_v1>(player_member::name))
+    {
+      patcher.patch(std::string("a much longer player name"));
+    }
+
+    // nested types and list elements
+    if (patcher.seek<my::game::player_v1>(player_member::pos) &&
+      patcher.seek<util::vec3>(adata::member_index<util::vec3>::x))
+    {
+      patcher.patch(2.5f);
+    }
+    if (patcher.seek<my::game::player_v1>(player_member::inventory) &&
+      patcher.seek_element<my::game::item>(1) &&
+      patcher.seek<my::game::item>(adata::member_index<my::game::item>::level))
+    {
+      patcher.patch((int32_t)321110);
+    }
+
+    // quests is empty and pos.y at its default, neither is in the data to be patched;
+    // a failed seek goes back to the outermost type, so the next seek starts over
+    assert(!patcher.seek<my::game::player_v1>(player_member::quests) && patcher.absent());
+    assert(patcher.seek<my::game::player_v1>(player_member::pos) &&
+      !patcher.seek<util::vec3>(adata::member_index<util::vec3>::y) && patcher.absent());
+    assert(patcher.seek<my::game::player_v1>(player_member::age) && !patcher.absent());
+    patcher.reset();
+    length = patcher.length();
+
+    my::game::player_v1 pv1_other;
+    stream.set_read(buff, length);
+    adata::read(stream, pv1_other);
+    assert(stream.read_length() == length);
+    assert(adata::size_of(pv1_other) == (int32_t)length);
+    assert(pv1_other.id == 100000);
+    assert(pv1_other.name == "a much longer player name");
+    assert(pv1_other.age == 22);
+    assert(pv1_other.pos.x == 2.5f);
+    assert(pv1_other.inventory[0].level == 3 && pv1_other.inventory[1].level == 321110);
+
+    std::cout << "done." << std::endl;
+  }
+  catch (std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,1051 @@
+#ifndef my_game_config_adl_h_adata_header_define
+#define my_game_config_adl_h_adata_header_define
+
+#include <adata.hpp>
+#include <adata_table.hpp>
+#include <adata_flat.hpp>
+
+namespace my {namespace game {
+  struct item_config
+  {
+    int32_t id;
+    int32_t type;
+    int32_t level;
+    int32_t price;
+    ::std::string name;
+    item_config()
+    :    id(0),
+    type(0),
+    level(0),
+    price(100)
+    {}
+  };
+
+  struct skill_config
+  {
+    float cooldown;
+    int64_t id;
+    ::std::string name;
+    ::std::vector< int32_t > effects;
+    skill_config()
+    :    cooldown(0.0f),
+    id(0LL)
+    {}
+  };
+
+  struct item_config_flat
+  {
+    typedef item_config_flat value_type;
+    static const uint32_t slot_size = 4;
+
+    item_config_flat() : m_base(0), m_offset(0) {}
+    item_config_flat(const char * base, uint32_t offset) : m_base(base), m_offset(offset) {}
+    static item_config_flat load_slot(const char * base, uint32_t offset) { return item_config_flat(base, ::adata::flat_load<uint32_t>(base + offset)); }
+
+    int32_t id() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 0); }
+    ::adata::flat_string name() const { return ::adata::flat_string::load_slot(m_base, m_offset + 4); }
+    int32_t type() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 8); }
+    int32_t level() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 12); }
+    int32_t price() const { return ::adata::flat_scalar< int32_t >::load_slot(m_base, m_offset + 16); }
+  private:
+    const char * m_base;
+    uint32_t m_offset;
+  };
+
+  struct skill_config_flat
+  {
+    typedef skill_config_flat value_type;
+    static const uint32_t slot_size = 4;
+
+    skill_config_flat() : m_base(0), m_offset(0) {}
+    skill_config_flat(const char * base, uint32_t offset) : m_base(base), m_offset(offset) {}
+    static skill_config_flat load_slot(const char * base, uint32_t offset) { return skill_config_flat(base, ::adata::flat_load<uint32_t>(base + offset)); }
+
+    int64_t id() const { return ::adata::flat_scalar< int64_t >::load_slot(m_base, m_offset + 0); }
+    ::adata::flat_string name() const { return ::adata::flat_string::load_slot(m_base, m_offset + 8); }
+    float cooldown() const { return ::adata::flat_scalar< float >::load_slot(m_base, m_offset + 12); }
+    ::adata::flat_list< ::adata::flat_scalar< int32_t > > effects() const { return ::adata::flat_list< ::adata::flat_scalar< int32_t > >(m_base, ::adata::flat_load<uint32_t>(m_base + m_offset + 16)); }
+  private:
+    const char * m_base;
+    uint32_t m_offset;
+  };
+
+  typedef ::adata::table< item_config > item_config_table;
+  typedef ::adata::table< skill_config > skill_config_table;
+}}
+
+namespace adata
+{
+template<>
+struct is_adata<my::game::item_config>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::item_config >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    type = 2,
+    level = 3,
+    price = 4,
+    member_count = 5
+  };
+};
+
+template<>
+struct is_adata<my::game::skill_config>
+{
+  static const bool value = true;
+};
+
+template<>
+struct member_index< ::my::game::skill_config >
+{
+  enum
+  {
+    id = 0,
+    name = 1,
+    cooldown = 2,
+    effects = 3,
+    member_count = 4
+  };
+};
+
+}
+namespace adata
+{
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::game::item_config& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {read(stream,value.type);}
+    if(tag&8LL)    {read(stream,value.level);}
+    if(tag&16LL)    {read(stream,value.price);}
+    if(!(tag&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.type = (int32_t)0;}
+    if(!(tag&8LL)){value.level = (int32_t)0;}
+    if(!(tag&16LL)){value.price = (int32_t)100;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::item_config& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.type);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {read(stream,value.level);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 16ULL) break;
+      if(tag&16LL)
+      {
+        if(mask&16LL)        {read(stream,value.price);}
+        else        {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int32_t)0;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.type = (int32_t)0;}
+    if(!(tag&8LL) && (mask&8LL)){value.level = (int32_t)0;}
+    if(!(tag&16LL) && (mask&16LL)){value.price = (int32_t)100;}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::item_config* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::item_config* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 5) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    if(tag&8LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 4) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::item_config& value)
+  {
+    if(!is_default(value.id,(int32_t)0)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.type,(int32_t)0)) return false;
+    if(!is_default(value.level,(int32_t)0)) return false;
+    if(!is_default(value.price,(int32_t)100)) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::game::item_config& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.type,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.level,(int32_t)0)){tag|=8LL;}
+    if(!is_default(value.price,(int32_t)100)){tag|=16LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.type);
+    }
+    if(tag&8LL)
+    {
+      size += size_of(value.level);
+    }
+    if(tag&16LL)
+    {
+      size += size_of(value.price);
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::item_config& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.type,(int32_t)0)){tag|=4LL;}
+    if(!is_default(value.level,(int32_t)0)){tag|=8LL;}
+    if(!is_default(value.price,(int32_t)100)){tag|=16LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    write(stream,value.type);
+    if(tag&8LL)    write(stream,value.level);
+    if(tag&16LL)    write(stream,value.price);
+  }
+
+  template<>
+  struct columns< ::my::game::item_config >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::item_config& value = values[k];
+        if(!is_default(value.id,(int32_t)0)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!is_default(value.type,(int32_t)0)){tag|=4LL;}
+        if(!is_default(value.level,(int32_t)0)){tag|=8LL;}
+        if(!is_default(value.price,(int32_t)100)){tag|=16LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::item_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].type;}
+        size += size_of_column(column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        size += size_of_column(column);
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].price;}
+        size += size_of_column(column);
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::item_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].type;}
+        write_column(stream,column);
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].level;}
+        write_column(stream,column);
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].price;}
+        write_column(stream,column);
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::item_config& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].type = column[k];}
+      }
+      if(tag&8LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].level = column[k];}
+      }
+      if(tag&16LL)
+      {
+        ::std::vector< int32_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].price = column[k];}
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::item_config& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    read(stream,value.type);
+    read(stream,value.level);
+    read(stream,value.price);
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::item_config& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.type);
+    size += size_of(value.level);
+    size += size_of(value.price);
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::item_config& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    write(stream,value.type);
+    write(stream,value.level);
+    write(stream,value.price);
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read( stream_ty& stream, ::my::game::skill_config& value)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    if(tag&1LL)    {read(stream,value.id);}
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    if(tag&4LL)    {read(stream,value.cooldown);}
+    if(tag&8LL)    {
+      int32_t len = check_read_size(stream);
+      value.effects.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        {read(stream,value.effects[i]);}
+      }
+    }
+    if(!(tag&1LL)){value.id = (int64_t)0LL;}
+    if(!(tag&2LL)){value.name.clear();}
+    if(!(tag&4LL)){value.cooldown = (float)0.0f;}
+    if(!(tag&8LL)){value.effects.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void read_projected( stream_ty& stream, ::my::game::skill_config& value, int64_t mask)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    uint64_t wanted = (uint64_t)(tag&mask);
+    do
+    {
+      if(len_tag >= 0 && wanted < 1ULL) break;
+      if(tag&1LL)
+      {
+        if(mask&1LL)        {read(stream,value.id);}
+        else        {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 2ULL) break;
+      if(tag&2LL)
+      {
+        if(mask&2LL)        {
+          int32_t len = check_read_size(stream);
+          value.name.resize(len);
+          stream.read((char *)value.name.data(),len);
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          stream.skip_read(len);
+        }
+      }
+      if(len_tag >= 0 && wanted < 4ULL) break;
+      if(tag&4LL)
+      {
+        if(mask&4LL)        {read(stream,value.cooldown);}
+        else        {float* dummy_value = 0;skip_read(stream,dummy_value);}
+      }
+      if(len_tag >= 0 && wanted < 8ULL) break;
+      if(tag&8LL)
+      {
+        if(mask&8LL)        {
+          int32_t len = check_read_size(stream);
+          value.effects.resize(len);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {read(stream,value.effects[i]);}
+          }
+        }
+        else        {
+          int32_t len = check_read_size(stream);
+          for (int32_t i = 0 ; i < len ; ++i)
+          {
+            {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+          }
+        }
+      }
+    } while(false);
+    if(!(tag&1LL) && (mask&1LL)){value.id = (int64_t)0LL;}
+    if(!(tag&2LL) && (mask&2LL)){value.name.clear();}
+    if(!(tag&4LL) && (mask&4LL)){value.cooldown = (float)0.0f;}
+    if(!(tag&8LL) && (mask&8LL)){value.effects.clear();}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE void skip_read(stream_ty& stream, ::my::game::skill_config* )
+  {
+    skip_read_compatible(stream);
+  }
+
+  template <typename stream_ty>
+  ADATA_INLINE bool seek_member(stream_ty& stream, ::my::game::skill_config* , int32_t index, bool& absent)
+  {
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+    if(index < 0 || index >= 4) return false;
+    if(!(tag&(1LL<<index))){absent = true; return false;}
+    if(index == 0) return true;
+    if(tag&1LL)    {int64_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 1) return true;
+    if(tag&2LL)    {
+      int32_t len = check_read_size(stream);
+      stream.skip_read(len);
+    }
+    if(index == 2) return true;
+    if(tag&4LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(index == 3) return true;
+    return false;
+  }
+
+  ADATA_INLINE bool is_default(const ::my::game::skill_config& value)
+  {
+    if(!is_default(value.id,(int64_t)0LL)) return false;
+    if(!value.name.empty()) return false;
+    if(!is_default(value.cooldown,(float)0.0f)) return false;
+    if(!value.effects.empty()) return false;
+    return true;
+  }
+
+  ADATA_INLINE int32_t size_of(const ::my::game::skill_config& value)
+  {
+    int32_t size = 0;
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.cooldown,(float)0.0f)){tag|=4LL;}
+    if(!value.effects.empty()){tag|=8LL;}
+    if(tag&1LL)
+    {
+      size += size_of(value.id);
+    }
+    if(tag&2LL)
+    {
+      {
+        int32_t len = (int32_t)(value.name).size();
+        size += size_of(len);
+        size += len;
+      }
+    }
+    if(tag&4LL)
+    {
+      size += size_of(value.cooldown);
+    }
+    if(tag&8LL)
+    {
+      {
+        int32_t len = (int32_t)(value.effects).size();
+        size += size_of(len);
+        for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+        {
+          size += size_of(*i);
+        }
+      }
+    }
+    size += size_of(tag);
+    size += size_of(size + size_of(size));
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void write(stream_ty& stream , const ::my::game::skill_config& value)
+  {
+    int64_t tag = 0LL;
+    if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+    if(!value.name.empty()){tag|=2LL;}
+    if(!is_default(value.cooldown,(float)0.0f)){tag|=4LL;}
+    if(!value.effects.empty()){tag|=8LL;}
+    write(stream,tag);
+    write(stream,size_of(value));
+    if(tag&1LL)    write(stream,value.id);
+    if(tag&2LL)    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    if(tag&4LL)    write(stream,value.cooldown);
+    if(tag&8LL)    {
+      int32_t len = (int32_t)(value.effects).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+  template<>
+  struct columns< ::my::game::skill_config >
+  {
+    template<typename list_ty>
+    static int64_t column_tag(const list_ty& values)
+    {
+      int64_t tag = 0LL;
+      int32_t count = (int32_t)values.size();
+      for (int32_t k = 0 ; k < count ; ++k)
+      {
+        const ::my::game::skill_config& value = values[k];
+        if(!is_default(value.id,(int64_t)0LL)){tag|=1LL;}
+        if(!value.name.empty()){tag|=2LL;}
+        if(!is_default(value.cooldown,(float)0.0f)){tag|=4LL;}
+        if(!value.effects.empty()){tag|=8LL;}
+      }
+      return tag;
+    }
+
+    template<typename list_ty>
+    static int32_t column_size(const list_ty& values, int64_t tag)
+    {
+      int32_t size = 0;
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        size += size_of_column(column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            size += size_of(len);
+            size += len;
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          size += size_of(value.cooldown);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.effects).size();
+            size += size_of(len);
+            for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+            {
+              size += size_of(*i);
+            }
+          }
+        }
+      }
+      return size;
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void write_columns(stream_ty& stream, const list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column(count);
+        for (int32_t k = 0 ; k < count ; ++k){column[k] = values[k].id;}
+        write_column(stream,column);
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.name).size();
+            write(stream,len);
+            stream.write((value.name).data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          write(stream,value.cooldown);
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          const ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = (int32_t)(value.effects).size();
+            write(stream,len);
+            for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+            {
+              write(stream,*i);
+            }
+          }
+        }
+      }
+    }
+
+    template<typename stream_ty, typename list_ty>
+    static void read_columns(stream_ty& stream, list_ty& values, int64_t tag)
+    {
+      int32_t count = (int32_t)values.size();
+      if(tag&1LL)
+      {
+        ::std::vector< int64_t > column;
+        read_column(stream,column,count);
+        for (int32_t k = 0 ; k < count ; ++k){values[k].id = column[k];}
+      }
+      if(tag&2LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.name.resize(len);
+            stream.read((char *)value.name.data(),len);
+          }
+        }
+      }
+      if(tag&4LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::skill_config& value = values[k];
+          {read(stream,value.cooldown);}
+        }
+      }
+      if(tag&8LL)
+      {
+        for (int32_t k = 0 ; k < count ; ++k)
+        {
+          ::my::game::skill_config& value = values[k];
+          {
+            int32_t len = check_read_size(stream);
+            value.effects.resize(len);
+            for (int32_t i = 0 ; i < len ; ++i)
+            {
+              {read(stream,value.effects[i]);}
+            }
+          }
+        }
+      }
+    }
+  };
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_read( stream_ty& stream, ::my::game::skill_config& value)
+  {
+    read(stream,value.id);
+    {
+      int32_t len = check_read_size(stream);
+      value.name.resize(len);
+      stream.read((char *)value.name.data(),len);
+    }
+    read(stream,value.cooldown);
+    {
+      int32_t len = check_read_size(stream);
+      value.effects.resize(len);
+      for (int32_t i = 0 ; i < len ; ++i)
+      {
+        read(stream,value.effects[i]);
+      }
+    }
+  }
+
+  ADATA_INLINE int32_t raw_size_of(const ::my::game::skill_config& value)
+  {
+    int32_t size = 0;
+    size += size_of(value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      size += size_of(len);
+      size += len;
+    }
+    size += size_of(value.cooldown);
+    {
+      int32_t len = (int32_t)(value.effects).size();
+      size += size_of(len);
+      for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+      {
+        size += size_of(*i);
+      }
+    }
+    return size;
+  }
+
+  template<typename stream_ty>
+  ADATA_INLINE void raw_write(stream_ty& stream , const ::my::game::skill_config& value)
+  {
+    write(stream,value.id);
+    {
+      int32_t len = (int32_t)(value.name).size();
+      write(stream,len);
+      stream.write((value.name).data(),len);
+    }
+    write(stream,value.cooldown);
+    {
+      int32_t len = (int32_t)(value.effects).size();
+      write(stream,len);
+      for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i)
+      {
+        write(stream,*i);
+      }
+    }
+  }
+
+}
+
+namespace adata
+{
+  template<>
+  struct table_traits< ::my::game::item_config >
+  {
+    typedef ::my::game::item_config value_type;
+    static int64_t key(const value_type& value) { return (int64_t)value.id; }
+    static int32_t size_of(const value_type& value) { return ::adata::size_of(value); }
+  };
+
+  template<>
+  struct table_traits< ::my::game::skill_config >
+  {
+    typedef ::my::game::skill_config value_type;
+    static int64_t key(const value_type& value) { return (int64_t)value.id; }
+    static int32_t size_of(const value_type& value) { return ::adata::size_of(value); }
+  };
+
+}
+
+namespace adata
+{
+  template<>
+  struct flat_traits< ::my::game::item_config >
+  {
+    typedef ::my::game::item_config value_type;
+    typedef ::my::game::item_config_flat view_type;
+    enum { size = 20, align = 4, layout = 0xb24b16c0U };
+
+    static void write(::adata::flat_writer& out, uint32_t offset, const value_type& value)
+    {
+      out.put(offset + 0, (int32_t)value.id);
+      out.put(offset + 4, out.add_string(value.name.data(), value.name.size()));
+      out.put(offset + 8, (int32_t)value.type);
+      out.put(offset + 12, (int32_t)value.level);
+      out.put(offset + 16, (int32_t)value.price);
+    }
+
+    static void read(const view_type& view, value_type& value)
+    {
+      value.id = view.id();
+      { ::adata::flat_string s = view.name(); value.name.assign(s.data(), s.size()); }
+      value.type = view.type();
+      value.level = view.level();
+      value.price = view.price();
+    }
+
+    static bool verify(::adata::flat_verifier& v, uint32_t offset, int32_t depth)
+    {
+      if (depth > ::adata::flat_max_depth || !v.record(offset, size)) return false;
+      if (!v.string(v.ref(offset + 4))) return false;
+      return true;
+    }
+  };
+
+  template<>
+  struct flat_traits< ::my::game::skill_config >
+  {
+    typedef ::my::game::skill_config value_type;
+    typedef ::my::game::skill_config_flat view_type;
+    enum { size = 24, align = 8, layout = 0xa4f5d22cU };
+
+    static void write(::adata::flat_writer& out, uint32_t offset, const value_type& value)
+    {
+      out.put(offset + 0, (int64_t)value.id);
+      out.put(offset + 8, out.add_string(value.name.data(), value.name.size()));
+      out.put(offset + 12, (float)value.cooldown);
+      {
+        uint32_t list = out.add_list(value.effects.size(), 4);
+        uint32_t at = list + ::adata::flat_block_header_size;
+        for (::std::vector< int32_t >::const_iterator i = value.effects.begin() ; i != value.effects.end() ; ++i, at += 4)
+        {
+          out.put(at, (int32_t)(*i));
+        }
+        out.put(offset + 16, list);
+      }
+    }
+
+    static void read(const view_type& view, value_type& value)
+    {
+      value.id = view.id();
+      { ::adata::flat_string s = view.name(); value.name.assign(s.data(), s.size()); }
+      value.cooldown = view.cooldown();
+      {
+        ::adata::flat_list< ::adata::flat_scalar< int32_t > > list = view.effects();
+        value.effects.resize(list.size());
+        ::std::vector< int32_t >::iterator i = value.effects.begin();
+        for (uint32_t k = 0; k < list.size(); ++k, ++i)
+        {
+          (*i) = list[k];
+        }
+      }
+    }
+
+    static bool verify(::adata::flat_verifier& v, uint32_t offset, int32_t depth)
+    {
+      if (depth > ::adata::flat_max_depth || !v.record(offset, size)) return false;
+      if (!v.string(v.ref(offset + 8))) return false;
+      {
+        uint32_t count = 0;
+        uint32_t list = v.ref(offset + 16);
+        if (!v.list(list, 4, count)) return false;
+      }
+      return true;
+    }
+  };
+
+}
+
+#endif
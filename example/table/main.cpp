@@ -0,0 +1,177 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/game/config.adl.h>
+#include <adata_table_reload.hpp>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cassert>
+#include <cstdio>
+#include <condition_variable>
+#include <mutex>
+
+int main()
+{
+  // build an item pack, ids are dense so lookup is a direct index
+  adata::table_builder<my::game::item_config> item_builder;
+  for (int32_t i = 0; i < 1000; ++i)
+  {
+    my::game::item_config item;
+    item.id = 10000 + i;
+    item.name = "item";
+    item.type = i % 7;
+    item.level = i / 10;
+    item_builder.add(item);
+  }
+  std::string item_pack;
+  item_builder.build(item_pack);
+
+  // skill ids are sparse, lookup go through the hash index
+  adata::table_builder<my::game::skill_config> skill_builder;
+  for (int64_t i = 0; i < 100; ++i)
+  {
+    my::game::skill_config skill;
+    skill.id = i * 1000003 + 7;
+    skill.name = "skill";
+    skill.cooldown = 1.5f;
+    skill.effects.push_back((int32_t)i);
+    skill_builder.add(skill);
+  }
+  std::string skill_pack;
+  skill_builder.build(skill_pack);
+
+  const char * item_file = "item_config.tab";
+  {
+    std::ofstream ofs(item_file, std::ios::binary);
+    ofs.write(item_pack.data(), item_pack.size());
+  }
+
+  // map the pack file, records decode on first lookup
+  my::game::item_config_table items;
+  bool ok = items.open(item_file);
+  assert(ok);
+  assert(items.size() == 1000);
+  const my::game::item_config * item = items.find(10042);
+  assert(item != 0);
+  assert(item->id == 10042 && item->level == 4 && item->type == 42 % 7);
+  assert(item->price == 100);
+  assert(items.find(9999) == 0);
+  assert(items.find(11000) == 0);
+  items.close();
+  std::remove(item_file);
+
+  // a record that doesn't decode to its slot length is rejected, and not cached
+  std::string broken_pack = item_pack;
+  unsigned char * first_length = (unsigned char *)&broken_pack[adata::table_header_size + 12];
+  adata::table_detail::store_uint32(first_length, adata::table_detail::load_uint32(first_length) + 1);
+  items.attach(broken_pack.data(), broken_pack.size());
+  for (int i = 0; i < 2; ++i)
+  {
+    try
+    {
+      items.find(10000);
+      assert(false);
+    }
+    catch (adata::exception& e)
+    {
+      assert(e.error_code() == adata::table_format_not_match);
+    }
+  }
+  assert(items.find(10001)->id == 10001);
+  items.close();
+
+  // nor is such a pack ever published by a versioned table, the reload callback gets the error
+  adata::versioned_table<my::game::item_config> versioned;
+  uint64_t version = versioned.load_pack(item_pack);
+  try
+  {
+    versioned.load_pack(broken_pack);
+    assert(false);
+  }
+  catch (adata::exception& e)
+  {
+    assert(e.error_code() == adata::table_format_not_match);
+  }
+  std::mutex reload_mutex;
+  std::condition_variable reload_cv;
+  bool reloaded = false;
+  bool reload_failed = false;
+  versioned.set_reload_callback([&](uint64_t, const std::exception * error)
+  {
+    std::lock_guard<std::mutex> lock(reload_mutex);
+    reloaded = true;
+    reload_failed = error != nullptr;
+    reload_cv.notify_one();
+  });
+  versioned.reload_pack(broken_pack);
+  {
+    std::unique_lock<std::mutex> lock(reload_mutex);
+    reload_cv.wait(lock, [&] { return reloaded; });
+  }
+  assert(reload_failed && versioned.version() == version);
+  {
+    adata::versioned_table<my::game::item_config>::reader reader(versioned);
+    adata::versioned_table<my::game::item_config>::guard snapshot(reader);
+    assert(snapshot->find(10000)->id == 10000);
+  }
+  (void)version;
+  (void)reload_failed;
+
+  // or just view a pack in memory without caching
+  adata::table_view<my::game::skill_config> skills;
+  skills.attach(skill_pack.data(), skill_pack.size());
+  my::game::skill_config skill;
+  ok = skills.get(42 * 1000003 + 7, skill);
+  assert(ok);
+  assert(skill.effects.size() == 1 && skill.effects[0] == 42);
+  assert(!skills.get(8, skill));
+
+  // a pack with no empty bucket still finds a key, and misses one, in a bounded probe
+  std::string full_pack = skill_pack;
+  unsigned char * header = (unsigned char *)&full_pack[0];
+  uint32_t bucket_count = adata::table_detail::load_uint32(header + 12);
+  unsigned char * buckets = header + adata::table_header_size + 100 * adata::table_slot_size;
+  for (uint32_t i = 0; i < bucket_count; ++i)
+  {
+    adata::table_detail::store_uint32(buckets + i * 4, 1);
+  }
+  adata::table_view<my::game::skill_config> full_skills;
+  full_skills.attach(full_pack.data(), full_pack.size());
+  assert(full_skills.get(7, skill) && !full_skills.get(8, skill));
+
+  // a dense pack whose keys span more slots than it has is rejected by attach
+  std::string sparse_pack = item_pack;
+  adata::table_detail::store_int64((unsigned char *)&sparse_pack[24], 20000);
+  try
+  {
+    items.attach(sparse_pack.data(), sparse_pack.size());
+    assert(false);
+  }
+  catch (adata::exception& e)
+  {
+    assert(e.error_code() == adata::table_format_not_match);
+  }
+
+  try
+  {
+    skill_builder.add(skill);
+    skill_builder.build(skill_pack);
+    assert(false);
+  }
+  catch (adata::exception& e)
+  {
+    assert(e.error_code() == adata::table_key_duplicated);
+  }
+
+  (void)ok;
+  std::cout << "done." << std::endl;
+  return 0;
+}
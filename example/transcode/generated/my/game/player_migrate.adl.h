@@ -0,0 +1,104 @@
+#ifndef my_game_player_migrate_adl_h_adata_header_define
+#define my_game_player_migrate_adl_h_adata_header_define
+
+#include <adata.hpp>
+#include <adata_transcode.hpp>
+#include "my/game/player.adl.h"
+#include "my/game/quest.adl.h"
+#include "util/vec3.adl.h"
+
+namespace my {namespace game {
+}}
+
+namespace adata
+{
+}
+namespace adata
+{
+}
+
+namespace adata
+{
+  template<>
+  struct transcoder< ::my::game::player_v1, ::my::game::player_v2 >
+  {
+    static void transcode(zero_copy_buffer& stream, transcode_buffer& out);
+  };
+
+  inline void transcoder< ::my::game::player_v1, ::my::game::player_v2 >::transcode(zero_copy_buffer& stream, transcode_buffer& out)
+  {
+    ::std::size_t offset = stream.read_length();
+    int64_t tag = 0;
+    read(stream,tag);
+    int32_t len_tag = 0;
+    read(stream,len_tag);
+
+    const unsigned char * span[7] = {0};
+    ::std::size_t span_len[7] = {0};
+    if(tag&1LL)
+    {
+      span[0] = stream.read_ptr();
+      {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+      span_len[0] = stream.read_ptr() - span[0];
+    }
+    if(tag&2LL)
+    {
+      span[1] = stream.read_ptr();
+      {
+        int32_t len = check_read_size(stream,30);
+        stream.skip_read(len);
+      }
+      span_len[1] = stream.read_ptr() - span[1];
+    }
+    if(tag&4LL)    {int32_t* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(tag&8LL)
+    {
+      span[3] = stream.read_ptr();
+      {::util::vec3* dummy_value = 0;skip_read(stream,dummy_value);}
+      span_len[3] = stream.read_ptr() - span[3];
+    }
+    if(tag&16LL)
+    {
+      span[4] = stream.read_ptr();
+      {
+        int32_t len = check_read_size(stream);
+        for (int32_t i = 0 ; i < len ; ++i)
+        {
+          {::my::game::item* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+      span_len[4] = stream.read_ptr() - span[4];
+    }
+    if(tag&32LL)
+    {
+      span[5] = stream.read_ptr();
+      {
+        int32_t len = check_read_size(stream);
+        for (int32_t i = 0 ; i < len ; ++i)
+        {
+          {::my::game::quest* dummy_value = 0;skip_read(stream,dummy_value);}
+        }
+      }
+      span_len[5] = stream.read_ptr() - span[5];
+    }
+    if(tag&64LL)    {float* dummy_value = 0;skip_read(stream,dummy_value);}
+    if(len_tag >= 0)
+    {
+      ::std::size_t read_len = stream.read_length() - offset;
+      ::std::size_t len = (::std::size_t)len_tag;
+      if(len > read_len) stream.skip_read(len - read_len);
+    }
+
+    ::std::size_t header = out.begin_type();
+    int64_t out_tag = 0;
+    if(tag&1LL){out_tag|=1LL;out.append(span[0],span_len[0]);}
+    if(tag&2LL){out_tag|=2LL;out.append(span[1],span_len[1]);}
+    if(tag&8LL){out_tag|=8LL;out.append(span[3],span_len[3]);}
+    if(tag&16LL){out_tag|=16LL;out.append(span[4],span_len[4]);}
+    if(tag&32LL){out_tag|=32LL;out.append(span[5],span_len[5]);}
+    out.end_type(header,out_tag);
+  }
+
+}
+
+#endif
@@ -0,0 +1,184 @@
+///
+/// Copyright (c) 2014-2015 Ning Ding (lordoffox@gmail.com)
+/// Copyright (c) 2015 Nous Xiong (348944179@qq.com)
+///
+/// Distributed under the Boost Software License, Version 1.0. (See accompanying
+/// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///
+/// See https://github.com/lordoffox/adata for latest version.
+///
+
+#include <my/game/player_migrate.adl.h>
+#include <adata_transcode_file.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// migrate a file of player_v1 records to player_v2:
+//   transcode gen players.v1 1000000
+//   transcode run players.v1 players.v2
+//   transcode check players.v1 players.v2
+
+static my::game::player_v1 make_player(int32_t id)
+{
+  my::game::player_v1 pv1;
+  pv1.id = id;
+  pv1.age = 18 + id % 50;
+  pv1.factor = 1.5f;
+  pv1.name = "player" + std::to_string(id);
+  pv1.pos.x = (float)id;
+  for (int32_t i = 0; i < id % 4; ++i)
+  {
+    my::game::item itm;
+    itm.id = id * 10 + i;
+    itm.level = i;
+    pv1.inventory.push_back(itm);
+  }
+  if (id % 3 == 0)
+  {
+    my::game::quest qst;
+    qst.id = id;
+    qst.name = "quest";
+    pv1.quests.push_back(qst);
+  }
+  return pv1;
+}
+
+static int gen(int argc, char ** argv)
+{
+  if (argc < 1)
+  {
+    return -1;
+  }
+  int32_t count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::ofstream os(argv[0], std::ios::binary | std::ios::trunc);
+  std::string buffer;
+  adata::zero_copy_buffer stream;
+  for (int32_t id = 0; id < count; ++id)
+  {
+    my::game::player_v1 pv1 = make_player(id);
+    buffer.resize(adata::size_of(pv1));
+    stream.set_write(&buffer[0], buffer.size());
+    adata::write(stream, pv1);
+    os.write(buffer.data(), (std::streamsize)buffer.size());
+  }
+  std::cout << count << " records written to " << argv[0] << std::endl;
+  return 0;
+}
+
+static int run(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    return -1;
+  }
+  unsigned threads = argc > 2 ? (unsigned)std::atoi(argv[2]) : 0;
+  adata::transcode_file_stats stats;
+  auto start = std::chrono::steady_clock::now();
+  if (!adata::transcode_file<my::game::player_v1, my::game::player_v2>(argv[0], argv[1], &stats, threads))
+  {
+    std::cerr << "can't open " << argv[0] << " or " << argv[1] << std::endl;
+    return 1;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::cout << stats.records << " records, " << stats.read_bytes << " -> " << stats.write_bytes << " bytes in "
+    << seconds << "s (" << stats.read_bytes / seconds / (1024 * 1024) << " MB/s)" << std::endl;
+  return 0;
+}
+
+static bool read_file(const char * path, std::string& data)
+{
+  std::ifstream is(path, std::ios::binary);
+  data.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  return (bool)is || is.eof();
+}
+
+static int check(int argc, char ** argv)
+{
+  if (argc < 2)
+  {
+    return -1;
+  }
+  std::string v1_data;
+  std::string v2_data;
+  if (!read_file(argv[0], v1_data) || !read_file(argv[1], v2_data))
+  {
+    std::cerr << "can't read " << argv[0] << " or " << argv[1] << std::endl;
+    return 1;
+  }
+  adata::zero_copy_buffer v1_stream;
+  adata::zero_copy_buffer v2_stream;
+  v1_stream.set_read(v1_data.data(), v1_data.size());
+  v2_stream.set_read(v2_data.data(), v2_data.size());
+  std::size_t count = 0;
+  while (v1_stream.read_length() < v1_data.size())
+  {
+    my::game::player_v1 pv1;
+    my::game::player_v2 pv2;
+    adata::read(v1_stream, pv1);
+    adata::read(v2_stream, pv2);
+    if (pv1.id != pv2.id || pv1.name != pv2.name || pv1.pos.x != pv2.pos.x ||
+      pv1.inventory.size() != pv2.inventory.size() || pv1.quests.size() != pv2.quests.size())
+    {
+      std::cerr << "record " << count << " not match" << std::endl;
+      return 1;
+    }
+    ++count;
+  }
+  if (v2_stream.read_length() != v2_data.size())
+  {
+    std::cerr << "record count not match" << std::endl;
+    return 1;
+  }
+  std::cout << count << " records match" << std::endl;
+  return 0;
+}
+
+struct transcode_command
+{
+  const char * name;
+  int(*run)(int argc, char ** argv);
+  const char * usage;
+};
+
+static const transcode_command commands[] =
+{
+  { "gen", gen, "gen <v1 file> [records=1000000]" },
+  { "run", run, "run <v1 file> <v2 file> [threads=all]" },
+  { "check", check, "check <v1 file> <v2 file>" },
+};
+
+int main(int argc, char ** argv)
+{
+  try
+  {
+    if (argc >= 2)
+    {
+      for (auto const& cmd : commands)
+      {
+        if (std::strcmp(argv[1], cmd.name) == 0)
+        {
+          int ret = cmd.run(argc - 2, argv + 2);
+          if (ret >= 0)
+          {
+            return ret;
+          }
+        }
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
+  std::cerr << "usage:" << std::endl;
+  for (auto const& cmd : commands)
+  {
+    std::cerr << "  transcode " << cmd.usage << std::endl;
+  }
+  return 1;
+}
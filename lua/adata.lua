@@ -41,6 +41,8 @@ local make_type = function(ns,ty)
       local val = construct_list[i];
       if val == nil then
         obj[field] = {};
+      elseif val == false then
+        -- a member of a union or an optional member, left unset
       elseif val == "" then
         obj[field] = val;
       elseif type(val) == "function" then
@@ -111,6 +113,7 @@ m = {
   types = types,
   new = core.new_buf,
   tablen = tablen,
+  enum_names = core.enum_names,
 }
 
 return m;
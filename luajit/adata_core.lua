@@ -82,6 +82,9 @@ local adata_et_string     =19;
 local adata_et_list       =20;
 local adata_et_map        =21;
 local adata_et_type       =22;
+local adata_et_bool       =23;
+local adata_et_bits       =24;
+local adata_et_array      =25;
 
 local m = {};
 
@@ -1207,8 +1210,10 @@ local decode_default_value = function(buf,t,tname)
   local v = nil;
   if t >= adata_et_fix_int8 and t <= adata_et_int64 then
     v = rd_i64(buf);
-  elseif t == adata_et_fix_uint64 then
+  elseif t == adata_et_fix_uint64 or t == adata_et_uint64 then
     v = rd_u64(buf);
+  elseif t == adata_et_bool then
+    v = rd_u64(buf) ~= 0;
   elseif t == adata_et_float32 then
     v = rd_f32(buf);
   elseif t == adata_et_float64 then
@@ -1221,6 +1226,39 @@ local decode_default_value = function(buf,t,tname)
   return v;
 end
 
+-- member flags of the adt, 1 deleted, the others are wire features this core doesn't implement
+-- {first bit , bit count , what}
+local unsupported_flags = {
+  {1 , 1 , 'is sized'},
+  {2 , 3 , 'has a list encoding'},
+  {5 , 1 , 'is columnar'},
+  {6 , 7 , 'has a bits width'},
+  {13 , 1 , 'is of a packed type'},
+  {14 , 1 , 'is quantized'},
+  {15 , 1 , 'is a dict string'},
+  {16 , 1 , 'is of a union type'},
+  {17 , 1 , 'is optional'},
+  {18 , 3 , 'is aligned bytes'},
+};
+
+local check_member_flags = function(type_name,member_name,flags)
+  for i = 1 , #unsupported_flags do
+    local f = unsupported_flags[i];
+    if math.floor(flags / 2^f[1]) % 2^f[2] ~= 0 then
+      error("member " .. type_name .. "." .. member_name .. " " .. f[3] .. ", not supported by the luajit core");
+    end
+  end
+end
+
+-- bool , bits and array members have no codec in this core
+local check_member_type = function(type_name,member_name,t)
+  if t == adata_et_bool or t == adata_et_bits then
+    error("member " .. type_name .. "." .. member_name .. " is a bool or bits, not supported by the luajit core");
+  elseif t == adata_et_array then
+    error("member " .. type_name .. "." .. member_name .. " is an array, not supported by the luajit core");
+  end
+end
+
 local load_namespace = function(buf,str_pool,str_idx,types,mts,mt_list)
   local ns_name = rd_str(buf,0);
   local str_pool_count = rd_i32(buf);
@@ -1244,6 +1282,9 @@ local load_namespace = function(buf,str_pool,str_idx,types,mts,mt_list)
     local type_name_sid = rd_i32(buf);
     type_name_sid = rehash(ns_str_pool_idx,type_name_sid);
     type_name = str_idx[type_name_sid];
+    if member_count > 63 then
+      error("type " .. type_name .. " has more than 63 members, not supported by the luajit core");
+    end
     local type_def = {type_name , type_members};
     local process_count = 1;
     for m = 1, member_count do
@@ -1257,17 +1298,20 @@ local load_namespace = function(buf,str_pool,str_idx,types,mts,mt_list)
       if member_type == adata_et_type then
         local member_typename_sid = rd_i32(buf);
         member_typename_sid = rehash(ns_str_pool_idx,member_typename_sid);
-        member_typename = str_idx[member_typename_sid];
+        member_type_name = str_idx[member_typename_sid];
         local namespace_idx = rd_i32(buf);
         
         if namespace_idx == -1 then
-          member_type_def = types[member_typename];
+          member_type_def = types[member_type_name];
         else
           member_type_def = ns_types[namespace_idx+1];
         end        
       end
       
-      local member_del = rd_i32(buf);
+      local member_flags = rd_i32(buf);
+      local member_del = member_flags % 2;
+      check_member_flags(type_name,member_name,member_flags);
+      check_member_type(type_name,member_name,member_type);
       if member_del == 0 then
         field_list[process_count] = member_name;
         local construct_value = decode_default_value(buf,member_type,member_type_def);
@@ -1287,12 +1331,12 @@ local load_namespace = function(buf,str_pool,str_idx,types,mts,mt_list)
         if p_type == adata_et_type then
           local ptype_typename_sid = rd_i32(buf);
           ptype_typename_sid = rehash(ns_str_pool_idx,ptype_typename_sid);
-          ptype_typname = str_pool[ptype_typename_sid];
+          ptype_typename = str_idx[ptype_typename_sid];
           local namespace_idx = rd_i32(buf);
           if namespace_idx == -1 then
-            ptype_type_def = types[ptype.typename];
+            ptype_typedef = types[ptype_typename];
           else
-            ptype_type_def = ns_types[namespace_idx+1];
+            ptype_typedef = ns_types[namespace_idx+1];
           end            
         end
         local ptype_size = rd_i32(buf);